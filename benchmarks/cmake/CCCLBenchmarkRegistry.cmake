@@ -1,4 +1,5 @@
-find_package(CUDAToolkit REQUIRED)
+# Benchmarks of host device systems build without a CUDA toolkit.
+find_package(CUDAToolkit)
 
 find_package(Git REQUIRED)
 if(GIT_FOUND)
@@ -28,7 +29,12 @@ endfunction()
 function(create_benchmark_registry)
   get_meta_path(meta_path)
 
-  set(ctk_version "${CUDAToolkit_VERSION}")
+  if (CUDAToolkit_FOUND)
+    set(ctk_version "${CUDAToolkit_VERSION}")
+  else()
+    # Identify host-only results by their compiler instead
+    set(ctk_version "${CMAKE_CXX_COMPILER_ID}-${CMAKE_CXX_COMPILER_VERSION}")
+  endif()
   message(STATUS "CTK version: ${ctk_version}")
 
   file(REMOVE "${meta_path}")
@@ -4,3 +4,6 @@ from .bench import Bench
 from .cmake import CMake
 from .score import *
 from .search import *
+from .history import *
+from .strategies import *
+from .replay import *
@@ -143,11 +143,29 @@ def parse_samples_meta(state):
     return sample_count, sample_filename
 
 
-def parse_samples(state):
+def resolve_samples_filename(samples_filename, search_dir):
+    if search_dir is None or os.path.exists(samples_filename):
+        return samples_filename
+
+    # NVBench records sample files by the path it was given. Saved results are
+    # usually moved together with their sample directory.
+    candidates = [os.path.join(search_dir, samples_filename),
+                  os.path.join(search_dir,
+                               os.path.basename(os.path.dirname(samples_filename)),
+                               os.path.basename(samples_filename))]
+    for candidate in candidates:
+        if os.path.exists(candidate):
+            return candidate
+
+    return samples_filename
+
+
+def parse_samples(state, search_dir=None):
     sample_count, samples_filename = parse_samples_meta(state)
     if not sample_count or not samples_filename:
         return np.array([], dtype=np.float32)
 
+    samples_filename = resolve_samples_filename(samples_filename, search_dir)
     with open(samples_filename, "rb") as f:
         samples = np.fromfile(f, "<f4")
 
@@ -166,8 +184,8 @@ def parse_bw(state):
     return extract_bw(bwutil)
 
 class SubBenchState:
-    def __init__(self, state, axes_names, axes_values):
-        self.samples = parse_samples(state)
+    def __init__(self, state, axes_names, axes_values, search_dir=None):
+        self.samples = parse_samples(state, search_dir)
         self.bw = parse_bw(state)
 
         self.point = {}
@@ -186,7 +204,7 @@ class SubBenchState:
         return estimator(self.samples)
 
 class SubBenchResult:
-    def __init__(self, bench):
+    def __init__(self, bench, search_dir=None):
         axes_names = {}
         axes_values = {}
         for axis in bench["axes"]:
@@ -203,7 +221,7 @@ class SubBenchResult:
         self.states = []
         for state in bench["states"]:
             if not state["is_skipped"]:
-                self.states.append(SubBenchState(state, axes_names, axes_values))
+                self.states.append(SubBenchState(state, axes_names, axes_values, search_dir))
 
     def __repr__(self):
         return str(self.__dict__)
@@ -223,8 +241,9 @@ class BenchResult:
         if json_path:
             self.subbenches = {}
             if code == 0:
+                search_dir = os.path.dirname(os.path.abspath(json_path))
                 for bench in read_json(json_path)["benchmarks"]:
-                    self.subbenches[bench["name"]] = SubBenchResult(bench)
+                    self.subbenches[bench["name"]] = SubBenchResult(bench, search_dir)
     
     def __repr__(self):
         return str(self.__dict__)
@@ -446,6 +465,24 @@ def speedup(base, variant):
     return result
 
 
+def speedups_score(speedups, rt_values):
+    if not speedups:
+        return float('-inf')
+
+    rt_axes_ids = compute_axes_ids(rt_values)
+    weight_matrices = compute_weight_matrices(rt_values, rt_axes_ids)
+
+    score = 0
+    for bench in speedups:
+        for state in speedups[bench]:
+            rt_workload = state_to_rt_workload(bench, state)
+            weights = weight_matrices[bench]
+            weight = get_workload_weight(rt_workload, rt_values[bench], rt_axes_ids[bench], weights)
+            score = score + weight * speedups[bench][state]
+
+    return score
+
+
 def values_to_space(axes):
     result = []
     for axis in axes:
@@ -717,23 +754,7 @@ class Bench:
             return 1.0
 
         speedups = self.speedup(ct_workload, rt_values, base_estimator, variant_estimator)
-
-        if not speedups:
-            return float('-inf')
-
-        rt_axes_ids = compute_axes_ids(rt_values)
-        weight_matrices = compute_weight_matrices(rt_values, rt_axes_ids)
-
-        score = 0
-        for bench in speedups:
-            for state in speedups[bench]:
-                rt_workload = state_to_rt_workload(bench, state)
-                weights = weight_matrices[bench]
-                weight = get_workload_weight(rt_workload, rt_values[bench], rt_axes_ids[bench], weights)
-                speedup = speedups[bench][state]
-                score = score + weight * speedup
-
-        return score
+        return speedups_score(speedups, rt_values)
 
 
 class BaseBench(Bench):
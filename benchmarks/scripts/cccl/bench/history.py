@@ -0,0 +1,301 @@
+import os
+import re
+import fpzip
+import sqlite3
+import datetime
+import numpy as np
+
+from .bench import BenchResult, read_json, get_device_name
+from .storage import blob_to_samples
+
+
+history_db_name = "cccl_bench_history.db"
+
+
+def create_history_tables(conn):
+    with conn:
+        conn.execute("""
+        CREATE TABLE IF NOT EXISTS history_runs (
+            id INTEGER PRIMARY KEY AUTOINCREMENT,
+            cccl TEXT NOT NULL,
+            machine TEXT NOT NULL,
+            bench TEXT NOT NULL,
+            date TEXT NOT NULL,
+            source TEXT
+        );
+        """)
+
+        conn.execute("""
+        CREATE TABLE IF NOT EXISTS history_states (
+            run INTEGER NOT NULL REFERENCES history_runs(id) ON DELETE CASCADE,
+            subbench TEXT NOT NULL,
+            state TEXT NOT NULL,
+            center REAL,
+            bw REAL,
+            samples BLOB,
+            UNIQUE(run, subbench, state)
+        );
+        """)
+
+
+def bench_name_from_path(json_path):
+    # bin/cub.bench.reduce.sum.base --json cub.bench.reduce.sum.base.json
+    name = os.path.basename(json_path)
+    for suffix in ['.json', '.base', '.variant']:
+        if name.endswith(suffix):
+            name = name[:-len(suffix)]
+    return name
+
+
+def machine_from_json(json_path):
+    devices = read_json(json_path).get("devices", [])
+    if len(devices) != 1:
+        raise Exception("Can't tell the machine of {}, use --machine".format(json_path))
+    return get_device_name(devices[0])
+
+
+class History:
+    def __init__(self, db_path=history_db_name):
+        self.conn = sqlite3.connect(db_path)
+        self.conn.execute("PRAGMA foreign_keys = ON;")
+        create_history_tables(self.conn)
+
+    def ingest(self, json_path, cccl, machine=None, bench=None, date=None):
+        if machine is None:
+            machine = machine_from_json(json_path)
+        if bench is None:
+            bench = bench_name_from_path(json_path)
+        if date is None:
+            date = datetime.datetime.now().isoformat(timespec='seconds')
+
+        result = BenchResult(json_path, 0, None)
+
+        with self.conn:
+            cursor = self.conn.execute(
+                "INSERT INTO history_runs (cccl, machine, bench, date, source) VALUES (?, ?, ?, ?, ?);",
+                (cccl, machine, bench, date, os.path.abspath(json_path)))
+            run_id = cursor.lastrowid
+
+            num_states = 0
+            for subbench in result.subbenches:
+                for state in result.subbenches[subbench].states:
+                    if len(state.samples) == 0:
+                        continue
+
+                    self.conn.execute("""
+                    INSERT INTO history_states (run, subbench, state, center, bw, samples)
+                    VALUES (?, ?, ?, ?, ?, ?)
+                    ON CONFLICT DO NOTHING;
+                    """, (run_id, subbench, state.name(), float(np.median(state.samples)),
+                          state.bw, fpzip.compress(state.samples)))
+                    num_states += 1
+
+        return run_id, num_states
+
+    def runs(self, machine=None):
+        query = "SELECT id, cccl, machine, bench, date, source FROM history_runs"
+        params = ()
+        if machine is not None:
+            query += " WHERE machine = ?"
+            params = (machine,)
+        query += " ORDER BY id;"
+
+        with self.conn:
+            return self.conn.execute(query, params).fetchall()
+
+    def machines(self):
+        with self.conn:
+            rows = self.conn.execute(
+                "SELECT machine FROM history_runs GROUP BY machine ORDER BY MIN(id);").fetchall()
+            return [row[0] for row in rows]
+
+    def revisions(self, machine):
+        # in the order in which they were first ingested
+        with self.conn:
+            rows = self.conn.execute(
+                "SELECT cccl FROM history_runs WHERE machine = ? GROUP BY cccl ORDER BY MIN(id);",
+                (machine,)).fetchall()
+            return [row[0] for row in rows]
+
+    def previous_revision(self, machine, cccl):
+        revisions = self.revisions(machine)
+        if cccl not in revisions:
+            raise Exception("No results of {} on {}".format(cccl, machine))
+
+        index = revisions.index(cccl)
+        if index == 0:
+            return None
+        return revisions[index - 1]
+
+    def samples(self, machine, cccl):
+        """Samples of every state measured for a revision on a machine. The
+        samples of repeated runs are pooled."""
+        result = {}
+        with self.conn:
+            rows = self.conn.execute("""
+            SELECT r.bench, s.subbench, s.state, s.samples
+            FROM history_states s JOIN history_runs r ON s.run = r.id
+            WHERE r.machine = ? AND r.cccl = ?
+            ORDER BY r.id;
+            """, (machine, cccl)).fetchall()
+
+        for bench, subbench, state, blob in rows:
+            key = ("{}.{}".format(bench, subbench), state)
+            samples = np.atleast_1d(blob_to_samples(blob))
+            if key in result:
+                result[key] = np.concatenate([result[key], samples])
+            else:
+                result[key] = samples
+
+        return result
+
+
+def json_samples(json_path, bench=None):
+    """Samples of every state of a result file, keyed like History.samples."""
+    if bench is None:
+        bench = bench_name_from_path(json_path)
+
+    result = {}
+    bench_result = BenchResult(json_path, 0, None)
+    for subbench in bench_result.subbenches:
+        for state in bench_result.subbenches[subbench].states:
+            if len(state.samples) != 0:
+                result[("{}.{}".format(bench, subbench), state.name())] = state.samples
+    return result
+
+
+def mann_whitney_p_values(base, candidate):
+    from scipy.stats import mannwhitneyu
+
+    # H0: the candidate is not slower (faster) than the base
+    # H1: the candidate is slower (faster) than the base
+    _, p_slower = mannwhitneyu(base, candidate, alternative='less')
+    _, p_faster = mannwhitneyu(base, candidate, alternative='greater')
+    return p_slower, p_faster
+
+
+def bootstrap_p_values(base, candidate, num_resamples=1000, seed=0):
+    rng = np.random.default_rng(seed)
+
+    # bounds the memory of the resampled matrices
+    max_samples = 4096
+    if len(base) > max_samples:
+        base = rng.choice(base, max_samples, replace=False)
+    if len(candidate) > max_samples:
+        candidate = rng.choice(candidate, max_samples, replace=False)
+
+    base_centers = np.median(rng.choice(base, (num_resamples, len(base))), axis=1)
+    candidate_centers = np.median(rng.choice(candidate, (num_resamples, len(candidate))), axis=1)
+    ratios = candidate_centers / base_centers
+
+    p_slower = (np.count_nonzero(ratios <= 1.0) + 1) / (num_resamples + 1)
+    p_faster = (np.count_nonzero(ratios >= 1.0) + 1) / (num_resamples + 1)
+    return p_slower, p_faster
+
+
+class RegressionDetector:
+    """Flags a state when its samples differ significantly and its median time
+    changed by more than the threshold."""
+
+    min_samples = 5
+
+    def __init__(self, test='mannwhitney', alpha=0.01, threshold=0.05):
+        if test not in ['mannwhitney', 'bootstrap']:
+            raise ValueError("Unknown test: {}".format(test))
+
+        self.test = test
+        self.alpha = alpha
+        self.threshold = threshold
+
+    def p_values(self, base, candidate):
+        if self.test == 'mannwhitney':
+            return mann_whitney_p_values(base, candidate)
+        return bootstrap_p_values(base, candidate)
+
+    def __call__(self, base, candidate):
+        base_center = float(np.median(base))
+        candidate_center = float(np.median(candidate))
+        ratio = candidate_center / base_center
+
+        if min(len(base), len(candidate)) < self.min_samples:
+            return base_center, candidate_center, ratio, None, 'insufficient'
+
+        p_slower, p_faster = self.p_values(base, candidate)
+        if ratio > 1.0 + self.threshold and p_slower < self.alpha:
+            return base_center, candidate_center, ratio, p_slower, 'regression'
+        if ratio < 1.0 - self.threshold and p_faster < self.alpha:
+            return base_center, candidate_center, ratio, p_faster, 'improvement'
+        return base_center, candidate_center, ratio, min(p_slower, p_faster), 'same'
+
+
+def compare_samples(base, candidate, detector, regex='.*'):
+    pattern = re.compile(regex)
+
+    rows = []
+    for key in base:
+        bench, state = key
+        if key not in candidate or not pattern.match(bench):
+            continue
+
+        base_center, candidate_center, ratio, p, verdict = detector(base[key], candidate[key])
+        rows.append({'bench': bench,
+                     'state': state,
+                     'base': base_center,
+                     'candidate': candidate_center,
+                     'ratio': ratio,
+                     'p': None if p is None else float(p),
+                     'verdict': verdict})
+
+    return rows
+
+
+def format_time(seconds):
+    for unit, scale in [('s', 1.0), ('ms', 1e-3), ('us', 1e-6)]:
+        if seconds >= scale:
+            return "{:.3f} {}".format(seconds / scale, unit)
+    return "{:.3f} ns".format(seconds / 1e-9)
+
+
+def report_table(rows, verbose):
+    header = ['Benchmark', 'State', 'Base', 'Candidate', 'Change', 'p', 'Verdict']
+    table = []
+    for row in rows:
+        if not verbose and row['verdict'] in ['same', 'insufficient']:
+            continue
+        table.append([row['bench'],
+                      row['state'],
+                      format_time(row['base']),
+                      format_time(row['candidate']),
+                      "{:+.2f}%".format((row['ratio'] - 1.0) * 100.0),
+                      '-' if row['p'] is None else "{:.2g}".format(row['p']),
+                      row['verdict']])
+    return header, table
+
+
+def report_summary(rows):
+    counts = {}
+    for row in rows:
+        counts[row['verdict']] = counts.get(row['verdict'], 0) + 1
+
+    verdicts = ['regression', 'improvement', 'same', 'insufficient']
+    return "{} states compared: ".format(len(rows)) + \
+        ", ".join("{} {}".format(counts.get(v, 0), v) for v in verdicts)
+
+
+def format_report(rows, fmt='text', verbose=False):
+    if fmt == 'json':
+        import json
+        return json.dumps(rows, indent=2)
+
+    header, table = report_table(rows, verbose)
+
+    if fmt == 'markdown':
+        lines = ["| " + " | ".join(header) + " |",
+                 "|" + "|".join("---" for _ in header) + "|"]
+        lines += ["| " + " | ".join(cells) + " |" for cells in table]
+        return "\n".join(lines + ["", report_summary(rows)])
+
+    widths = [max([len(header[i])] + [len(cells[i]) for cells in table]) for i in range(len(header))]
+    lines = ["  ".join(header[i].ljust(widths[i]) for i in range(len(header)))]
+    lines += ["  ".join(cells[i].ljust(widths[i]) for i in range(len(header))) for cells in table]
+    return "\n".join(lines + ["", report_summary(rows)])
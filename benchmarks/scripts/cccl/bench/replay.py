@@ -0,0 +1,144 @@
+import re
+import sqlite3
+
+from .bench import speedup, speedups_score, is_ct_axis, values_to_space
+from .config import RangePoint
+from .strategies import VariantSpace, run_strategy, rt_values_subset, rt_fidelity_cost
+
+
+bench_columns = ['ctk', 'cccl', 'gpu', 'variant', 'elapsed', 'center', 'bw', 'samples']
+
+
+class ReplayCase:
+    """The results a search stored for one compile-time workload of an
+    algorithm on one GPU. Search strategies can be replayed on them without
+    building or running anything."""
+
+    def __init__(self, algname, ctk, cccl, gpu, ct_workload):
+        self.algname = algname
+        self.ctk = ctk
+        self.cccl = cccl
+        self.gpu = gpu
+        self.ct_workload = ct_workload
+        # subbench -> axis -> values, in the order they were benchmarked
+        self.rt_values = {}
+        # variant label -> subbench -> state -> center
+        self.centers = {}
+
+    def name(self):
+        return "{}[{}] {} {} {}".format(self.algname, ", ".join(self.ct_workload), self.gpu, self.ctk, self.cccl)
+
+    def add(self, subbench, rt_point, variant, center):
+        axes = self.rt_values.setdefault(subbench, {})
+        for axis, value in rt_point:
+            values = axes.setdefault(axis, [])
+            if value not in values:
+                values.append(value)
+
+        state = ' '.join("{}={}".format(axis, value) for axis, value in rt_point)
+        self.centers.setdefault(variant, {}).setdefault(subbench, {})[state] = center
+
+    def variant_centers(self, label, rt_values):
+        if label not in self.centers:
+            return None
+
+        centers = {}
+        for subbench in rt_values:
+            centers[subbench] = {}
+            for rt_point in values_to_space(rt_values[subbench]):
+                state = ' '.join(rt_point)
+                if state not in self.centers[label].get(subbench, {}):
+                    return None
+                centers[subbench][state] = self.centers[label][subbench][state]
+        return centers
+
+    def variant_labels(self):
+        return [label for label in self.centers if label != 'base']
+
+    def space(self):
+        # the stored variants tell the parameters and the values they took
+        values = {}
+        for label in self.variant_labels():
+            for point in label.split('.'):
+                name, value = point.rsplit('_', 1)
+                values.setdefault(name, set()).add(int(value))
+
+        return VariantSpace([[RangePoint(name, name, value) for value in sorted(values[name])]
+                             for name in values])
+
+    def score(self, label, fidelity=1.0):
+        rt_values = rt_values_subset(self.rt_values, fidelity)
+        base = self.variant_centers('base', rt_values)
+        centers = self.variant_centers(label, rt_values)
+
+        # variants the search never stored replay as failures
+        if base is None or centers is None:
+            return float('-inf')
+
+        return speedups_score(speedup(base, centers), rt_values)
+
+    def __call__(self, variant, fidelity):
+        return self.score(variant.label(), fidelity)
+
+
+def replay_cases(db_path, regex='.*'):
+    pattern = re.compile(regex)
+    conn = sqlite3.connect(db_path)
+    cases = {}
+
+    with conn:
+        subbenches = conn.execute("SELECT algorithm, bench FROM subbenches;").fetchall()
+
+        for algname, subbench in subbenches:
+            if not pattern.match(algname):
+                continue
+
+            table = "{}.{}".format(algname, subbench)
+            columns = [row[1] for row in conn.execute("PRAGMA table_info(\"{}\");".format(table))]
+            axes = [column for column in columns if column not in bench_columns]
+            ct_axes = [axis for axis in axes if is_ct_axis(axis)]
+            rt_axes = [axis for axis in axes if not is_ct_axis(axis)]
+
+            query = "SELECT ctk, cccl, gpu, variant, center{} FROM \"{}\" ORDER BY rowid;".format(
+                "".join(", \"{}\"".format(axis) for axis in ct_axes + rt_axes), table)
+
+            for row in conn.execute(query):
+                ctk, cccl, gpu, variant, center = row[:5]
+                if center is None:
+                    continue
+
+                values = row[5:]
+                ct_workload = tuple("{}={}".format(axis, value) for axis, value in zip(ct_axes, values))
+                rt_point = list(zip(rt_axes, values[len(ct_axes):]))
+
+                key = (algname, ctk, cccl, gpu, ct_workload)
+                if key not in cases:
+                    cases[key] = ReplayCase(*key)
+                cases[key].add(subbench, rt_point, variant, center)
+
+    return [cases[key] for key in sorted(cases)]
+
+
+def replay_search(strategy, db_path, regex='.*', budget=None, seed=0):
+    """Runs a strategy on the stored results of every compile-time workload
+    and reports how close it gets to the best stored variant."""
+    for case in replay_cases(db_path, regex):
+        space = case.space()
+
+        scores = {label: case.score(label) for label in case.variant_labels()}
+        ranking = sorted((score for score in scores.values() if score != float('-inf')), reverse=True)
+        if not ranking:
+            continue
+
+        objective = run_strategy(strategy, space, case, budget, seed, None, rt_fidelity_cost(case.rt_values))
+        best = objective.best()
+
+        print(case.name())
+        print("  stored: {} of {} variants, best score {:.4f}".format(len(ranking), space.size(), ranking[0]))
+        if best is None:
+            print("  {}: no variant after {:.1f} evaluations".format(strategy.name, objective.cost))
+        else:
+            print("  {}: {} score {:.4f} (rank {}) after {:.1f} evaluations".format(
+                strategy.name, space.point(best[0]).label(), best[1],
+                ranking.index(best[1]) + 1, objective.cost))
+
@@ -1,11 +1,13 @@
 import re
+import zlib
 import argparse
 import numpy as np
 
-from .bench import Bench, BaseBench
+from .bench import Bench, BaseBench, BenchCache
 from .config import Config
 from .storage import Storage
 from .cmake import CMake
+from .strategies import variant_space, run_strategy, rt_values_subset, rt_fidelity_cost
 
 
 def list_benches():
@@ -136,3 +138,119 @@ class BruteForceSeeker:
                                         self.variant_center_estimator)
 
                     print(bench.label(), score)
+
+
+def create_failures_table(conn):
+    with conn:
+        conn.execute("""
+        CREATE TABLE IF NOT EXISTS failures (
+            ctk TEXT NOT NULL,
+            cccl TEXT NOT NULL,
+            bench TEXT NOT NULL,
+            ct_workload TEXT NOT NULL,
+            UNIQUE(ctk, cccl, bench, ct_workload)
+        );
+        """)
+
+
+class FailuresCache:
+    """Variants which failed to build or run for a compile-time workload, so
+    that a resumed search doesn't try them again. Unlike the builds table, it
+    tells the compile-time workloads apart."""
+
+    _instance = None
+
+    def __new__(cls, *args, **kwargs):
+        if cls._instance is None:
+            cls._instance = super().__new__(cls, *args, **kwargs)
+            create_failures_table(Storage().connection())
+        return cls._instance
+
+    def pull_failure(self, bench):
+        config = Config()
+        conn = Storage().connection()
+
+        with conn:
+            query = "SELECT 1 FROM failures WHERE ctk = ? AND cccl = ? AND bench = ? AND ct_workload = ?;"
+            return conn.execute(query, (config.ctk, config.cccl, bench.label(), ' '.join(bench.ct_workload))).fetchone() is not None
+
+    def push_failure(self, bench):
+        config = Config()
+        conn = Storage().connection()
+
+        with conn:
+            conn.execute("INSERT INTO failures (ctk, cccl, bench, ct_workload) VALUES (?, ?, ?, ?) ON CONFLICT DO NOTHING;",
+                         (config.ctk, config.cccl, bench.label(), ' '.join(bench.ct_workload)))
+
+
+class VariantEvaluator:
+    """Scores the variants of a compile-time workload. Variants whose results
+    are cached are scored without being built again."""
+
+    def __init__(self, algname, ct_workload, rt_values, base_center_estimator, variant_center_estimator):
+        self.algname = algname
+        self.ct_workload = ct_workload
+        self.rt_values = rt_values
+        self.base_center_estimator = base_center_estimator
+        self.variant_center_estimator = variant_center_estimator
+
+    def __call__(self, variant, fidelity):
+        rt_values = rt_values_subset(self.rt_values, fidelity)
+        bench = Bench(self.algname, variant, list(self.ct_workload))
+        failures = FailuresCache()
+
+        if failures.pull_failure(bench):
+            return float('-inf')
+
+        if BenchCache().pull_bench_centers(bench, self.ct_workload, rt_values) is None:
+            if not bench.build():
+                failures.push_failure(bench)
+                return float('-inf')
+
+        score = bench.score(self.ct_workload,
+                            rt_values,
+                            self.base_center_estimator,
+                            self.variant_center_estimator)
+
+        if score == float('-inf'):
+            failures.push_failure(bench)
+        return score
+
+
+def strategy_seed(seed, algname, ct_workload):
+    # stable across runs, unlike hash()
+    return zlib.crc32("{} {} {}".format(seed, algname, ' '.join(ct_workload)).encode())
+
+
+class StrategySeeker:
+    def __init__(self, strategy, budget, seed, base_center_estimator, variant_center_estimator):
+        self.strategy = strategy
+        self.budget = budget
+        self.seed = seed
+        self.base_center_estimator = base_center_estimator
+        self.variant_center_estimator = variant_center_estimator
+
+    def __call__(self, algname, ct_workload_space, rt_values):
+        space = variant_space(Config().benchmarks[algname])
+
+        for ct_workload in ct_workload_space:
+            evaluate = VariantEvaluator(algname, ct_workload, rt_values,
+                                        self.base_center_estimator, self.variant_center_estimator)
+
+            def report(variant, fidelity, score):
+                if fidelity < 1.0:
+                    print("{}.{} {} (fidelity {:.3f})".format(algname, variant.label(), score, fidelity))
+                else:
+                    print("{}.{} {}".format(algname, variant.label(), score))
+
+            objective = run_strategy(self.strategy, space, evaluate, self.budget,
+                                     strategy_seed(self.seed, algname, ct_workload), report,
+                                     rt_fidelity_cost(rt_values))
+
+            best = objective.best()
+            if best is None:
+                print("{}[{}]: no variant".format(algname, ", ".join(ct_workload)))
+            else:
+                print("{}[{}]: best {} {} after {:.1f} evaluations of {}".format(
+                    algname, ", ".join(ct_workload), space.point(best[0]).label(), best[1],
+                    objective.cost, space.size()))
@@ -0,0 +1,376 @@
+import math
+import random
+import functools
+import itertools
+import numpy as np
+
+from .config import RangePoint, VariantPoint
+
+
+class VariantSpace:
+    """Cartesian product of the parameter ranges of an algorithm. Strategies
+    address variants by tuples of indices into the ranges."""
+
+    def __init__(self, axes):
+        # list of lists of RangePoint, one list per tuning parameter
+        self.axes = axes
+
+    def shape(self):
+        return tuple(len(axis) for axis in self.axes)
+
+    def size(self):
+        return math.prod(self.shape())
+
+    def point(self, indices):
+        return VariantPoint([axis[i] for axis, i in zip(self.axes, indices)])
+
+    def coordinates(self, indices):
+        # every parameter is scaled to [0, 1], so that distances are comparable
+        return np.array([i / max(1, n - 1) for i, n in zip(indices, self.shape())], dtype=float)
+
+    def center(self):
+        return tuple(n // 2 for n in self.shape())
+
+    def random_order(self, rng):
+        shape = self.shape()
+        size = self.size()
+
+        # shuffling is cheap unless the space is huge
+        if size <= 1 << 16:
+            order = list(itertools.product(*[range(n) for n in shape]))
+            rng.shuffle(order)
+            yield from order
+            return
+
+        visited = set()
+        while len(visited) < size:
+            indices = tuple(rng.randrange(n) for n in shape)
+            if indices not in visited:
+                visited.add(indices)
+                yield indices
+
+
+def variant_space(ranges):
+    axes = []
+    for param_space in ranges:
+        axes.append([RangePoint(param_space.definition, param_space.label, value)
+                     for value in range(param_space.low, param_space.high, param_space.step)])
+    return VariantSpace(axes)
+
+
+class BudgetExhausted(Exception):
+    pass
+
+
+class Objective:
+    """Memoizes the scores of the variants of a search and enforces its budget.
+
+    `evaluate(variant_point, fidelity)` returns the score of a variant, higher
+    is better and `-inf` marks variants that failed to build or run. Fidelity in
+    (0, 1] is the fraction of the runtime workloads the variant is measured on.
+    The budget is spent in units of full evaluations; `fidelity_cost` tells
+    what measuring a fraction of the workloads actually costs."""
+
+    def __init__(self, space, evaluate, budget=None, on_score=None, fidelity_cost=None):
+        self.space = space
+        self.evaluate = evaluate
+        self.budget = budget
+        self.on_score = on_score
+        self.fidelity_cost = fidelity_cost or (lambda fidelity: fidelity)
+        self.scores = {}
+        self.cost = 0.0
+
+    def __call__(self, indices, fidelity=1.0):
+        key = (tuple(indices), fidelity)
+        if key not in self.scores:
+            if self.exhausted():
+                raise BudgetExhausted()
+
+            score = self.evaluate(self.space.point(indices), fidelity)
+            self.scores[key] = score
+            self.cost = self.cost + self.fidelity_cost(fidelity)
+
+            if self.on_score:
+                self.on_score(self.space.point(indices), fidelity, score)
+
+        return self.scores[key]
+
+    def exhausted(self):
+        return self.budget is not None and self.cost >= self.budget
+
+    def visited(self, indices):
+        return (tuple(indices), 1.0) in self.scores
+
+    def full_scores(self):
+        return {key[0]: score for key, score in self.scores.items() if key[1] == 1.0}
+
+    def best(self):
+        best = None
+        for indices, score in self.full_scores().items():
+            if score != float('-inf') and (best is None or score > best[1]):
+                best = (indices, score)
+        return best
+
+
+def unvisited(space, objective, rng, count):
+    result = []
+    for indices in space.random_order(rng):
+        if len(result) == count:
+            break
+        if not objective.visited(indices):
+            result.append(indices)
+    return result
+
+
+class BruteForce:
+    """Evaluates variants in random order until the space or the budget is
+    exhausted."""
+
+    name = 'brute-force'
+
+    def __call__(self, space, objective, rng):
+        for indices in space.random_order(rng):
+            objective(indices)
+
+
+class CoordinateDescent:
+    """Sweeps one parameter at a time while the others stay fixed, moving to
+    the best variant of the sweep, until no sweep improves the score. With a
+    budget, the descent restarts from random variants while budget remains."""
+
+    name = 'coordinate-descent'
+
+    def __call__(self, space, objective, rng):
+        shape = space.shape()
+        current = space.center()
+
+        while True:
+            current_score = objective(current)
+
+            improved = True
+            while improved:
+                improved = False
+                for axis in rng.sample(range(len(shape)), len(shape)):
+                    for value in range(shape[axis]):
+                        candidate = current[:axis] + (value,) + current[axis + 1:]
+                        score = objective(candidate)
+                        if score > current_score:
+                            current, current_score = candidate, score
+                            improved = True
+
+            if objective.budget is None:
+                return
+
+            restart = unvisited(space, objective, rng, 1)
+            if not restart:
+                return
+            current = restart[0]
+
+
+class SuccessiveHalving:
+    """Measures many random variants on a fraction of the runtime workloads,
+    keeps the best 1/eta of them, and repeats with eta times more workloads
+    until the survivors are measured on all of them."""
+
+    name = 'successive-halving'
+
+    def __init__(self, eta=3, num_candidates=81):
+        self.eta = eta
+        self.num_candidates = num_candidates
+
+    def fidelity(self, rung, num_rungs):
+        return 1.0 if rung == num_rungs else float(self.eta ** (rung - num_rungs))
+
+    def num_rungs(self, objective, num_candidates):
+        # lower rungs only pay off while they measure fewer workloads
+        rungs = 0
+        while num_candidates > 1:
+            cheaper = objective.fidelity_cost(self.fidelity(0, rungs + 1))
+            if cheaper >= objective.fidelity_cost(self.fidelity(0, rungs)):
+                break
+            num_candidates = max(1, num_candidates // self.eta)
+            rungs = rungs + 1
+        return rungs
+
+    def cost(self, objective, num_candidates):
+        rungs = self.num_rungs(objective, num_candidates)
+        cost = 0.0
+        for rung in range(rungs + 1):
+            cost = cost + num_candidates * objective.fidelity_cost(self.fidelity(rung, rungs))
+            num_candidates = max(1, num_candidates // self.eta)
+        return cost
+
+    def __call__(self, space, objective, rng):
+        num_candidates = min(space.size(), self.num_candidates)
+        if objective.budget is not None:
+            # as many candidates as the budget affords
+            low, high = 1, space.size()
+            while low < high:
+                middle = (low + high + 1) // 2
+                if self.cost(objective, middle) <= objective.budget:
+                    low = middle
+                else:
+                    high = middle - 1
+            num_candidates = low
+
+        candidates = unvisited(space, objective, rng, num_candidates)
+        rungs = self.num_rungs(objective, len(candidates))
+
+        for rung in range(rungs + 1):
+            fidelity = self.fidelity(rung, rungs)
+            scores = [(objective(indices, fidelity), indices) for indices in candidates]
+
+            if rung < rungs:
+                scores = [entry for entry in scores if entry[0] != float('-inf')]
+                scores.sort(key=lambda entry: entry[0], reverse=True)
+                candidates = [indices for _, indices in scores[:max(1, len(candidates) // self.eta)]]
+
+            if not candidates:
+                return
+
+
+def matern52(a, b, lengthscale):
+    distance = np.sqrt(np.sum((a[:, None, :] - b[None, :, :]) ** 2, axis=-1)) / lengthscale
+    scaled = math.sqrt(5.0) * distance
+    return (1.0 + scaled + scaled ** 2 / 3.0) * np.exp(-scaled)
+
+
+class GaussianProcess:
+    """Gaussian process regression with a Matern 5/2 kernel. The lengthscale
+    maximizing the marginal likelihood is picked from a fixed grid, which is
+    robust enough for the handful of observations of a tuning search."""
+
+    lengthscales = [0.05, 0.1, 0.2, 0.4, 0.8, 1.6]
+
+    def __init__(self, noise=1e-3):
+        self.noise = noise
+
+    def fit(self, x, y):
+        self.x = x
+        self.mean = np.mean(y)
+        self.std = np.std(y) if np.std(y) > 0 else 1.0
+        y = (y - self.mean) / self.std
+
+        best_likelihood = float('-inf')
+        for lengthscale in self.lengthscales:
+            k = matern52(x, x, lengthscale) + self.noise * np.eye(len(x))
+            l = np.linalg.cholesky(k)
+            alpha = np.linalg.solve(l.T, np.linalg.solve(l, y))
+            likelihood = -0.5 * y @ alpha - np.sum(np.log(np.diag(l)))
+            if likelihood > best_likelihood:
+                best_likelihood = likelihood
+                self.lengthscale, self.l, self.alpha = lengthscale, l, alpha
+
+        return self
+
+    def predict(self, x):
+        k = matern52(self.x, x, self.lengthscale)
+        mean = k.T @ self.alpha
+        v = np.linalg.solve(self.l, k)
+        variance = np.maximum(1.0 - np.sum(v ** 2, axis=0), 1e-12)
+        return mean * self.std + self.mean, np.sqrt(variance) * self.std
+
+
+def expected_improvement(mean, std, best, xi=0.01):
+    improvement = mean - best - xi
+    z = improvement / std
+    cdf = 0.5 * (1.0 + np.vectorize(math.erf)(z / math.sqrt(2.0)))
+    pdf = np.exp(-0.5 * z ** 2) / math.sqrt(2.0 * math.pi)
+    return improvement * cdf + std * pdf
+
+
+class BayesianOptimization:
+    """Models the score over the space with a Gaussian process and evaluates
+    the variant with the largest expected improvement next. Variants that
+    failed are modeled as scoring as badly as the worst successful one, which
+    steers the search away from regions that do not compile or fit the device.
+    Without a budget, a tenth of the space is evaluated."""
+
+    name = 'bayesian'
+
+    def __init__(self, num_initial=8, num_candidates=2048):
+        self.num_initial = num_initial
+        self.num_candidates = num_candidates
+
+    def __call__(self, space, objective, rng):
+        budget = objective.budget
+        if budget is None:
+            budget = min(space.size(), max(4 * self.num_initial, space.size() // 10))
+
+        for indices in unvisited(space, objective, rng, min(self.num_initial, budget)):
+            objective(indices)
+
+        while objective.cost < budget:
+            observed = objective.full_scores()
+            candidates = unvisited(space, objective, rng, self.num_candidates)
+            if not candidates:
+                return
+
+            finite = [score for score in observed.values() if score != float('-inf')]
+            if len(finite) < 2:
+                objective(candidates[0])
+                continue
+
+            worst = min(finite)
+            x = np.array([space.coordinates(indices) for indices in observed])
+            y = np.array([score if score != float('-inf') else worst for score in observed.values()])
+
+            gp = GaussianProcess().fit(x, y)
+            mean, std = gp.predict(np.array([space.coordinates(indices) for indices in candidates]))
+            ei = expected_improvement(mean, std, max(finite))
+            objective(candidates[int(np.argmax(ei))])
+
+
+search_strategies = {strategy.name: strategy for strategy in [BruteForce,
+                                                             CoordinateDescent,
+                                                             SuccessiveHalving,
+                                                             BayesianOptimization]}
+
+
+def run_strategy(strategy, space, evaluate, budget=None, seed=0, on_score=None, fidelity_cost=None):
+    """Searches the space and returns the objective with every score seen.
+
+    The strategies are deterministic for a given seed, so repeating a search
+    whose results were cached retraces the same variants without measuring
+    them again and continues where the previous search stopped."""
+    objective = Objective(space, evaluate, budget, on_score, fidelity_cost)
+    try:
+        strategy(space, objective, random.Random(seed))
+    except BudgetExhausted:
+        pass
+    return objective
+
+
+def num_rt_workloads(rt_values):
+    return sum(math.prod(len(values) for values in axes.values()) for axes in rt_values.values())
+
+
+def rt_values_subset(rt_values, fidelity):
+    """Keeps a fraction of the runtime workloads of every subbench by dropping
+    values of the longest axes. The last values of an axis are kept, as they
+    carry the most weight in the score."""
+    if fidelity >= 1.0:
+        return rt_values
+
+    result = {}
+    for subbench in rt_values:
+        axes = {axis: list(values) for axis, values in rt_values[subbench].items()}
+        target = max(1, int(round(math.prod(len(values) for values in axes.values()) * fidelity)))
+
+        while math.prod(len(values) for values in axes.values()) > target:
+            longest = max(axes, key=lambda axis: len(axes[axis]))
+            axes[longest] = axes[longest][1:]
+
+        result[subbench] = axes
+    return result
+
+
+def rt_fidelity_cost(rt_values):
+    """The fraction of the runtime workloads actually measured at a fidelity."""
+    total = num_rt_workloads(rt_values)
+
+    @functools.lru_cache(maxsize=None)
+    def cost(fidelity):
+        return num_rt_workloads(rt_values_subset(rt_values, fidelity)) / total
+
+    return cost
@@ -0,0 +1,163 @@
+#!/usr/bin/env python3
+
+import os
+import sys
+import argparse
+import cccl.bench
+
+
+def file_exists(value):
+    if not os.path.isfile(value):
+        raise argparse.ArgumentTypeError(f"The file '{value}' does not exist.")
+    return value
+
+
+def default_revision():
+    # results produced in a build directory belong to its revision
+    if os.path.isfile("cccl_meta_bench.csv"):
+        return cccl.bench.parse_meta()[1]
+    return None
+
+
+def ingest(args):
+    revision = args.cccl or default_revision()
+    if revision is None:
+        sys.exit("Can't tell the revision of the results, use --cccl")
+
+    if args.name and len(args.files) != 1:
+        sys.exit("--name requires a single file")
+
+    history = cccl.bench.History(args.db)
+    for json_path in args.files:
+        _, num_states = history.ingest(json_path, revision, args.machine, args.name, args.date)
+        print("{}: {} states of {}".format(json_path, num_states, revision))
+
+
+def list_runs(args):
+    history = cccl.bench.History(args.db)
+    for run_id, revision, machine, bench, date, _ in history.runs(args.machine):
+        print("{:>5}  {}  {}  {}  {}".format(run_id, date, revision, machine, bench))
+
+
+def detector_from_args(args):
+    return cccl.bench.RegressionDetector(args.test, args.alpha, args.threshold)
+
+
+def report(args, rows):
+    print(cccl.bench.format_report(rows, args.format, args.verbose))
+
+    if args.fail_on_regression and any(row['verdict'] == 'regression' for row in rows):
+        sys.exit(1)
+
+
+def compare(args):
+    history = cccl.bench.History(args.db)
+
+    machines = [args.machine] if args.machine else history.machines()
+    if not machines:
+        sys.exit("The history is empty")
+
+    rows = []
+    for machine in machines:
+        revisions = history.revisions(machine)
+        if args.candidate not in revisions:
+            continue
+
+        baseline = args.baseline or history.previous_revision(machine, args.candidate)
+        if baseline is None or baseline not in revisions:
+            print("{}: no baseline for {}".format(machine, args.candidate), file=sys.stderr)
+            continue
+
+        base = history.samples(machine, baseline)
+        candidate = history.samples(machine, args.candidate)
+        for row in cccl.bench.compare_samples(base, candidate, detector_from_args(args), args.R):
+            if len(machines) > 1:
+                row['bench'] = "{} @ {}".format(row['bench'], machine)
+            rows.append(row)
+
+    report(args, rows)
+
+
+def diff(args):
+    # both files hold the results of the same benchmark
+    name = args.name or cccl.bench.bench_name_from_path(args.base)
+    base = cccl.bench.json_samples(args.base, name)
+    candidate = cccl.bench.json_samples(args.candidate, name)
+    report(args, cccl.bench.compare_samples(base, candidate, detector_from_args(args), args.R))
+
+
+def add_report_arguments(parser):
+    parser.add_argument(
+        '-R', type=str, default='.*', help="Regex for benchmarks selection.")
+    parser.add_argument(
+        '--test', choices=['mannwhitney', 'bootstrap'], default='mannwhitney',
+        help="Test that tells apart the sample distributions.")
+    parser.add_argument(
+        '--alpha', default=0.01, type=float, help="Significance level.")
+    parser.add_argument(
+        '--threshold', default=0.05, type=float,
+        help="Smallest relative change of the median time that is reported.")
+    parser.add_argument(
+        '--format', choices=['text', 'markdown', 'json'], default='text')
+    parser.add_argument(
+        '--verbose', action=argparse.BooleanOptionalAction, help="Report unchanged states as well.")
+    parser.add_argument(
+        '--fail-on-regression', action=argparse.BooleanOptionalAction,
+        help="Exit with an error when a regression is found.")
+
+
+def parse_arguments():
+    parser = argparse.ArgumentParser(
+        description="Track benchmark results over time and detect regressions.")
+    parser.add_argument(
+        '--db', type=str, default=cccl.bench.history_db_name, help="History database.")
+    subparsers = parser.add_subparsers(dest='command', required=True)
+
+    ingest_parser = subparsers.add_parser(
+        'ingest', help="Add NVBench JSON results to the history.")
+    ingest_parser.add_argument(
+        '--cccl', type=str, help="Revision the results belong to. Defaults to the revision of the build directory.")
+    ingest_parser.add_argument(
+        '--machine', type=str, help="Machine the results were measured on. Defaults to the device in the results.")
+    ingest_parser.add_argument(
+        '--name', type=str, help="Benchmark name. Defaults to the file name.")
+    ingest_parser.add_argument(
+        '--date', type=str, help="Date of the results. Defaults to now.")
+    ingest_parser.add_argument(
+        'files', type=file_exists, nargs='+', help='NVBench JSON files.')
+    ingest_parser.set_defaults(func=ingest)
+
+    list_parser = subparsers.add_parser(
+        'list', help="List the ingested runs.")
+    list_parser.add_argument('--machine', type=str)
+    list_parser.set_defaults(func=list_runs)
+
+    compare_parser = subparsers.add_parser(
+        'compare', help="Compare two revisions in the history.")
+    compare_parser.add_argument(
+        '--candidate', type=str, required=True, help="Revision to check.")
+    compare_parser.add_argument(
+        '--baseline', type=str, help="Reference revision. Defaults to the revision ingested before the candidate.")
+    compare_parser.add_argument('--machine', type=str)
+    add_report_arguments(compare_parser)
+    compare_parser.set_defaults(func=compare)
+
+    diff_parser = subparsers.add_parser(
+        'diff', help="Compare two NVBench JSON files without a history.")
+    diff_parser.add_argument('base', type=file_exists)
+    diff_parser.add_argument('candidate', type=file_exists)
+    diff_parser.add_argument(
+        '--name', type=str, help="Benchmark name. Defaults to the file name.")
+    add_report_arguments(diff_parser)
+    diff_parser.set_defaults(func=diff)
+
+    return parser.parse_args()
+
+
+def main():
+    args = parse_arguments()
+    args.func(args)
+
+
+if __name__ == "__main__":
+    main()
@@ -1,5 +1,7 @@
 #!/usr/bin/env python3
 
+import sys
+import argparse
 import cccl.bench as bench
 
 
@@ -10,9 +12,44 @@ import cccl.bench as bench
 # - ecc
 
 
+def parse_arguments():
+    parser = argparse.ArgumentParser(description='Search strategy', add_help=False)
+    parser.add_argument('--strategy', choices=list(bench.search_strategies.keys()), default='brute-force',
+                        help="Order in which variants are evaluated.")
+    parser.add_argument('--budget', type=float, default=None,
+                        help="Number of variant evaluations per compile-time workload.")
+    parser.add_argument('--seed', type=int, default=0, help="Seed of the strategy.")
+    parser.add_argument('--replay', type=str, default=None,
+                        help="Replay the strategy on the results stored in a database instead of benchmarking.")
+
+    # the remaining arguments are handled by `bench.search`
+    args, remaining = parser.parse_known_args()
+    sys.argv = sys.argv[:1] + remaining
+
+    return args
+
+
+def replay(args, strategy):
+    parser = argparse.ArgumentParser(description='Replay search strategy')
+    parser.add_argument('-R', type=str, default='.*', help="Regex for benchmarks selection.")
+    regex = parser.parse_args().R
+
+    bench.replay_search(strategy, args.replay, regex, args.budget, args.seed)
+
+
 def main():
+    args = parse_arguments()
+    strategy = bench.search_strategies[args.strategy]()
+
+    if args.replay:
+        replay(args, strategy)
+        return
+
     center_estimator = bench.MedianCenterEstimator()
-    bench.search(bench.BruteForceSeeker(center_estimator, center_estimator))
+    if args.strategy == 'brute-force' and args.budget is None:
+        bench.search(bench.BruteForceSeeker(center_estimator, center_estimator))
+    else:
+        bench.search(bench.StrategySeeker(strategy, args.budget, args.seed, center_estimator, center_estimator))
 
 
 if __name__ == "__main__":
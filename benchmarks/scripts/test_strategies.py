@@ -0,0 +1,153 @@
+#!/usr/bin/env python3
+
+# Replays the search strategies on a synthetic database of results:
+#   python3 -m unittest test_strategies
+
+import io
+import os
+import sys
+import types
+import sqlite3
+import tempfile
+import unittest
+import contextlib
+
+try:
+    import fpzip
+except ImportError:
+    # replaying never compresses or decompresses samples
+    sys.modules['fpzip'] = types.ModuleType('fpzip')
+
+import cccl.bench as bench
+from cccl.bench.bench import create_benches_tables
+
+
+algname = 'cub.bench.synthetic'
+subbench = 'base'
+ct_axis = 'T{ct}'
+rt_axes = {'Elements{io}[pow2]': ['16', '20', '24', '28'], 'Entropy': ['1.000', '0.544']}
+
+# the score surface has a single maximum, the variants around a corner of the
+# space failed and were never stored
+params = {'A': range(1, 9), 'B': range(1, 9)}
+optimum = 'A_5.B_3'
+
+
+def synthetic_speedup(a, b):
+    return 2.0 - ((a - 5) ** 2 + (b - 3) ** 2) / 50.0
+
+
+def synthetic_failure(a, b):
+    return a >= 7 and b == 8
+
+
+def fill_database(db_path):
+    conn = sqlite3.connect(db_path)
+    create_benches_tables(conn, subbench, {algname: [ct_axis] + list(rt_axes)})
+
+    rows = [('base', 1.0)]
+    for a in params['A']:
+        for b in params['B']:
+            if not synthetic_failure(a, b):
+                rows.append(("A_{}.B_{}".format(a, b), 1.0 / synthetic_speedup(a, b)))
+
+    with conn:
+        for variant, center in rows:
+            for elements in rt_axes['Elements{io}[pow2]']:
+                for entropy in rt_axes['Entropy']:
+                    conn.execute("INSERT INTO \"{}.{}\" VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?);".format(algname, subbench),
+                                 ('12.0', '2.3.0', 'synthetic', variant, 1.0, center, None, None,
+                                  'I32', elements, entropy))
+    conn.close()
+
+
+class CachingEvaluator:
+    """Memoizes the scores of a replay case like the benchmark cache does,
+    counting the evaluations which were not cached."""
+
+    def __init__(self, case):
+        self.case = case
+        self.cache = {}
+        self.misses = 0
+
+    def __call__(self, variant, fidelity):
+        key = (variant.label(), fidelity)
+        if key not in self.cache:
+            self.cache[key] = self.case(variant, fidelity)
+            self.misses = self.misses + 1
+        return self.cache[key]
+
+
+class TestStrategies(unittest.TestCase):
+    budgets = {'brute-force': 64,
+               'coordinate-descent': 32,
+               'successive-halving': 32,
+               'bayesian': 32}
+
+    def setUp(self):
+        self.tmpdir = tempfile.TemporaryDirectory()
+        self.db_path = os.path.join(self.tmpdir.name, 'cccl_meta_bench.db')
+        fill_database(self.db_path)
+
+        cases = bench.replay_cases(self.db_path)
+        self.assertEqual(len(cases), 1)
+        self.case = cases[0]
+
+    def tearDown(self):
+        self.tmpdir.cleanup()
+
+    def search(self, strategy, evaluate, seed=0):
+        return bench.run_strategy(strategy, self.case.space(), evaluate, self.budgets[strategy.name], seed,
+                                  None, bench.rt_fidelity_cost(self.case.rt_values))
+
+    def test_replay_case(self):
+        space = self.case.space()
+        self.assertEqual(space.shape(), (8, 8))
+        self.assertAlmostEqual(self.case.score(optimum), synthetic_speedup(5, 3))
+        self.assertAlmostEqual(self.case.score(optimum, 1.0 / 3.0), synthetic_speedup(5, 3))
+        self.assertEqual(self.case.score('A_8.B_8'), float('-inf'))
+
+    def test_strategies_find_optimum(self):
+        self.assertEqual(set(bench.search_strategies), set(self.budgets))
+
+        for name, strategy in bench.search_strategies.items():
+            with self.subTest(strategy=name):
+                objective = self.search(strategy(), self.case)
+                best = objective.best()
+
+                self.assertIsNotNone(best)
+                self.assertEqual(self.case.space().point(best[0]).label(), optimum)
+                self.assertLessEqual(objective.cost, self.budgets[name] + 1.0)
+
+                if name == 'successive-halving':
+                    # the budget affords the whole space on the lower rungs
+                    self.assertTrue(any(key[1] < 1.0 for key in objective.scores))
+                    self.assertLess(len(objective.full_scores()), self.case.space().size())
+
+    def test_strategies_resume(self):
+        for name, strategy in bench.search_strategies.items():
+            with self.subTest(strategy=name):
+                evaluate = CachingEvaluator(self.case)
+
+                first = self.search(strategy(), evaluate, seed=42)
+                misses = evaluate.misses
+                self.assertGreater(misses, 0)
+
+                # the same seed retraces the cached variants
+                second = self.search(strategy(), evaluate, seed=42)
+                self.assertEqual(evaluate.misses, misses)
+                self.assertEqual(second.scores, first.scores)
+
+    def test_replay_search(self):
+        for name, strategy in bench.search_strategies.items():
+            with self.subTest(strategy=name):
+                output = io.StringIO()
+                with contextlib.redirect_stdout(output):
+                    bench.replay_search(strategy(), self.db_path, budget=self.budgets[name])
+
+                self.assertIn("{}: {} score".format(name, optimum), output.getvalue())
+                self.assertIn("(rank 1)", output.getvalue())
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -1,4 +1,8 @@
+#include <thrust/detail/config.h>
+
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
 #include <cub/device/device_copy.cuh>
+#endif
 
 #include <thrust/binary_search.h>
 #include <thrust/count.h>
@@ -15,14 +19,36 @@
 #include <thrust/scan.h>
 #include <thrust/tabulate.h>
 
+#include <algorithm>
+#include <cmath>
 #include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <optional>
 #include <random>
+#include <string>
+#include <thread>
 #include <type_traits>
+#include <typeinfo>
+#include <vector>
 
 #include "thrust/device_vector.h"
-#include <curand.h>
 #include <nvbench_helper.cuh>
 
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
+#include <curand.h>
+#endif
+
+#if __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define NVBENCH_HELPER_HAS_MMAP 1
+#else
+#define NVBENCH_HELPER_HAS_MMAP 0
+#endif
+
 namespace 
 {
 
@@ -35,6 +61,158 @@ enum class executor
   device
 };
 
+/**
+ * Counter-based random number stream. The i-th value only depends on the seed and i, so that
+ * the values don't depend on how the indices are split across threads. The i-th value is the
+ * i-th output of SplitMix64 started from the scrambled seed.
+ */
+class counter_rng_t
+{
+public:
+  explicit counter_rng_t(seed_t seed)
+      : m_key(mix(seed.get()))
+  {}
+
+  std::uint64_t operator()(std::uint64_t counter) const
+  {
+    return mix(m_key + (counter + 1) * 0x9E3779B97F4A7C15ull);
+  }
+
+  // Uniformly distributed in [0, 1)
+  double uniform(std::uint64_t counter) const
+  {
+    return static_cast<double>((*this)(counter) >> 11) * 0x1.0p-53;
+  }
+
+private:
+  static std::uint64_t mix(std::uint64_t z)
+  {
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+  }
+
+  std::uint64_t m_key;
+};
+
+// The number of threads generating host data, `NVBENCH_HELPER_THREADS` overrides the default
+std::size_t host_threads()
+{
+  if (const char *threads = std::getenv("NVBENCH_HELPER_THREADS"))
+  {
+    const long num_threads = std::strtol(threads, nullptr, 10);
+    if (num_threads > 0)
+    {
+      return static_cast<std::size_t>(num_threads);
+    }
+  }
+
+  return std::max(1u, std::thread::hardware_concurrency());
+}
+
+/**
+ * Calls `op(begin, end)` on consecutive chunks of [0, num_items) from multiple threads.
+ */
+template <class OpT>
+void parallel_for_host(std::size_t num_items, OpT op)
+{
+  constexpr std::size_t min_items_per_thread = 64 * 1024;
+
+  const std::size_t num_threads =
+    std::min(host_threads(), (num_items + min_items_per_thread - 1) / min_items_per_thread);
+
+  if (num_threads <= 1)
+  {
+    op(std::size_t{0}, num_items);
+    return;
+  }
+
+  const std::size_t items_per_thread = (num_items + num_threads - 1) / num_threads;
+
+  std::vector<std::thread> threads;
+  for (std::size_t tid = 1; tid < num_threads; tid++)
+  {
+    const std::size_t begin = std::min(num_items, tid * items_per_thread);
+    const std::size_t end   = std::min(num_items, begin + items_per_thread);
+    threads.emplace_back(op, begin, end);
+  }
+
+  op(std::size_t{0}, items_per_thread);
+
+  for (std::thread &thread : threads)
+  {
+    thread.join();
+  }
+}
+
+// Policies whose algorithms run on a single host thread
+template <class ExecT>
+constexpr bool is_serial_host_policy_v =
+  std::is_same_v<ExecT, std::decay_t<decltype(thrust::host)>>
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CPP
+  || std::is_same_v<ExecT, std::decay_t<decltype(thrust::device)>>
+#endif
+  ;
+
+template <class ExecT, class InT, class OutT, class OpT>
+void transform_n(const ExecT &exec, const InT *in, std::size_t num_items, OutT *out, OpT op)
+{
+  if constexpr (is_serial_host_policy_v<ExecT>)
+  {
+    parallel_for_host(num_items, [=](std::size_t begin, std::size_t end) {
+      for (std::size_t i = begin; i < end; i++)
+      {
+        out[i] = op(in[i]);
+      }
+    });
+  }
+  else
+  {
+    thrust::transform(exec, in, in + num_items, out, op);
+  }
+}
+
+template <class ExecT, class InT1, class InT2, class OutT, class OpT>
+void transform_n(const ExecT &exec,
+                 const InT1 *in1,
+                 const InT2 *in2,
+                 std::size_t num_items,
+                 OutT *out,
+                 OpT op)
+{
+  if constexpr (is_serial_host_policy_v<ExecT>)
+  {
+    parallel_for_host(num_items, [=](std::size_t begin, std::size_t end) {
+      for (std::size_t i = begin; i < end; i++)
+      {
+        out[i] = op(in1[i], in2[i]);
+      }
+    });
+  }
+  else
+  {
+    thrust::transform(exec, in1, in1 + num_items, in2, out, op);
+  }
+}
+
+template <class ExecT, class OpT>
+void for_each_index(const ExecT &exec, std::size_t num_items, OpT op)
+{
+  if constexpr (is_serial_host_policy_v<ExecT>)
+  {
+    parallel_for_host(num_items, [=](std::size_t begin, std::size_t end) {
+      for (std::size_t i = begin; i < end; i++)
+      {
+        op(i);
+      }
+    });
+  }
+  else
+  {
+    thrust::for_each_n(exec, thrust::make_counting_iterator(std::size_t{0}), num_items, op);
+  }
+}
+
 class host_generator_t
 {
 public:
@@ -54,13 +232,13 @@ const double *host_generator_t::new_uniform_distribution(seed_t seed, std::size_
   m_distribution.resize(num_items);
   double *h_distribution = thrust::raw_pointer_cast(m_distribution.data());
 
-  std::default_random_engine re(seed.get());
-  std::uniform_real_distribution<double> dist(0.0, 1.0);
-
-  for (std::size_t i = 0; i < num_items; i++)
-  {
-    h_distribution[i] = dist(re);
-  }
+  const counter_rng_t rng(seed);
+  parallel_for_host(num_items, [=](std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; i++)
+    {
+      h_distribution[i] = rng.uniform(i);
+    }
+  });
 
   return h_distribution;
 }
@@ -70,13 +248,18 @@ const double *host_generator_t::new_lognormal_distribution(seed_t seed, std::siz
   m_distribution.resize(num_items);
   double *h_distribution = thrust::raw_pointer_cast(m_distribution.data());
 
-  std::default_random_engine re(seed.get());
-  std::lognormal_distribution<double> dist(lognormal_mean, lognormal_sigma);
+  constexpr double two_pi = 6.283185307179586;
 
-  for (std::size_t i = 0; i < num_items; i++)
-  {
-    h_distribution[i] = dist(re);
-  }
+  const counter_rng_t rng(seed);
+  parallel_for_host(num_items, [=](std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; i++)
+    {
+      // Box-Muller transform of the pair of uniform values of the item
+      const double radius = std::sqrt(-2.0 * std::log(1.0 - rng.uniform(2 * i)));
+      const double normal = radius * std::cos(two_pi * rng.uniform(2 * i + 1));
+      h_distribution[i]   = std::exp(lognormal_mean + lognormal_sigma * normal);
+    }
+  });
 
   return h_distribution;
 }
@@ -89,6 +272,7 @@ const double *host_generator_t::new_constant(std::size_t num_items, double val)
   return h_distribution;
 }
 
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
 class device_generator_t
 {
 public:
@@ -107,6 +291,10 @@ private:
   curandGenerator_t m_gen;
   thrust::device_vector<double> m_distribution;
 };
+#else
+// The device memory of host device systems is host memory.
+using device_generator_t = host_generator_t;
+#endif
 
 template <typename T>
 struct random_to_item_t
@@ -132,6 +320,7 @@ struct random_to_item_t
   }
 };
 
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
 const double *device_generator_t::new_uniform_distribution(seed_t seed, std::size_t num_items)
 {
   m_distribution.resize(num_items);
@@ -161,6 +350,7 @@ const double *device_generator_t::new_constant(std::size_t num_items, double val
   thrust::fill_n(thrust::device, d_distribution, num_items, val);
   return d_distribution;
 }
+#endif
 
 struct and_t
 {
@@ -170,36 +360,41 @@ struct and_t
     return a & b;
   }
 
+  // The bits of floating point values are accessed through memcpy, as type punning through
+  // references breaks strict aliasing
+  template <class FloatT, class BitsT>
+  __host__ __device__ static FloatT and_bits(FloatT a, FloatT b)
+  {
+    static_assert(sizeof(FloatT) == sizeof(BitsT), "");
+
+    BitsT a_bits;
+    BitsT b_bits;
+    std::memcpy(&a_bits, &a, sizeof(a));
+    std::memcpy(&b_bits, &b, sizeof(b));
+
+    const BitsT result_bits = a_bits & b_bits;
+
+    FloatT result;
+    std::memcpy(&result, &result_bits, sizeof(result));
+    return result;
+  }
+
   __host__ __device__ float operator()(float a, float b) const
   {
-    const std::uint32_t result = reinterpret_cast<std::uint32_t &>(a) &
-                                 reinterpret_cast<std::uint32_t &>(b);
-    return reinterpret_cast<const float &>(result);
+    return and_bits<float, std::uint32_t>(a, b);
   }
 
   __host__ __device__ double operator()(double a, double b) const
   {
-    const std::uint64_t result = reinterpret_cast<std::uint64_t &>(a) &
-                                 reinterpret_cast<std::uint64_t &>(b);
-    return reinterpret_cast<const double &>(result);
+    return and_bits<double, std::uint64_t>(a, b);
   }
 
   __host__ __device__ complex operator()(complex a, complex b) const
   {
-    double a_real = a.real();
-    double a_imag = a.imag();
-
-    double b_real = b.real();
-    double b_imag = b.imag();
+    const double result_real = and_bits<double, std::uint64_t>(a.real(), b.real());
+    const double result_imag = and_bits<double, std::uint64_t>(a.imag(), b.imag());
 
-    const std::uint64_t result_real = reinterpret_cast<std::uint64_t &>(a_real) &
-                                      reinterpret_cast<std::uint64_t &>(b_real);
-
-    const std::uint64_t result_imag = reinterpret_cast<std::uint64_t &>(a_imag) &
-                                      reinterpret_cast<std::uint64_t &>(b_imag);
-
-    return {static_cast<float>(reinterpret_cast<const double &>(result_real)),
-            static_cast<float>(reinterpret_cast<const double &>(result_imag))};
+    return {static_cast<float>(result_real), static_cast<float>(result_imag)};
   }
 };
 
@@ -350,11 +545,11 @@ void generator_t::generate(const ExecT &exec,
     case bit_entropy::_1_000: {
       const double *uniform_distribution = dist.new_uniform_distribution(seed, span.size());
 
-      thrust::transform(exec,
-                        uniform_distribution,
-                        uniform_distribution + span.size(),
-                        span.data(),
-                        random_to_item_t<T>(min, max));
+      transform_n(exec,
+                  uniform_distribution,
+                  span.size(),
+                  span.data(),
+                  random_to_item_t<T>(min, max));
       return;
     }
     case bit_entropy::_0_000: {
@@ -369,11 +564,11 @@ void generator_t::generate(const ExecT &exec,
       const double *uniform_distribution = dist.new_uniform_distribution(seed, span.size());
       ++seed;
 
-      thrust::transform(exec,
-                        uniform_distribution,
-                        uniform_distribution + span.size(),
-                        span.data(),
-                        random_to_item_t<T>(min, max));
+      transform_n(exec,
+                  uniform_distribution,
+                  span.size(),
+                  span.data(),
+                  random_to_item_t<T>(min, max));
 
       const int number_of_steps = static_cast<int>(entropy);
 
@@ -391,12 +586,7 @@ void generator_t::generate(const ExecT &exec,
                        min,
                        max);
 
-        thrust::transform(exec,
-                          span.data(),
-                          span.data() + span.size(),
-                          tmp.data(),
-                          span.data(),
-                          and_t{});
+        transform_n(exec, span.data(), tmp.data(), span.size(), span.data(), and_t{});
       }
       return;
     }
@@ -416,17 +606,11 @@ void generator_t::generate(const ExecT &exec,
   {
     case bit_entropy::_1_000: {
       const double *uniform_distribution = dist.new_uniform_distribution(seed, span.size());
-      thrust::for_each_n(exec,
-                         thrust::make_counting_iterator(0),
-                         span.size(),
-                         set_real_t{min, max, span.data(), uniform_distribution});
+      for_each_index(exec, span.size(), set_real_t{min, max, span.data(), uniform_distribution});
       ++seed;
 
       uniform_distribution = dist.new_uniform_distribution(seed, span.size());
-      thrust::for_each_n(exec,
-                         thrust::make_counting_iterator(0),
-                         span.size(),
-                         set_imag_t{min, max, span.data(), uniform_distribution});
+      for_each_index(exec, span.size(), set_imag_t{min, max, span.data(), uniform_distribution});
       ++seed;
       return;
     }
@@ -441,17 +625,11 @@ void generator_t::generate(const ExecT &exec,
     }
     default: {
       const double *uniform_distribution = dist.new_uniform_distribution(seed, span.size());
-      thrust::for_each_n(exec,
-                         thrust::make_counting_iterator(0),
-                         span.size(),
-                         set_real_t{min, max, span.data(), uniform_distribution});
+      for_each_index(exec, span.size(), set_real_t{min, max, span.data(), uniform_distribution});
       ++seed;
 
       uniform_distribution = dist.new_uniform_distribution(seed, span.size());
-      thrust::for_each_n(exec,
-                         thrust::make_counting_iterator(0),
-                         span.size(),
-                         set_imag_t{min, max, span.data(), uniform_distribution});
+      for_each_index(exec, span.size(), set_imag_t{min, max, span.data(), uniform_distribution});
       ++seed;
 
       const int number_of_steps = static_cast<int>(entropy);
@@ -472,12 +650,7 @@ void generator_t::generate(const ExecT &exec,
                        min,
                        max);
 
-        thrust::transform(exec,
-                          span.data(),
-                          span.data() + span.size(),
-                          tmp.data(),
-                          span.data(),
-                          and_t{}); // TODO issue
+        transform_n(exec, span.data(), tmp.data(), span.size(), span.data(), and_t{}); // TODO issue
       }
       return;
     }
@@ -515,11 +688,11 @@ void generator_t::generate(const ExecT &exec,
   {
     const double *uniform_distribution = dist.new_uniform_distribution(seed, span.size());
 
-    thrust::transform(exec,
-                      uniform_distribution,
-                      uniform_distribution + span.size(),
-                      span.data(),
-                      random_to_probability_t{entropy_to_probability(entropy)});
+    transform_n(exec,
+                uniform_distribution,
+                span.size(),
+                span.data(),
+                random_to_probability_t{entropy_to_probability(entropy)});
   }
 }
 
@@ -541,8 +714,10 @@ void generator_t::power_law_segment_offsets(const ExecT &exec,
   const std::size_t total_segments   = device_segment_offsets.size() - 1;
   const double *uniform_distribution = dist.new_lognormal_distribution(seed, total_segments);
 
-  if (thrust::count(exec, uniform_distribution, uniform_distribution + total_segments, 0.0) ==
-      total_segments)
+  if (static_cast<std::size_t>(thrust::count(exec,
+                                             uniform_distribution,
+                                             uniform_distribution + total_segments,
+                                             0.0)) == total_segments)
   {
     uniform_distribution = dist.new_constant(total_segments, 1.0);
   }
@@ -550,11 +725,11 @@ void generator_t::power_law_segment_offsets(const ExecT &exec,
   const double sum =
     thrust::reduce(exec, uniform_distribution, uniform_distribution + total_segments);
 
-  thrust::transform(exec,
-                    uniform_distribution,
-                    uniform_distribution + total_segments,
-                    device_segment_offsets.data(),
-                    lognormal_transformer_t<T>{total_elements, sum});
+  transform_n(exec,
+              uniform_distribution,
+              total_segments,
+              device_segment_offsets.data(),
+              lognormal_transformer_t<T>{total_elements, sum});
 
   const int diff = total_elements -
                    thrust::reduce(exec,
@@ -581,6 +756,142 @@ void gen(executor exec, seed_t seed, cuda::std::span<T> span, bit_entropy entrop
   generator_t{}.generate(exec, seed, span, entropy, min, max);
 }
 
+// FNV-1a hash of the parameters of a generator that are not part of the cache file name
+class params_hash_t
+{
+public:
+  template <class T>
+  params_hash_t &add(const T &value)
+  {
+    const unsigned char *bytes = reinterpret_cast<const unsigned char *>(&value);
+    for (std::size_t i = 0; i < sizeof(T); i++)
+    {
+      m_hash = (m_hash ^ bytes[i]) * 0x100000001B3ull;
+    }
+    return *this;
+  }
+
+  std::uint64_t get() const { return m_hash; }
+
+private:
+  std::uint64_t m_hash{0xCBF29CE484222325ull};
+};
+
+bool load_cached_input(const std::string &path, void *data, std::size_t bytes)
+{
+#if NVBENCH_HELPER_HAS_MMAP
+  const int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0)
+  {
+    return false;
+  }
+
+  bool loaded = false;
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) == 0 && static_cast<std::size_t>(file_stat.st_size) == bytes)
+  {
+    if (bytes == 0)
+    {
+      loaded = true;
+    }
+    else
+    {
+      void *mapping = mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (mapping != MAP_FAILED)
+      {
+        std::memcpy(data, mapping, bytes);
+        munmap(mapping, bytes);
+        loaded = true;
+      }
+    }
+  }
+
+  close(fd);
+  return loaded;
+#else
+  (void)path;
+  (void)data;
+  (void)bytes;
+  return false;
+#endif
+}
+
+void store_cached_input(const std::string &path, const void *data, std::size_t bytes)
+{
+#if NVBENCH_HELPER_HAS_MMAP
+  // Written aside and renamed, so that concurrent runs never read a partial file
+  const std::string tmp_path = path + ".tmp." + std::to_string(getpid());
+
+  const int fd = open(tmp_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0)
+  {
+    return;
+  }
+
+  const char *ptr = static_cast<const char *>(data);
+  bool written    = true;
+  while (bytes > 0)
+  {
+    const ssize_t chunk = write(fd, ptr, bytes);
+    if (chunk <= 0)
+    {
+      written = false;
+      break;
+    }
+    ptr += chunk;
+    bytes -= static_cast<std::size_t>(chunk);
+  }
+
+  written = (close(fd) == 0) && written;
+  if (!written || rename(tmp_path.c_str(), path.c_str()) != 0)
+  {
+    unlink(tmp_path.c_str());
+  }
+#else
+  (void)path;
+  (void)data;
+  (void)bytes;
+#endif
+}
+
+/**
+ * Fills the span with the input `generate` produces. If `NVBENCH_HELPER_CACHE_DIR` is set,
+ * generated inputs are stored there and later runs map them instead of generating them again.
+ * The cache is keyed by the generator, the type, the seed, the size and the hash of the remaining
+ * parameters.
+ */
+template <class T, class GeneratorT>
+void cached_input(const char *generator,
+                  seed_t seed,
+                  params_hash_t params,
+                  cuda::std::span<T> span,
+                  GeneratorT generate)
+{
+  const char *cache_dir = std::getenv("NVBENCH_HELPER_CACHE_DIR");
+  if (cache_dir == nullptr || *cache_dir == '\0')
+  {
+    generate();
+    return;
+  }
+
+  // Bump the version when generators change the values they produce
+  constexpr int version = 1;
+
+  const std::string path = std::string(cache_dir) + "/" + generator + ".v" +
+                           std::to_string(version) + "." + typeid(T).name() + "." +
+                           std::to_string(sizeof(T)) + ".s" + std::to_string(seed.get()) + ".n" +
+                           std::to_string(span.size()) + "." + std::to_string(params.get()) +
+                           ".bin";
+
+  if (load_cached_input(path, span.data(), span.size_bytes()))
+  {
+    return;
+  }
+
+  generate();
+  store_cached_input(path, span.data(), span.size_bytes());
+}
+
 } // namespace
 
 namespace detail
@@ -589,7 +900,9 @@ namespace detail
 template <typename T>
 void gen_host(seed_t seed, cuda::std::span<T> span, bit_entropy entropy, T min, T max)
 {
-  gen(executor::host, seed, span, entropy, min, max);
+  cached_input("gen", seed, params_hash_t{}.add(entropy).add(min).add(max), span, [&] {
+    gen(executor::host, seed, span, entropy, min, max);
+  });
 }
 
 template <typename T>
@@ -630,22 +943,22 @@ struct offset_to_size_t
 
 template <typename T>
 void gen_key_segments(executor exec,
-                      seed_t seed,
                       cuda::std::span<T> keys,
                       cuda::std::span<std::size_t> segment_offsets)
 {
-  thrust::counting_iterator<int> iota(0);
-  offset_to_iterator_t<T> dst_transform_op{keys.data()};
-
   const std::size_t total_segments = segment_offsets.size() - 1;
 
-  auto d_range_srcs  = thrust::make_transform_iterator(iota, repeat_index_t<T>{});
-  auto d_range_dsts  = thrust::make_transform_iterator(segment_offsets.data(), dst_transform_op);
-  auto d_range_sizes = thrust::make_transform_iterator(iota,
-                                                       offset_to_size_t{segment_offsets.data()});
-
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
   if (exec == executor::device)
   {
+    thrust::counting_iterator<int> iota(0);
+    offset_to_iterator_t<T> dst_transform_op{keys.data()};
+
+    auto d_range_srcs  = thrust::make_transform_iterator(iota, repeat_index_t<T>{});
+    auto d_range_dsts  = thrust::make_transform_iterator(segment_offsets.data(), dst_transform_op);
+    auto d_range_sizes = thrust::make_transform_iterator(iota,
+                                                         offset_to_size_t{segment_offsets.data()});
+
     std::uint8_t *d_temp_storage   = nullptr;
     std::size_t temp_storage_bytes = 0;
     cub::DeviceCopy::Batched(d_temp_storage,
@@ -665,14 +978,29 @@ void gen_key_segments(executor exec,
                              d_range_sizes,
                              total_segments);
     cudaDeviceSynchronize();
+    return;
   }
-  else
-  {
-    for (std::size_t sid = 0; sid < total_segments; sid++)
+#else
+  (void)exec;
+#endif
+
+  // The key of an item is the index of the segment containing it
+  T *h_keys                    = keys.data();
+  const std::size_t *h_offsets = segment_offsets.data();
+
+  parallel_for_host(keys.size(), [=](std::size_t begin, std::size_t end) {
+    std::size_t sid =
+      std::upper_bound(h_offsets, h_offsets + total_segments + 1, begin) - h_offsets - 1;
+
+    for (std::size_t i = begin; i < end; i++)
     {
-      thrust::copy(d_range_srcs[sid], d_range_srcs[sid] + d_range_sizes[sid], d_range_dsts[sid]);
+      while (h_offsets[sid + 1] <= i)
+      {
+        sid++;
+      }
+      h_keys[i] = static_cast<T>(sid);
     }
-  }
+  });
 }
 
 template <class T>
@@ -741,25 +1069,31 @@ void gen_uniform_key_segments_host(seed_t seed,
                                    std::size_t min_segment_size,
                                    std::size_t max_segment_size)
 {
-  thrust::host_vector<std::size_t> segment_offsets(keys.size() + 2);
-
-  {
-    cuda::std::span<std::size_t> segment_offsets_span(thrust::raw_pointer_cast(
-                                                        segment_offsets.data()),
-                                                      segment_offsets.size());
-    const std::size_t offsets_size = gen_uniform_offsets(executor::host,
-                                                         seed,
-                                                         segment_offsets_span,
-                                                         min_segment_size,
-                                                         max_segment_size);
-    segment_offsets.resize(offsets_size);
-  }
-
-  cuda::std::span<std::size_t> segment_offsets_span(thrust::raw_pointer_cast(
-                                                      segment_offsets.data()),
-                                                    segment_offsets.size());
-
-  gen_key_segments(executor::host, seed, keys, segment_offsets_span);
+  cached_input("uniform_key_segments",
+               seed,
+               params_hash_t{}.add(min_segment_size).add(max_segment_size),
+               keys,
+               [&] {
+                 thrust::host_vector<std::size_t> segment_offsets(keys.size() + 2);
+
+                 {
+                   cuda::std::span<std::size_t> segment_offsets_span(
+                     thrust::raw_pointer_cast(segment_offsets.data()),
+                     segment_offsets.size());
+                   const std::size_t offsets_size = gen_uniform_offsets(executor::host,
+                                                                        seed,
+                                                                        segment_offsets_span,
+                                                                        min_segment_size,
+                                                                        max_segment_size);
+                   segment_offsets.resize(offsets_size);
+                 }
+
+                 cuda::std::span<std::size_t> segment_offsets_span(
+                   thrust::raw_pointer_cast(segment_offsets.data()),
+                   segment_offsets.size());
+
+                 gen_key_segments(executor::host, keys, segment_offsets_span);
+               });
 }
 
 template <typename T>
@@ -786,7 +1120,7 @@ void gen_uniform_key_segments_device(seed_t seed,
                                                       segment_offsets.data()),
                                                     segment_offsets.size());
 
-  gen_key_segments(executor::device, seed, keys, segment_offsets_span);
+  gen_key_segments(executor::device, keys, segment_offsets_span);
 }
 
 template <typename T>
@@ -820,7 +1154,9 @@ void gen_power_law_segment_offsets_host(seed_t seed,
                                         cuda::std::span<T> segment_offsets,
                                         std::size_t elements)
 {
-  generator_t{}.power_law_segment_offsets<T>(executor::host, seed, segment_offsets, elements);
+  cached_input("power_law_segment_offsets", seed, params_hash_t{}.add(elements), segment_offsets, [&] {
+    generator_t{}.power_law_segment_offsets<T>(executor::host, seed, segment_offsets, elements);
+  });
 }
 
 template <typename T>
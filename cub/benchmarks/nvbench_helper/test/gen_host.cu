@@ -0,0 +1,166 @@
+/******************************************************************************
+ * Copyright (c) 2024, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the NVIDIA CORPORATION nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NVIDIA CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+
+#include <thrust/host_vector.h>
+
+#include <cuda/std/span>
+
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+#include <nvbench_helper.cuh>
+#include <unistd.h>
+
+using types = nvbench::type_list<bool,
+                                 int8_t,
+                                 int32_t,
+                                 int64_t,
+                                 float,
+                                 double,
+                                 complex>;
+
+namespace
+{
+
+template <class T>
+cuda::std::span<T> as_span(thrust::host_vector<T> &vec)
+{
+  return cuda::std::span<T>(thrust::raw_pointer_cast(vec.data()), vec.size());
+}
+
+template <class T>
+thrust::host_vector<T> gen_host(std::size_t elements, bit_entropy entropy, const char *threads)
+{
+  setenv("NVBENCH_HELPER_THREADS", threads, 1);
+
+  thrust::host_vector<T> vec(elements);
+  detail::gen_host(seed_t{}, as_span(vec), entropy, T{}, static_cast<T>(100));
+
+  unsetenv("NVBENCH_HELPER_THREADS");
+  return vec;
+}
+
+struct cache_dir_t
+{
+  std::filesystem::path path = std::filesystem::temp_directory_path() /
+                               ("nvbench_helper_cache." + std::to_string(getpid()));
+
+  cache_dir_t()
+  {
+    std::filesystem::create_directories(path);
+    setenv("NVBENCH_HELPER_CACHE_DIR", path.c_str(), 1);
+  }
+
+  ~cache_dir_t()
+  {
+    unsetenv("NVBENCH_HELPER_CACHE_DIR");
+    std::filesystem::remove_all(path);
+  }
+
+  std::vector<std::filesystem::path> files() const
+  {
+    std::vector<std::filesystem::path> result;
+    for (const auto &entry : std::filesystem::directory_iterator(path))
+    {
+      result.push_back(entry.path());
+    }
+    return result;
+  }
+};
+
+} // namespace
+
+TEMPLATE_LIST_TEST_CASE("Host generators don't depend on the number of threads", "[gen]", types)
+{
+  const std::size_t elements = 1 << 20;
+  const bit_entropy entropy  = GENERATE(bit_entropy::_1_000, bit_entropy::_0_544);
+
+  const thrust::host_vector<TestType> vec_1 = gen_host<TestType>(elements, entropy, "1");
+  const thrust::host_vector<TestType> vec_2 = gen_host<TestType>(elements, entropy, "7");
+
+  REQUIRE(vec_1 == vec_2);
+}
+
+TEST_CASE("Host segment generators don't depend on the number of threads", "[gen]")
+{
+  const std::size_t elements = 1 << 20;
+  thrust::host_vector<std::uint32_t> keys[2]{thrust::host_vector<std::uint32_t>(elements),
+                                             thrust::host_vector<std::uint32_t>(elements)};
+  thrust::host_vector<std::uint32_t> offsets[2]{thrust::host_vector<std::uint32_t>(1 << 17),
+                                                thrust::host_vector<std::uint32_t>(1 << 17)};
+
+  const char *threads[2] = {"1", "7"};
+  for (int i = 0; i < 2; i++)
+  {
+    setenv("NVBENCH_HELPER_THREADS", threads[i], 1);
+    detail::gen_uniform_key_segments_host(seed_t{}, as_span(keys[i]), 1, 1000);
+    detail::gen_power_law_segment_offsets_host(seed_t{}, as_span(offsets[i]), elements);
+    unsetenv("NVBENCH_HELPER_THREADS");
+  }
+
+  REQUIRE(keys[0] == keys[1]);
+  REQUIRE(offsets[0] == offsets[1]);
+}
+
+TEST_CASE("Host generators reuse cached inputs", "[gen]")
+{
+  cache_dir_t cache_dir;
+
+  const std::size_t elements = 1 << 16;
+  thrust::host_vector<int> vec_1(elements);
+  thrust::host_vector<int> vec_2(elements);
+
+  detail::gen_host(seed_t{}, as_span(vec_1), bit_entropy::_0_811, 0, 1000);
+  REQUIRE(cache_dir.files().size() == 1);
+
+  detail::gen_host(seed_t{}, as_span(vec_2), bit_entropy::_0_811, 0, 1000);
+  REQUIRE(vec_1 == vec_2);
+
+  // Inputs with other parameters are cached separately
+  detail::gen_host(seed_t{}, as_span(vec_2), bit_entropy::_0_811, 0, 10);
+  detail::gen_host(seed_t{}, as_span(vec_2), bit_entropy::_0_544, 0, 1000);
+  detail::gen_host(seed_t{42 + 1}, as_span(vec_2), bit_entropy::_0_811, 0, 1000);
+  REQUIRE(cache_dir.files().size() == 4);
+
+  // A cached input is read instead of generated
+  for (const auto &file : cache_dir.files())
+  {
+    std::FILE *stream = std::fopen(file.c_str(), "r+b");
+    REQUIRE(stream != nullptr);
+    const std::vector<char> zeros(elements * sizeof(int));
+    std::fwrite(zeros.data(), 1, zeros.size(), stream);
+    std::fclose(stream);
+  }
+
+  detail::gen_host(seed_t{}, as_span(vec_2), bit_entropy::_0_811, 0, 1000);
+  REQUIRE(vec_2 == thrust::host_vector<int>(elements, 0));
+}
@@ -109,6 +109,7 @@
 
 // Util
 #include <cub/util_allocator.cuh>
+#include <cub/util_caching_allocator.cuh>
 #include <cub/util_debug.cuh>
 #include <cub/util_device.cuh>
 #include <cub/util_ptx.cuh>
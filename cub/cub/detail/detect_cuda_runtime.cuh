@@ -44,10 +44,32 @@
 #  pragma system_header
 #endif // no system header
 
-#include <cuda_runtime_api.h>
+// Without the CUDA toolkit, CUB falls back to its host backend: the
+// device-wide algorithms run on CPU threads and CUB provides the subset of the
+// CUDA runtime API they need.
+#if !defined(CUB_HOST_BACKEND) && !defined(__CUDACC__) && !defined(_NVHPC_CUDA) && defined(__has_include)
+#  if !__has_include(<cuda_runtime_api.h>)
+#    define CUB_HOST_BACKEND
+#  endif
+#endif
+
+#ifdef CUB_HOST_BACKEND
+#  include <cub/detail/host_runtime_api.cuh>
+#else
+#  include <cuda_runtime_api.h>
+#endif
 
 #ifdef DOXYGEN_SHOULD_SKIP_THIS // Only parse this during doxygen passes:
 
+/**
+ * \def CUB_HOST_BACKEND
+ *
+ * If defined, the device-wide algorithms of CUB run on CPU threads of the
+ * calling process. Defined automatically when the CUDA runtime headers are
+ * not available.
+ */
+#define CUB_HOST_BACKEND
+
 /**
  * \def CUB_DISABLE_CDP
  *
@@ -30,8 +30,6 @@
 
 #include <nv/target>
 
-#include <cuda_runtime_api.h>
-
 CUB_NAMESPACE_BEGIN
 
 namespace detail
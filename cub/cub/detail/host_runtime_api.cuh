@@ -0,0 +1,243 @@
+/******************************************************************************
+ * Copyright (c) 2024, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the NVIDIA CORPORATION nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL NVIDIA CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+
+/**
+ * @file
+ * The subset of the CUDA runtime API used by the host backend of CUB, for
+ * builds without the CUDA toolkit. "Device" memory is host memory and every
+ * operation completes before it returns, so streams carry no state.
+ */
+
+#pragma once
+
+// We cannot use `cub/config.cuh` here due to circular dependencies
+#include <cuda/__cccl_config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if defined(__has_include)
+#  if __has_include(<cuda_runtime_api.h>)
+#    define CUB_DETAIL_HAS_CUDA_RUNTIME_API
+#  endif
+#endif
+
+#ifdef CUB_DETAIL_HAS_CUDA_RUNTIME_API
+
+// The host backend was requested explicitly, the toolkit provides the API
+#include <cuda_runtime_api.h>
+
+#else // CUB_DETAIL_HAS_CUDA_RUNTIME_API
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+
+// The values match the CUDA runtime
+enum cudaError
+{
+  cudaSuccess                 = 0,
+  cudaErrorInvalidValue       = 1,
+  cudaErrorMemoryAllocation   = 2,
+  cudaErrorInvalidDevice      = 101,
+  cudaErrorInvalidDevicePointer = 17,
+  cudaErrorInvalidMemcpyDirection = 21,
+  cudaErrorNotSupported       = 801,
+  cudaErrorUnknown            = 999
+};
+typedef enum cudaError cudaError_t;
+
+enum cudaMemcpyKind
+{
+  cudaMemcpyHostToHost     = 0,
+  cudaMemcpyHostToDevice   = 1,
+  cudaMemcpyDeviceToHost   = 2,
+  cudaMemcpyDeviceToDevice = 3,
+  cudaMemcpyDefault        = 4
+};
+
+typedef struct CUstream_st *cudaStream_t;
+
+#ifndef __align__
+#  if defined(_MSC_VER)
+#    define __align__(n) __declspec(align(n))
+#  else
+#    define __align__(n) __attribute__((aligned(n)))
+#  endif
+#endif
+
+// The vector types, with the alignment they have in CUDA
+#define CUB_DETAIL_HOST_VECTOR_TYPE(name, base, align1, align2, align3, align4) \
+  struct __align__(align1) name##1                                             \
+  {                                                                            \
+    base x;                                                                    \
+  };                                                                           \
+  struct __align__(align2) name##2                                             \
+  {                                                                            \
+    base x, y;                                                                 \
+  };                                                                           \
+  struct __align__(align3) name##3                                             \
+  {                                                                            \
+    base x, y, z;                                                              \
+  };                                                                           \
+  struct __align__(align4) name##4                                             \
+  {                                                                            \
+    base x, y, z, w;                                                           \
+  }
+
+CUB_DETAIL_HOST_VECTOR_TYPE(char, signed char, 1, 2, 1, 4);
+CUB_DETAIL_HOST_VECTOR_TYPE(uchar, unsigned char, 1, 2, 1, 4);
+CUB_DETAIL_HOST_VECTOR_TYPE(short, short, 2, 4, 2, 8);
+CUB_DETAIL_HOST_VECTOR_TYPE(ushort, unsigned short, 2, 4, 2, 8);
+CUB_DETAIL_HOST_VECTOR_TYPE(int, int, 4, 8, 4, 16);
+CUB_DETAIL_HOST_VECTOR_TYPE(uint, unsigned int, 4, 8, 4, 16);
+CUB_DETAIL_HOST_VECTOR_TYPE(long, long, sizeof(long), 2 * sizeof(long), sizeof(long), 16);
+CUB_DETAIL_HOST_VECTOR_TYPE(ulong, unsigned long, sizeof(long), 2 * sizeof(long), sizeof(long), 16);
+CUB_DETAIL_HOST_VECTOR_TYPE(longlong, long long, 8, 16, 8, 16);
+CUB_DETAIL_HOST_VECTOR_TYPE(ulonglong, unsigned long long, 8, 16, 8, 16);
+CUB_DETAIL_HOST_VECTOR_TYPE(float, float, 4, 8, 4, 16);
+CUB_DETAIL_HOST_VECTOR_TYPE(double, double, 8, 16, 8, 16);
+
+#undef CUB_DETAIL_HOST_VECTOR_TYPE
+
+inline cudaError_t cudaGetLastError()
+{
+  return cudaSuccess;
+}
+
+inline cudaError_t cudaPeekAtLastError()
+{
+  return cudaSuccess;
+}
+
+inline const char *cudaGetErrorString(cudaError_t error)
+{
+  switch (error)
+  {
+    case cudaSuccess:
+      return "no error";
+    case cudaErrorInvalidValue:
+      return "invalid argument";
+    case cudaErrorMemoryAllocation:
+      return "out of memory";
+    case cudaErrorInvalidDevice:
+      return "invalid device ordinal";
+    case cudaErrorInvalidDevicePointer:
+      return "invalid device pointer";
+    case cudaErrorInvalidMemcpyDirection:
+      return "invalid copy direction for memcpy";
+    case cudaErrorNotSupported:
+      return "operation not supported";
+    default:
+      return "unknown error";
+  }
+}
+
+inline cudaError_t cudaGetDevice(int *device)
+{
+  *device = 0;
+  return cudaSuccess;
+}
+
+inline cudaError_t cudaSetDevice(int device)
+{
+  return device == 0 ? cudaSuccess : cudaErrorInvalidDevice;
+}
+
+inline cudaError_t cudaGetDeviceCount(int *count)
+{
+  *count = 1;
+  return cudaSuccess;
+}
+
+inline cudaError_t cudaDeviceSynchronize()
+{
+  return cudaSuccess;
+}
+
+inline cudaError_t cudaStreamSynchronize(cudaStream_t)
+{
+  return cudaSuccess;
+}
+
+inline cudaError_t cudaMalloc(void **ptr, std::size_t size)
+{
+  *ptr = std::malloc(size);
+  return (*ptr != nullptr || size == 0) ? cudaSuccess : cudaErrorMemoryAllocation;
+}
+
+template <class T>
+inline cudaError_t cudaMalloc(T **ptr, std::size_t size)
+{
+  return ::cudaMalloc(reinterpret_cast<void **>(ptr), size);
+}
+
+inline cudaError_t cudaFree(void *ptr)
+{
+  std::free(ptr);
+  return cudaSuccess;
+}
+
+inline cudaError_t cudaMemcpy(void *dst, const void *src, std::size_t count, cudaMemcpyKind kind)
+{
+  if (kind < cudaMemcpyHostToHost || kind > cudaMemcpyDefault)
+  {
+    return cudaErrorInvalidMemcpyDirection;
+  }
+  if (count > 0)
+  {
+    std::memmove(dst, src, count);
+  }
+  return cudaSuccess;
+}
+
+inline cudaError_t
+cudaMemcpyAsync(void *dst, const void *src, std::size_t count, cudaMemcpyKind kind, cudaStream_t = nullptr)
+{
+  return ::cudaMemcpy(dst, src, count, kind);
+}
+
+inline cudaError_t cudaMemset(void *ptr, int value, std::size_t count)
+{
+  if (count > 0)
+  {
+    std::memset(ptr, value, count);
+  }
+  return cudaSuccess;
+}
+
+inline cudaError_t cudaMemsetAsync(void *ptr, int value, std::size_t count, cudaStream_t = nullptr)
+{
+  return ::cudaMemset(ptr, value, count);
+}
+
+#endif // CUB_DETAIL_HAS_CUDA_RUNTIME_API
@@ -42,6 +42,10 @@
 #  pragma system_header
 #endif // no system header
 
+#ifdef CUB_HOST_BACKEND
+#  include <cub/device/host/device_histogram.cuh>
+#else // CUB_HOST_BACKEND
+
 #include <stdio.h>
 #include <iterator>
 #include <limits>
@@ -1666,4 +1670,4 @@ struct DeviceHistogram
 
 CUB_NAMESPACE_END
 
-
+#endif // CUB_HOST_BACKEND
@@ -42,6 +42,10 @@
 #  pragma system_header
 #endif // no system header
 
+#ifdef CUB_HOST_BACKEND
+#  include <cub/device/host/device_radix_sort.cuh>
+#else // CUB_HOST_BACKEND
+
 #include <cub/detail/choose_offset.cuh>
 #include <cub/device/dispatch/dispatch_radix_sort.cuh>
 #include <cub/util_deprecated.cuh>
@@ -3645,3 +3649,5 @@ public:
 };
 
 CUB_NAMESPACE_END
+
+#endif // CUB_HOST_BACKEND
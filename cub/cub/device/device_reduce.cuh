@@ -42,6 +42,10 @@
 #  pragma system_header
 #endif // no system header
 
+#ifdef CUB_HOST_BACKEND
+#  include <cub/device/host/device_reduce.cuh>
+#else // CUB_HOST_BACKEND
+
 #include <iterator>
 #include <limits>
 
@@ -1296,3 +1300,5 @@ struct DeviceReduce
 };
 
 CUB_NAMESPACE_END
+
+#endif // CUB_HOST_BACKEND
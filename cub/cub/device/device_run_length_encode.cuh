@@ -42,6 +42,10 @@
 #  pragma system_header
 #endif // no system header
 
+#ifdef CUB_HOST_BACKEND
+#  include <cub/device/host/device_run_length_encode.cuh>
+#else // CUB_HOST_BACKEND
+
 #include <cub/device/dispatch/dispatch_reduce_by_key.cuh>
 #include <cub/device/dispatch/dispatch_rle.cuh>
 #include <cub/device/dispatch/tuning/tuning_run_length_encode.cuh>
@@ -420,3 +424,5 @@ struct DeviceRunLengthEncode
 };
 
 CUB_NAMESPACE_END
+
+#endif // CUB_HOST_BACKEND
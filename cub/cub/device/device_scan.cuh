@@ -41,6 +41,10 @@
 #  pragma system_header
 #endif // no system header
 
+#ifdef CUB_HOST_BACKEND
+#  include <cub/device/host/device_scan.cuh>
+#else // CUB_HOST_BACKEND
+
 #include <cub/device/dispatch/dispatch_scan.cuh>
 #include <cub/device/dispatch/dispatch_scan_by_key.cuh>
 #include <cub/thread/thread_operators.cuh>
@@ -2167,4 +2171,4 @@ struct DeviceScan
 
 CUB_NAMESPACE_END
 
-
+#endif // CUB_HOST_BACKEND
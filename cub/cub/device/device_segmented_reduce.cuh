@@ -42,6 +42,10 @@
 #  pragma system_header
 #endif // no system header
 
+#ifdef CUB_HOST_BACKEND
+#  include <cub/device/host/device_segmented_reduce.cuh>
+#else // CUB_HOST_BACKEND
+
 #include <cub/detail/choose_offset.cuh>
 #include <cub/device/dispatch/dispatch_reduce.cuh>
 #include <cub/device/dispatch/dispatch_reduce_by_key.cuh>
@@ -1180,3 +1184,5 @@ struct DeviceSegmentedReduce
 };
 
 CUB_NAMESPACE_END
+
+#endif // CUB_HOST_BACKEND
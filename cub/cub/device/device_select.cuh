@@ -42,6 +42,10 @@
 #  pragma system_header
 #endif // no system header
 
+#ifdef CUB_HOST_BACKEND
+#  include <cub/device/host/device_select.cuh>
+#else // CUB_HOST_BACKEND
+
 #include <iterator>
 #include <stdio.h>
 
@@ -1017,3 +1021,5 @@ struct DeviceSelect
 };
 
 CUB_NAMESPACE_END
+
+#endif // CUB_HOST_BACKEND
@@ -0,0 +1,586 @@
+/******************************************************************************
+ * Copyright (c) 2024, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the NVIDIA CORPORATION nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL NVIDIA CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+
+//! @file cub::DeviceHistogram on the host backend, see
+//!       cub/device/device_histogram.cuh.
+
+#pragma once
+
+#include <cub/config.cuh>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cub/device/host/host_parallel.cuh>
+#include <cub/util_type.cuh>
+
+#include <cuda/std/limits>
+#include <cuda/std/type_traits>
+
+#include <algorithm>
+#include <cstring>
+
+CUB_NAMESPACE_BEGIN
+
+namespace detail
+{
+namespace host
+{
+
+/// Maps samples to the bins of evenly-spaced levels, matching the CUDA backend
+template <typename LevelT, typename SampleT>
+struct even_bins
+{
+  using CommonT = typename ::cuda::std::common_type<LevelT, SampleT>::type;
+
+  CommonT max_level;
+  CommonT min_level;
+  int num_bins;
+
+  cudaError_t Init(int num_levels, LevelT upper_level, LevelT lower_level)
+  {
+    max_level = static_cast<CommonT>(upper_level);
+    min_level = static_cast<CommonT>(lower_level);
+    num_bins  = num_levels - 1;
+
+    // Check whether accurate bin computation for an integral sample type may overflow
+    return MayOverflow(::cuda::std::is_integral<CommonT>{}) ? cudaErrorInvalidValue : cudaSuccess;
+  }
+
+  int operator()(SampleT sample) const
+  {
+    const CommonT common_sample = static_cast<CommonT>(sample);
+    if (!(common_sample >= min_level && common_sample < max_level))
+    {
+      return -1;
+    }
+    return ComputeBin(common_sample, ::cuda::std::is_integral<CommonT>{}, ::cuda::std::is_floating_point<CommonT>{});
+  }
+
+private:
+  bool MayOverflow(::cuda::std::false_type /* is_integral */) const
+  {
+    return false;
+  }
+
+  bool MayOverflow(::cuda::std::true_type /* is_integral */) const
+  {
+    return num_bins > 0
+        && static_cast<unsigned long long>(max_level - min_level)
+             > (::cuda::std::numeric_limits<unsigned long long>::max() / static_cast<unsigned long long>(num_bins));
+  }
+
+  int ComputeBin(CommonT sample, ::cuda::std::true_type /* is_integral */, ::cuda::std::false_type) const
+  {
+    return static_cast<int>(static_cast<unsigned long long>(sample - min_level) * static_cast<unsigned long long>(num_bins)
+                            / static_cast<unsigned long long>(max_level - min_level));
+  }
+
+  int ComputeBin(CommonT sample, ::cuda::std::false_type, ::cuda::std::true_type /* is_fp */) const
+  {
+    const CommonT reciprocal = static_cast<CommonT>(static_cast<CommonT>(num_bins) / (max_level - min_level));
+    return static_cast<int>((sample - min_level) * reciprocal);
+  }
+
+  int ComputeBin(CommonT sample, ::cuda::std::false_type, ::cuda::std::false_type) const
+  {
+    return static_cast<int>(((sample - min_level) * static_cast<CommonT>(num_bins)) / (max_level - min_level));
+  }
+};
+
+/// Maps samples to the bins between custom levels
+template <typename LevelT, typename SampleT>
+struct range_bins
+{
+  const LevelT *d_levels;
+  int num_levels;
+
+  cudaError_t Init(const LevelT *d_levels_, int num_levels_)
+  {
+    d_levels   = d_levels_;
+    num_levels = num_levels_;
+    return cudaSuccess;
+  }
+
+  int operator()(SampleT sample) const
+  {
+    const int bin = static_cast<int>(std::upper_bound(d_levels, d_levels + num_levels, static_cast<LevelT>(sample)) - d_levels) - 1;
+    return bin < num_levels - 1 ? bin : -1;
+  }
+};
+
+/**
+ * @brief Counts the samples of every active channel of the pixels in
+ * `num_rows` rows of `num_row_pixels` pixels into `d_histogram`.
+ *
+ * Each worker counts the pixels of its chunk into a privatized histogram, the
+ * histograms are summed up afterwards. For single-byte samples, the bin of
+ * every possible sample value is computed upfront.
+ */
+template <int NUM_CHANNELS,
+          int NUM_ACTIVE_CHANNELS,
+          typename SampleIteratorT,
+          typename CounterT,
+          typename OffsetT,
+          typename BinOpT>
+cudaError_t histogram(void *d_temp_storage,
+                      size_t &temp_storage_bytes,
+                      SampleIteratorT d_samples,
+                      CounterT *d_histogram[NUM_ACTIVE_CHANNELS],
+                      const int num_levels[NUM_ACTIVE_CHANNELS],
+                      const BinOpT bin_op[NUM_ACTIVE_CHANNELS],
+                      OffsetT num_row_pixels,
+                      OffsetT num_rows,
+                      OffsetT row_stride_samples)
+{
+  using SampleT = cub::detail::value_t<SampleIteratorT>;
+
+  constexpr bool is_byte_sample = sizeof(SampleT) == 1;
+  constexpr int num_byte_values = 256;
+
+  cudaError error = cudaSuccess;
+  do
+  {
+    int channel_offsets[NUM_ACTIVE_CHANNELS + 1] = {};
+    for (int channel = 0; channel < NUM_ACTIVE_CHANNELS; ++channel)
+    {
+      channel_offsets[channel + 1] = channel_offsets[channel] + (std::max)(0, num_levels[channel] - 1);
+    }
+    const int total_bins = channel_offsets[NUM_ACTIVE_CHANNELS];
+
+    const std::size_t num_pixels =
+      (num_row_pixels > OffsetT(0) && num_rows > OffsetT(0))
+        ? static_cast<std::size_t>(num_row_pixels) * static_cast<std::size_t>(num_rows)
+        : 0;
+
+    // Privatized histograms only pay off while they are smaller than the input
+    int workers = num_workers(num_pixels);
+    if (total_bins > 0)
+    {
+      workers = static_cast<int>((std::max)(
+        std::size_t{1}, (std::min)(static_cast<std::size_t>(workers), num_pixels / total_bins)));
+    }
+
+    void *allocations[2]       = {};
+    size_t allocation_sizes[2] = {
+      workers > 1 ? workers * total_bins * sizeof(CounterT) : 0,
+      is_byte_sample ? NUM_ACTIVE_CHANNELS * num_byte_values * sizeof(int) : 0};
+
+    error = CubDebug(AliasTemporaries(d_temp_storage, temp_storage_bytes, allocations, allocation_sizes));
+    if (cudaSuccess != error || d_temp_storage == nullptr)
+    {
+      break;
+    }
+
+    for (int channel = 0; channel < NUM_ACTIVE_CHANNELS; ++channel)
+    {
+      std::fill(d_histogram[channel], d_histogram[channel] + (channel_offsets[channel + 1] - channel_offsets[channel]), CounterT{});
+    }
+
+    if (num_pixels == 0 || total_bins == 0)
+    {
+      break;
+    }
+
+    int *byte_bins = static_cast<int *>(allocations[1]);
+    if (is_byte_sample)
+    {
+      for (int channel = 0; channel < NUM_ACTIVE_CHANNELS; ++channel)
+      {
+        for (int value = 0; value < num_byte_values; ++value)
+        {
+          unsigned char byte = static_cast<unsigned char>(value);
+          SampleT sample;
+          std::memcpy(&sample, &byte, 1);
+          byte_bins[channel * num_byte_values + value] = bin_op[channel](sample);
+        }
+      }
+    }
+
+    CounterT *privatized = static_cast<CounterT *>(allocations[0]);
+    if (workers > 1)
+    {
+      std::fill(privatized, privatized + workers * total_bins, CounterT{});
+    }
+
+    parallel_chunks(workers, num_pixels, [&](std::size_t begin, std::size_t end, int worker) {
+      CounterT *histograms[NUM_ACTIVE_CHANNELS];
+      for (int channel = 0; channel < NUM_ACTIVE_CHANNELS; ++channel)
+      {
+        histograms[channel] =
+          workers > 1 ? privatized + worker * total_bins + channel_offsets[channel] : d_histogram[channel];
+      }
+
+      std::size_t row = begin / static_cast<std::size_t>(num_row_pixels);
+      std::size_t col = begin % static_cast<std::size_t>(num_row_pixels);
+
+      for (std::size_t pixel = begin; pixel < end; ++pixel)
+      {
+        const std::size_t offset = row * static_cast<std::size_t>(row_stride_samples) + col * NUM_CHANNELS;
+
+        for (int channel = 0; channel < NUM_ACTIVE_CHANNELS; ++channel)
+        {
+          const SampleT sample = d_samples[offset + channel];
+
+          int bin;
+          if (is_byte_sample)
+          {
+            unsigned char byte;
+            std::memcpy(&byte, &sample, 1);
+            bin = byte_bins[channel * num_byte_values + byte];
+          }
+          else
+          {
+            bin = bin_op[channel](sample);
+          }
+
+          if (bin >= 0 && bin < channel_offsets[channel + 1] - channel_offsets[channel])
+          {
+            ++histograms[channel][bin];
+          }
+        }
+
+        if (++col == static_cast<std::size_t>(num_row_pixels))
+        {
+          col = 0;
+          ++row;
+        }
+      }
+    });
+
+    if (workers > 1)
+    {
+      parallel_chunks(num_workers(total_bins), total_bins, [&](int begin, int end, int /* worker */) {
+        int channel = 0;
+        for (int bin = begin; bin < end; ++bin)
+        {
+          while (bin >= channel_offsets[channel + 1])
+          {
+            ++channel;
+          }
+
+          CounterT count{};
+          for (int worker = 0; worker < workers; ++worker)
+          {
+            count += privatized[worker * total_bins + bin];
+          }
+          d_histogram[channel][bin - channel_offsets[channel]] = count;
+        }
+      });
+    }
+  } while (0);
+
+  return error;
+}
+
+} // namespace host
+} // namespace detail
+
+//! @rst
+//! DeviceHistogram provides device-wide parallel operations for constructing
+//! histogram(s) from a sequence of samples. On the host backend, the samples
+//! reside in host memory and are counted by CPU threads before the call
+//! returns; ``stream`` is ignored.
+//!
+//! The interface and the semantics match the CUDA backend, with the
+//! exception of the overloads deprecated with ``debug_synchronous``.
+//! @endrst
+struct DeviceHistogram
+{
+  //! @brief Computes an intensity histogram from a sequence of data samples
+  //!        using equal-width bins.
+  template <typename SampleIteratorT, typename CounterT, typename LevelT, typename OffsetT>
+  CUB_RUNTIME_FUNCTION static cudaError_t HistogramEven(void *d_temp_storage,
+                                                        size_t &temp_storage_bytes,
+                                                        SampleIteratorT d_samples,
+                                                        CounterT *d_histogram,
+                                                        int num_levels,
+                                                        LevelT lower_level,
+                                                        LevelT upper_level,
+                                                        OffsetT num_samples,
+                                                        cudaStream_t stream = 0)
+  {
+    /// The sample value type of the input iterator
+    using SampleT = cub::detail::value_t<SampleIteratorT>;
+    return MultiHistogramEven<1, 1>(d_temp_storage,
+                                    temp_storage_bytes,
+                                    d_samples,
+                                    &d_histogram,
+                                    &num_levels,
+                                    &lower_level,
+                                    &upper_level,
+                                    num_samples,
+                                    static_cast<OffsetT>(1),
+                                    sizeof(SampleT) * num_samples,
+                                    stream);
+  }
+
+  //! @brief Computes an intensity histogram from a sequence of data samples
+  //!        using equal-width bins, from a 2D region of interest.
+  template <typename SampleIteratorT, typename CounterT, typename LevelT, typename OffsetT>
+  CUB_RUNTIME_FUNCTION static cudaError_t HistogramEven(void *d_temp_storage,
+                                                        size_t &temp_storage_bytes,
+                                                        SampleIteratorT d_samples,
+                                                        CounterT *d_histogram,
+                                                        int num_levels,
+                                                        LevelT lower_level,
+                                                        LevelT upper_level,
+                                                        OffsetT num_row_samples,
+                                                        OffsetT num_rows,
+                                                        size_t row_stride_bytes,
+                                                        cudaStream_t stream = 0)
+  {
+    return MultiHistogramEven<1, 1>(d_temp_storage,
+                                    temp_storage_bytes,
+                                    d_samples,
+                                    &d_histogram,
+                                    &num_levels,
+                                    &lower_level,
+                                    &upper_level,
+                                    num_row_samples,
+                                    num_rows,
+                                    row_stride_bytes,
+                                    stream);
+  }
+
+  //! @brief Computes per-channel intensity histograms from a sequence of
+  //!        multi-channel "pixel" data samples using equal-width bins.
+  template <int NUM_CHANNELS,
+            int NUM_ACTIVE_CHANNELS,
+            typename SampleIteratorT,
+            typename CounterT,
+            typename LevelT,
+            typename OffsetT>
+  CUB_RUNTIME_FUNCTION static cudaError_t MultiHistogramEven(void *d_temp_storage,
+                                                             size_t &temp_storage_bytes,
+                                                             SampleIteratorT d_samples,
+                                                             CounterT *d_histogram[NUM_ACTIVE_CHANNELS],
+                                                             int num_levels[NUM_ACTIVE_CHANNELS],
+                                                             LevelT lower_level[NUM_ACTIVE_CHANNELS],
+                                                             LevelT upper_level[NUM_ACTIVE_CHANNELS],
+                                                             OffsetT num_pixels,
+                                                             cudaStream_t stream = 0)
+  {
+    /// The sample value type of the input iterator
+    using SampleT = cub::detail::value_t<SampleIteratorT>;
+
+    return MultiHistogramEven<NUM_CHANNELS, NUM_ACTIVE_CHANNELS>(
+      d_temp_storage,
+      temp_storage_bytes,
+      d_samples,
+      d_histogram,
+      num_levels,
+      lower_level,
+      upper_level,
+      num_pixels,
+      static_cast<OffsetT>(1),
+      sizeof(SampleT) * NUM_CHANNELS * num_pixels,
+      stream);
+  }
+
+  //! @brief Computes per-channel intensity histograms from a sequence of
+  //!        multi-channel "pixel" data samples using equal-width bins, from a
+  //!        2D region of interest.
+  template <int NUM_CHANNELS,
+            int NUM_ACTIVE_CHANNELS,
+            typename SampleIteratorT,
+            typename CounterT,
+            typename LevelT,
+            typename OffsetT>
+  CUB_RUNTIME_FUNCTION static cudaError_t MultiHistogramEven(void *d_temp_storage,
+                                                             size_t &temp_storage_bytes,
+                                                             SampleIteratorT d_samples,
+                                                             CounterT *d_histogram[NUM_ACTIVE_CHANNELS],
+                                                             int num_levels[NUM_ACTIVE_CHANNELS],
+                                                             LevelT lower_level[NUM_ACTIVE_CHANNELS],
+                                                             LevelT upper_level[NUM_ACTIVE_CHANNELS],
+                                                             OffsetT num_row_pixels,
+                                                             OffsetT num_rows,
+                                                             size_t row_stride_bytes,
+                                                             cudaStream_t /* stream */ = 0)
+  {
+    /// The sample value type of the input iterator
+    using SampleT = cub::detail::value_t<SampleIteratorT>;
+
+    detail::host::even_bins<LevelT, SampleT> bin_op[NUM_ACTIVE_CHANNELS];
+    for (int channel = 0; channel < NUM_ACTIVE_CHANNELS; ++channel)
+    {
+      const cudaError_t error =
+        CubDebug(bin_op[channel].Init(num_levels[channel], upper_level[channel], lower_level[channel]));
+      if (cudaSuccess != error)
+      {
+        return error;
+      }
+    }
+
+    return detail::host::histogram<NUM_CHANNELS, NUM_ACTIVE_CHANNELS>(
+      d_temp_storage,
+      temp_storage_bytes,
+      d_samples,
+      d_histogram,
+      num_levels,
+      bin_op,
+      num_row_pixels,
+      num_rows,
+      static_cast<OffsetT>(row_stride_bytes / sizeof(SampleT)));
+  }
+
+  //! @brief Computes an intensity histogram from a sequence of data samples
+  //!        using the specified bin boundary levels.
+  template <typename SampleIteratorT, typename CounterT, typename LevelT, typename OffsetT>
+  CUB_RUNTIME_FUNCTION static cudaError_t HistogramRange(void *d_temp_storage,
+                                                         size_t &temp_storage_bytes,
+                                                         SampleIteratorT d_samples,
+                                                         CounterT *d_histogram,
+                                                         int num_levels,
+                                                         LevelT *d_levels,
+                                                         OffsetT num_samples,
+                                                         cudaStream_t stream = 0)
+  {
+    /// The sample value type of the input iterator
+    using SampleT = cub::detail::value_t<SampleIteratorT>;
+    return MultiHistogramRange<1, 1>(d_temp_storage,
+                                     temp_storage_bytes,
+                                     d_samples,
+                                     &d_histogram,
+                                     &num_levels,
+                                     &d_levels,
+                                     num_samples,
+                                     (OffsetT)1,
+                                     (size_t)(sizeof(SampleT) * num_samples),
+                                     stream);
+  }
+
+  //! @brief Computes an intensity histogram from a sequence of data samples
+  //!        using the specified bin boundary levels, from a 2D region of
+  //!        interest.
+  template <typename SampleIteratorT, typename CounterT, typename LevelT, typename OffsetT>
+  CUB_RUNTIME_FUNCTION static cudaError_t HistogramRange(void *d_temp_storage,
+                                                         size_t &temp_storage_bytes,
+                                                         SampleIteratorT d_samples,
+                                                         CounterT *d_histogram,
+                                                         int num_levels,
+                                                         LevelT *d_levels,
+                                                         OffsetT num_row_samples,
+                                                         OffsetT num_rows,
+                                                         size_t row_stride_bytes,
+                                                         cudaStream_t stream = 0)
+  {
+    return MultiHistogramRange<1, 1>(d_temp_storage,
+                                     temp_storage_bytes,
+                                     d_samples,
+                                     &d_histogram,
+                                     &num_levels,
+                                     &d_levels,
+                                     num_row_samples,
+                                     num_rows,
+                                     row_stride_bytes,
+                                     stream);
+  }
+
+  //! @brief Computes per-channel intensity histograms from a sequence of
+  //!        multi-channel "pixel" data samples using the specified bin
+  //!        boundary levels.
+  template <int NUM_CHANNELS,
+            int NUM_ACTIVE_CHANNELS,
+            typename SampleIteratorT,
+            typename CounterT,
+            typename LevelT,
+            typename OffsetT>
+  CUB_RUNTIME_FUNCTION static cudaError_t MultiHistogramRange(void *d_temp_storage,
+                                                              size_t &temp_storage_bytes,
+                                                              SampleIteratorT d_samples,
+                                                              CounterT *d_histogram[NUM_ACTIVE_CHANNELS],
+                                                              int num_levels[NUM_ACTIVE_CHANNELS],
+                                                              LevelT *d_levels[NUM_ACTIVE_CHANNELS],
+                                                              OffsetT num_pixels,
+                                                              cudaStream_t stream = 0)
+  {
+    /// The sample value type of the input iterator
+    using SampleT = cub::detail::value_t<SampleIteratorT>;
+
+    return MultiHistogramRange<NUM_CHANNELS, NUM_ACTIVE_CHANNELS>(
+      d_temp_storage,
+      temp_storage_bytes,
+      d_samples,
+      d_histogram,
+      num_levels,
+      d_levels,
+      num_pixels,
+      (OffsetT)1,
+      (size_t)(sizeof(SampleT) * NUM_CHANNELS * num_pixels),
+      stream);
+  }
+
+  //! @brief Computes per-channel intensity histograms from a sequence of
+  //!        multi-channel "pixel" data samples using the specified bin
+  //!        boundary levels, from a 2D region of interest.
+  template <int NUM_CHANNELS,
+            int NUM_ACTIVE_CHANNELS,
+            typename SampleIteratorT,
+            typename CounterT,
+            typename LevelT,
+            typename OffsetT>
+  CUB_RUNTIME_FUNCTION static cudaError_t MultiHistogramRange(void *d_temp_storage,
+                                                              size_t &temp_storage_bytes,
+                                                              SampleIteratorT d_samples,
+                                                              CounterT *d_histogram[NUM_ACTIVE_CHANNELS],
+                                                              int num_levels[NUM_ACTIVE_CHANNELS],
+                                                              LevelT *d_levels[NUM_ACTIVE_CHANNELS],
+                                                              OffsetT num_row_pixels,
+                                                              OffsetT num_rows,
+                                                              size_t row_stride_bytes,
+                                                              cudaStream_t /* stream */ = 0)
+  {
+    /// The sample value type of the input iterator
+    using SampleT = cub::detail::value_t<SampleIteratorT>;
+
+    detail::host::range_bins<LevelT, SampleT> bin_op[NUM_ACTIVE_CHANNELS];
+    for (int channel = 0; channel < NUM_ACTIVE_CHANNELS; ++channel)
+    {
+      bin_op[channel].Init(d_levels[channel], num_levels[channel]);
+    }
+
+    return detail::host::histogram<NUM_CHANNELS, NUM_ACTIVE_CHANNELS>(
+      d_temp_storage,
+      temp_storage_bytes,
+      d_samples,
+      d_histogram,
+      num_levels,
+      bin_op,
+      num_row_pixels,
+      num_rows,
+      static_cast<OffsetT>(row_stride_bytes / sizeof(SampleT)));
+  }
+};
+
+CUB_NAMESPACE_END
@@ -0,0 +1,449 @@
+/******************************************************************************
+ * Copyright (c) 2024, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the NVIDIA CORPORATION nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL NVIDIA CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+
+//! @file cub::DeviceRadixSort on the host backend, see
+//!       cub/device/device_radix_sort.cuh.
+
+#pragma once
+
+#include <cub/config.cuh>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cub/detail/choose_offset.cuh>
+#include <cub/device/host/host_parallel.cuh>
+#include <cub/util_type.cuh>
+
+#include <cuda/std/type_traits>
+
+#include <algorithm>
+#include <cstring>
+
+CUB_NAMESPACE_BEGIN
+
+namespace detail
+{
+namespace host
+{
+
+constexpr int radix_bits   = 8;
+constexpr int radix_digits = 1 << radix_bits;
+
+/**
+ * @brief The bits of a key in the order they are sorted by: twiddled, with
+ * -0.0 mapped to +0.0, and complemented for a descending sort.
+ */
+template <typename KeyT, bool IS_DESCENDING>
+struct radix_sort_bits
+{
+  using TraitsT      = Traits<KeyT>;
+  using UnsignedBits = typename TraitsT::UnsignedBits;
+
+  static UnsignedBits Get(const KeyT &key)
+  {
+    UnsignedBits bits;
+    std::memcpy(&bits, &key, sizeof(KeyT));
+    bits = TraitsT::TwiddleIn(bits);
+
+    if (TraitsT::CATEGORY == FLOATING_POINT)
+    {
+      const UnsignedBits twiddled_minus_zero =
+        TraitsT::TwiddleIn(UnsignedBits(1) << UnsignedBits(8 * sizeof(UnsignedBits) - 1));
+      if (bits == twiddled_minus_zero)
+      {
+        bits = TraitsT::TwiddleIn(0);
+      }
+    }
+
+    return IS_DESCENDING ? UnsignedBits(~bits) : bits;
+  }
+};
+
+/**
+ * @brief Sorts `d_keys.Current()`, along with `d_values.Current()`, by the
+ * bits [begin_bit, end_bit) of the keys.
+ *
+ * A stable least-significant-digit radix sort with a pass per 8 bits. In each
+ * pass, every worker counts the digits of its chunk, then scatters its chunk
+ * to the offsets the counts give. Passes where all keys share the digit are
+ * skipped.
+ *
+ * When `is_overwrite_okay` is set, both buffers are overwritten and the
+ * selectors tell the sorted buffer. Otherwise, `d_keys.Current()` is left
+ * intact, the sorted keys are written to `d_keys.Alternate()` and the
+ * temporary storage holds the other buffer.
+ */
+template <bool IS_DESCENDING, typename KeyT, typename ValueT, typename OffsetT>
+cudaError_t radix_sort(void *d_temp_storage,
+                       size_t &temp_storage_bytes,
+                       DoubleBuffer<KeyT> &d_keys,
+                       DoubleBuffer<ValueT> &d_values,
+                       OffsetT num_items,
+                       int begin_bit,
+                       int end_bit,
+                       bool is_overwrite_okay)
+{
+  constexpr bool KEYS_ONLY = ::cuda::std::is_same<ValueT, NullType>::value;
+
+  using BitsT        = radix_sort_bits<KeyT, IS_DESCENDING>;
+  using UnsignedBits = typename BitsT::UnsignedBits;
+
+  cudaError error = cudaSuccess;
+  do
+  {
+    const int workers = num_workers(num_items);
+    const size_t alternate_items = is_overwrite_okay ? 0 : static_cast<size_t>(num_items);
+
+    void *allocations[3]       = {};
+    size_t allocation_sizes[3] = {workers * radix_digits * sizeof(OffsetT),
+                                  alternate_items * sizeof(KeyT),
+                                  KEYS_ONLY ? 0 : alternate_items * sizeof(ValueT)};
+
+    error = CubDebug(AliasTemporaries(d_temp_storage, temp_storage_bytes, allocations, allocation_sizes));
+    if (cudaSuccess != error || d_temp_storage == nullptr)
+    {
+      break;
+    }
+
+    OffsetT *offsets = static_cast<OffsetT *>(allocations[0]);
+
+    // Pass p reads the result of the previous pass and writes buffer p % 2
+    const KeyT *keys_in     = d_keys.Current();
+    const ValueT *values_in = d_values.Current();
+    KeyT *keys_out[2]       = {d_keys.Alternate(), d_keys.Current()};
+    ValueT *values_out[2]   = {d_values.Alternate(), d_values.Current()};
+    if (!is_overwrite_okay)
+    {
+      keys_out[1]   = static_cast<KeyT *>(allocations[1]);
+      values_out[1] = static_cast<ValueT *>(allocations[2]);
+    }
+
+    int num_passes = 0;
+    for (int shift = begin_bit; shift < end_bit; shift += radix_bits)
+    {
+      const UnsignedBits mask = static_cast<UnsignedBits>((1u << (std::min)(radix_bits, end_bit - shift)) - 1u);
+
+      parallel_chunks(workers, num_items, [&](OffsetT begin, OffsetT end, int worker) {
+        OffsetT *counts = offsets + worker * radix_digits;
+        std::fill(counts, counts + radix_digits, OffsetT(0));
+        for (OffsetT i = begin; i < end; ++i)
+        {
+          ++counts[(BitsT::Get(keys_in[i]) >> shift) & mask];
+        }
+      });
+
+      // Digit-major order keeps the sort stable
+      bool trivial_pass = false;
+      OffsetT running   = 0;
+      for (int digit = 0; digit < radix_digits; ++digit)
+      {
+        for (int worker = 0; worker < workers; ++worker)
+        {
+          const OffsetT count = offsets[worker * radix_digits + digit];
+          trivial_pass        = trivial_pass || count == num_items;
+          offsets[worker * radix_digits + digit] = running;
+          running += count;
+        }
+      }
+
+      if (trivial_pass)
+      {
+        continue;
+      }
+
+      KeyT *keys_dst     = keys_out[num_passes % 2];
+      ValueT *values_dst = values_out[num_passes % 2];
+
+      parallel_chunks(workers, num_items, [&](OffsetT begin, OffsetT end, int worker) {
+        OffsetT *digit_offsets = offsets + worker * radix_digits;
+        for (OffsetT i = begin; i < end; ++i)
+        {
+          const OffsetT position = digit_offsets[(BitsT::Get(keys_in[i]) >> shift) & mask]++;
+          keys_dst[position]     = keys_in[i];
+          if (!KEYS_ONLY)
+          {
+            values_dst[position] = values_in[i];
+          }
+        }
+      });
+
+      keys_in   = keys_dst;
+      values_in = values_dst;
+      ++num_passes;
+    }
+
+    if (is_overwrite_okay)
+    {
+      if (num_passes % 2 == 1)
+      {
+        d_keys.selector ^= 1;
+        d_values.selector ^= 1;
+      }
+    }
+    else if (keys_in != d_keys.Alternate())
+    {
+      // No pass or an even number of them, the result is yet to be moved
+      parallel_chunks(workers, num_items, [&](OffsetT begin, OffsetT end, int /* worker */) {
+        std::copy(keys_in + begin, keys_in + end, d_keys.Alternate() + begin);
+        if (!KEYS_ONLY)
+        {
+          std::copy(values_in + begin, values_in + end, d_values.Alternate() + begin);
+        }
+      });
+    }
+  } while (0);
+
+  return error;
+}
+
+} // namespace host
+} // namespace detail
+
+//! @rst
+//! DeviceRadixSort provides device-wide, parallel operations for computing a
+//! radix sort across a sequence of data items. On the host backend, the items
+//! reside in host memory and are sorted by CPU threads before the call
+//! returns; ``stream`` is ignored.
+//!
+//! The interface and the semantics match the CUDA backend for the keys CUB
+//! provides ``cub::Traits`` for, with the exception of the overloads
+//! deprecated with ``debug_synchronous`` and the ones taking a decomposer.
+//! @endrst
+struct DeviceRadixSort
+{
+  //! @brief Sorts key-value pairs into ascending order.
+  template <typename KeyT, typename ValueT, typename NumItemsT>
+  CUB_RUNTIME_FUNCTION static cudaError_t SortPairs(void *d_temp_storage,
+                                                    size_t &temp_storage_bytes,
+                                                    const KeyT *d_keys_in,
+                                                    KeyT *d_keys_out,
+                                                    const ValueT *d_values_in,
+                                                    ValueT *d_values_out,
+                                                    NumItemsT num_items,
+                                                    int begin_bit       = 0,
+                                                    int end_bit         = sizeof(KeyT) * 8,
+                                                    cudaStream_t stream = 0)
+  {
+    return Sort<false>(d_temp_storage,
+                       temp_storage_bytes,
+                       d_keys_in,
+                       d_keys_out,
+                       d_values_in,
+                       d_values_out,
+                       num_items,
+                       begin_bit,
+                       end_bit,
+                       stream);
+  }
+
+  //! @brief Sorts key-value pairs into ascending order using double buffers.
+  template <typename KeyT, typename ValueT, typename NumItemsT>
+  CUB_RUNTIME_FUNCTION static cudaError_t SortPairs(void *d_temp_storage,
+                                                    size_t &temp_storage_bytes,
+                                                    DoubleBuffer<KeyT> &d_keys,
+                                                    DoubleBuffer<ValueT> &d_values,
+                                                    NumItemsT num_items,
+                                                    int begin_bit       = 0,
+                                                    int end_bit         = sizeof(KeyT) * 8,
+                                                    cudaStream_t stream = 0)
+  {
+    return Sort<false>(d_temp_storage, temp_storage_bytes, d_keys, d_values, num_items, begin_bit, end_bit, stream);
+  }
+
+  //! @brief Sorts key-value pairs into descending order.
+  template <typename KeyT, typename ValueT, typename NumItemsT>
+  CUB_RUNTIME_FUNCTION static cudaError_t SortPairsDescending(void *d_temp_storage,
+                                                              size_t &temp_storage_bytes,
+                                                              const KeyT *d_keys_in,
+                                                              KeyT *d_keys_out,
+                                                              const ValueT *d_values_in,
+                                                              ValueT *d_values_out,
+                                                              NumItemsT num_items,
+                                                              int begin_bit       = 0,
+                                                              int end_bit         = sizeof(KeyT) * 8,
+                                                              cudaStream_t stream = 0)
+  {
+    return Sort<true>(d_temp_storage,
+                      temp_storage_bytes,
+                      d_keys_in,
+                      d_keys_out,
+                      d_values_in,
+                      d_values_out,
+                      num_items,
+                      begin_bit,
+                      end_bit,
+                      stream);
+  }
+
+  //! @brief Sorts key-value pairs into descending order using double buffers.
+  template <typename KeyT, typename ValueT, typename NumItemsT>
+  CUB_RUNTIME_FUNCTION static cudaError_t SortPairsDescending(void *d_temp_storage,
+                                                              size_t &temp_storage_bytes,
+                                                              DoubleBuffer<KeyT> &d_keys,
+                                                              DoubleBuffer<ValueT> &d_values,
+                                                              NumItemsT num_items,
+                                                              int begin_bit       = 0,
+                                                              int end_bit         = sizeof(KeyT) * 8,
+                                                              cudaStream_t stream = 0)
+  {
+    return Sort<true>(d_temp_storage, temp_storage_bytes, d_keys, d_values, num_items, begin_bit, end_bit, stream);
+  }
+
+  //! @brief Sorts keys into ascending order.
+  template <typename KeyT, typename NumItemsT>
+  CUB_RUNTIME_FUNCTION static cudaError_t SortKeys(void *d_temp_storage,
+                                                   size_t &temp_storage_bytes,
+                                                   const KeyT *d_keys_in,
+                                                   KeyT *d_keys_out,
+                                                   NumItemsT num_items,
+                                                   int begin_bit       = 0,
+                                                   int end_bit         = sizeof(KeyT) * 8,
+                                                   cudaStream_t stream = 0)
+  {
+    // Null value type
+    NullType *d_values = nullptr;
+
+    return Sort<false>(
+      d_temp_storage, temp_storage_bytes, d_keys_in, d_keys_out, d_values, d_values, num_items, begin_bit, end_bit, stream);
+  }
+
+  //! @brief Sorts keys into ascending order using double buffers.
+  template <typename KeyT, typename NumItemsT>
+  CUB_RUNTIME_FUNCTION static cudaError_t SortKeys(void *d_temp_storage,
+                                                   size_t &temp_storage_bytes,
+                                                   DoubleBuffer<KeyT> &d_keys,
+                                                   NumItemsT num_items,
+                                                   int begin_bit       = 0,
+                                                   int end_bit         = sizeof(KeyT) * 8,
+                                                   cudaStream_t stream = 0)
+  {
+    // Null value type
+    DoubleBuffer<NullType> d_values;
+
+    return Sort<false>(d_temp_storage, temp_storage_bytes, d_keys, d_values, num_items, begin_bit, end_bit, stream);
+  }
+
+  //! @brief Sorts keys into descending order.
+  template <typename KeyT, typename NumItemsT>
+  CUB_RUNTIME_FUNCTION static cudaError_t SortKeysDescending(void *d_temp_storage,
+                                                             size_t &temp_storage_bytes,
+                                                             const KeyT *d_keys_in,
+                                                             KeyT *d_keys_out,
+                                                             NumItemsT num_items,
+                                                             int begin_bit       = 0,
+                                                             int end_bit         = sizeof(KeyT) * 8,
+                                                             cudaStream_t stream = 0)
+  {
+    // Null value type
+    NullType *d_values = nullptr;
+
+    return Sort<true>(
+      d_temp_storage, temp_storage_bytes, d_keys_in, d_keys_out, d_values, d_values, num_items, begin_bit, end_bit, stream);
+  }
+
+  //! @brief Sorts keys into descending order using double buffers.
+  template <typename KeyT, typename NumItemsT>
+  CUB_RUNTIME_FUNCTION static cudaError_t SortKeysDescending(void *d_temp_storage,
+                                                             size_t &temp_storage_bytes,
+                                                             DoubleBuffer<KeyT> &d_keys,
+                                                             NumItemsT num_items,
+                                                             int begin_bit       = 0,
+                                                             int end_bit         = sizeof(KeyT) * 8,
+                                                             cudaStream_t stream = 0)
+  {
+    // Null value type
+    DoubleBuffer<NullType> d_values;
+
+    return Sort<true>(d_temp_storage, temp_storage_bytes, d_keys, d_values, num_items, begin_bit, end_bit, stream);
+  }
+
+private:
+  template <bool IS_DESCENDING, typename KeyT, typename ValueT, typename NumItemsT>
+  static cudaError_t Sort(void *d_temp_storage,
+                          size_t &temp_storage_bytes,
+                          const KeyT *d_keys_in,
+                          KeyT *d_keys_out,
+                          const ValueT *d_values_in,
+                          ValueT *d_values_out,
+                          NumItemsT num_items,
+                          int begin_bit,
+                          int end_bit,
+                          cudaStream_t /* stream */)
+  {
+    // Unsigned integer type for global offsets.
+    using OffsetT = typename detail::ChooseOffsetT<NumItemsT>::Type;
+
+    // We cast away const-ness, but will *not* write to these arrays.
+    // `detail::host::radix_sort` sorts into the alternate buffers when the
+    // `is_overwrite_ok` flag is not set.
+    constexpr bool is_overwrite_okay = false;
+    DoubleBuffer<KeyT> d_keys(const_cast<KeyT *>(d_keys_in), d_keys_out);
+    DoubleBuffer<ValueT> d_values(const_cast<ValueT *>(d_values_in), d_values_out);
+
+    return detail::host::radix_sort<IS_DESCENDING>(d_temp_storage,
+                                                   temp_storage_bytes,
+                                                   d_keys,
+                                                   d_values,
+                                                   static_cast<OffsetT>(num_items),
+                                                   begin_bit,
+                                                   end_bit,
+                                                   is_overwrite_okay);
+  }
+
+  template <bool IS_DESCENDING, typename KeyT, typename ValueT, typename NumItemsT>
+  static cudaError_t Sort(void *d_temp_storage,
+                          size_t &temp_storage_bytes,
+                          DoubleBuffer<KeyT> &d_keys,
+                          DoubleBuffer<ValueT> &d_values,
+                          NumItemsT num_items,
+                          int begin_bit,
+                          int end_bit,
+                          cudaStream_t /* stream */)
+  {
+    // Unsigned integer type for global offsets.
+    using OffsetT = typename detail::ChooseOffsetT<NumItemsT>::Type;
+
+    constexpr bool is_overwrite_okay = true;
+
+    return detail::host::radix_sort<IS_DESCENDING>(d_temp_storage,
+                                                   temp_storage_bytes,
+                                                   d_keys,
+                                                   d_values,
+                                                   static_cast<OffsetT>(num_items),
+                                                   begin_bit,
+                                                   end_bit,
+                                                   is_overwrite_okay);
+  }
+};
+
+CUB_NAMESPACE_END
@@ -0,0 +1,306 @@
+/******************************************************************************
+ * Copyright (c) 2024, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the NVIDIA CORPORATION nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL NVIDIA CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+
+//! @file cub::DeviceReduce on the host backend, see cub/device/device_reduce.cuh.
+
+#pragma once
+
+#include <cub/config.cuh>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cub/detail/choose_offset.cuh>
+#include <cub/detail/type_traits.cuh>
+#include <cub/device/host/host_parallel.cuh>
+#include <cub/thread/thread_operators.cuh>
+#include <cub/util_type.cuh>
+
+CUB_NAMESPACE_BEGIN
+
+//! @rst
+//! DeviceReduce provides device-wide, parallel operations for computing
+//! a reduction across a sequence of data items. On the host backend, the
+//! items reside in host memory and are reduced by CPU threads before the call
+//! returns; ``stream`` is ignored.
+//!
+//! The interface and the semantics match the CUDA backend, with the
+//! exception of the overloads deprecated with ``debug_synchronous``.
+//! @endrst
+struct DeviceReduce
+{
+  //! @brief Computes a device-wide reduction using the specified binary
+  //!        `reduction_op` functor and initial value `init`.
+  template <typename InputIteratorT,
+            typename OutputIteratorT,
+            typename ReductionOpT,
+            typename T,
+            typename NumItemsT>
+  CUB_RUNTIME_FUNCTION static cudaError_t Reduce(void *d_temp_storage,
+                                                 size_t &temp_storage_bytes,
+                                                 InputIteratorT d_in,
+                                                 OutputIteratorT d_out,
+                                                 NumItemsT num_items,
+                                                 ReductionOpT reduction_op,
+                                                 T init,
+                                                 cudaStream_t /* stream */ = 0)
+  {
+    using OffsetT = typename detail::ChooseOffsetT<NumItemsT>::Type;
+    using AccumT  = detail::accumulator_t<ReductionOpT, T, detail::value_t<InputIteratorT>>;
+
+    return detail::host::reduce<AccumT>(
+      d_temp_storage,
+      temp_storage_bytes,
+      d_out,
+      static_cast<OffsetT>(num_items),
+      [&](OffsetT i) { return d_in[i]; },
+      reduction_op,
+      init);
+  }
+
+  //! @brief Computes a device-wide sum using the addition (`+`) operator.
+  template <typename InputIteratorT, typename OutputIteratorT, typename NumItemsT>
+  CUB_RUNTIME_FUNCTION static cudaError_t Sum(void *d_temp_storage,
+                                              size_t &temp_storage_bytes,
+                                              InputIteratorT d_in,
+                                              OutputIteratorT d_out,
+                                              NumItemsT num_items,
+                                              cudaStream_t stream = 0)
+  {
+    using OutputT = cub::detail::non_void_value_t<OutputIteratorT, cub::detail::value_t<InputIteratorT>>;
+
+    return Reduce(d_temp_storage,
+                  temp_storage_bytes,
+                  d_in,
+                  d_out,
+                  num_items,
+                  cub::Sum(),
+                  OutputT{}, // zero-initialize
+                  stream);
+  }
+
+  //! @brief Computes a device-wide minimum using the less-than (`<`) operator.
+  template <typename InputIteratorT, typename OutputIteratorT, typename NumItemsT>
+  CUB_RUNTIME_FUNCTION static cudaError_t Min(void *d_temp_storage,
+                                              size_t &temp_storage_bytes,
+                                              InputIteratorT d_in,
+                                              OutputIteratorT d_out,
+                                              NumItemsT num_items,
+                                              cudaStream_t stream = 0)
+  {
+    using InputT = cub::detail::value_t<InputIteratorT>;
+
+    return Reduce(d_temp_storage,
+                  temp_storage_bytes,
+                  d_in,
+                  d_out,
+                  num_items,
+                  cub::Min(),
+                  Traits<InputT>::Max(),
+                  stream);
+  }
+
+  //! @brief Finds the first device-wide minimum using the less-than (`<`)
+  //!        operator, also returning the index of that item.
+  template <typename InputIteratorT, typename OutputIteratorT>
+  CUB_RUNTIME_FUNCTION static cudaError_t ArgMin(void *d_temp_storage,
+                                                 size_t &temp_storage_bytes,
+                                                 InputIteratorT d_in,
+                                                 OutputIteratorT d_out,
+                                                 int num_items,
+                                                 cudaStream_t stream = 0)
+  {
+    using InputValueT = cub::detail::value_t<InputIteratorT>;
+
+    return ArgReduce(d_temp_storage,
+                     temp_storage_bytes,
+                     d_in,
+                     d_out,
+                     num_items,
+                     cub::ArgMin(),
+                     Traits<InputValueT>::Max(),
+                     stream);
+  }
+
+  //! @brief Computes a device-wide maximum using the greater-than (`>`) operator.
+  template <typename InputIteratorT, typename OutputIteratorT, typename NumItemsT>
+  CUB_RUNTIME_FUNCTION static cudaError_t Max(void *d_temp_storage,
+                                              size_t &temp_storage_bytes,
+                                              InputIteratorT d_in,
+                                              OutputIteratorT d_out,
+                                              NumItemsT num_items,
+                                              cudaStream_t stream = 0)
+  {
+    using InputT = cub::detail::value_t<InputIteratorT>;
+
+    return Reduce(d_temp_storage,
+                  temp_storage_bytes,
+                  d_in,
+                  d_out,
+                  num_items,
+                  cub::Max(),
+                  Traits<InputT>::Lowest(),
+                  stream);
+  }
+
+  //! @brief Finds the first device-wide maximum using the greater-than (`>`)
+  //!        operator, also returning the index of that item.
+  template <typename InputIteratorT, typename OutputIteratorT>
+  CUB_RUNTIME_FUNCTION static cudaError_t ArgMax(void *d_temp_storage,
+                                                 size_t &temp_storage_bytes,
+                                                 InputIteratorT d_in,
+                                                 OutputIteratorT d_out,
+                                                 int num_items,
+                                                 cudaStream_t stream = 0)
+  {
+    using InputValueT = cub::detail::value_t<InputIteratorT>;
+
+    return ArgReduce(d_temp_storage,
+                     temp_storage_bytes,
+                     d_in,
+                     d_out,
+                     num_items,
+                     cub::ArgMax(),
+                     Traits<InputValueT>::Lowest(),
+                     stream);
+  }
+
+  //! @brief Fuses transform and reduce operations.
+  template <typename InputIteratorT,
+            typename OutputIteratorT,
+            typename ReductionOpT,
+            typename TransformOpT,
+            typename T,
+            typename NumItemsT>
+  CUB_RUNTIME_FUNCTION static cudaError_t TransformReduce(void *d_temp_storage,
+                                                          size_t &temp_storage_bytes,
+                                                          InputIteratorT d_in,
+                                                          OutputIteratorT d_out,
+                                                          NumItemsT num_items,
+                                                          ReductionOpT reduction_op,
+                                                          TransformOpT transform_op,
+                                                          T init,
+                                                          cudaStream_t /* stream */ = 0)
+  {
+    using OffsetT = typename detail::ChooseOffsetT<NumItemsT>::Type;
+    using AccumT =
+      detail::accumulator_t<ReductionOpT, T, detail::invoke_result_t<TransformOpT, detail::value_t<InputIteratorT>>>;
+
+    return detail::host::reduce<AccumT>(
+      d_temp_storage,
+      temp_storage_bytes,
+      d_out,
+      static_cast<OffsetT>(num_items),
+      [&](OffsetT i) { return transform_op(d_in[i]); },
+      reduction_op,
+      init);
+  }
+
+  //! @brief Reduces segments of values, where segments are demarcated by
+  //!        corresponding runs of identical keys.
+  template <typename KeysInputIteratorT,
+            typename UniqueOutputIteratorT,
+            typename ValuesInputIteratorT,
+            typename AggregatesOutputIteratorT,
+            typename NumRunsOutputIteratorT,
+            typename ReductionOpT,
+            typename NumItemsT>
+  CUB_RUNTIME_FUNCTION static cudaError_t ReduceByKey(void *d_temp_storage,
+                                                      size_t &temp_storage_bytes,
+                                                      KeysInputIteratorT d_keys_in,
+                                                      UniqueOutputIteratorT d_unique_out,
+                                                      ValuesInputIteratorT d_values_in,
+                                                      AggregatesOutputIteratorT d_aggregates_out,
+                                                      NumRunsOutputIteratorT d_num_runs_out,
+                                                      ReductionOpT reduction_op,
+                                                      NumItemsT num_items,
+                                                      cudaStream_t /* stream */ = 0)
+  {
+    using OffsetT = typename detail::ChooseOffsetT<NumItemsT>::Type;
+    using ValueT  = cub::detail::value_t<ValuesInputIteratorT>;
+    using AccumT  = detail::accumulator_t<ReductionOpT, ValueT, ValueT>;
+
+    const OffsetT num_items_ = static_cast<OffsetT>(num_items);
+    Equality equality_op;
+
+    auto is_head = [&](OffsetT i) {
+      return i == 0 || !equality_op(d_keys_in[i - 1], d_keys_in[i]);
+    };
+
+    // The worker that finds the first key of a run reduces the whole run
+    auto reduce_run = [&](OffsetT i, OffsetT run) {
+      AccumT aggregate = d_values_in[i];
+      for (OffsetT j = i + 1; j < num_items_ && !is_head(j); ++j)
+      {
+        aggregate = reduction_op(aggregate, d_values_in[j]);
+      }
+      d_unique_out[run]     = d_keys_in[i];
+      d_aggregates_out[run] = aggregate;
+    };
+
+    return detail::host::compact(d_temp_storage, temp_storage_bytes, num_items_, is_head, reduce_run, d_num_runs_out);
+  }
+
+private:
+  template <typename InputIteratorT, typename OutputIteratorT, typename ReductionOpT, typename InputValueT>
+  static cudaError_t ArgReduce(void *d_temp_storage,
+                               size_t &temp_storage_bytes,
+                               InputIteratorT d_in,
+                               OutputIteratorT d_out,
+                               int num_items,
+                               ReductionOpT reduction_op,
+                               InputValueT empty_value,
+                               cudaStream_t /* stream */)
+  {
+    using OffsetT = int;
+
+    // The output tuple type
+    using OutputTupleT =
+      cub::detail::non_void_value_t<OutputIteratorT, KeyValuePair<OffsetT, InputValueT>>;
+
+    using AccumT = OutputTupleT;
+
+    // TODO Address https://github.com/NVIDIA/cub/issues/651
+    const AccumT initial_value(1, empty_value);
+
+    return detail::host::reduce<AccumT>(
+      d_temp_storage,
+      temp_storage_bytes,
+      d_out,
+      num_items,
+      [&](OffsetT i) { return AccumT(i, d_in[i]); },
+      reduction_op,
+      initial_value);
+  }
+};
+
+CUB_NAMESPACE_END
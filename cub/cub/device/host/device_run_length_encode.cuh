@@ -0,0 +1,143 @@
+/******************************************************************************
+ * Copyright (c) 2024, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the NVIDIA CORPORATION nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL NVIDIA CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+
+//! @file cub::DeviceRunLengthEncode on the host backend, see
+//!       cub/device/device_run_length_encode.cuh.
+
+#pragma once
+
+#include <cub/config.cuh>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cub/device/host/host_parallel.cuh>
+#include <cub/thread/thread_operators.cuh>
+#include <cub/util_type.cuh>
+
+CUB_NAMESPACE_BEGIN
+
+//! @rst
+//! DeviceRunLengthEncode provides device-wide, parallel operations for
+//! demarcating "runs" of same-valued items within a sequence. On the host
+//! backend, the items reside in host memory and are encoded by CPU threads
+//! before the call returns; ``stream`` is ignored.
+//!
+//! The interface and the semantics match the CUDA backend, with the
+//! exception of the overloads deprecated with ``debug_synchronous``.
+//! @endrst
+struct DeviceRunLengthEncode
+{
+  //! @brief Computes a run-length encoding of the sequence `d_in`.
+  template <typename InputIteratorT,
+            typename UniqueOutputIteratorT,
+            typename LengthsOutputIteratorT,
+            typename NumRunsOutputIteratorT>
+  CUB_RUNTIME_FUNCTION static cudaError_t Encode(void *d_temp_storage,
+                                                 size_t &temp_storage_bytes,
+                                                 InputIteratorT d_in,
+                                                 UniqueOutputIteratorT d_unique_out,
+                                                 LengthsOutputIteratorT d_counts_out,
+                                                 NumRunsOutputIteratorT d_num_runs_out,
+                                                 int num_items,
+                                                 cudaStream_t /* stream */ = 0)
+  {
+    using offset_t = int; // Signed integer type for global offsets
+
+    // The lengths output value type
+    using length_t = cub::detail::non_void_value_t<LengthsOutputIteratorT, offset_t>;
+
+    Equality equality_op;
+
+    auto is_head = [&](offset_t i) {
+      return i == 0 || !equality_op(d_in[i - 1], d_in[i]);
+    };
+
+    return detail::host::compact(
+      d_temp_storage,
+      temp_storage_bytes,
+      num_items,
+      is_head,
+      [&](offset_t i, offset_t run) {
+        offset_t end = i + 1;
+        while (end < num_items && !is_head(end))
+        {
+          ++end;
+        }
+        d_unique_out[run] = d_in[i];
+        d_counts_out[run] = static_cast<length_t>(end - i);
+      },
+      d_num_runs_out);
+  }
+
+  //! @brief Enumerates the starting offsets and lengths of all non-trivial
+  //!        runs (of `length > 1`) of same-valued keys in the sequence `d_in`.
+  template <typename InputIteratorT,
+            typename OffsetsOutputIteratorT,
+            typename LengthsOutputIteratorT,
+            typename NumRunsOutputIteratorT>
+  CUB_RUNTIME_FUNCTION static cudaError_t NonTrivialRuns(void *d_temp_storage,
+                                                         size_t &temp_storage_bytes,
+                                                         InputIteratorT d_in,
+                                                         OffsetsOutputIteratorT d_offsets_out,
+                                                         LengthsOutputIteratorT d_lengths_out,
+                                                         NumRunsOutputIteratorT d_num_runs_out,
+                                                         int num_items,
+                                                         cudaStream_t /* stream */ = 0)
+  {
+    using OffsetT = int; // Signed integer type for global offsets
+
+    Equality equality_op;
+
+    auto is_head = [&](OffsetT i) {
+      return i == 0 || !equality_op(d_in[i - 1], d_in[i]);
+    };
+
+    return detail::host::compact(
+      d_temp_storage,
+      temp_storage_bytes,
+      num_items,
+      [&](OffsetT i) { return is_head(i) && i + 1 < num_items && !is_head(i + 1); },
+      [&](OffsetT i, OffsetT run) {
+        OffsetT end = i + 2;
+        while (end < num_items && !is_head(end))
+        {
+          ++end;
+        }
+        d_offsets_out[run] = i;
+        d_lengths_out[run] = end - i;
+      },
+      d_num_runs_out);
+  }
+};
+
+CUB_NAMESPACE_END
@@ -0,0 +1,334 @@
+/******************************************************************************
+ * Copyright (c) 2024, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the NVIDIA CORPORATION nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL NVIDIA CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+
+//! @file cub::DeviceScan on the host backend, see cub/device/device_scan.cuh.
+
+#pragma once
+
+#include <cub/config.cuh>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cub/detail/type_traits.cuh>
+#include <cub/device/host/host_parallel.cuh>
+#include <cub/thread/thread_operators.cuh>
+#include <cub/util_type.cuh>
+
+CUB_NAMESPACE_BEGIN
+
+//! @rst
+//! DeviceScan provides device-wide, parallel operations for computing a
+//! prefix scan across a sequence of data items. On the host backend, the
+//! items reside in host memory and are scanned by CPU threads before the call
+//! returns; ``stream`` is ignored.
+//!
+//! The interface and the semantics match the CUDA backend, with the
+//! exception of the overloads deprecated with ``debug_synchronous``.
+//! @endrst
+struct DeviceScan
+{
+  //! @brief Computes a device-wide exclusive prefix sum.
+  template <typename InputIteratorT, typename OutputIteratorT>
+  CUB_RUNTIME_FUNCTION static cudaError_t ExclusiveSum(void *d_temp_storage,
+                                                       size_t &temp_storage_bytes,
+                                                       InputIteratorT d_in,
+                                                       OutputIteratorT d_out,
+                                                       int num_items,
+                                                       cudaStream_t stream = 0)
+  {
+    using InitT = cub::detail::value_t<InputIteratorT>;
+
+    // Initial value
+    InitT init_value{};
+
+    return ExclusiveScan(d_temp_storage, temp_storage_bytes, d_in, d_out, Sum(), init_value, num_items, stream);
+  }
+
+  //! @brief Computes a device-wide exclusive prefix sum in-place.
+  template <typename IteratorT>
+  CUB_RUNTIME_FUNCTION static cudaError_t ExclusiveSum(void *d_temp_storage,
+                                                       size_t &temp_storage_bytes,
+                                                       IteratorT d_data,
+                                                       int num_items,
+                                                       cudaStream_t stream = 0)
+  {
+    return ExclusiveSum(d_temp_storage, temp_storage_bytes, d_data, d_data, num_items, stream);
+  }
+
+  //! @brief Computes a device-wide exclusive prefix scan using the specified
+  //!        binary `scan_op` functor.
+  template <typename InputIteratorT, typename OutputIteratorT, typename ScanOpT, typename InitValueT>
+  CUB_RUNTIME_FUNCTION static cudaError_t ExclusiveScan(void *d_temp_storage,
+                                                        size_t &temp_storage_bytes,
+                                                        InputIteratorT d_in,
+                                                        OutputIteratorT d_out,
+                                                        ScanOpT scan_op,
+                                                        InitValueT init_value,
+                                                        int num_items,
+                                                        cudaStream_t /* stream */ = 0)
+  {
+    using AccumT = detail::accumulator_t<ScanOpT, InitValueT, cub::detail::value_t<InputIteratorT>>;
+
+    return detail::host::exclusive_scan<AccumT>(
+      d_temp_storage, temp_storage_bytes, d_in, d_out, scan_op, init_value, num_items);
+  }
+
+  //! @brief Computes a device-wide exclusive prefix scan in-place.
+  template <typename IteratorT, typename ScanOpT, typename InitValueT>
+  CUB_RUNTIME_FUNCTION static cudaError_t ExclusiveScan(void *d_temp_storage,
+                                                        size_t &temp_storage_bytes,
+                                                        IteratorT d_data,
+                                                        ScanOpT scan_op,
+                                                        InitValueT init_value,
+                                                        int num_items,
+                                                        cudaStream_t stream = 0)
+  {
+    return ExclusiveScan(d_temp_storage, temp_storage_bytes, d_data, d_data, scan_op, init_value, num_items, stream);
+  }
+
+  //! @brief Computes a device-wide exclusive prefix scan with an initial value
+  //!        that is read when the scan runs.
+  template <typename InputIteratorT,
+            typename OutputIteratorT,
+            typename ScanOpT,
+            typename InitValueT,
+            typename InitValueIterT = InitValueT *>
+  CUB_RUNTIME_FUNCTION static cudaError_t ExclusiveScan(void *d_temp_storage,
+                                                        size_t &temp_storage_bytes,
+                                                        InputIteratorT d_in,
+                                                        OutputIteratorT d_out,
+                                                        ScanOpT scan_op,
+                                                        FutureValue<InitValueT, InitValueIterT> init_value,
+                                                        int num_items,
+                                                        cudaStream_t stream = 0)
+  {
+    // The size query must not read the value, it might not be ready yet
+    if (d_temp_storage == nullptr)
+    {
+      return ExclusiveScan(
+        d_temp_storage, temp_storage_bytes, d_in, d_out, scan_op, InitValueT{}, num_items, stream);
+    }
+
+    return ExclusiveScan(
+      d_temp_storage, temp_storage_bytes, d_in, d_out, scan_op, static_cast<InitValueT>(init_value), num_items, stream);
+  }
+
+  //! @brief Computes a device-wide exclusive prefix scan in-place with an
+  //!        initial value that is read when the scan runs.
+  template <typename IteratorT, typename ScanOpT, typename InitValueT, typename InitValueIterT = InitValueT *>
+  CUB_RUNTIME_FUNCTION static cudaError_t ExclusiveScan(void *d_temp_storage,
+                                                        size_t &temp_storage_bytes,
+                                                        IteratorT d_data,
+                                                        ScanOpT scan_op,
+                                                        FutureValue<InitValueT, InitValueIterT> init_value,
+                                                        int num_items,
+                                                        cudaStream_t stream = 0)
+  {
+    return ExclusiveScan(d_temp_storage, temp_storage_bytes, d_data, d_data, scan_op, init_value, num_items, stream);
+  }
+
+  //! @brief Computes a device-wide inclusive prefix sum.
+  template <typename InputIteratorT, typename OutputIteratorT>
+  CUB_RUNTIME_FUNCTION static cudaError_t InclusiveSum(void *d_temp_storage,
+                                                       size_t &temp_storage_bytes,
+                                                       InputIteratorT d_in,
+                                                       OutputIteratorT d_out,
+                                                       int num_items,
+                                                       cudaStream_t stream = 0)
+  {
+    return InclusiveScan(d_temp_storage, temp_storage_bytes, d_in, d_out, Sum(), num_items, stream);
+  }
+
+  //! @brief Computes a device-wide inclusive prefix sum in-place.
+  template <typename IteratorT>
+  CUB_RUNTIME_FUNCTION static cudaError_t InclusiveSum(void *d_temp_storage,
+                                                       size_t &temp_storage_bytes,
+                                                       IteratorT d_data,
+                                                       int num_items,
+                                                       cudaStream_t stream = 0)
+  {
+    return InclusiveSum(d_temp_storage, temp_storage_bytes, d_data, d_data, num_items, stream);
+  }
+
+  //! @brief Computes a device-wide inclusive prefix scan using the specified
+  //!        binary `scan_op` functor.
+  template <typename InputIteratorT, typename OutputIteratorT, typename ScanOpT>
+  CUB_RUNTIME_FUNCTION static cudaError_t InclusiveScan(void *d_temp_storage,
+                                                        size_t &temp_storage_bytes,
+                                                        InputIteratorT d_in,
+                                                        OutputIteratorT d_out,
+                                                        ScanOpT scan_op,
+                                                        int num_items,
+                                                        cudaStream_t /* stream */ = 0)
+  {
+    using InputT = cub::detail::value_t<InputIteratorT>;
+    using AccumT = detail::accumulator_t<ScanOpT, InputT, InputT>;
+
+    return detail::host::inclusive_scan<AccumT>(d_temp_storage, temp_storage_bytes, d_in, d_out, scan_op, num_items);
+  }
+
+  //! @brief Computes a device-wide inclusive prefix scan in-place.
+  template <typename IteratorT, typename ScanOpT>
+  CUB_RUNTIME_FUNCTION static cudaError_t InclusiveScan(void *d_temp_storage,
+                                                        size_t &temp_storage_bytes,
+                                                        IteratorT d_data,
+                                                        ScanOpT scan_op,
+                                                        int num_items,
+                                                        cudaStream_t stream = 0)
+  {
+    return InclusiveScan(d_temp_storage, temp_storage_bytes, d_data, d_data, scan_op, num_items, stream);
+  }
+
+  //! @brief Computes a device-wide exclusive prefix sum-by-key with key
+  //!        equality defined by `equality_op`.
+  template <typename KeysInputIteratorT,
+            typename ValuesInputIteratorT,
+            typename ValuesOutputIteratorT,
+            typename EqualityOpT = Equality>
+  CUB_RUNTIME_FUNCTION static cudaError_t ExclusiveSumByKey(void *d_temp_storage,
+                                                            size_t &temp_storage_bytes,
+                                                            KeysInputIteratorT d_keys_in,
+                                                            ValuesInputIteratorT d_values_in,
+                                                            ValuesOutputIteratorT d_values_out,
+                                                            int num_items,
+                                                            EqualityOpT equality_op = EqualityOpT(),
+                                                            cudaStream_t stream     = 0)
+  {
+    using InitT = cub::detail::value_t<ValuesInputIteratorT>;
+
+    // Initial value
+    InitT init_value{};
+
+    return ExclusiveScanByKey(d_temp_storage,
+                              temp_storage_bytes,
+                              d_keys_in,
+                              d_values_in,
+                              d_values_out,
+                              Sum(),
+                              init_value,
+                              num_items,
+                              equality_op,
+                              stream);
+  }
+
+  //! @brief Computes a device-wide exclusive prefix scan-by-key using the
+  //!        specified binary `scan_op` functor.
+  template <typename KeysInputIteratorT,
+            typename ValuesInputIteratorT,
+            typename ValuesOutputIteratorT,
+            typename ScanOpT,
+            typename InitValueT,
+            typename EqualityOpT = Equality>
+  CUB_RUNTIME_FUNCTION static cudaError_t ExclusiveScanByKey(void *d_temp_storage,
+                                                             size_t &temp_storage_bytes,
+                                                             KeysInputIteratorT d_keys_in,
+                                                             ValuesInputIteratorT d_values_in,
+                                                             ValuesOutputIteratorT d_values_out,
+                                                             ScanOpT scan_op,
+                                                             InitValueT init_value,
+                                                             int num_items,
+                                                             EqualityOpT equality_op = EqualityOpT(),
+                                                             cudaStream_t /* stream */ = 0)
+  {
+    using AccumT = detail::accumulator_t<ScanOpT, InitValueT, cub::detail::value_t<ValuesInputIteratorT>>;
+
+    return detail::host::scan_by_key<AccumT>(d_temp_storage,
+                                             temp_storage_bytes,
+                                             d_keys_in,
+                                             d_values_in,
+                                             d_values_out,
+                                             equality_op,
+                                             scan_op,
+                                             init_value,
+                                             num_items);
+  }
+
+  //! @brief Computes a device-wide inclusive prefix sum-by-key with key
+  //!        equality defined by `equality_op`.
+  template <typename KeysInputIteratorT,
+            typename ValuesInputIteratorT,
+            typename ValuesOutputIteratorT,
+            typename EqualityOpT = Equality>
+  CUB_RUNTIME_FUNCTION static cudaError_t InclusiveSumByKey(void *d_temp_storage,
+                                                            size_t &temp_storage_bytes,
+                                                            KeysInputIteratorT d_keys_in,
+                                                            ValuesInputIteratorT d_values_in,
+                                                            ValuesOutputIteratorT d_values_out,
+                                                            int num_items,
+                                                            EqualityOpT equality_op = EqualityOpT(),
+                                                            cudaStream_t stream     = 0)
+  {
+    return InclusiveScanByKey(d_temp_storage,
+                              temp_storage_bytes,
+                              d_keys_in,
+                              d_values_in,
+                              d_values_out,
+                              Sum(),
+                              num_items,
+                              equality_op,
+                              stream);
+  }
+
+  //! @brief Computes a device-wide inclusive prefix scan-by-key using the
+  //!        specified binary `scan_op` functor.
+  template <typename KeysInputIteratorT,
+            typename ValuesInputIteratorT,
+            typename ValuesOutputIteratorT,
+            typename ScanOpT,
+            typename EqualityOpT = Equality>
+  CUB_RUNTIME_FUNCTION static cudaError_t InclusiveScanByKey(void *d_temp_storage,
+                                                             size_t &temp_storage_bytes,
+                                                             KeysInputIteratorT d_keys_in,
+                                                             ValuesInputIteratorT d_values_in,
+                                                             ValuesOutputIteratorT d_values_out,
+                                                             ScanOpT scan_op,
+                                                             int num_items,
+                                                             EqualityOpT equality_op = EqualityOpT(),
+                                                             cudaStream_t /* stream */ = 0)
+  {
+    using ValueT = cub::detail::value_t<ValuesInputIteratorT>;
+    using AccumT = detail::accumulator_t<ScanOpT, ValueT, ValueT>;
+
+    return detail::host::scan_by_key<AccumT>(d_temp_storage,
+                                             temp_storage_bytes,
+                                             d_keys_in,
+                                             d_values_in,
+                                             d_values_out,
+                                             equality_op,
+                                             scan_op,
+                                             NullType(),
+                                             num_items);
+  }
+};
+
+CUB_NAMESPACE_END
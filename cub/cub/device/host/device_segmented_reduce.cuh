@@ -0,0 +1,366 @@
+/******************************************************************************
+ * Copyright (c) 2024, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the NVIDIA CORPORATION nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL NVIDIA CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+
+//! @file cub::DeviceSegmentedReduce on the host backend, see
+//!       cub/device/device_segmented_reduce.cuh.
+
+#pragma once
+
+#include <cub/config.cuh>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cub/detail/choose_offset.cuh>
+#include <cub/detail/type_traits.cuh>
+#include <cub/device/host/host_parallel.cuh>
+#include <cub/thread/thread_operators.cuh>
+#include <cub/util_type.cuh>
+
+CUB_NAMESPACE_BEGIN
+
+namespace detail
+{
+namespace host
+{
+
+/// Segments a worker reduces at least
+constexpr std::size_t segment_grain_size = 64;
+
+/**
+ * @brief Reduces `load(i, begin)` for every i in each segment [begin, end)
+ * into `d_out[segment]`, starting from `init`. Empty segments yield `init`.
+ *
+ * Workers reduce whole segments, no temporary storage is needed.
+ */
+template <typename AccumT,
+          typename OutputIteratorT,
+          typename BeginOffsetIteratorT,
+          typename EndOffsetIteratorT,
+          typename LoadOpT,
+          typename ReductionOpT,
+          typename InitT>
+cudaError_t segmented_reduce(void *d_temp_storage,
+                             size_t &temp_storage_bytes,
+                             OutputIteratorT d_out,
+                             int num_segments,
+                             BeginOffsetIteratorT d_begin_offsets,
+                             EndOffsetIteratorT d_end_offsets,
+                             LoadOpT load,
+                             ReductionOpT reduction_op,
+                             InitT init)
+{
+  using OffsetT = common_iterator_value_t<BeginOffsetIteratorT, EndOffsetIteratorT>;
+
+  // Segments are reduced without temporary storage, the single byte keeps the
+  // two-phase interface of the other algorithms
+  void *allocations[1]       = {};
+  size_t allocation_sizes[1] = {1};
+
+  const cudaError_t error = CubDebug(AliasTemporaries(d_temp_storage, temp_storage_bytes, allocations, allocation_sizes));
+  if (cudaSuccess != error || d_temp_storage == nullptr)
+  {
+    return error;
+  }
+
+  const int workers = num_workers(num_segments, segment_grain_size);
+
+  parallel_chunks(workers, num_segments, [&](int first, int last, int /* worker */) {
+    for (int segment = first; segment < last; ++segment)
+    {
+      const OffsetT begin = d_begin_offsets[segment];
+      const OffsetT end   = d_end_offsets[segment];
+
+      if (end <= begin)
+      {
+        d_out[segment] = init;
+        continue;
+      }
+
+      AccumT aggregate = load(begin, begin);
+      for (OffsetT i = begin + 1; i < end; ++i)
+      {
+        aggregate = reduction_op(aggregate, load(i, begin));
+      }
+      d_out[segment] = reduction_op(init, aggregate);
+    }
+  });
+
+  return cudaSuccess;
+}
+
+} // namespace host
+} // namespace detail
+
+//! @rst
+//! DeviceSegmentedReduce provides device-wide, parallel operations for
+//! computing a reduction across multiple sequences of data items. On the host
+//! backend, the items reside in host memory and segments are reduced by CPU
+//! threads before the call returns; ``stream`` is ignored.
+//!
+//! The interface and the semantics match the CUDA backend, with the
+//! exception of the overloads deprecated with ``debug_synchronous``.
+//! @endrst
+struct DeviceSegmentedReduce
+{
+  //! @brief Computes a device-wide segmented reduction using the specified
+  //!        binary `reduction_op` functor.
+  template <typename InputIteratorT,
+            typename OutputIteratorT,
+            typename BeginOffsetIteratorT,
+            typename EndOffsetIteratorT,
+            typename ReductionOpT,
+            typename T>
+  CUB_RUNTIME_FUNCTION static cudaError_t Reduce(void *d_temp_storage,
+                                                 size_t &temp_storage_bytes,
+                                                 InputIteratorT d_in,
+                                                 OutputIteratorT d_out,
+                                                 int num_segments,
+                                                 BeginOffsetIteratorT d_begin_offsets,
+                                                 EndOffsetIteratorT d_end_offsets,
+                                                 ReductionOpT reduction_op,
+                                                 T initial_value,
+                                                 cudaStream_t /* stream */ = 0)
+  {
+    using OffsetT = detail::common_iterator_value_t<BeginOffsetIteratorT, EndOffsetIteratorT>;
+    using AccumT  = detail::accumulator_t<ReductionOpT, T, cub::detail::value_t<InputIteratorT>>;
+
+    return detail::host::segmented_reduce<AccumT>(
+      d_temp_storage,
+      temp_storage_bytes,
+      d_out,
+      num_segments,
+      d_begin_offsets,
+      d_end_offsets,
+      [&](OffsetT i, OffsetT /* begin */) { return d_in[i]; },
+      reduction_op,
+      initial_value);
+  }
+
+  //! @brief Computes a device-wide segmented sum using the addition (`+`)
+  //!        operator.
+  template <typename InputIteratorT,
+            typename OutputIteratorT,
+            typename BeginOffsetIteratorT,
+            typename EndOffsetIteratorT>
+  CUB_RUNTIME_FUNCTION static cudaError_t Sum(void *d_temp_storage,
+                                              size_t &temp_storage_bytes,
+                                              InputIteratorT d_in,
+                                              OutputIteratorT d_out,
+                                              int num_segments,
+                                              BeginOffsetIteratorT d_begin_offsets,
+                                              EndOffsetIteratorT d_end_offsets,
+                                              cudaStream_t stream = 0)
+  {
+    // The output value type
+    using OutputT = cub::detail::non_void_value_t<OutputIteratorT, cub::detail::value_t<InputIteratorT>>;
+
+    return Reduce(d_temp_storage,
+                  temp_storage_bytes,
+                  d_in,
+                  d_out,
+                  num_segments,
+                  d_begin_offsets,
+                  d_end_offsets,
+                  cub::Sum(),
+                  OutputT(), // zero-initialize
+                  stream);
+  }
+
+  //! @brief Computes a device-wide segmented minimum using the less-than
+  //!        (`<`) operator.
+  template <typename InputIteratorT,
+            typename OutputIteratorT,
+            typename BeginOffsetIteratorT,
+            typename EndOffsetIteratorT>
+  CUB_RUNTIME_FUNCTION static cudaError_t Min(void *d_temp_storage,
+                                              size_t &temp_storage_bytes,
+                                              InputIteratorT d_in,
+                                              OutputIteratorT d_out,
+                                              int num_segments,
+                                              BeginOffsetIteratorT d_begin_offsets,
+                                              EndOffsetIteratorT d_end_offsets,
+                                              cudaStream_t stream = 0)
+  {
+    // The input value type
+    using InputT = cub::detail::value_t<InputIteratorT>;
+
+    return Reduce(d_temp_storage,
+                  temp_storage_bytes,
+                  d_in,
+                  d_out,
+                  num_segments,
+                  d_begin_offsets,
+                  d_end_offsets,
+                  cub::Min(),
+                  Traits<InputT>::Max(),
+                  stream);
+  }
+
+  //! @brief Finds the first device-wide minimum in each segment using the
+  //!        less-than (`<`) operator, also returning the in-segment index of
+  //!        that item.
+  template <typename InputIteratorT,
+            typename OutputIteratorT,
+            typename BeginOffsetIteratorT,
+            typename EndOffsetIteratorT>
+  CUB_RUNTIME_FUNCTION static cudaError_t ArgMin(void *d_temp_storage,
+                                                 size_t &temp_storage_bytes,
+                                                 InputIteratorT d_in,
+                                                 OutputIteratorT d_out,
+                                                 int num_segments,
+                                                 BeginOffsetIteratorT d_begin_offsets,
+                                                 EndOffsetIteratorT d_end_offsets,
+                                                 cudaStream_t stream = 0)
+  {
+    using InputValueT = cub::detail::value_t<InputIteratorT>;
+
+    return ArgReduce(d_temp_storage,
+                     temp_storage_bytes,
+                     d_in,
+                     d_out,
+                     num_segments,
+                     d_begin_offsets,
+                     d_end_offsets,
+                     cub::ArgMin(),
+                     Traits<InputValueT>::Max(),
+                     stream);
+  }
+
+  //! @brief Computes a device-wide segmented maximum using the greater-than
+  //!        (`>`) operator.
+  template <typename InputIteratorT,
+            typename OutputIteratorT,
+            typename BeginOffsetIteratorT,
+            typename EndOffsetIteratorT>
+  CUB_RUNTIME_FUNCTION static cudaError_t Max(void *d_temp_storage,
+                                              size_t &temp_storage_bytes,
+                                              InputIteratorT d_in,
+                                              OutputIteratorT d_out,
+                                              int num_segments,
+                                              BeginOffsetIteratorT d_begin_offsets,
+                                              EndOffsetIteratorT d_end_offsets,
+                                              cudaStream_t stream = 0)
+  {
+    // The input value type
+    using InputT = cub::detail::value_t<InputIteratorT>;
+
+    return Reduce(d_temp_storage,
+                  temp_storage_bytes,
+                  d_in,
+                  d_out,
+                  num_segments,
+                  d_begin_offsets,
+                  d_end_offsets,
+                  cub::Max(),
+                  Traits<InputT>::Lowest(),
+                  stream);
+  }
+
+  //! @brief Finds the first device-wide maximum in each segment using the
+  //!        greater-than (`>`) operator, also returning the in-segment index
+  //!        of that item.
+  template <typename InputIteratorT,
+            typename OutputIteratorT,
+            typename BeginOffsetIteratorT,
+            typename EndOffsetIteratorT>
+  CUB_RUNTIME_FUNCTION static cudaError_t ArgMax(void *d_temp_storage,
+                                                 size_t &temp_storage_bytes,
+                                                 InputIteratorT d_in,
+                                                 OutputIteratorT d_out,
+                                                 int num_segments,
+                                                 BeginOffsetIteratorT d_begin_offsets,
+                                                 EndOffsetIteratorT d_end_offsets,
+                                                 cudaStream_t stream = 0)
+  {
+    using InputValueT = cub::detail::value_t<InputIteratorT>;
+
+    return ArgReduce(d_temp_storage,
+                     temp_storage_bytes,
+                     d_in,
+                     d_out,
+                     num_segments,
+                     d_begin_offsets,
+                     d_end_offsets,
+                     cub::ArgMax(),
+                     Traits<InputValueT>::Lowest(),
+                     stream);
+  }
+
+private:
+  template <typename InputIteratorT,
+            typename OutputIteratorT,
+            typename BeginOffsetIteratorT,
+            typename EndOffsetIteratorT,
+            typename ReductionOpT,
+            typename InputValueT>
+  static cudaError_t ArgReduce(void *d_temp_storage,
+                               size_t &temp_storage_bytes,
+                               InputIteratorT d_in,
+                               OutputIteratorT d_out,
+                               int num_segments,
+                               BeginOffsetIteratorT d_begin_offsets,
+                               EndOffsetIteratorT d_end_offsets,
+                               ReductionOpT reduction_op,
+                               InputValueT empty_value,
+                               cudaStream_t /* stream */)
+  {
+    // Integer type for global offsets
+    // Using common iterator value type is a breaking change, see:
+    // https://github.com/NVIDIA/cccl/pull/414#discussion_r1330632615
+    using OffsetT = int;
+
+    // The output tuple type
+    using OutputTupleT =
+      cub::detail::non_void_value_t<OutputIteratorT, KeyValuePair<OffsetT, InputValueT>>;
+
+    using AccumT = OutputTupleT;
+
+    using SegmentOffsetT = detail::common_iterator_value_t<BeginOffsetIteratorT, EndOffsetIteratorT>;
+
+    // TODO Address https://github.com/NVIDIA/cub/issues/651
+    const AccumT initial_value(1, empty_value);
+
+    return detail::host::segmented_reduce<AccumT>(
+      d_temp_storage,
+      temp_storage_bytes,
+      d_out,
+      num_segments,
+      d_begin_offsets,
+      d_end_offsets,
+      [&](SegmentOffsetT i, SegmentOffsetT begin) { return AccumT(static_cast<OffsetT>(i - begin), d_in[i]); },
+      reduction_op,
+      initial_value);
+  }
+};
+
+CUB_NAMESPACE_END
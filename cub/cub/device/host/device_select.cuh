@@ -0,0 +1,200 @@
+/******************************************************************************
+ * Copyright (c) 2024, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the NVIDIA CORPORATION nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL NVIDIA CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+
+//! @file cub::DeviceSelect on the host backend, see cub/device/device_select.cuh.
+
+#pragma once
+
+#include <cub/config.cuh>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cub/device/host/host_parallel.cuh>
+#include <cub/thread/thread_operators.cuh>
+#include <cub/util_type.cuh>
+
+CUB_NAMESPACE_BEGIN
+
+//! @rst
+//! DeviceSelect provides device-wide, parallel operations for compacting
+//! selected items from sequences of data items. On the host backend, the
+//! items reside in host memory and are compacted by CPU threads before the
+//! call returns; ``stream`` is ignored.
+//!
+//! The interface and the semantics match the CUDA backend, with the
+//! exception of the overloads deprecated with ``debug_synchronous``.
+//! @endrst
+struct DeviceSelect
+{
+  //! @brief Uses the `d_flags` sequence to selectively copy the corresponding
+  //!        items from `d_in` into `d_out`.
+  template <typename InputIteratorT, typename FlagIterator, typename OutputIteratorT, typename NumSelectedIteratorT>
+  CUB_RUNTIME_FUNCTION static cudaError_t Flagged(void *d_temp_storage,
+                                                  size_t &temp_storage_bytes,
+                                                  InputIteratorT d_in,
+                                                  FlagIterator d_flags,
+                                                  OutputIteratorT d_out,
+                                                  NumSelectedIteratorT d_num_selected_out,
+                                                  int num_items,
+                                                  cudaStream_t /* stream */ = 0)
+  {
+    return detail::host::compact(
+      d_temp_storage,
+      temp_storage_bytes,
+      num_items,
+      [&](int i) { return static_cast<bool>(d_flags[i]); },
+      [&](int i, int j) { d_out[j] = d_in[i]; },
+      d_num_selected_out);
+  }
+
+  //! @brief Uses the `d_flags` sequence to selectively compact the items in
+  //!        `d_data`.
+  template <typename IteratorT, typename FlagIterator, typename NumSelectedIteratorT>
+  CUB_RUNTIME_FUNCTION static cudaError_t Flagged(void *d_temp_storage,
+                                                  size_t &temp_storage_bytes,
+                                                  IteratorT d_data,
+                                                  FlagIterator d_flags,
+                                                  NumSelectedIteratorT d_num_selected_out,
+                                                  int num_items,
+                                                  cudaStream_t /* stream */ = 0)
+  {
+    return detail::host::compact(
+      d_temp_storage,
+      temp_storage_bytes,
+      num_items,
+      [&](int i) { return static_cast<bool>(d_flags[i]); },
+      [&](int i, int j) { d_data[j] = d_data[i]; },
+      d_num_selected_out,
+      true);
+  }
+
+  //! @brief Uses the `select_op` functor to selectively copy items from
+  //!        `d_in` into `d_out`.
+  template <typename InputIteratorT, typename OutputIteratorT, typename NumSelectedIteratorT, typename SelectOp>
+  CUB_RUNTIME_FUNCTION static cudaError_t If(void *d_temp_storage,
+                                             size_t &temp_storage_bytes,
+                                             InputIteratorT d_in,
+                                             OutputIteratorT d_out,
+                                             NumSelectedIteratorT d_num_selected_out,
+                                             int num_items,
+                                             SelectOp select_op,
+                                             cudaStream_t /* stream */ = 0)
+  {
+    return detail::host::compact(
+      d_temp_storage,
+      temp_storage_bytes,
+      num_items,
+      [&](int i) { return static_cast<bool>(select_op(d_in[i])); },
+      [&](int i, int j) { d_out[j] = d_in[i]; },
+      d_num_selected_out);
+  }
+
+  //! @brief Uses the `select_op` functor to selectively compact the items in
+  //!        `d_data`.
+  template <typename IteratorT, typename NumSelectedIteratorT, typename SelectOp>
+  CUB_RUNTIME_FUNCTION static cudaError_t If(void *d_temp_storage,
+                                             size_t &temp_storage_bytes,
+                                             IteratorT d_data,
+                                             NumSelectedIteratorT d_num_selected_out,
+                                             int num_items,
+                                             SelectOp select_op,
+                                             cudaStream_t /* stream */ = 0)
+  {
+    return detail::host::compact(
+      d_temp_storage,
+      temp_storage_bytes,
+      num_items,
+      [&](int i) { return static_cast<bool>(select_op(d_data[i])); },
+      [&](int i, int j) { d_data[j] = d_data[i]; },
+      d_num_selected_out,
+      true);
+  }
+
+  //! @brief Given an input sequence `d_in` having runs of consecutive
+  //!        equal-valued keys, only the first key from each run is selectively
+  //!        copied to `d_out`.
+  template <typename InputIteratorT, typename OutputIteratorT, typename NumSelectedIteratorT>
+  CUB_RUNTIME_FUNCTION static cudaError_t Unique(void *d_temp_storage,
+                                                 size_t &temp_storage_bytes,
+                                                 InputIteratorT d_in,
+                                                 OutputIteratorT d_out,
+                                                 NumSelectedIteratorT d_num_selected_out,
+                                                 int num_items,
+                                                 cudaStream_t /* stream */ = 0)
+  {
+    Equality equality_op;
+
+    return detail::host::compact(
+      d_temp_storage,
+      temp_storage_bytes,
+      num_items,
+      [&](int i) { return i == 0 || !equality_op(d_in[i - 1], d_in[i]); },
+      [&](int i, int j) { d_out[j] = d_in[i]; },
+      d_num_selected_out);
+  }
+
+  //! @brief Given an input sequence `d_keys_in` and `d_values_in` with runs of
+  //!        key-value pairs with consecutive equal-valued keys, only the first
+  //!        key and its value from each run is selectively copied to
+  //!        `d_keys_out` and `d_values_out`.
+  template <typename KeyInputIteratorT,
+            typename ValueInputIteratorT,
+            typename KeyOutputIteratorT,
+            typename ValueOutputIteratorT,
+            typename NumSelectedIteratorT>
+  CUB_RUNTIME_FUNCTION static cudaError_t UniqueByKey(void *d_temp_storage,
+                                                      size_t &temp_storage_bytes,
+                                                      KeyInputIteratorT d_keys_in,
+                                                      ValueInputIteratorT d_values_in,
+                                                      KeyOutputIteratorT d_keys_out,
+                                                      ValueOutputIteratorT d_values_out,
+                                                      NumSelectedIteratorT d_num_selected_out,
+                                                      int num_items,
+                                                      cudaStream_t /* stream */ = 0)
+  {
+    Equality equality_op;
+
+    return detail::host::compact(
+      d_temp_storage,
+      temp_storage_bytes,
+      num_items,
+      [&](int i) { return i == 0 || !equality_op(d_keys_in[i - 1], d_keys_in[i]); },
+      [&](int i, int j) {
+        d_keys_out[j]   = d_keys_in[i];
+        d_values_out[j] = d_values_in[i];
+      },
+      d_num_selected_out);
+  }
+};
+
+CUB_NAMESPACE_END
@@ -0,0 +1,614 @@
+/******************************************************************************
+ * Copyright (c) 2024, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the NVIDIA CORPORATION nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL NVIDIA CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+
+/**
+ * @file
+ * Building blocks of the host backend: splitting work across CPU threads and
+ * the parallel reduction, scan and compaction the device-wide algorithms are
+ * made of.
+ */
+
+#pragma once
+
+#include <cub/config.cuh>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cub/util_debug.cuh>
+#include <cub/util_namespace.cuh>
+#include <cub/util_temporary_storage.cuh>
+#include <cub/util_type.cuh>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#ifdef _OPENMP
+#  include <omp.h>
+#endif
+
+CUB_NAMESPACE_BEGIN
+
+namespace detail
+{
+namespace host
+{
+
+/// Items a worker processes at least, splitting finer costs more than it saves
+constexpr std::size_t grain_size = 16 * 1024;
+
+/**
+ * @brief Number of CPU threads the algorithms use at most.
+ *
+ * Queried once, so that the temporary storage an algorithm asks for does not
+ * change between the size query and the run.
+ */
+inline int max_workers()
+{
+  static const int workers = [] {
+#ifdef _OPENMP
+    return (std::max)(1, omp_get_max_threads());
+#else
+    const unsigned threads = std::thread::hardware_concurrency();
+    return threads == 0 ? 1 : static_cast<int>(threads);
+#endif
+  }();
+  return workers;
+}
+
+/// Number of workers `num_items` are split across, at least one
+template <typename OffsetT>
+int num_workers(OffsetT num_items, std::size_t grain = grain_size)
+{
+  if (num_items <= OffsetT(0))
+  {
+    return 1;
+  }
+
+  const std::size_t chunks = (static_cast<std::size_t>(num_items) + grain - 1) / grain;
+  return static_cast<int>((std::min)(chunks, static_cast<std::size_t>(max_workers())));
+}
+
+/// First item of the chunk of a worker when `num_items` are split evenly
+template <typename OffsetT>
+OffsetT chunk_begin(OffsetT num_items, int num_chunks, int chunk)
+{
+  const OffsetT size      = num_items / static_cast<OffsetT>(num_chunks);
+  const OffsetT remainder = num_items % static_cast<OffsetT>(num_chunks);
+  return size * static_cast<OffsetT>(chunk) + (std::min)(static_cast<OffsetT>(chunk), remainder);
+}
+
+/// Invokes `op(worker)` for every worker in [0, num_workers) concurrently
+template <typename OpT>
+void parallel_for(int num_workers, OpT op)
+{
+  if (num_workers <= 1)
+  {
+    if (num_workers == 1)
+    {
+      op(0);
+    }
+    return;
+  }
+
+#ifdef _OPENMP
+#  pragma omp parallel for num_threads(num_workers) schedule(static, 1)
+  for (int worker = 0; worker < num_workers; ++worker)
+  {
+    op(worker);
+  }
+#else
+  std::vector<std::thread> threads;
+  threads.reserve(num_workers - 1);
+  for (int worker = 1; worker < num_workers; ++worker)
+  {
+    try
+    {
+      threads.emplace_back(std::ref(op), worker);
+    }
+    catch (const std::system_error &)
+    {
+      // Out of threads, the calling thread does the work
+      op(worker);
+    }
+  }
+
+  op(0);
+
+  for (std::thread &thread : threads)
+  {
+    thread.join();
+  }
+#endif
+}
+
+/// Invokes `op(begin, end, worker)` for the chunks of [0, num_items) concurrently
+template <typename OffsetT, typename OpT>
+void parallel_chunks(int num_workers, OffsetT num_items, OpT op)
+{
+  parallel_for(num_workers, [&](int worker) {
+    op(chunk_begin(num_items, num_workers, worker),
+       chunk_begin(num_items, num_workers, worker + 1),
+       worker);
+  });
+}
+
+/**
+ * @brief Reduces `load(i)` for every i in [0, num_items) into `*d_out`.
+ *
+ * Each worker reduces its chunk, the partials are combined with `init` in
+ * chunk order. For a given number of threads, the result is deterministic.
+ */
+template <typename AccumT,
+          typename OutputIteratorT,
+          typename OffsetT,
+          typename LoadOpT,
+          typename ReductionOpT,
+          typename InitT>
+cudaError_t reduce(void *d_temp_storage,
+                   size_t &temp_storage_bytes,
+                   OutputIteratorT d_out,
+                   OffsetT num_items,
+                   LoadOpT load,
+                   ReductionOpT reduction_op,
+                   InitT init)
+{
+  cudaError error = cudaSuccess;
+  do
+  {
+    const int workers = num_workers(num_items);
+
+    void *allocations[1]       = {};
+    size_t allocation_sizes[1] = {workers * sizeof(AccumT)};
+
+    error = CubDebug(AliasTemporaries(d_temp_storage, temp_storage_bytes, allocations, allocation_sizes));
+    if (cudaSuccess != error || d_temp_storage == nullptr)
+    {
+      break;
+    }
+
+    if (num_items <= OffsetT(0))
+    {
+      *d_out = init;
+      break;
+    }
+
+    AccumT *partials = static_cast<AccumT *>(allocations[0]);
+
+    parallel_chunks(workers, num_items, [&](OffsetT begin, OffsetT end, int worker) {
+      AccumT partial = load(begin);
+      for (OffsetT i = begin + 1; i < end; ++i)
+      {
+        partial = reduction_op(partial, load(i));
+      }
+      new (partials + worker) AccumT(partial);
+    });
+
+    AccumT result = reduction_op(init, partials[0]);
+    for (int worker = 1; worker < workers; ++worker)
+    {
+      result = reduction_op(result, partials[worker]);
+    }
+    *d_out = result;
+  } while (0);
+
+  return error;
+}
+
+/**
+ * @brief Computes an exclusive scan of `d_in` seeded with `init`.
+ *
+ * Each worker reduces its chunk, the reductions are scanned serially into the
+ * carry-in of every chunk, then each worker scans its chunk. Every item is
+ * read before it is written, so `d_in` and `d_out` may be the same sequence.
+ */
+template <typename AccumT,
+          typename InputIteratorT,
+          typename OutputIteratorT,
+          typename ScanOpT,
+          typename InitT,
+          typename OffsetT>
+cudaError_t exclusive_scan(void *d_temp_storage,
+                           size_t &temp_storage_bytes,
+                           InputIteratorT d_in,
+                           OutputIteratorT d_out,
+                           ScanOpT scan_op,
+                           InitT init,
+                           OffsetT num_items)
+{
+  cudaError error = cudaSuccess;
+  do
+  {
+    const int workers = num_workers(num_items);
+
+    void *allocations[1]       = {};
+    size_t allocation_sizes[1] = {workers * sizeof(AccumT)};
+
+    error = CubDebug(AliasTemporaries(d_temp_storage, temp_storage_bytes, allocations, allocation_sizes));
+    if (cudaSuccess != error || d_temp_storage == nullptr || num_items <= OffsetT(0))
+    {
+      break;
+    }
+
+    AccumT *carries = static_cast<AccumT *>(allocations[0]);
+
+    parallel_chunks(workers, num_items, [&](OffsetT begin, OffsetT end, int worker) {
+      if (worker + 1 < workers)
+      {
+        AccumT partial = d_in[begin];
+        for (OffsetT i = begin + 1; i < end; ++i)
+        {
+          partial = scan_op(partial, d_in[i]);
+        }
+        new (carries + worker) AccumT(partial);
+      }
+    });
+
+    AccumT carry = init;
+    for (int worker = 0; worker < workers; ++worker)
+    {
+      AccumT partial = carries[worker];
+      new (carries + worker) AccumT(carry);
+      if (worker + 1 < workers)
+      {
+        carry = scan_op(carry, partial);
+      }
+    }
+
+    parallel_chunks(workers, num_items, [&](OffsetT begin, OffsetT end, int worker) {
+      AccumT accum = carries[worker];
+      for (OffsetT i = begin; i < end; ++i)
+      {
+        const auto item = d_in[i];
+        d_out[i]        = accum;
+        accum           = scan_op(accum, item);
+      }
+    });
+  } while (0);
+
+  return error;
+}
+
+/**
+ * @brief Computes an inclusive scan of `d_in`, see exclusive_scan.
+ */
+template <typename AccumT, typename InputIteratorT, typename OutputIteratorT, typename ScanOpT, typename OffsetT>
+cudaError_t inclusive_scan(void *d_temp_storage,
+                           size_t &temp_storage_bytes,
+                           InputIteratorT d_in,
+                           OutputIteratorT d_out,
+                           ScanOpT scan_op,
+                           OffsetT num_items)
+{
+  cudaError error = cudaSuccess;
+  do
+  {
+    const int workers = num_workers(num_items);
+
+    void *allocations[1]       = {};
+    size_t allocation_sizes[1] = {workers * sizeof(AccumT)};
+
+    error = CubDebug(AliasTemporaries(d_temp_storage, temp_storage_bytes, allocations, allocation_sizes));
+    if (cudaSuccess != error || d_temp_storage == nullptr || num_items <= OffsetT(0))
+    {
+      break;
+    }
+
+    AccumT *partials = static_cast<AccumT *>(allocations[0]);
+
+    parallel_chunks(workers, num_items, [&](OffsetT begin, OffsetT end, int worker) {
+      if (worker + 1 < workers)
+      {
+        AccumT partial = d_in[begin];
+        for (OffsetT i = begin + 1; i < end; ++i)
+        {
+          partial = scan_op(partial, d_in[i]);
+        }
+        new (partials + worker) AccumT(partial);
+      }
+    });
+
+    // The carry-in of chunk w is the inclusive prefix up to chunk w - 1
+    for (int worker = 1; worker + 1 < workers; ++worker)
+    {
+      partials[worker] = scan_op(partials[worker - 1], partials[worker]);
+    }
+
+    parallel_chunks(workers, num_items, [&](OffsetT begin, OffsetT end, int worker) {
+      AccumT accum = worker == 0 ? AccumT(d_in[begin]) : AccumT(scan_op(partials[worker - 1], d_in[begin]));
+      d_out[begin] = accum;
+      for (OffsetT i = begin + 1; i < end; ++i)
+      {
+        accum    = scan_op(accum, d_in[i]);
+        d_out[i] = accum;
+      }
+    });
+  } while (0);
+
+  return error;
+}
+
+// The accumulator of a segment of a scan by key after its first value
+template <typename AccumT, typename ScanOpT, typename InitT, typename ValueT>
+AccumT scan_by_key_head(ScanOpT &scan_op, const InitT &init, const ValueT &value)
+{
+  return scan_op(init, value);
+}
+
+template <typename AccumT, typename ScanOpT, typename ValueT>
+AccumT scan_by_key_head(ScanOpT &, const NullType &, const ValueT &value)
+{
+  return value;
+}
+
+// An exclusive scan stores the accumulator before the value, seeded with init
+template <typename OutputIteratorT, typename OffsetT, typename AccumT, typename InitT>
+void scan_by_key_store(
+  OutputIteratorT d_out, OffsetT i, bool head, const AccumT &before, const AccumT & /* after */, const InitT &init)
+{
+  if (head)
+  {
+    d_out[i] = init;
+  }
+  else
+  {
+    d_out[i] = before;
+  }
+}
+
+// An inclusive scan stores the accumulator after the value
+template <typename OutputIteratorT, typename OffsetT, typename AccumT>
+void scan_by_key_store(
+  OutputIteratorT d_out, OffsetT i, bool /* head */, const AccumT & /* before */, const AccumT &after, const NullType &)
+{
+  d_out[i] = after;
+}
+
+/**
+ * @brief Computes a scan of `d_values_in` that restarts at every key that
+ * differs from its predecessor. The scan is exclusive and seeded with `init`,
+ * unless `init` is `NullType`.
+ *
+ * Each worker reduces the last segment of its chunk and records whether the
+ * chunk starts a segment. The carry-in of every chunk follows serially, then
+ * each worker scans its chunk. `d_values_in` and `d_values_out` may be the
+ * same sequence.
+ */
+template <typename AccumT,
+          typename KeysInputIteratorT,
+          typename ValuesInputIteratorT,
+          typename ValuesOutputIteratorT,
+          typename EqualityOpT,
+          typename ScanOpT,
+          typename InitT,
+          typename OffsetT>
+cudaError_t scan_by_key(void *d_temp_storage,
+                        size_t &temp_storage_bytes,
+                        KeysInputIteratorT d_keys_in,
+                        ValuesInputIteratorT d_values_in,
+                        ValuesOutputIteratorT d_values_out,
+                        EqualityOpT equality_op,
+                        ScanOpT scan_op,
+                        InitT init,
+                        OffsetT num_items)
+{
+  cudaError error = cudaSuccess;
+  do
+  {
+    const int workers = num_workers(num_items);
+
+    void *allocations[2]       = {};
+    size_t allocation_sizes[2] = {workers * sizeof(AccumT), workers * sizeof(bool)};
+
+    error = CubDebug(AliasTemporaries(d_temp_storage, temp_storage_bytes, allocations, allocation_sizes));
+    if (cudaSuccess != error || d_temp_storage == nullptr || num_items <= OffsetT(0))
+    {
+      break;
+    }
+
+    AccumT *partials = static_cast<AccumT *>(allocations[0]);
+    bool *has_head   = static_cast<bool *>(allocations[1]);
+
+    auto is_head = [&](OffsetT i) {
+      return i == 0 || !equality_op(d_keys_in[i - 1], d_keys_in[i]);
+    };
+
+    parallel_chunks(workers, num_items, [&](OffsetT begin, OffsetT end, int worker) {
+      if (worker + 1 < workers)
+      {
+        bool head = false;
+        AccumT partial{};
+        for (OffsetT i = begin; i < end; ++i)
+        {
+          if (is_head(i))
+          {
+            partial = scan_by_key_head<AccumT>(scan_op, init, d_values_in[i]);
+            head    = true;
+          }
+          else if (i == begin)
+          {
+            partial = d_values_in[i];
+          }
+          else
+          {
+            partial = scan_op(partial, d_values_in[i]);
+          }
+        }
+        new (partials + worker) AccumT(partial);
+        has_head[worker] = head;
+      }
+    });
+
+    // From here on, partials[w] is the carry-in of chunk w + 1. The first
+    // chunk starts a segment, so its partial is its carry-out.
+    for (int worker = 1; worker + 1 < workers; ++worker)
+    {
+      if (!has_head[worker])
+      {
+        partials[worker] = scan_op(partials[worker - 1], partials[worker]);
+      }
+    }
+
+    parallel_chunks(workers, num_items, [&](OffsetT begin, OffsetT end, int worker) {
+      AccumT accum{};
+      if (worker > 0)
+      {
+        accum = partials[worker - 1];
+      }
+
+      for (OffsetT i = begin; i < end; ++i)
+      {
+        const bool head     = is_head(i);
+        const auto value    = d_values_in[i];
+        const AccumT before = accum;
+
+        accum = head ? scan_by_key_head<AccumT>(scan_op, init, value) : AccumT(scan_op(accum, value));
+        scan_by_key_store(d_values_out, i, head, before, accum, init);
+      }
+    });
+  } while (0);
+
+  return error;
+}
+
+/**
+ * @brief Invokes `emit(i, j)` for the j-th index i in [0, num_items) that
+ * satisfies `select(i)` and writes the number of such indices to
+ * `*d_num_selected_out`.
+ *
+ * Each worker counts the selected items of its chunk, and after the counts
+ * are scanned, emits them to their final position. `select` is evaluated
+ * twice per item when more than one worker is used. When selected items are
+ * written to the sequence they are read from, `in_place` makes the workers
+ * emit in chunk order, so that no item is overwritten before it is read.
+ */
+template <typename OffsetT, typename SelectOpT, typename EmitOpT, typename NumSelectedIteratorT>
+cudaError_t compact(void *d_temp_storage,
+                    size_t &temp_storage_bytes,
+                    OffsetT num_items,
+                    SelectOpT select,
+                    EmitOpT emit,
+                    NumSelectedIteratorT d_num_selected_out,
+                    bool in_place = false)
+{
+  cudaError error = cudaSuccess;
+  do
+  {
+    const int workers = num_workers(num_items);
+
+    void *allocations[1]       = {};
+    size_t allocation_sizes[1] = {workers * sizeof(OffsetT)};
+
+    error = CubDebug(AliasTemporaries(d_temp_storage, temp_storage_bytes, allocations, allocation_sizes));
+    if (cudaSuccess != error || d_temp_storage == nullptr)
+    {
+      break;
+    }
+
+    if (num_items <= OffsetT(0))
+    {
+      *d_num_selected_out = 0;
+      break;
+    }
+
+    OffsetT *offsets = static_cast<OffsetT *>(allocations[0]);
+
+    if (workers > 1)
+    {
+      parallel_chunks(workers, num_items, [&](OffsetT begin, OffsetT end, int worker) {
+        OffsetT count = 0;
+        for (OffsetT i = begin; i < end; ++i)
+        {
+          if (select(i))
+          {
+            ++count;
+          }
+        }
+        offsets[worker] = count;
+      });
+    }
+    else
+    {
+      // A single worker counts while it emits
+      offsets[0] = 0;
+    }
+
+    OffsetT num_selected = 0;
+    for (int worker = 0; worker < workers; ++worker)
+    {
+      const OffsetT count = offsets[worker];
+      offsets[worker]     = num_selected;
+      num_selected += count;
+    }
+
+    auto emit_chunk = [&](OffsetT begin, OffsetT end, int worker) {
+      OffsetT j = offsets[worker];
+      for (OffsetT i = begin; i < end; ++i)
+      {
+        if (select(i))
+        {
+          emit(i, j++);
+        }
+      }
+      if (workers == 1)
+      {
+        num_selected = j;
+      }
+    };
+
+    if (in_place)
+    {
+      for (int worker = 0; worker < workers; ++worker)
+      {
+        emit_chunk(chunk_begin(num_items, workers, worker), chunk_begin(num_items, workers, worker + 1), worker);
+      }
+    }
+    else
+    {
+      parallel_chunks(workers, num_items, emit_chunk);
+    }
+
+    *d_num_selected_out = num_selected;
+  } while (0);
+
+  return error;
+}
+
+} // namespace host
+} // namespace detail
+
+CUB_NAMESPACE_END
@@ -0,0 +1,820 @@
+/******************************************************************************
+ * Copyright (c) 2024, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the NVIDIA CORPORATION nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL NVIDIA CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+
+/******************************************************************************
+ * Caching allocator with a pluggable upstream. The allocator is thread-safe
+ * and serves most requests from a per-thread cache without locking.
+ ******************************************************************************/
+
+#pragma once
+
+#include <cub/config.cuh>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cub/util_debug.cuh>
+#include <cub/util_namespace.cuh>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <stdlib.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#  include <sys/mman.h>
+#  define CUB_DETAIL_HAS_MMAP
+#endif
+
+CUB_NAMESPACE_BEGIN
+
+
+/******************************************************************************
+ * Upstream allocators
+ ******************************************************************************/
+
+/**
+ * @brief Upstream of CachingAllocator allocating host memory with @p malloc.
+ *
+ * An upstream provides @p Allocate(void **ptr, size_t bytes) and
+ * @p Deallocate(void *ptr, size_t bytes), where @p bytes passed to
+ * @p Deallocate is the one the allocation was made with. Both return
+ * @p cudaErrorMemoryAllocation when the memory is exhausted.
+ */
+struct HostMallocUpstream
+{
+  cudaError_t Allocate(void **ptr, size_t bytes)
+  {
+    *ptr = malloc(bytes);
+    return (*ptr != nullptr || bytes == 0) ? cudaSuccess : cudaErrorMemoryAllocation;
+  }
+
+  cudaError_t Deallocate(void *ptr, size_t /* bytes */)
+  {
+    free(ptr);
+    return cudaSuccess;
+  }
+};
+
+#if defined(CUB_DETAIL_HAS_MMAP) || defined(DOXYGEN_SHOULD_SKIP_THIS)
+
+/**
+ * @brief Upstream of CachingAllocator mapping anonymous host memory.
+ *
+ * With @p huge_pages, allocations that are a multiple of 2MB are first
+ * attempted from the reserved huge pages, and the others are advised to be
+ * backed by transparent huge pages where the system supports them.
+ */
+struct HostMmapUpstream
+{
+  /// Size of the huge pages requested explicitly
+  static constexpr size_t HUGE_PAGE_BYTES = 2 * 1024 * 1024;
+
+  /// Whether or not to back allocations with huge pages
+  bool huge_pages;
+
+  explicit HostMmapUpstream(bool huge_pages = true)
+      : huge_pages(huge_pages)
+  {}
+
+  cudaError_t Allocate(void **ptr, size_t bytes)
+  {
+    *ptr = nullptr;
+    if (bytes == 0)
+    {
+      return cudaSuccess;
+    }
+
+    void *mapping = MAP_FAILED;
+
+#  ifdef MAP_HUGETLB
+    if (huge_pages && (bytes % HUGE_PAGE_BYTES == 0))
+    {
+      mapping = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    }
+#  endif
+
+    if (mapping == MAP_FAILED)
+    {
+      mapping = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (mapping == MAP_FAILED)
+      {
+        return cudaErrorMemoryAllocation;
+      }
+
+#  ifdef MADV_HUGEPAGE
+      if (huge_pages)
+      {
+        // Only advice, the mapping is usable either way
+        madvise(mapping, bytes, MADV_HUGEPAGE);
+      }
+#  endif
+    }
+
+    *ptr = mapping;
+    return cudaSuccess;
+  }
+
+  cudaError_t Deallocate(void *ptr, size_t bytes)
+  {
+    if (ptr == nullptr)
+    {
+      return cudaSuccess;
+    }
+    return munmap(ptr, bytes) == 0 ? cudaSuccess : cudaErrorInvalidValue;
+  }
+};
+
+#endif // CUB_DETAIL_HAS_MMAP
+
+/**
+ * @brief Upstream of CachingAllocator allocating device memory on the current
+ *        device with @p cudaMalloc.
+ *
+ * CachingAllocator is not stream-ordered: memory has to be idle by the time
+ * it is deallocated.
+ */
+struct DeviceMallocUpstream
+{
+  cudaError_t Allocate(void **ptr, size_t bytes)
+  {
+    const cudaError_t error = cudaMalloc(ptr, bytes);
+    if (error == cudaErrorMemoryAllocation)
+    {
+      cudaGetLastError(); // Reset CUDART's error
+    }
+    return error;
+  }
+
+  cudaError_t Deallocate(void *ptr, size_t /* bytes */)
+  {
+    return cudaFree(ptr);
+  }
+};
+
+#if !defined(CUB_HOST_BACKEND) || defined(DOXYGEN_SHOULD_SKIP_THIS)
+
+/**
+ * @brief Upstream of CachingAllocator allocating page-locked host memory with
+ *        @p cudaMallocHost.
+ */
+struct HostPinnedUpstream
+{
+  cudaError_t Allocate(void **ptr, size_t bytes)
+  {
+    const cudaError_t error = cudaMallocHost(ptr, bytes);
+    if (error == cudaErrorMemoryAllocation)
+    {
+      cudaGetLastError(); // Reset CUDART's error
+    }
+    return error;
+  }
+
+  cudaError_t Deallocate(void *ptr, size_t /* bytes */)
+  {
+    return cudaFreeHost(ptr);
+  }
+};
+
+#endif // !CUB_HOST_BACKEND
+
+
+/******************************************************************************
+ * CachingAllocator
+ ******************************************************************************/
+
+/**
+ * @brief A caching allocator on top of an upstream allocator.
+ *
+ * @par Overview
+ * Allocations are categorized and cached by bin size the way
+ * CachingDeviceAllocator does it:
+ *
+ * @par
+ * - Bin limits progress geometrically in accordance with the growth factor
+ *   @p bin_growth provided during construction. Unused allocations within
+ *   a larger bin cache are not reused for allocation requests that categorize to
+ *   smaller bin sizes.
+ * - Allocation requests below ( @p bin_growth ^ @p min_bin ) are rounded up to
+ *   ( @p bin_growth ^ @p min_bin ).
+ * - Allocations above ( @p bin_growth ^ @p max_bin ) are not rounded up to the nearest
+ *   bin and are simply freed when they are deallocated instead of being returned
+ *   to a bin-cache.
+ * - If the total storage of cached allocations will exceed @p max_cached_bytes,
+ *   allocations are simply freed when they are deallocated instead of being
+ *   returned to their bin-cache.
+ *
+ * @par
+ * Unlike CachingDeviceAllocator, the allocator is neither stream-ordered nor
+ * device-aware: the upstream decides where the memory comes from, and
+ * @p Deallocate takes the number of bytes the allocation was requested with,
+ * so that no live allocations have to be tracked.
+ *
+ * @par
+ * Each thread caches up to @p THREAD_CACHE_BLOCKS allocations per bin and
+ * serves requests from them without contention. The remaining cached
+ * allocations are kept in a free list per bin shared by all threads. Allocations
+ * cached by a thread are returned to the shared free lists when the thread
+ * exits. The allocator has to outlive the threads using it.
+ *
+ * @tparam UpstreamT
+ *   Upstream allocator, such as HostMallocUpstream, HostMmapUpstream or
+ *   DeviceMallocUpstream
+ */
+template <typename UpstreamT>
+class CachingAllocator
+{
+public:
+  //---------------------------------------------------------------------
+  // Constants
+  //---------------------------------------------------------------------
+
+  /// Out-of-bounds bin
+  static constexpr unsigned int INVALID_BIN = (unsigned int)-1;
+
+  /// Invalid size
+  static constexpr size_t INVALID_SIZE = (size_t)-1;
+
+  /// Maximum number of allocations a thread caches per bin
+  static constexpr size_t THREAD_CACHE_BLOCKS = 4;
+
+private:
+#ifndef DOXYGEN_SHOULD_SKIP_THIS // Do not document
+
+  //---------------------------------------------------------------------
+  // Type definitions and helper types
+  //---------------------------------------------------------------------
+
+  /// Cached allocations, one list per bin
+  typedef std::vector<std::vector<void *>> FreeLists;
+
+  /// Allocations cached by a thread
+  struct ThreadCache
+  {
+    // Locked by the owning thread, and by FreeAllCached() from others
+    std::mutex mutex;
+    FreeLists bins;
+  };
+
+  /// Shared state, outliving the allocator while a thread exit releases its cache
+  struct State
+  {
+    UpstreamT upstream;
+
+    /// Mutex for the free lists and the registry of thread caches
+    std::mutex mutex;
+
+    unsigned int bin_growth;
+    unsigned int min_bin;
+    unsigned int max_bin;
+    size_t min_bin_bytes;
+    size_t max_bin_bytes;
+
+    std::atomic<size_t> max_cached_bytes;
+    std::atomic<size_t> cached_bytes;
+    std::atomic<size_t> live_bytes;
+
+    /// Size of the allocations of each bin
+    std::vector<size_t> bin_bytes;
+
+    /// Cached allocations shared by all threads
+    FreeLists free_lists;
+
+    /// Caches of the threads that used the allocator
+    std::vector<std::unique_ptr<ThreadCache>> thread_caches;
+
+    State(UpstreamT upstream,
+          unsigned int bin_growth,
+          unsigned int min_bin,
+          unsigned int max_bin,
+          size_t max_cached_bytes)
+        : upstream(upstream)
+        , bin_growth(bin_growth)
+        , min_bin(min_bin)
+        , max_bin(max_bin)
+        , max_cached_bytes(max_cached_bytes)
+        , cached_bytes(0)
+        , live_bytes(0)
+    {
+      // Bins whose size doesn't fit size_t are never used
+      unsigned int largest_bin = 0;
+      size_t largest_bin_bytes = 1;
+      while (largest_bin < this->max_bin && largest_bin_bytes <= INVALID_SIZE / bin_growth)
+      {
+        largest_bin_bytes *= bin_growth;
+        largest_bin++;
+      }
+
+      this->max_bin = largest_bin;
+      max_bin_bytes = largest_bin_bytes;
+      min_bin_bytes = IntPow(bin_growth, this->min_bin);
+
+      for (unsigned int bin = this->min_bin; bin <= this->max_bin; ++bin)
+      {
+        bin_bytes.push_back(IntPow(bin_growth, bin));
+      }
+      free_lists.resize(bin_bytes.size());
+    }
+
+    /**
+     * Bin and size of the allocation serving a request, INVALID_BIN and the
+     * requested size if it isn't cached
+     */
+    void Categorize(unsigned int &bin, size_t &rounded_bytes, size_t bytes) const
+    {
+      NearestPowerOf(bin, rounded_bytes, bin_growth, bytes);
+
+      if (bin < min_bin)
+      {
+        bin           = min_bin;
+        rounded_bytes = min_bin_bytes;
+      }
+
+      if (bin > max_bin)
+      {
+        bin           = INVALID_BIN;
+        rounded_bytes = bytes;
+      }
+    }
+
+    /// Accounts for an allocation to be cached, unless the cache is full
+    bool ReserveCached(size_t bytes)
+    {
+      size_t cached = cached_bytes.load();
+      do
+      {
+        if (cached + bytes > max_cached_bytes.load())
+        {
+          return false;
+        }
+      } while (!cached_bytes.compare_exchange_weak(cached, cached + bytes));
+      return true;
+    }
+
+    /// Moves the allocations of a thread cache to the shared free lists.  Requires @p mutex.
+    void Drain(ThreadCache &cache)
+    {
+      std::lock_guard<std::mutex> cache_lock(cache.mutex);
+      for (size_t bin = 0; bin < cache.bins.size(); ++bin)
+      {
+        free_lists[bin].insert(free_lists[bin].end(), cache.bins[bin].begin(), cache.bins[bin].end());
+        cache.bins[bin].clear();
+      }
+    }
+
+    /// Unregisters the cache of an exiting thread
+    void ReleaseThreadCache(ThreadCache *cache)
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      for (size_t i = 0; i < thread_caches.size(); ++i)
+      {
+        if (thread_caches[i].get() == cache)
+        {
+          Drain(*cache);
+          thread_caches.erase(thread_caches.begin() + i);
+          break;
+        }
+      }
+    }
+  };
+
+  /// The cache of the calling thread in one allocator
+  struct ThreadSlot
+  {
+    std::weak_ptr<State> state;
+    const State *key;
+    ThreadCache *cache;
+  };
+
+  /// The caches of the calling thread, returned to their allocators when it exits
+  struct ThreadSlots
+  {
+    std::vector<ThreadSlot> slots;
+
+    ~ThreadSlots()
+    {
+      for (size_t i = 0; i < slots.size(); ++i)
+      {
+        if (std::shared_ptr<State> state = slots[i].state.lock())
+        {
+          state->ReleaseThreadCache(slots[i].cache);
+        }
+      }
+    }
+  };
+
+  //---------------------------------------------------------------------
+  // Utility functions
+  //---------------------------------------------------------------------
+
+  /**
+   * Integer pow function for unsigned base and exponent
+   */
+  static size_t IntPow(size_t base, unsigned int exp)
+  {
+    size_t retval = 1;
+    while (exp > 0)
+    {
+      if (exp & 1)
+      {
+        retval = retval * base; // multiply the result by the current base
+      }
+      base = base * base; // square the base
+      exp  = exp >> 1;    // divide the exponent in half
+    }
+    return retval;
+  }
+
+  /**
+   * Round up to the nearest power-of
+   */
+  static void NearestPowerOf(unsigned int &power, size_t &rounded_bytes, unsigned int base, size_t value)
+  {
+    power         = 0;
+    rounded_bytes = 1;
+
+    if (value * base < value)
+    {
+      // Overflow
+      power         = sizeof(size_t) * 8;
+      rounded_bytes = size_t(0) - 1;
+      return;
+    }
+
+    while (rounded_bytes < value)
+    {
+      rounded_bytes *= base;
+      power++;
+    }
+  }
+
+  /**
+   * The cache of the calling thread, registered on first use
+   */
+  ThreadCache &LocalCache()
+  {
+    static thread_local ThreadSlots thread_slots;
+    std::vector<ThreadSlot> &slots = thread_slots.slots;
+
+    for (size_t i = 0; i < slots.size(); ++i)
+    {
+      // A slot of a destroyed allocator at the same address has expired
+      if (slots[i].key == state.get() && !slots[i].state.expired())
+      {
+        return *slots[i].cache;
+      }
+    }
+
+    // Forget the slots of destroyed allocators
+    for (size_t i = slots.size(); i > 0; --i)
+    {
+      if (slots[i - 1].state.expired())
+      {
+        slots.erase(slots.begin() + (i - 1));
+      }
+    }
+
+    std::unique_ptr<ThreadCache> cache(new ThreadCache);
+    cache->bins.resize(state->bin_bytes.size());
+
+    ThreadSlot slot;
+    slot.state = state;
+    slot.key   = state.get();
+    slot.cache = cache.get();
+    slots.push_back(slot);
+
+    std::lock_guard<std::mutex> lock(state->mutex);
+    state->thread_caches.push_back(std::move(cache));
+    return *slot.cache;
+  }
+
+  //---------------------------------------------------------------------
+  // Fields
+  //---------------------------------------------------------------------
+
+  std::shared_ptr<State> state;
+
+  /// Whether or not to skip a call to FreeAllCached() when destructor is called.
+  /// (The CUDA runtime may have already shut down for statically declared allocators)
+  const bool skip_cleanup;
+
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+public:
+  //---------------------------------------------------------------------
+  // Methods
+  //---------------------------------------------------------------------
+
+  /**
+   * @brief Constructor.
+   *
+   * @param bin_growth
+   *   Geometric growth factor for bin-sizes
+   *
+   * @param min_bin
+   *   Minimum bin (default is bin_growth ^ 1)
+   *
+   * @param max_bin
+   *   Maximum bin (default is no max bin)
+   *
+   * @param max_cached_bytes
+   *   Maximum aggregate cached bytes (default is no limit)
+   *
+   * @param skip_cleanup
+   *   Whether or not to skip a call to @p FreeAllCached() when the destructor is called (default
+   *   is to deallocate)
+   *
+   * @param upstream
+   *   Upstream allocator providing the memory
+   */
+  CachingAllocator(unsigned int bin_growth,
+                   unsigned int min_bin    = 1,
+                   unsigned int max_bin    = INVALID_BIN,
+                   size_t max_cached_bytes = INVALID_SIZE,
+                   bool skip_cleanup       = false,
+                   UpstreamT upstream      = UpstreamT())
+      : state(std::make_shared<State>(upstream, bin_growth, min_bin, max_bin, max_cached_bytes))
+      , skip_cleanup(skip_cleanup)
+  {}
+
+  /**
+   * @brief Default constructor.
+   *
+   * Configured like the default CachingDeviceAllocator:
+   * @par
+   * - @p bin_growth          = 8
+   * - @p min_bin             = 3
+   * - @p max_bin             = 7
+   * - @p max_cached_bytes    = ( @p bin_growth ^ @p max_bin) * 3 ) - 1 = 6,291,455 bytes
+   *
+   * which delineates five bin-sizes: 512B, 4KB, 32KB, 256KB, and 2MB and
+   * sets a maximum of 6,291,455 cached bytes
+   */
+  explicit CachingAllocator(bool skip_cleanup = false)
+      : CachingAllocator(8, 3, 7, (IntPow(8, 7) * 3) - 1, skip_cleanup)
+  {}
+
+  CachingAllocator(const CachingAllocator &)            = delete;
+  CachingAllocator &operator=(const CachingAllocator &) = delete;
+
+  /**
+   * @brief Sets the limit on the number bytes this allocator is allowed to cache.
+   *
+   * Changing the ceiling of cached bytes does not cause any allocations (in-use or
+   * cached-in-reserve) to be freed.  See \p FreeAllCached().
+   */
+  cudaError_t SetMaxCachedBytes(size_t max_cached_bytes_)
+  {
+#ifdef CUB_DETAIL_DEBUG_ENABLE_LOG
+    _CubLog("Changing max_cached_bytes (%lld -> %lld)\n",
+            (long long)state->max_cached_bytes.load(),
+            (long long)max_cached_bytes_);
+#endif
+
+    state->max_cached_bytes = max_cached_bytes_;
+    return cudaSuccess;
+  }
+
+  /**
+   * @brief Provides a suitable allocation for the given size.
+   *
+   * @param[out] ptr
+   *   Reference to pointer to the allocation
+   *
+   * @param[in] bytes
+   *   Minimum number of bytes for the allocation
+   */
+  cudaError_t Allocate(void **ptr, size_t bytes)
+  {
+    *ptr = nullptr;
+
+    unsigned int bin;
+    size_t rounded_bytes;
+    state->Categorize(bin, rounded_bytes, bytes);
+
+    if (bin != INVALID_BIN)
+    {
+      const size_t bin_index = bin - state->min_bin;
+
+      // Reuse an allocation cached by this thread
+      ThreadCache &cache = LocalCache();
+      {
+        std::lock_guard<std::mutex> cache_lock(cache.mutex);
+        std::vector<void *> &cached = cache.bins[bin_index];
+        if (!cached.empty())
+        {
+          *ptr = cached.back();
+          cached.pop_back();
+        }
+      }
+
+      // Reuse an allocation cached by any thread
+      if (*ptr == nullptr)
+      {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        std::vector<void *> &cached = state->free_lists[bin_index];
+        if (!cached.empty())
+        {
+          *ptr = cached.back();
+          cached.pop_back();
+        }
+      }
+
+      if (*ptr != nullptr)
+      {
+        state->cached_bytes -= rounded_bytes;
+        state->live_bytes += rounded_bytes;
+
+#ifdef CUB_DETAIL_DEBUG_ENABLE_LOG
+        _CubLog("\tReused cached block at %p (%lld bytes).\n", *ptr, (long long)rounded_bytes);
+#endif
+
+        return cudaSuccess;
+      }
+    }
+
+    // Attempt to allocate
+    cudaError_t error = CubDebug(state->upstream.Allocate(ptr, rounded_bytes));
+    if (error == cudaErrorMemoryAllocation)
+    {
+      // The allocation attempt failed: free all cached blocks and retry
+#ifdef CUB_DETAIL_DEBUG_ENABLE_LOG
+      _CubLog("\tFailed to allocate %lld bytes, retrying after freeing cached allocations\n",
+              (long long)rounded_bytes);
+#endif
+
+      error = CubDebug(FreeAllCached());
+      if (cudaSuccess != error)
+      {
+        return error;
+      }
+
+      error = CubDebug(state->upstream.Allocate(ptr, rounded_bytes));
+    }
+
+    if (cudaSuccess != error)
+    {
+      return error;
+    }
+
+    state->live_bytes += rounded_bytes;
+
+#ifdef CUB_DETAIL_DEBUG_ENABLE_LOG
+    _CubLog("\tAllocated new block at %p (%lld bytes).\n", *ptr, (long long)rounded_bytes);
+#endif
+
+    return cudaSuccess;
+  }
+
+  /**
+   * @brief Returns a live allocation to the allocator.
+   *
+   * @param[in] ptr
+   *   Pointer to the allocation
+   *
+   * @param[in] bytes
+   *   Number of bytes @p ptr was allocated with
+   */
+  cudaError_t Deallocate(void *ptr, size_t bytes)
+  {
+    if (ptr == nullptr)
+    {
+      return cudaSuccess;
+    }
+
+    unsigned int bin;
+    size_t rounded_bytes;
+    state->Categorize(bin, rounded_bytes, bytes);
+    state->live_bytes -= rounded_bytes;
+
+    // Keep the returned allocation if bin is valid and we won't exceed the max cached threshold
+    if (bin != INVALID_BIN && state->ReserveCached(rounded_bytes))
+    {
+      const size_t bin_index = bin - state->min_bin;
+
+      ThreadCache &cache = LocalCache();
+      {
+        std::lock_guard<std::mutex> cache_lock(cache.mutex);
+        std::vector<void *> &cached = cache.bins[bin_index];
+        if (cached.size() < THREAD_CACHE_BLOCKS)
+        {
+          cached.push_back(ptr);
+          return cudaSuccess;
+        }
+      }
+
+      std::lock_guard<std::mutex> lock(state->mutex);
+      state->free_lists[bin_index].push_back(ptr);
+      return cudaSuccess;
+    }
+
+#ifdef CUB_DETAIL_DEBUG_ENABLE_LOG
+    _CubLog("\tFreed block at %p (%lld bytes).\n", ptr, (long long)rounded_bytes);
+#endif
+
+    return CubDebug(state->upstream.Deallocate(ptr, rounded_bytes));
+  }
+
+  /**
+   * @brief Frees all cached allocations, including the ones cached by other threads
+   */
+  cudaError_t FreeAllCached()
+  {
+    cudaError_t error = cudaSuccess;
+
+    std::lock_guard<std::mutex> lock(state->mutex);
+
+    for (size_t i = 0; i < state->thread_caches.size(); ++i)
+    {
+      state->Drain(*state->thread_caches[i]);
+    }
+
+    for (size_t bin = 0; bin < state->free_lists.size(); ++bin)
+    {
+      std::vector<void *> &cached = state->free_lists[bin];
+      while (!cached.empty())
+      {
+        error = CubDebug(state->upstream.Deallocate(cached.back(), state->bin_bytes[bin]));
+        if (cudaSuccess != error)
+        {
+          return error;
+        }
+
+        state->cached_bytes -= state->bin_bytes[bin];
+        cached.pop_back();
+      }
+    }
+
+#ifdef CUB_DETAIL_DEBUG_ENABLE_LOG
+    _CubLog("\tFreed all cached blocks, %lld live bytes outstanding.\n", (long long)state->live_bytes.load());
+#endif
+
+    return error;
+  }
+
+  /**
+   * @brief Number of bytes held in the caches
+   */
+  size_t CachedBytes() const
+  {
+    return state->cached_bytes.load();
+  }
+
+  /**
+   * @brief Number of bytes of the live allocations
+   */
+  size_t LiveBytes() const
+  {
+    return state->live_bytes.load();
+  }
+
+  /**
+   * @brief Destructor
+   */
+  virtual ~CachingAllocator()
+  {
+    if (!skip_cleanup)
+    {
+      FreeAllCached();
+    }
+  }
+};
+
+/**
+ * @brief A caching allocator for host memory, using the bin policy of
+ *        CachingDeviceAllocator.
+ */
+using CachingHostAllocator = CachingAllocator<HostMallocUpstream>;
+
+CUB_NAMESPACE_END
@@ -46,11 +46,11 @@
 #include <cuda/std/limits>
 #include <cuda/__cccl_config> // _LIBCUDACXX_CUDACC_VER
 
-#if !_NVHPC_CUDA
+#if !_NVHPC_CUDA && !defined(CUB_HOST_BACKEND)
     #include <cuda_fp16.h>
 #endif
 
-#if !_NVHPC_CUDA && !defined(CUB_DISABLE_BF16_SUPPORT)
+#if !_NVHPC_CUDA && !defined(CUB_DISABLE_BF16_SUPPORT) && !defined(CUB_HOST_BACKEND)
 #  include <cuda_bf16.h>
 // cuda_fp8.h transitively includes cuda_fp16.h, so we have to include the header under !CUB_DISABLE_BF16_SUPPORT
 #  if _LIBCUDACXX_CUDACC_VER >= 1108000
@@ -1139,7 +1139,7 @@ struct FpLimits<double>
     }
 };
 
-#if !_NVHPC_CUDA
+#if !_NVHPC_CUDA && !defined(CUB_HOST_BACKEND)
 template <>
 struct FpLimits<__half>
 {
@@ -1155,7 +1155,7 @@ struct FpLimits<__half>
 };
 #endif
 
-#if !_NVHPC_CUDA && !defined(CUB_DISABLE_BF16_SUPPORT)
+#if !_NVHPC_CUDA && !defined(CUB_DISABLE_BF16_SUPPORT) && !defined(CUB_HOST_BACKEND)
 template <>
 struct FpLimits<__nv_bfloat16>
 {
@@ -1348,10 +1348,10 @@ struct NumericTraits<__int128_t>
 
 template <> struct NumericTraits<float> :               BaseTraits<FLOATING_POINT, true, false, unsigned int, float> {};
 template <> struct NumericTraits<double> :              BaseTraits<FLOATING_POINT, true, false, unsigned long long, double> {};
-#if !_NVHPC_CUDA
+#if !_NVHPC_CUDA && !defined(CUB_HOST_BACKEND)
     template <> struct NumericTraits<__half> :          BaseTraits<FLOATING_POINT, true, false, unsigned short, __half> {};
 #endif
-#if !_NVHPC_CUDA && !defined(CUB_DISABLE_BF16_SUPPORT)
+#if !_NVHPC_CUDA && !defined(CUB_DISABLE_BF16_SUPPORT) && !defined(CUB_HOST_BACKEND)
     template <> struct NumericTraits<__nv_bfloat16> :   BaseTraits<FLOATING_POINT, true, false, unsigned short, __nv_bfloat16> {};
 #endif
 
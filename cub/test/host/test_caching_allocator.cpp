@@ -0,0 +1,281 @@
+/******************************************************************************
+ * Copyright (c) 2024, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the NVIDIA CORPORATION nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL NVIDIA CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+
+/******************************************************************************
+ * Test of CachingAllocator with host upstreams on the host backend
+ ******************************************************************************/
+
+// Ensure printing of CUDA runtime errors to console
+#define CUB_STDERR
+
+#include <cub/util_caching_allocator.cuh>
+
+#include <atomic>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "test_util_host.h"
+
+using namespace cub;
+
+/**
+ * Counts the bytes the allocator holds from its upstream
+ */
+struct CountingUpstream : HostMallocUpstream
+{
+  static std::atomic<size_t> allocated_bytes;
+
+  cudaError_t Allocate(void **ptr, size_t bytes)
+  {
+    allocated_bytes += bytes;
+    return HostMallocUpstream::Allocate(ptr, bytes);
+  }
+
+  cudaError_t Deallocate(void *ptr, size_t bytes)
+  {
+    allocated_bytes -= bytes;
+    return HostMallocUpstream::Deallocate(ptr, bytes);
+  }
+};
+
+std::atomic<size_t> CountingUpstream::allocated_bytes(0);
+
+/**
+ * Test the bin policy of the default-constructed allocator
+ */
+void TestBins()
+{
+  printf("Testing bins...\n"); fflush(stdout);
+
+  {
+    // Caches up to 6MB in 512B, 4KB, 32KB, 256KB and 2MB bins
+    CachingAllocator<CountingUpstream> allocator;
+
+    // Allocate 5 bytes, rounded up to the minimum bin
+    char *h_5B;
+    CubDebugExit(allocator.Allocate((void **) &h_5B, 5));
+    AssertEquals(allocator.LiveBytes(), 512);
+    AssertEquals(allocator.CachedBytes(), 0);
+
+    // Allocate 4096 bytes
+    char *h_4096B;
+    CubDebugExit(allocator.Allocate((void **) &h_4096B, 4096));
+    AssertEquals(allocator.LiveBytes(), 512 + 4096);
+
+    // Free both, they are cached
+    CubDebugExit(allocator.Deallocate(h_5B, 5));
+    CubDebugExit(allocator.Deallocate(h_4096B, 4096));
+    AssertEquals(allocator.LiveBytes(), 0);
+    AssertEquals(allocator.CachedBytes(), 512 + 4096);
+
+    // Allocate 768 bytes, which reuses the 4096 bytes block
+    char *h_768B;
+    CubDebugExit(allocator.Allocate((void **) &h_768B, 768));
+    AssertEquals(h_768B, h_4096B);
+    AssertEquals(allocator.CachedBytes(), 512);
+    AssertEquals(allocator.LiveBytes(), 4096);
+
+    // Allocate 3MB, above the maximum bin, which isn't cached
+    char *h_3MB;
+    CubDebugExit(allocator.Allocate((void **) &h_3MB, 3 * 1024 * 1024));
+    AssertEquals(CountingUpstream::allocated_bytes, 512 + 4096 + 3 * 1024 * 1024);
+    CubDebugExit(allocator.Deallocate(h_3MB, 3 * 1024 * 1024));
+    AssertEquals(CountingUpstream::allocated_bytes, 512 + 4096);
+    AssertEquals(allocator.CachedBytes(), 512);
+
+    // Fill the cache up to its limit with 2MB blocks, the third one is freed
+    char *h_2MB[3];
+    for (int i = 0; i < 3; ++i)
+    {
+      CubDebugExit(allocator.Allocate((void **) &h_2MB[i], 2 * 1024 * 1024));
+    }
+    for (int i = 0; i < 3; ++i)
+    {
+      CubDebugExit(allocator.Deallocate(h_2MB[i], 2 * 1024 * 1024));
+    }
+    AssertEquals(allocator.CachedBytes(), 512 + 2 * 2 * 1024 * 1024);
+
+    // Lowering the limit doesn't free anything, but the next block isn't cached
+    CubDebugExit(allocator.SetMaxCachedBytes(0));
+    CubDebugExit(allocator.Deallocate(h_768B, 768));
+    AssertEquals(allocator.CachedBytes(), 512 + 2 * 2 * 1024 * 1024);
+    AssertEquals(CountingUpstream::allocated_bytes, 512 + 2 * 2 * 1024 * 1024);
+
+    CubDebugExit(allocator.FreeAllCached());
+    AssertEquals(allocator.CachedBytes(), 0);
+    AssertEquals(CountingUpstream::allocated_bytes, 0);
+
+    // Freeing a null pointer is a no-op
+    CubDebugExit(allocator.Deallocate(NULL, 42));
+  }
+
+  {
+    // Blocks cached on destruction are freed
+    CachingAllocator<CountingUpstream> allocator(2, 4, 20);
+
+    void *h_block;
+    CubDebugExit(allocator.Allocate(&h_block, 100));
+    AssertEquals(allocator.LiveBytes(), 128);
+    CubDebugExit(allocator.Deallocate(h_block, 100));
+    AssertEquals(allocator.CachedBytes(), 128);
+  }
+  AssertEquals(CountingUpstream::allocated_bytes, 0);
+}
+
+/**
+ * Test allocations cached by one thread are reused by another
+ */
+void TestThreads(int num_threads, int iterations)
+{
+  printf("Testing %d threads...\n", num_threads); fflush(stdout);
+
+  CachingAllocator<CountingUpstream> allocator;
+
+  // Blocks freed by a thread that exited are shared
+  const int num_blocks = 2 * CachingAllocator<CountingUpstream>::THREAD_CACHE_BLOCKS;
+  std::thread([&] {
+    void *h_blocks[num_blocks];
+    for (int i = 0; i < num_blocks; ++i)
+    {
+      CubDebugExit(allocator.Allocate(&h_blocks[i], 1000));
+    }
+    for (int i = 0; i < num_blocks; ++i)
+    {
+      CubDebugExit(allocator.Deallocate(h_blocks[i], 1000));
+    }
+  }).join();
+
+  AssertEquals(allocator.CachedBytes(), num_blocks * 4096);
+
+  std::vector<void *> h_blocks(num_blocks);
+  for (int i = 0; i < num_blocks; ++i)
+  {
+    CubDebugExit(allocator.Allocate(&h_blocks[i], 1000));
+  }
+  AssertEquals(CountingUpstream::allocated_bytes, num_blocks * 4096);
+  for (int i = 0; i < num_blocks; ++i)
+  {
+    CubDebugExit(allocator.Deallocate(h_blocks[i], 1000));
+  }
+
+  // Threads allocating and freeing concurrently
+  std::vector<std::thread> threads;
+  for (int t = 0; t < num_threads; ++t)
+  {
+    threads.emplace_back([&, t] {
+      std::vector<char *> h_live;
+      for (int i = 0; i < iterations; ++i)
+      {
+        const size_t bytes = 1 + (i * 7919 + t * 104729) % (64 * 1024);
+
+        char *h_block;
+        CubDebugExit(allocator.Allocate((void **) &h_block, bytes));
+        h_block[0] = h_block[bytes - 1] = static_cast<char>(t);
+        h_live.push_back(h_block);
+
+        if (h_live.size() > 8)
+        {
+          AssertEquals(h_live.front()[0], static_cast<char>(t));
+          const size_t front_bytes = 1 + ((i - 8) * 7919 + t * 104729) % (64 * 1024);
+          CubDebugExit(allocator.Deallocate(h_live.front(), front_bytes));
+          h_live.erase(h_live.begin());
+        }
+      }
+
+      for (size_t i = 0; i < h_live.size(); ++i)
+      {
+        const size_t bytes = 1 + ((iterations - h_live.size() + i) * 7919 + t * 104729) % (64 * 1024);
+        CubDebugExit(allocator.Deallocate(h_live[i], bytes));
+      }
+    });
+  }
+
+  for (size_t t = 0; t < threads.size(); ++t)
+  {
+    threads[t].join();
+  }
+
+  AssertEquals(allocator.LiveBytes(), 0);
+  AssertEquals(CountingUpstream::allocated_bytes, allocator.CachedBytes());
+
+  CubDebugExit(allocator.FreeAllCached());
+  AssertEquals(CountingUpstream::allocated_bytes, 0);
+}
+
+#ifdef CUB_DETAIL_HAS_MMAP
+
+/**
+ * Test mapped allocations are reused and unmapped
+ */
+void TestMmap()
+{
+  printf("Testing mmap upstream...\n"); fflush(stdout);
+
+  CachingAllocator<HostMmapUpstream> allocator(2, 12, 22);
+
+  char *h_block;
+  CubDebugExit(allocator.Allocate((void **) &h_block, 3 * 1024 * 1024));
+  h_block[0] = h_block[3 * 1024 * 1024 - 1] = 1;
+  CubDebugExit(allocator.Deallocate(h_block, 3 * 1024 * 1024));
+  AssertEquals(allocator.CachedBytes(), 4 * 1024 * 1024);
+
+  char *h_reused;
+  CubDebugExit(allocator.Allocate((void **) &h_reused, 4 * 1024 * 1024));
+  AssertEquals(h_reused, h_block);
+  CubDebugExit(allocator.Deallocate(h_reused, 4 * 1024 * 1024));
+
+  // Above the maximum bin, mapped without rounding
+  CubDebugExit(allocator.Allocate((void **) &h_block, 5 * 1024 * 1024 + 1));
+  h_block[5 * 1024 * 1024] = 1;
+  CubDebugExit(allocator.Deallocate(h_block, 5 * 1024 * 1024 + 1));
+
+  CubDebugExit(allocator.FreeAllCached());
+  AssertEquals(allocator.CachedBytes(), 0);
+}
+
+#endif // CUB_DETAIL_HAS_MMAP
+
+//---------------------------------------------------------------------
+// Main
+//---------------------------------------------------------------------
+
+/**
+ * Main
+ */
+int main()
+{
+  TestBins();
+  TestThreads(8, 10000);
+
+#ifdef CUB_DETAIL_HAS_MMAP
+  TestMmap();
+#endif
+
+  printf("Success\n");
+  return 0;
+}
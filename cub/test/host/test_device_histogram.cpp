@@ -0,0 +1,274 @@
+/******************************************************************************
+ * Copyright (c) 2024, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the NVIDIA CORPORATION nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL NVIDIA CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+
+/******************************************************************************
+ * Test of DeviceHistogram on the host backend
+ ******************************************************************************/
+
+#include <cub/device/device_histogram.cuh>
+
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "test_util_host.h"
+
+using namespace cub;
+
+/**
+ * Returns the bin of `sample` among the bins [levels[i], levels[i + 1]), or
+ * -1 if it falls outside of all of them
+ */
+template <typename SampleT, typename LevelT>
+int ReferenceBin(SampleT sample, const std::vector<LevelT> &levels)
+{
+  for (std::size_t bin = 0; bin + 1 < levels.size(); ++bin)
+  {
+    if (levels[bin] <= sample && sample < levels[bin + 1])
+    {
+      return static_cast<int>(bin);
+    }
+  }
+  return -1;
+}
+
+/**
+ * Test single-channel histograms with evenly spaced and custom levels, of all
+ * samples and of a region of interest
+ */
+void TestSingleChannel(int num_rows, int num_row_samples)
+{
+  printf("Testing single-channel histograms of %d x %d samples...\n", num_rows, num_row_samples);
+  fflush(stdout);
+
+  // Rows are padded with samples which must not be counted
+  const int row_stride = num_row_samples + 3;
+
+  std::mt19937 gen(num_rows * num_row_samples);
+  std::uniform_int_distribution<int> dist(-10, 300);
+
+  std::vector<int> h_samples(num_rows * row_stride);
+  for (int &sample : h_samples)
+  {
+    sample = dist(gen);
+  }
+
+  // 8 bins of width 32 in [0, 256), which integer samples map to exactly
+  const int num_levels = 9;
+  std::vector<int> h_even_levels(num_levels);
+  for (int level = 0; level < num_levels; ++level)
+  {
+    h_even_levels[level] = 32 * level;
+  }
+  std::vector<int> h_range_levels = {-5, 0, 1, 100, 101, 250};
+
+  std::vector<int> h_even_reference(num_levels - 1, 0);
+  std::vector<int> h_range_reference(h_range_levels.size() - 1, 0);
+  std::vector<int> h_roi_reference(num_levels - 1, 0);
+  for (int row = 0; row < num_rows; ++row)
+  {
+    for (int i = 0; i < row_stride; ++i)
+    {
+      const int sample = h_samples[row * row_stride + i];
+
+      int bin = ReferenceBin(sample, h_even_levels);
+      if (bin >= 0)
+      {
+        ++h_even_reference[bin];
+        if (i < num_row_samples)
+        {
+          ++h_roi_reference[bin];
+        }
+      }
+
+      bin = ReferenceBin(sample, h_range_levels);
+      if (bin >= 0)
+      {
+        ++h_range_reference[bin];
+      }
+    }
+  }
+
+  const int num_samples = static_cast<int>(h_samples.size());
+  std::vector<int> h_histogram(num_levels - 1, -1);
+
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceHistogram::HistogramEven(
+      d_temp_storage, temp_storage_bytes, h_samples.data(), h_histogram.data(), num_levels, 0, 256, num_samples);
+  });
+  AssertTrue(h_histogram == h_even_reference);
+
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceHistogram::HistogramEven(d_temp_storage,
+                                          temp_storage_bytes,
+                                          h_samples.data(),
+                                          h_histogram.data(),
+                                          num_levels,
+                                          0,
+                                          256,
+                                          num_row_samples,
+                                          num_rows,
+                                          row_stride * sizeof(int));
+  });
+  AssertTrue(h_histogram == h_roi_reference);
+
+  h_histogram.assign(h_range_levels.size() - 1, -1);
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceHistogram::HistogramRange(d_temp_storage,
+                                           temp_storage_bytes,
+                                           h_samples.data(),
+                                           h_histogram.data(),
+                                           static_cast<int>(h_range_levels.size()),
+                                           h_range_levels.data(),
+                                           num_samples);
+  });
+  AssertTrue(h_histogram == h_range_reference);
+}
+
+/**
+ * Test histograms of three active channels of RGBA pixels
+ */
+void TestMultiChannel(int num_pixels)
+{
+  printf("Testing multi-channel histograms of %d pixels...\n", num_pixels);
+  fflush(stdout);
+
+  constexpr int num_channels        = 4;
+  constexpr int num_active_channels = 3;
+
+  std::mt19937 gen(num_pixels);
+  std::uniform_int_distribution<int> dist(0, 255);
+
+  std::vector<unsigned char> h_samples(num_pixels * num_channels);
+  for (unsigned char &sample : h_samples)
+  {
+    sample = static_cast<unsigned char>(dist(gen));
+  }
+
+  // Bins of width 1, 16 and 64 in [0, 256)
+  int num_levels[num_active_channels]  = {257, 17, 5};
+  int lower_level[num_active_channels] = {0, 0, 0};
+  int upper_level[num_active_channels] = {256, 256, 256};
+
+  std::vector<int> h_levels[num_active_channels] = {{0, 1, 2, 255, 256}, {10, 20, 30}, {0, 128, 200, 256}};
+  int *d_levels[num_active_channels]             = {h_levels[0].data(), h_levels[1].data(), h_levels[2].data()};
+  int num_range_levels[num_active_channels]      = {5, 3, 4};
+
+  std::vector<int> h_even_reference[num_active_channels];
+  std::vector<int> h_range_reference[num_active_channels];
+  for (int channel = 0; channel < num_active_channels; ++channel)
+  {
+    h_even_reference[channel].assign(num_levels[channel] - 1, 0);
+    h_range_reference[channel].assign(num_range_levels[channel] - 1, 0);
+  }
+
+  for (int pixel = 0; pixel < num_pixels; ++pixel)
+  {
+    for (int channel = 0; channel < num_active_channels; ++channel)
+    {
+      const int sample = h_samples[pixel * num_channels + channel];
+      ++h_even_reference[channel][sample * (num_levels[channel] - 1) / 256];
+
+      const int bin = ReferenceBin(sample, h_levels[channel]);
+      if (bin >= 0)
+      {
+        ++h_range_reference[channel][bin];
+      }
+    }
+  }
+
+  std::vector<int> h_histograms[num_active_channels];
+  int *d_histogram[num_active_channels];
+  for (int channel = 0; channel < num_active_channels; ++channel)
+  {
+    h_histograms[channel].assign(num_levels[channel] - 1, -1);
+    d_histogram[channel] = h_histograms[channel].data();
+  }
+
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceHistogram::MultiHistogramEven<num_channels, num_active_channels>(
+      d_temp_storage, temp_storage_bytes, h_samples.data(), d_histogram, num_levels, lower_level, upper_level, num_pixels);
+  });
+  for (int channel = 0; channel < num_active_channels; ++channel)
+  {
+    AssertTrue(h_histograms[channel] == h_even_reference[channel]);
+  }
+
+  for (int channel = 0; channel < num_active_channels; ++channel)
+  {
+    h_histograms[channel].assign(num_range_levels[channel] - 1, -1);
+    d_histogram[channel] = h_histograms[channel].data();
+  }
+
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceHistogram::MultiHistogramRange<num_channels, num_active_channels>(
+      d_temp_storage, temp_storage_bytes, h_samples.data(), d_histogram, num_range_levels, d_levels, num_pixels);
+  });
+  for (int channel = 0; channel < num_active_channels; ++channel)
+  {
+    AssertTrue(h_histograms[channel] == h_range_reference[channel]);
+  }
+}
+
+/**
+ * Test that histograms of no samples are zeroed
+ */
+void TestEmpty()
+{
+  printf("Testing empty sequences...\n");
+  fflush(stdout);
+
+  int sample = 1;
+  std::vector<int> h_histogram(4, -1);
+
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceHistogram::HistogramEven(
+      d_temp_storage, temp_storage_bytes, &sample, h_histogram.data(), 5, 0, 4, 0);
+  });
+  AssertTrue(h_histogram == std::vector<int>(4, 0));
+}
+
+int main()
+{
+  TestEmpty();
+
+  for (int num_rows : {1, 7, 300})
+  {
+    for (int num_row_samples : {1, 1000})
+    {
+      TestSingleChannel(num_rows, num_row_samples);
+    }
+  }
+
+  for (int num_pixels : {1, 1000, 1 << 20})
+  {
+    TestMultiChannel(num_pixels);
+  }
+
+  printf("Success\n");
+  return 0;
+}
@@ -0,0 +1,193 @@
+/******************************************************************************
+ * Copyright (c) 2024, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the NVIDIA CORPORATION nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL NVIDIA CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+
+/******************************************************************************
+ * Test of DeviceRadixSort on the host backend
+ ******************************************************************************/
+
+#include <cub/device/device_radix_sort.cuh>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "test_util_host.h"
+
+using namespace cub;
+
+/**
+ * Sorts key-value pairs by the bits [begin_bit, end_bit) of the keys and
+ * compares against a stable sort
+ */
+template <typename KeyT>
+void TestPairs(int num_items, int begin_bit, int end_bit, bool descending)
+{
+  printf("Testing %d pairs of %d-byte keys, bits [%d, %d), %s...\n",
+         num_items, static_cast<int>(sizeof(KeyT)), begin_bit, end_bit,
+         descending ? "descending" : "ascending");
+  fflush(stdout);
+
+  using UnsignedBits = typename Traits<KeyT>::UnsignedBits;
+
+  std::mt19937 gen(num_items + begin_bit + end_bit);
+  std::uniform_int_distribution<std::uint64_t> dist;
+
+  std::vector<KeyT> h_keys_in(num_items);
+  std::vector<int> h_values_in(num_items);
+  for (int i = 0; i < num_items; ++i)
+  {
+    // signed values, so that floating point keys are negative as well
+    h_keys_in[i]   = static_cast<KeyT>(static_cast<std::int64_t>(dist(gen)));
+    h_values_in[i] = i;
+  }
+
+  // Reference: a stable sort by the selected bits of the twiddled keys
+  auto digit = [=](KeyT key) {
+    UnsignedBits bits;
+    std::memcpy(&bits, &key, sizeof(key));
+    bits = Traits<KeyT>::TwiddleIn(bits);
+    const int num_bits = end_bit - begin_bit;
+    bits >>= begin_bit;
+    if (num_bits < static_cast<int>(sizeof(UnsignedBits) * 8))
+    {
+      bits &= (UnsignedBits(1) << num_bits) - 1;
+    }
+    return bits;
+  };
+
+  std::vector<int> h_reference(num_items);
+  for (int i = 0; i < num_items; ++i)
+  {
+    h_reference[i] = i;
+  }
+  std::stable_sort(h_reference.begin(), h_reference.end(), [&](int lhs, int rhs) {
+    return descending ? digit(h_keys_in[rhs]) < digit(h_keys_in[lhs])
+                      : digit(h_keys_in[lhs]) < digit(h_keys_in[rhs]);
+  });
+
+  std::vector<KeyT> h_keys_out(num_items);
+  std::vector<int> h_values_out(num_items);
+
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return descending ? DeviceRadixSort::SortPairsDescending(d_temp_storage,
+                                                             temp_storage_bytes,
+                                                             h_keys_in.data(),
+                                                             h_keys_out.data(),
+                                                             h_values_in.data(),
+                                                             h_values_out.data(),
+                                                             num_items,
+                                                             begin_bit,
+                                                             end_bit)
+                      : DeviceRadixSort::SortPairs(d_temp_storage,
+                                                   temp_storage_bytes,
+                                                   h_keys_in.data(),
+                                                   h_keys_out.data(),
+                                                   h_values_in.data(),
+                                                   h_values_out.data(),
+                                                   num_items,
+                                                   begin_bit,
+                                                   end_bit);
+  });
+
+  for (int i = 0; i < num_items; ++i)
+  {
+    AssertEquals(h_values_out[i], h_reference[i]);
+    AssertTrue(h_keys_out[i] == h_keys_in[h_reference[i]]);
+  }
+
+  // Keys only, with double buffers
+  std::vector<KeyT> h_keys_alt(num_items);
+  std::vector<KeyT> h_keys(h_keys_in);
+  DoubleBuffer<KeyT> d_keys(h_keys.data(), h_keys_alt.data());
+
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return descending
+           ? DeviceRadixSort::SortKeysDescending(d_temp_storage, temp_storage_bytes, d_keys, num_items, begin_bit, end_bit)
+           : DeviceRadixSort::SortKeys(d_temp_storage, temp_storage_bytes, d_keys, num_items, begin_bit, end_bit);
+  });
+
+  for (int i = 0; i < num_items; ++i)
+  {
+    AssertTrue(d_keys.Current()[i] == h_keys_in[h_reference[i]]);
+  }
+}
+
+/**
+ * Test sorting an empty sequence
+ */
+void TestEmpty()
+{
+  printf("Testing empty sequences...\n");
+  fflush(stdout);
+
+  int key_in    = 42;
+  int key_out   = 7;
+  int value_in  = 1;
+  int value_out = 3;
+
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceRadixSort::SortPairs(
+      d_temp_storage, temp_storage_bytes, &key_in, &key_out, &value_in, &value_out, 0);
+  });
+
+  AssertEquals(key_out, 7);
+  AssertEquals(value_out, 3);
+
+  DoubleBuffer<int> d_keys(&key_in, &key_out);
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceRadixSort::SortKeysDescending(d_temp_storage, temp_storage_bytes, d_keys, 0);
+  });
+
+  AssertEquals(key_in, 42);
+  AssertEquals(key_out, 7);
+}
+
+int main()
+{
+  TestEmpty();
+
+  for (int num_items : {1, 1000, 1 << 17})
+  {
+    for (bool descending : {false, true})
+    {
+      TestPairs<std::uint32_t>(num_items, 0, 32, descending);
+      TestPairs<std::uint32_t>(num_items, 4, 13, descending);
+      TestPairs<std::int64_t>(num_items, 0, 64, descending);
+      TestPairs<std::int64_t>(num_items, 40, 64, descending);
+      TestPairs<std::int8_t>(num_items, 0, 8, descending);
+      TestPairs<float>(num_items, 0, 32, descending);
+      TestPairs<double>(num_items, 3, 61, descending);
+    }
+  }
+
+  printf("Success\n");
+  return 0;
+}
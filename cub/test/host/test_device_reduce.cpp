@@ -0,0 +1,231 @@
+/******************************************************************************
+ * Copyright (c) 2024, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the NVIDIA CORPORATION nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL NVIDIA CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+
+/******************************************************************************
+ * Test of DeviceReduce on the host backend
+ ******************************************************************************/
+
+#include <cub/device/device_reduce.cuh>
+
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "test_util_host.h"
+
+using namespace cub;
+
+struct Square
+{
+  long long operator()(int x) const
+  {
+    return static_cast<long long>(x) * x;
+  }
+};
+
+/**
+ * Test the reductions against serial reductions
+ */
+void TestReduce(int num_items)
+{
+  printf("Testing reductions of %d items...\n", num_items);
+  fflush(stdout);
+
+  std::mt19937 gen(num_items);
+  std::uniform_int_distribution<int> dist(-1000, 1000);
+
+  std::vector<int> h_in(num_items);
+  for (int &item : h_in)
+  {
+    item = dist(gen);
+  }
+
+  long long sum         = 0;
+  long long sum_squares = 0;
+  int argmin            = 0;
+  int argmax            = 0;
+  for (int i = 0; i < num_items; ++i)
+  {
+    sum += h_in[i];
+    sum_squares += static_cast<long long>(h_in[i]) * h_in[i];
+    // the first of equal extrema
+    argmin = h_in[i] < h_in[argmin] ? i : argmin;
+    argmax = h_in[i] > h_in[argmax] ? i : argmax;
+  }
+
+  long long h_sum = 0;
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceReduce::Reduce(
+      d_temp_storage, temp_storage_bytes, h_in.data(), &h_sum, num_items, Sum(), 0ll);
+  });
+  AssertEquals(h_sum, sum);
+
+  long long h_sum_squares = 0;
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceReduce::TransformReduce(
+      d_temp_storage, temp_storage_bytes, h_in.data(), &h_sum_squares, num_items, Sum(), Square(), 0ll);
+  });
+  AssertEquals(h_sum_squares, sum_squares);
+
+  int h_min = 0;
+  int h_max = 0;
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceReduce::Min(d_temp_storage, temp_storage_bytes, h_in.data(), &h_min, num_items);
+  });
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceReduce::Max(d_temp_storage, temp_storage_bytes, h_in.data(), &h_max, num_items);
+  });
+  AssertEquals(h_min, h_in[argmin]);
+  AssertEquals(h_max, h_in[argmax]);
+
+  KeyValuePair<int, int> h_argmin;
+  KeyValuePair<int, int> h_argmax;
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceReduce::ArgMin(d_temp_storage, temp_storage_bytes, h_in.data(), &h_argmin, num_items);
+  });
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceReduce::ArgMax(d_temp_storage, temp_storage_bytes, h_in.data(), &h_argmax, num_items);
+  });
+  AssertEquals(h_argmin.key, argmin);
+  AssertEquals(h_argmin.value, h_in[argmin]);
+  AssertEquals(h_argmax.key, argmax);
+  AssertEquals(h_argmax.value, h_in[argmax]);
+}
+
+/**
+ * Test the reduction by key against a serial reduction of every run
+ */
+void TestReduceByKey(int num_items)
+{
+  printf("Testing reductions by key of %d items...\n", num_items);
+  fflush(stdout);
+
+  std::mt19937 gen(num_items);
+  std::uniform_int_distribution<int> dist(0, 9);
+
+  std::vector<int> h_keys(num_items);
+  std::vector<int> h_values(num_items);
+  for (int i = 0; i < num_items; ++i)
+  {
+    h_keys[i]   = (i > 0 && dist(gen) > 1) ? h_keys[i - 1] : dist(gen);
+    h_values[i] = dist(gen);
+  }
+
+  std::vector<int> h_unique;
+  std::vector<int> h_aggregates;
+  for (int i = 0; i < num_items; ++i)
+  {
+    if (i == 0 || h_keys[i - 1] != h_keys[i])
+    {
+      h_unique.push_back(h_keys[i]);
+      h_aggregates.push_back(0);
+    }
+    h_aggregates.back() += h_values[i];
+  }
+
+  std::vector<int> h_unique_out(num_items);
+  std::vector<int> h_aggregates_out(num_items);
+  int h_num_runs = -1;
+
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceReduce::ReduceByKey(d_temp_storage,
+                                     temp_storage_bytes,
+                                     h_keys.data(),
+                                     h_unique_out.data(),
+                                     h_values.data(),
+                                     h_aggregates_out.data(),
+                                     &h_num_runs,
+                                     Sum(),
+                                     num_items);
+  });
+
+  AssertEquals(h_num_runs, static_cast<int>(h_unique.size()));
+  h_unique_out.resize(h_num_runs);
+  h_aggregates_out.resize(h_num_runs);
+  AssertTrue(h_unique_out == h_unique);
+  AssertTrue(h_aggregates_out == h_aggregates);
+}
+
+/**
+ * Test reducing an empty sequence, which yields the initial values
+ */
+void TestEmpty()
+{
+  printf("Testing empty sequences...\n");
+  fflush(stdout);
+
+  int in = 1;
+
+  int h_sum = -1;
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceReduce::Sum(d_temp_storage, temp_storage_bytes, &in, &h_sum, 0);
+  });
+  AssertEquals(h_sum, 0);
+
+  int h_product = -1;
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceReduce::Reduce(
+      d_temp_storage, temp_storage_bytes, &in, &h_product, 0, [](int a, int b) { return a * b; }, 42);
+  });
+  AssertEquals(h_product, 42);
+
+  int h_min = -1;
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceReduce::Min(d_temp_storage, temp_storage_bytes, &in, &h_min, 0);
+  });
+  AssertEquals(h_min, (std::numeric_limits<int>::max)());
+
+  KeyValuePair<int, int> h_argmax;
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceReduce::ArgMax(d_temp_storage, temp_storage_bytes, &in, &h_argmax, 0);
+  });
+  AssertEquals(h_argmax.key, 1);
+  AssertEquals(h_argmax.value, (std::numeric_limits<int>::lowest)());
+
+  int h_num_runs = -1;
+  int out        = 2;
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceReduce::ReduceByKey(d_temp_storage, temp_storage_bytes, &in, &out, &in, &out, &h_num_runs, Sum(), 0);
+  });
+  AssertEquals(h_num_runs, 0);
+  AssertEquals(out, 2);
+}
+
+int main()
+{
+  TestEmpty();
+
+  for (int num_items : {1, 2, 1000, 1 << 20})
+  {
+    TestReduce(num_items);
+    TestReduceByKey(num_items);
+  }
+
+  printf("Success\n");
+  return 0;
+}
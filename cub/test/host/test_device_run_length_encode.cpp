@@ -0,0 +1,159 @@
+/******************************************************************************
+ * Copyright (c) 2024, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the NVIDIA CORPORATION nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL NVIDIA CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+
+/******************************************************************************
+ * Test of DeviceRunLengthEncode on the host backend
+ ******************************************************************************/
+
+#include <cub/device/device_run_length_encode.cuh>
+
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "test_util_host.h"
+
+using namespace cub;
+
+/**
+ * Test the encodings against a serial scan for runs
+ */
+void TestEncode(int num_items)
+{
+  printf("Testing encodings of %d items...\n", num_items);
+  fflush(stdout);
+
+  std::mt19937 gen(num_items);
+  std::uniform_int_distribution<int> dist(0, 9);
+
+  std::vector<int> h_in(num_items);
+  for (int i = 0; i < num_items; ++i)
+  {
+    // runs of random length, many of them trivial
+    h_in[i] = (i > 0 && dist(gen) > 4) ? h_in[i - 1] : dist(gen);
+  }
+
+  std::vector<int> h_unique;
+  std::vector<int> h_counts;
+  std::vector<int> h_offsets;
+  std::vector<int> h_lengths;
+  for (int i = 0; i < num_items;)
+  {
+    int end = i + 1;
+    while (end < num_items && h_in[end] == h_in[i])
+    {
+      ++end;
+    }
+
+    h_unique.push_back(h_in[i]);
+    h_counts.push_back(end - i);
+    if (end - i > 1)
+    {
+      h_offsets.push_back(i);
+      h_lengths.push_back(end - i);
+    }
+    i = end;
+  }
+
+  std::vector<int> h_unique_out(num_items, -1);
+  std::vector<int> h_counts_out(num_items, -1);
+  int h_num_runs = -1;
+
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceRunLengthEncode::Encode(d_temp_storage,
+                                         temp_storage_bytes,
+                                         h_in.data(),
+                                         h_unique_out.data(),
+                                         h_counts_out.data(),
+                                         &h_num_runs,
+                                         num_items);
+  });
+
+  AssertEquals(h_num_runs, static_cast<int>(h_unique.size()));
+  h_unique_out.resize(h_num_runs);
+  h_counts_out.resize(h_num_runs);
+  AssertTrue(h_unique_out == h_unique);
+  AssertTrue(h_counts_out == h_counts);
+
+  std::vector<int> h_offsets_out(num_items, -1);
+  std::vector<int> h_lengths_out(num_items, -1);
+
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceRunLengthEncode::NonTrivialRuns(d_temp_storage,
+                                                 temp_storage_bytes,
+                                                 h_in.data(),
+                                                 h_offsets_out.data(),
+                                                 h_lengths_out.data(),
+                                                 &h_num_runs,
+                                                 num_items);
+  });
+
+  AssertEquals(h_num_runs, static_cast<int>(h_offsets.size()));
+  h_offsets_out.resize(h_num_runs);
+  h_lengths_out.resize(h_num_runs);
+  AssertTrue(h_offsets_out == h_offsets);
+  AssertTrue(h_lengths_out == h_lengths);
+}
+
+/**
+ * Test encoding an empty sequence
+ */
+void TestEmpty()
+{
+  printf("Testing empty sequences...\n");
+  fflush(stdout);
+
+  int in         = 1;
+  int out        = 2;
+  int h_num_runs = -1;
+
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceRunLengthEncode::Encode(d_temp_storage, temp_storage_bytes, &in, &out, &out, &h_num_runs, 0);
+  });
+  AssertEquals(h_num_runs, 0);
+
+  h_num_runs = -1;
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceRunLengthEncode::NonTrivialRuns(d_temp_storage, temp_storage_bytes, &in, &out, &out, &h_num_runs, 0);
+  });
+  AssertEquals(h_num_runs, 0);
+
+  AssertEquals(out, 2);
+}
+
+int main()
+{
+  TestEmpty();
+
+  for (int num_items : {1, 2, 1000, 1 << 20})
+  {
+    TestEncode(num_items);
+  }
+
+  printf("Success\n");
+  return 0;
+}
@@ -0,0 +1,215 @@
+/******************************************************************************
+ * Copyright (c) 2024, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the NVIDIA CORPORATION nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL NVIDIA CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+
+/******************************************************************************
+ * Test of DeviceScan on the host backend
+ ******************************************************************************/
+
+#include <cub/device/device_scan.cuh>
+
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "test_util_host.h"
+
+using namespace cub;
+
+/**
+ * Test the scans out-of-place and in-place against a serial scan
+ */
+void TestScan(int num_items)
+{
+  printf("Testing scans of %d items...\n", num_items);
+  fflush(stdout);
+
+  std::mt19937 gen(num_items);
+  std::uniform_int_distribution<int> dist(-1000, 1000);
+
+  std::vector<int> h_in(num_items);
+  for (int &item : h_in)
+  {
+    item = dist(gen);
+  }
+
+  std::vector<int> h_exclusive_sum(num_items);
+  std::vector<int> h_inclusive_max(num_items);
+  int sum = 0;
+  int max = -5000;
+  for (int i = 0; i < num_items; ++i)
+  {
+    h_exclusive_sum[i] = sum;
+    sum += h_in[i];
+    max                = CUB_MAX(max, h_in[i]);
+    h_inclusive_max[i] = max;
+  }
+
+  std::vector<int> h_out(num_items, -1);
+
+  // Out-of-place
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceScan::ExclusiveSum(d_temp_storage, temp_storage_bytes, h_in.data(), h_out.data(), num_items);
+  });
+  AssertTrue(h_out == h_exclusive_sum);
+
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceScan::InclusiveScan(
+      d_temp_storage, temp_storage_bytes, h_in.data(), h_out.data(), Max(), num_items);
+  });
+  AssertTrue(h_out == h_inclusive_max);
+
+  // An initial value, also read when the scan runs
+  int h_init = -5000;
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceScan::ExclusiveScan(
+      d_temp_storage, temp_storage_bytes, h_in.data(), h_out.data(), Max(), FutureValue<int>(&h_init), num_items);
+  });
+  for (int i = 0; i < num_items; ++i)
+  {
+    AssertEquals(h_out[i], i == 0 ? -5000 : h_inclusive_max[i - 1]);
+  }
+
+  // In-place
+  std::vector<int> h_data(h_in);
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceScan::ExclusiveSum(d_temp_storage, temp_storage_bytes, h_data.data(), num_items);
+  });
+  AssertTrue(h_data == h_exclusive_sum);
+
+  h_data = h_in;
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceScan::InclusiveScan(d_temp_storage, temp_storage_bytes, h_data.data(), Max(), num_items);
+  });
+  AssertTrue(h_data == h_inclusive_max);
+
+  h_data = h_in;
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceScan::InclusiveSum(d_temp_storage, temp_storage_bytes, h_data.data(), num_items);
+  });
+  for (int i = 0; i < num_items; ++i)
+  {
+    AssertEquals(h_data[i], h_exclusive_sum[i] + h_in[i]);
+  }
+}
+
+/**
+ * Test the scans by key against serial scans restarting at every key change
+ */
+void TestScanByKey(int num_items)
+{
+  printf("Testing scans by key of %d items...\n", num_items);
+  fflush(stdout);
+
+  std::mt19937 gen(num_items);
+  std::uniform_int_distribution<int> dist(0, 9);
+
+  std::vector<int> h_keys(num_items);
+  std::vector<int> h_values(num_items);
+  for (int i = 0; i < num_items; ++i)
+  {
+    // runs of random length
+    h_keys[i]   = (i > 0 && dist(gen) > 1) ? h_keys[i - 1] : dist(gen);
+    h_values[i] = dist(gen);
+  }
+
+  std::vector<int> h_exclusive(num_items);
+  std::vector<int> h_inclusive(num_items);
+  for (int i = 0; i < num_items; ++i)
+  {
+    const bool head = i == 0 || h_keys[i - 1] != h_keys[i];
+    h_exclusive[i]  = head ? 0 : h_inclusive[i - 1];
+    h_inclusive[i]  = h_exclusive[i] + h_values[i];
+  }
+
+  std::vector<int> h_out(num_items, -1);
+
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceScan::ExclusiveSumByKey(
+      d_temp_storage, temp_storage_bytes, h_keys.data(), h_values.data(), h_out.data(), num_items);
+  });
+  AssertTrue(h_out == h_exclusive);
+
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceScan::InclusiveSumByKey(
+      d_temp_storage, temp_storage_bytes, h_keys.data(), h_values.data(), h_out.data(), num_items);
+  });
+  AssertTrue(h_out == h_inclusive);
+
+  // In-place on the values
+  std::vector<int> h_data(h_values);
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceScan::ExclusiveScanByKey(
+      d_temp_storage, temp_storage_bytes, h_keys.data(), h_data.data(), h_data.data(), Sum(), 0, num_items);
+  });
+  AssertTrue(h_data == h_exclusive);
+
+  h_data = h_values;
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceScan::InclusiveScanByKey(
+      d_temp_storage, temp_storage_bytes, h_keys.data(), h_data.data(), h_data.data(), Sum(), num_items);
+  });
+  AssertTrue(h_data == h_inclusive);
+}
+
+/**
+ * Test scanning an empty sequence
+ */
+void TestEmpty()
+{
+  printf("Testing empty sequences...\n");
+  fflush(stdout);
+
+  int in  = 1;
+  int out = 2;
+
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceScan::ExclusiveSum(d_temp_storage, temp_storage_bytes, &in, &out, 0);
+  });
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceScan::InclusiveSum(d_temp_storage, temp_storage_bytes, &in, &out, 0);
+  });
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceScan::InclusiveSumByKey(d_temp_storage, temp_storage_bytes, &in, &in, &out, 0);
+  });
+
+  AssertEquals(in, 1);
+  AssertEquals(out, 2);
+}
+
+int main()
+{
+  TestEmpty();
+
+  for (int num_items : {1, 2, 1000, 1 << 20})
+  {
+    TestScan(num_items);
+    TestScanByKey(num_items);
+  }
+
+  printf("Success\n");
+  return 0;
+}
@@ -0,0 +1,184 @@
+/******************************************************************************
+ * Copyright (c) 2024, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the NVIDIA CORPORATION nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL NVIDIA CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+
+/******************************************************************************
+ * Test of DeviceSegmentedReduce on the host backend
+ ******************************************************************************/
+
+#include <cub/device/device_segmented_reduce.cuh>
+
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "test_util_host.h"
+
+using namespace cub;
+
+/**
+ * Test the segmented reductions against serial reductions, with a share of
+ * empty segments
+ */
+void TestSegmentedReduce(int num_segments)
+{
+  printf("Testing reductions of %d segments...\n", num_segments);
+  fflush(stdout);
+
+  std::mt19937 gen(num_segments);
+  std::uniform_int_distribution<int> dist(-1000, 1000);
+
+  std::vector<int> h_offsets(num_segments + 1);
+  h_offsets[0] = 0;
+  for (int segment = 0; segment < num_segments; ++segment)
+  {
+    const int size          = dist(gen) % 64;
+    h_offsets[segment + 1] = h_offsets[segment] + (size > 0 ? size : 0);
+  }
+
+  const int num_items = h_offsets[num_segments];
+  std::vector<int> h_in(num_items);
+  for (int &item : h_in)
+  {
+    item = dist(gen);
+  }
+
+  std::vector<int> h_sums(num_segments);
+  std::vector<int> h_mins(num_segments);
+  std::vector<KeyValuePair<int, int>> h_argmaxs(num_segments);
+  for (int segment = 0; segment < num_segments; ++segment)
+  {
+    const int begin = h_offsets[segment];
+    const int end   = h_offsets[segment + 1];
+
+    // empty segments yield the initial values
+    int sum                       = 0;
+    int min                       = (std::numeric_limits<int>::max)();
+    KeyValuePair<int, int> argmax = {1, (std::numeric_limits<int>::lowest)()};
+    for (int i = begin; i < end; ++i)
+    {
+      sum += h_in[i];
+      min = CUB_MIN(min, h_in[i]);
+      if (i == begin || h_in[i] > argmax.value)
+      {
+        argmax = {i - begin, h_in[i]};
+      }
+    }
+
+    h_sums[segment]    = sum;
+    h_mins[segment]    = min;
+    h_argmaxs[segment] = argmax;
+  }
+
+  std::vector<int> h_out(num_segments, -1);
+
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceSegmentedReduce::Sum(d_temp_storage,
+                                      temp_storage_bytes,
+                                      h_in.data(),
+                                      h_out.data(),
+                                      num_segments,
+                                      h_offsets.data(),
+                                      h_offsets.data() + 1);
+  });
+  AssertTrue(h_out == h_sums);
+
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceSegmentedReduce::Min(d_temp_storage,
+                                      temp_storage_bytes,
+                                      h_in.data(),
+                                      h_out.data(),
+                                      num_segments,
+                                      h_offsets.data(),
+                                      h_offsets.data() + 1);
+  });
+  AssertTrue(h_out == h_mins);
+
+  // A custom operator with an initial value
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceSegmentedReduce::Reduce(d_temp_storage,
+                                         temp_storage_bytes,
+                                         h_in.data(),
+                                         h_out.data(),
+                                         num_segments,
+                                         h_offsets.data(),
+                                         h_offsets.data() + 1,
+                                         Sum(),
+                                         100);
+  });
+  for (int segment = 0; segment < num_segments; ++segment)
+  {
+    AssertEquals(h_out[segment], h_sums[segment] + 100);
+  }
+
+  std::vector<KeyValuePair<int, int>> h_argmax_out(num_segments);
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceSegmentedReduce::ArgMax(d_temp_storage,
+                                         temp_storage_bytes,
+                                         h_in.data(),
+                                         h_argmax_out.data(),
+                                         num_segments,
+                                         h_offsets.data(),
+                                         h_offsets.data() + 1);
+  });
+  for (int segment = 0; segment < num_segments; ++segment)
+  {
+    AssertEquals(h_argmax_out[segment].key, h_argmaxs[segment].key);
+    AssertEquals(h_argmax_out[segment].value, h_argmaxs[segment].value);
+  }
+}
+
+/**
+ * Test reducing no segments
+ */
+void TestEmpty()
+{
+  printf("Testing no segments...\n");
+  fflush(stdout);
+
+  int in     = 1;
+  int out    = 2;
+  int offset = 0;
+
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceSegmentedReduce::Sum(d_temp_storage, temp_storage_bytes, &in, &out, 0, &offset, &offset);
+  });
+  AssertEquals(out, 2);
+}
+
+int main()
+{
+  TestEmpty();
+
+  for (int num_segments : {1, 2, 1000, 1 << 16})
+  {
+    TestSegmentedReduce(num_segments);
+  }
+
+  printf("Success\n");
+  return 0;
+}
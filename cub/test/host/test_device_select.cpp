@@ -0,0 +1,193 @@
+/******************************************************************************
+ * Copyright (c) 2024, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the NVIDIA CORPORATION nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL NVIDIA CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+
+/******************************************************************************
+ * Test of DeviceSelect on the host backend
+ ******************************************************************************/
+
+#include <cub/device/device_select.cuh>
+
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "test_util_host.h"
+
+using namespace cub;
+
+struct IsEven
+{
+  bool operator()(int x) const
+  {
+    return x % 2 == 0;
+  }
+};
+
+/**
+ * Test the selections out-of-place and in-place against serial selections
+ */
+void TestSelect(int num_items)
+{
+  printf("Testing selections of %d items...\n", num_items);
+  fflush(stdout);
+
+  std::mt19937 gen(num_items);
+  std::uniform_int_distribution<int> dist(0, 9);
+
+  std::vector<int> h_in(num_items);
+  std::vector<char> h_flags(num_items);
+  std::vector<int> h_values(num_items);
+  for (int i = 0; i < num_items; ++i)
+  {
+    // runs of random length
+    h_in[i]     = (i > 0 && dist(gen) > 3) ? h_in[i - 1] : dist(gen);
+    h_flags[i]  = dist(gen) < 3;
+    h_values[i] = i;
+  }
+
+  std::vector<int> h_flagged;
+  std::vector<int> h_even;
+  std::vector<int> h_unique;
+  std::vector<int> h_unique_values;
+  for (int i = 0; i < num_items; ++i)
+  {
+    if (h_flags[i])
+    {
+      h_flagged.push_back(h_in[i]);
+    }
+    if (IsEven()(h_in[i]))
+    {
+      h_even.push_back(h_in[i]);
+    }
+    if (i == 0 || h_in[i - 1] != h_in[i])
+    {
+      h_unique.push_back(h_in[i]);
+      h_unique_values.push_back(i);
+    }
+  }
+
+  std::vector<int> h_out(num_items, -1);
+  int h_num_selected = -1;
+
+  auto selected = [&]() {
+    return std::vector<int>(h_out.begin(), h_out.begin() + h_num_selected);
+  };
+
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceSelect::Flagged(
+      d_temp_storage, temp_storage_bytes, h_in.data(), h_flags.data(), h_out.data(), &h_num_selected, num_items);
+  });
+  AssertTrue(selected() == h_flagged);
+
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceSelect::If(
+      d_temp_storage, temp_storage_bytes, h_in.data(), h_out.data(), &h_num_selected, num_items, IsEven());
+  });
+  AssertTrue(selected() == h_even);
+
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceSelect::Unique(
+      d_temp_storage, temp_storage_bytes, h_in.data(), h_out.data(), &h_num_selected, num_items);
+  });
+  AssertTrue(selected() == h_unique);
+
+  std::vector<int> h_values_out(num_items, -1);
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceSelect::UniqueByKey(d_temp_storage,
+                                     temp_storage_bytes,
+                                     h_in.data(),
+                                     h_values.data(),
+                                     h_out.data(),
+                                     h_values_out.data(),
+                                     &h_num_selected,
+                                     num_items);
+  });
+  AssertTrue(selected() == h_unique);
+  h_values_out.resize(h_num_selected);
+  AssertTrue(h_values_out == h_unique_values);
+
+  // In-place
+  std::vector<int> h_data(h_in);
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceSelect::Flagged(
+      d_temp_storage, temp_storage_bytes, h_data.data(), h_flags.data(), &h_num_selected, num_items);
+  });
+  AssertTrue(std::vector<int>(h_data.begin(), h_data.begin() + h_num_selected) == h_flagged);
+
+  h_data = h_in;
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceSelect::If(d_temp_storage, temp_storage_bytes, h_data.data(), &h_num_selected, num_items, IsEven());
+  });
+  AssertTrue(std::vector<int>(h_data.begin(), h_data.begin() + h_num_selected) == h_even);
+}
+
+/**
+ * Test selecting from an empty sequence
+ */
+void TestEmpty()
+{
+  printf("Testing empty sequences...\n");
+  fflush(stdout);
+
+  int in             = 1;
+  char flag          = 1;
+  int out            = 2;
+  int h_num_selected = -1;
+
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceSelect::Flagged(d_temp_storage, temp_storage_bytes, &in, &flag, &out, &h_num_selected, 0);
+  });
+  AssertEquals(h_num_selected, 0);
+
+  h_num_selected = -1;
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceSelect::If(d_temp_storage, temp_storage_bytes, &in, &h_num_selected, 0, IsEven());
+  });
+  AssertEquals(h_num_selected, 0);
+
+  h_num_selected = -1;
+  InvokeTwoPhase([&](void *d_temp_storage, size_t &temp_storage_bytes) {
+    return DeviceSelect::Unique(d_temp_storage, temp_storage_bytes, &in, &out, &h_num_selected, 0);
+  });
+  AssertEquals(h_num_selected, 0);
+
+  AssertEquals(in, 1);
+  AssertEquals(out, 2);
+}
+
+int main()
+{
+  TestEmpty();
+
+  for (int num_items : {1, 2, 1000, 1 << 20})
+  {
+    TestSelect(num_items);
+  }
+
+  printf("Success\n");
+  return 0;
+}
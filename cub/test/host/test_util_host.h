@@ -0,0 +1,81 @@
+/******************************************************************************
+ * Copyright (c) 2024, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the NVIDIA CORPORATION nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL NVIDIA CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+
+/******************************************************************************
+ * Test utilities for the host backend of the device-wide algorithms
+ ******************************************************************************/
+
+#pragma once
+
+#include <cub/util_debug.cuh>
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#ifndef CUB_HOST_BACKEND
+#  error "The host tests require CUB_HOST_BACKEND"
+#endif
+
+#define AssertEquals(a, b)                                                     \
+  if ((a) != (b))                                                              \
+  {                                                                            \
+    std::cerr << "\n"                                                          \
+              << __FILE__ << ": " << __LINE__                                  \
+              << ": AssertEquals(" #a ", " #b ") failed.\n";                   \
+    exit(1);                                                                   \
+  }
+
+#define AssertTrue(a)                                                          \
+  if (!(a))                                                                    \
+  {                                                                            \
+    std::cerr << "\n"                                                          \
+              << __FILE__ << ": " << __LINE__                                  \
+              << ": AssertTrue(" #a ") failed.\n";                             \
+    exit(1);                                                                   \
+  }
+
+/**
+ * Invokes `algorithm(d_temp_storage, temp_storage_bytes)` the way callers of
+ * the device-wide algorithms do: a query of the temporary storage size
+ * followed by the run. In between, a run with one byte less than the query
+ * reported must fail without touching the outputs.
+ */
+template <typename AlgorithmT>
+void InvokeTwoPhase(AlgorithmT algorithm)
+{
+  size_t temp_storage_bytes = 0;
+  AssertEquals(algorithm(nullptr, temp_storage_bytes), cudaSuccess);
+  AssertTrue(temp_storage_bytes > 0);
+
+  std::vector<char> temp_storage(temp_storage_bytes);
+
+  size_t insufficient_bytes = temp_storage_bytes - 1;
+  AssertEquals(algorithm(temp_storage.data(), insufficient_bytes), cudaErrorInvalidValue);
+
+  AssertEquals(algorithm(temp_storage.data(), temp_storage_bytes), cudaSuccess);
+}
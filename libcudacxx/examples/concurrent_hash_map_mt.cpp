@@ -0,0 +1,104 @@
+// Copyright (c) 2023 NVIDIA Corporation
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Released under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+
+// Counts the occurrences of keys from many host threads, once with
+// cuda::concurrent_hash_map_ref and once with a std::unordered_map protected
+// by a mutex.
+//
+// Usage: concurrent_hash_map_mt [threads (default: 64)] [distinct keys (default: 1<<16)]
+
+#include <cuda/concurrent_hash_map>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+constexpr std::size_t keys_per_thread = 1 << 20;
+
+template <class F>
+double run(unsigned threads, F&& f)
+{
+  std::vector<std::thread> pool;
+  auto const start = std::chrono::steady_clock::now();
+  for (unsigned t = 0; t < threads; ++t)
+  {
+    pool.emplace_back(f, t);
+  }
+  for (auto& thread : pool)
+  {
+    thread.join();
+  }
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char** argv)
+{
+  unsigned const threads      = argc > 1 ? std::atoi(argv[1]) : 64;
+  std::uint64_t const domain  = argc > 2 ? std::atoll(argv[2]) : (1 << 16);
+
+  std::vector<std::vector<std::uint64_t>> input(threads);
+  for (unsigned t = 0; t < threads; ++t)
+  {
+    std::mt19937_64 gen(t);
+    std::uniform_int_distribution<std::uint64_t> dis(0, domain - 1);
+    input[t].resize(keys_per_thread);
+    for (auto& key : input[t])
+    {
+      key = dis(gen);
+    }
+  }
+
+  // Twice the number of distinct keys, rounded up to a power of two.
+  std::size_t capacity = 1;
+  while (capacity < 2 * domain)
+  {
+    capacity *= 2;
+  }
+  using map_type = cuda::concurrent_hash_map_ref<std::uint64_t, std::uint64_t>;
+  std::vector<map_type::control_type> control(map_type::control_size(capacity));
+  std::vector<std::uint64_t> keys(capacity);
+  std::vector<std::uint64_t> counts(capacity);
+  map_type map(cuda::std::span<map_type::control_type>(control.data(), control.size()),
+               cuda::std::span<std::uint64_t>(keys.data(), keys.size()),
+               cuda::std::span<std::uint64_t>(counts.data(), counts.size()));
+  map.clear();
+
+  std::vector<std::uint64_t> const ones(keys_per_thread, 1);
+  double const concurrent = run(threads, [&](unsigned t) {
+    map.fetch_add(input[t].begin(), input[t].end(), ones.begin());
+  });
+
+  std::unordered_map<std::uint64_t, std::uint64_t> locked_map;
+  std::mutex mutex;
+  double const locked = run(threads, [&](unsigned t) {
+    for (auto key : input[t])
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      ++locked_map[key];
+    }
+  });
+
+  for (auto const& kv : locked_map)
+  {
+    std::uint64_t count = 0;
+    if (!map.find(kv.first, count) || count != kv.second)
+    {
+      std::printf("mismatch for key %llu\n", static_cast<unsigned long long>(kv.first));
+      return 1;
+    }
+  }
+
+  double const total = double(threads) * keys_per_thread;
+  std::printf("threads: %u, distinct keys: %llu\n", threads, static_cast<unsigned long long>(domain));
+  std::printf("cuda::concurrent_hash_map_ref:   %8.1f M updates/s\n", total / concurrent / 1e6);
+  std::printf("locked std::unordered_map:       %8.1f M updates/s\n", total / locked / 1e6);
+  return 0;
+}
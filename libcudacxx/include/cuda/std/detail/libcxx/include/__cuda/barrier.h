@@ -30,6 +30,7 @@
 #include "../cstdlib"                // _LIBCUDACXX_UNREACHABLE
 #include "../__type_traits/void_t.h" // _CUDA_VSTD::__void_t
 #include "../__cuda/ptx.h"           // cuda::ptx::*
+#include "../__cuda/memcpy_async_host.h" // cuda::__host_memcpy_async_*
 
 #if defined(_LIBCUDACXX_COMPILER_NVRTC)
 #define _LIBCUDACXX_OFFSET_IS_ZERO(type, member) !(&(((type *)0)->member))
@@ -87,6 +88,27 @@ public:
         : _CUDA_VSTD::__barrier_base<_CompletionF, _Sco>(__expected, __completion) {
     }
 
+    using arrival_token = typename _CUDA_VSTD::__barrier_base<_CompletionF, _Sco>::arrival_token;
+
+    // Host copies bound to the barrier by memcpy_async complete before the
+    // issuing thread arrives, see <__cuda/memcpy_async_host.h>.
+    _LIBCUDACXX_NODISCARD_ATTRIBUTE _LIBCUDACXX_INLINE_VISIBILITY
+    arrival_token arrive(_CUDA_VSTD::ptrdiff_t __update = 1) {
+        NV_IF_TARGET(NV_IS_HOST, (__host_memcpy_async_before_arrive();));
+        return _CUDA_VSTD::__barrier_base<_CompletionF, _Sco>::arrive(__update);
+    }
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    void arrive_and_wait() {
+        this->wait(arrive());
+    }
+
+    _LIBCUDACXX_INLINE_VISIBILITY
+    void arrive_and_drop() {
+        NV_IF_TARGET(NV_IS_HOST, (__host_memcpy_async_before_arrive();));
+        _CUDA_VSTD::__barrier_base<_CompletionF, _Sco>::arrive_and_drop();
+    }
+
     _LIBCUDACXX_INLINE_VISIBILITY
     friend void init(barrier * __b, _CUDA_VSTD::ptrdiff_t __expected) {
         _LIBCUDACXX_DEBUG_ASSERT(__expected >= 0, "Cannot initialize barrier with negative arrival count");
@@ -246,6 +268,7 @@ public:
                 }
                 __token = __shfl_sync(__active, __token, __leader);
             ), NV_IS_HOST, (
+                __host_memcpy_async_before_arrive();
                 __token = __barrier.arrive(__update);
             )
         )
@@ -495,6 +518,7 @@ public:
 
     _LIBCUDACXX_INLINE_VISIBILITY
     void arrive_and_drop() {
+        NV_IF_TARGET(NV_IS_HOST, (__host_memcpy_async_before_arrive();));
         NV_DISPATCH_TARGET(
             NV_PROVIDES_SM_90, (
                 if (!__isClusterShared(&__barrier)) {
@@ -823,10 +847,14 @@ struct __memcpy_completion_impl {
         switch (__cm) {
             case __completion_mechanism::__async_group:
                 // Pre-SM80, the async_group mechanism is not available.
-                NV_IF_TARGET(NV_PROVIDES_SM_80, (
+                NV_DISPATCH_TARGET(NV_PROVIDES_SM_80, (
                     // Blocking: wait for all thread-local cp.async instructions to have
                     // completed writing to shared memory.
                     asm volatile ("cp.async.wait_all;" ::: "memory");
+                ), NV_IS_HOST, (
+                    // Non-blocking: the copies issued by this host thread are
+                    // waited for when it next arrives on a barrier.
+                    __host_memcpy_async_bind();
                 ));
                 return async_contract_fulfillment::async;
             case __completion_mechanism::__mbarrier_complete_tx:
@@ -1123,8 +1151,13 @@ __completion_mechanism __dispatch_memcpy_async(_Group const & __group, char * __
             return __dispatch_memcpy_async_any_to_any<_Align>(__group, __dest_char, __src_char, __size, __allowed_completions, __bar_handle);
         }
     ), (
-        // Host code path:
+        // Host code path: copies are synchronous unless the asynchronous host
+        // implementation is enabled, see <__cuda/memcpy_async_host.h>.
+        const bool __can_use_async_group = __allowed_completions & uint32_t(__completion_mechanism::__async_group);
         if (__group.thread_rank() == 0) {
+            if (__can_use_async_group && __host_memcpy_async_issue(__dest_char, __src_char, __size)) {
+                return __completion_mechanism::__async_group;
+            }
             memcpy(__dest_char, __src_char, __size);
         }
         return __completion_mechanism::__sync;
@@ -47,6 +47,27 @@ NV_IS_HOST, (
 ));
 }
 
+#ifndef _LIBCUDACXX_HAS_NO_MONOTONIC_CLOCK
+inline _LIBCUDACXX_INLINE_VISIBILITY
+steady_clock::time_point steady_clock::now() noexcept
+{
+NV_DISPATCH_TARGET(
+NV_IS_DEVICE, (
+    uint64_t __time;
+    asm volatile("mov.u64 %0, %%globaltimer;":"=l"(__time)::);
+    return time_point(duration(static_cast<rep>(__time)));
+),
+NV_IS_HOST, (
+    // On Linux this is a vDSO clock_gettime(CLOCK_MONOTONIC), no system call.
+    return time_point(duration(static_cast<rep>(
+            ::std::chrono::duration_cast<::std::chrono::nanoseconds>(
+                ::std::chrono::steady_clock::now().time_since_epoch()
+            ).count()
+           )));
+));
+}
+#endif // _LIBCUDACXX_HAS_NO_MONOTONIC_CLOCK
+
 inline _LIBCUDACXX_INLINE_VISIBILITY
 time_t system_clock::to_time_t(const system_clock::time_point& __t) noexcept
 {
@@ -62,4 +83,114 @@ system_clock::time_point system_clock::from_time_t(time_t __t) noexcept
 
 _LIBCUDACXX_END_NAMESPACE_STD
 
+#if !defined(_LIBCUDACXX_COMPILER_NVRTC)
+#  if defined(_LIBCUDACXX_COMPILER_MSVC) && (defined(_M_X64) || defined(_M_IX86))
+#    include <intrin.h>
+#  endif
+#endif // !_LIBCUDACXX_COMPILER_NVRTC
+
+_LIBCUDACXX_BEGIN_NAMESPACE_CUDA
+
+// cycle_clock reads the cheapest cycle counter of the executing processor:
+// clock64() on the device and the time stamp counter (or the virtual counter
+// on AArch64) on the host. It is meant for timing short sections of code; its
+// values are only comparable within one thread, and it is not a Clock.
+class cycle_clock
+{
+public:
+    typedef long long rep;
+
+    _LIBCUDACXX_HOST_DEVICE
+    static rep now() noexcept;
+
+    // Frequency of the host counter in ticks per second, calibrated against
+    // steady_clock on first use where it is not architecturally known.
+    _LIBCUDACXX_HOST
+    static double ticks_per_second() noexcept;
+
+    // Converts a difference of two host counter values.
+    template <class _Duration>
+    _LIBCUDACXX_HOST
+    static _Duration to_duration(rep __ticks) noexcept
+    {
+        return _CUDA_VSTD::chrono::duration_cast<_Duration>(
+            _CUDA_VSTD::chrono::duration<double>(static_cast<double>(__ticks) / ticks_per_second()));
+    }
+};
+
+#if !defined(_LIBCUDACXX_COMPILER_NVRTC)
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#  define _LIBCUDACXX_CYCLE_CLOCK_TSC
+#elif defined(__aarch64__)
+#  define _LIBCUDACXX_CYCLE_CLOCK_CNTVCT
+#endif
+
+inline _LIBCUDACXX_HOST
+cycle_clock::rep __cycle_clock_host_now() noexcept
+{
+#if defined(_LIBCUDACXX_CYCLE_CLOCK_TSC) && defined(_LIBCUDACXX_COMPILER_MSVC)
+    return static_cast<cycle_clock::rep>(__rdtsc());
+#elif defined(_LIBCUDACXX_CYCLE_CLOCK_TSC)
+    return static_cast<cycle_clock::rep>(__builtin_ia32_rdtsc());
+#elif defined(_LIBCUDACXX_CYCLE_CLOCK_CNTVCT)
+    _CUDA_VSTD::uint64_t __ticks;
+    asm volatile("mrs %0, cntvct_el0" : "=r"(__ticks));
+    return static_cast<cycle_clock::rep>(__ticks);
+#else
+    return static_cast<cycle_clock::rep>(
+        ::std::chrono::duration_cast<::std::chrono::nanoseconds>(
+            ::std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+inline _LIBCUDACXX_HOST
+double __cycle_clock_host_calibrate() noexcept
+{
+#if defined(_LIBCUDACXX_CYCLE_CLOCK_TSC)
+    typedef ::std::chrono::steady_clock __clock;
+    const __clock::time_point __start = __clock::now();
+    const cycle_clock::rep __start_ticks = __cycle_clock_host_now();
+    __clock::time_point __end;
+    do {
+        __end = __clock::now();
+    } while (__end - __start < ::std::chrono::milliseconds(10));
+    const cycle_clock::rep __end_ticks = __cycle_clock_host_now();
+    return static_cast<double>(__end_ticks - __start_ticks)
+         / ::std::chrono::duration<double>(__end - __start).count();
+#elif defined(_LIBCUDACXX_CYCLE_CLOCK_CNTVCT)
+    _CUDA_VSTD::uint64_t __frequency;
+    asm volatile("mrs %0, cntfrq_el0" : "=r"(__frequency));
+    return static_cast<double>(__frequency);
+#else
+    return 1e9;
+#endif
+}
+
+#undef _LIBCUDACXX_CYCLE_CLOCK_TSC
+#undef _LIBCUDACXX_CYCLE_CLOCK_CNTVCT
+
+inline _LIBCUDACXX_HOST
+double cycle_clock::ticks_per_second() noexcept
+{
+    static const double __frequency = __cycle_clock_host_calibrate();
+    return __frequency;
+}
+
+#endif // !_LIBCUDACXX_COMPILER_NVRTC
+
+inline _LIBCUDACXX_INLINE_VISIBILITY
+cycle_clock::rep cycle_clock::now() noexcept
+{
+NV_DISPATCH_TARGET(
+NV_IS_DEVICE, (
+    return static_cast<rep>(clock64());
+),
+NV_IS_HOST, (
+    return __cycle_clock_host_now();
+));
+}
+
+_LIBCUDACXX_END_NAMESPACE_CUDA
+
 #endif // _LIBCUDACXX___CUDA_CHRONO_H
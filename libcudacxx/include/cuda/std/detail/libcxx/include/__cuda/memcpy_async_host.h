@@ -0,0 +1,413 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___CUDA_MEMCPY_ASYNC_HOST_H
+#define _LIBCUDACXX___CUDA_MEMCPY_ASYNC_HOST_H
+
+#ifndef __cuda_std__
+#error "<__cuda/memcpy_async_host.h> should only be included in from <cuda/std/barrier>"
+#endif // __cuda_std__
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+// Opt-in asynchronous host implementation of cuda::memcpy_async.
+//
+// By default, memcpy_async degrades to a synchronous memcpy in host code. When
+// LIBCUDACXX_ENABLE_EXPERIMENTAL_HOST_MEMCPY_ASYNC is defined, host copies are
+// instead handed to a process-wide pool of copy workers and tracked with the
+// same per-thread "async group" model that cp.async uses on the device:
+//
+//   * memcpy_async adds the copy to the calling thread's open group,
+//   * pipeline::producer_commit closes the open group (cp.async.commit_group),
+//   * pipeline::consumer_wait waits for the oldest committed group
+//     (cp.async.wait_group), and
+//   * barrier-based completion binds the copies issued so far to the barrier
+//     (cp.async.mbarrier.arrive). They are waited for when the issuing thread
+//     next arrives on a barrier, so they overlap with the work done before.
+//
+// Copies smaller than LIBCUDACXX_HOST_MEMCPY_ASYNC_MIN_SIZE bytes are performed
+// immediately because handing them off costs more than the copy itself. Larger
+// copies are split into chunks of LIBCUDACXX_HOST_MEMCPY_ASYNC_CHUNK_SIZE bytes
+// so that several workers can stream them concurrently. A thread that waits for
+// a group executes queued chunks itself instead of idling.
+
+#if !defined(_LIBCUDACXX_COMPILER_NVRTC)
+
+#if defined(LIBCUDACXX_ENABLE_EXPERIMENTAL_HOST_MEMCPY_ASYNC)
+
+#ifndef LIBCUDACXX_HOST_MEMCPY_ASYNC_WORKERS
+#  define LIBCUDACXX_HOST_MEMCPY_ASYNC_WORKERS 4
+#endif
+
+#ifndef LIBCUDACXX_HOST_MEMCPY_ASYNC_MIN_SIZE
+#  define LIBCUDACXX_HOST_MEMCPY_ASYNC_MIN_SIZE (64 * 1024)
+#endif
+
+#ifndef LIBCUDACXX_HOST_MEMCPY_ASYNC_CHUNK_SIZE
+#  define LIBCUDACXX_HOST_MEMCPY_ASYNC_CHUNK_SIZE (1024 * 1024)
+#endif
+
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_CUDA
+
+// Completion counter of one committed (or still open) group of host copies.
+struct __host_copy_group
+{
+  ::std::atomic<_CUDA_VSTD::size_t> __pending{0};
+};
+
+struct __host_copy_chunk
+{
+  char* __dest;
+  const char* __src;
+  _CUDA_VSTD::size_t __size;
+  __host_copy_group* __group;
+
+  _LIBCUDACXX_HOST void __run() const
+  {
+    ::std::memcpy(__dest, __src, __size);
+    __group->__pending.fetch_sub(1, ::std::memory_order_release);
+  }
+};
+
+// Process-wide pool of workers that execute copy chunks in FIFO order.
+class __host_copy_engine
+{
+public:
+  _LIBCUDACXX_HOST static __host_copy_engine& __get()
+  {
+    static __host_copy_engine __engine;
+    return __engine;
+  }
+
+  __host_copy_engine(const __host_copy_engine&)            = delete;
+  __host_copy_engine& operator=(const __host_copy_engine&) = delete;
+
+  _LIBCUDACXX_HOST ~__host_copy_engine()
+  {
+    {
+      ::std::lock_guard<::std::mutex> __lock(__mutex_);
+      __stop_ = true;
+    }
+    __cv_.notify_all();
+    for (auto& __worker : __workers_)
+    {
+      __worker.join();
+    }
+  }
+
+  _LIBCUDACXX_HOST void __submit(char* __dest, const char* __src, _CUDA_VSTD::size_t __size, __host_copy_group& __group)
+  {
+    const _CUDA_VSTD::size_t __chunk = LIBCUDACXX_HOST_MEMCPY_ASYNC_CHUNK_SIZE;
+    const _CUDA_VSTD::size_t __count = (__size + __chunk - 1) / __chunk;
+    __group.__pending.fetch_add(__count, ::std::memory_order_relaxed);
+    {
+      ::std::lock_guard<::std::mutex> __lock(__mutex_);
+      for (_CUDA_VSTD::size_t __offset = 0; __offset < __size; __offset += __chunk)
+      {
+        const _CUDA_VSTD::size_t __n = (__size - __offset < __chunk) ? __size - __offset : __chunk;
+        __queue_.push_back(__host_copy_chunk{__dest + __offset, __src + __offset, __n, &__group});
+      }
+    }
+    if (__count == 1)
+    {
+      __cv_.notify_one();
+    }
+    else
+    {
+      __cv_.notify_all();
+    }
+  }
+
+  // Blocks until every copy of __group has completed, running queued chunks on
+  // the calling thread in the meantime.
+  _LIBCUDACXX_HOST void __wait(__host_copy_group& __group)
+  {
+    while (__group.__pending.load(::std::memory_order_acquire) != 0)
+    {
+      __host_copy_chunk __task;
+      if (__try_pop(__task))
+      {
+        __task.__run();
+      }
+      else
+      {
+        ::std::this_thread::yield();
+      }
+    }
+  }
+
+private:
+  ::std::mutex __mutex_;
+  ::std::condition_variable __cv_;
+  ::std::deque<__host_copy_chunk> __queue_;
+  ::std::vector<::std::thread> __workers_;
+  bool __stop_ = false;
+
+  _LIBCUDACXX_HOST __host_copy_engine()
+  {
+    unsigned __n = ::std::thread::hardware_concurrency();
+    if (__n == 0 || __n > LIBCUDACXX_HOST_MEMCPY_ASYNC_WORKERS)
+    {
+      __n = LIBCUDACXX_HOST_MEMCPY_ASYNC_WORKERS;
+    }
+    __workers_.reserve(__n);
+    for (unsigned __i = 0; __i < __n; ++__i)
+    {
+      __workers_.emplace_back([this] {
+        __worker_loop();
+      });
+    }
+  }
+
+  _LIBCUDACXX_HOST bool __try_pop(__host_copy_chunk& __task)
+  {
+    ::std::lock_guard<::std::mutex> __lock(__mutex_);
+    if (__queue_.empty())
+    {
+      return false;
+    }
+    __task = __queue_.front();
+    __queue_.pop_front();
+    return true;
+  }
+
+  _LIBCUDACXX_HOST void __worker_loop()
+  {
+    for (;;)
+    {
+      __host_copy_chunk __task;
+      {
+        ::std::unique_lock<::std::mutex> __lock(__mutex_);
+        __cv_.wait(__lock, [this] {
+          return __stop_ || !__queue_.empty();
+        });
+        if (__queue_.empty())
+        {
+          return;
+        }
+        __task = __queue_.front();
+        __queue_.pop_front();
+      }
+      __task.__run();
+    }
+  }
+};
+
+// Per-thread async group state, the host counterpart of the cp.async groups
+// each device thread owns.
+class __host_async_groups
+{
+public:
+  _LIBCUDACXX_HOST static __host_async_groups& __get()
+  {
+    thread_local __host_async_groups __groups;
+    return __groups;
+  }
+
+  __host_async_groups(const __host_async_groups&)            = delete;
+  __host_async_groups& operator=(const __host_async_groups&) = delete;
+
+  _LIBCUDACXX_HOST ~__host_async_groups()
+  {
+    // Copies still in flight reference our groups.
+    __wait_all();
+  }
+
+  // Whether copies are bound to a barrier and not yet waited for.
+  _LIBCUDACXX_HOST bool __has_bound() const noexcept
+  {
+    return !__bound_.empty();
+  }
+
+  _LIBCUDACXX_HOST void __issue(char* __dest, const char* __src, _CUDA_VSTD::size_t __size)
+  {
+    if (__size < LIBCUDACXX_HOST_MEMCPY_ASYNC_MIN_SIZE)
+    {
+      ::std::memcpy(__dest, __src, __size);
+      return;
+    }
+    if (!__open_)
+    {
+      __open_ = __acquire_group();
+    }
+    __host_copy_engine::__get().__submit(__dest, __src, __size, *__open_);
+  }
+
+  // cp.async.commit_group: an empty commit still creates a (complete) group.
+  _LIBCUDACXX_HOST void __commit()
+  {
+    __committed_.push_back(__open_ ? ::std::move(__open_) : __acquire_group());
+  }
+
+  // cp.async.mbarrier.arrive: binds every copy issued so far to a barrier. The
+  // open group is taken over by the barrier, committed groups stay owned by
+  // the pipeline and are only referenced. A committed group may be recycled
+  // before the barrier waits for it, which only makes the barrier wait longer.
+  _LIBCUDACXX_HOST void __bind()
+  {
+    if (__open_)
+    {
+      __bound_.push_back(__open_.get());
+      __bound_owned_.push_back(::std::move(__open_));
+    }
+    for (auto& __group : __committed_)
+    {
+      __bound_.push_back(__group.get());
+    }
+  }
+
+  // Waits for the copies bound to barriers, before the thread arrives on one.
+  _LIBCUDACXX_HOST void __wait_bound()
+  {
+    for (__host_copy_group* __group : __bound_)
+    {
+      __host_copy_engine::__get().__wait(*__group);
+    }
+    __bound_.clear();
+    for (auto& __group : __bound_owned_)
+    {
+      __spare_.push_back(::std::move(__group));
+    }
+    __bound_owned_.clear();
+  }
+
+  // cp.async.wait_group: wait until at most __prior committed groups are pending.
+  // Copies bound to a barrier may have been issued through the pipeline as
+  // well, so they are waited for first.
+  _LIBCUDACXX_HOST void __wait_prior(_CUDA_VSTD::size_t __prior)
+  {
+    __wait_bound();
+    while (__committed_.size() > __prior)
+    {
+      __host_copy_engine::__get().__wait(*__committed_.front());
+      __spare_.push_back(::std::move(__committed_.front()));
+      __committed_.pop_front();
+    }
+  }
+
+  // cp.async.wait_all: commits the open group and waits for every group.
+  _LIBCUDACXX_HOST void __wait_all()
+  {
+    if (__open_)
+    {
+      __commit();
+    }
+    __wait_prior(0);
+  }
+
+private:
+  __host_async_groups() = default;
+
+  ::std::unique_ptr<__host_copy_group> __open_;
+  ::std::deque<::std::unique_ptr<__host_copy_group>> __committed_;
+  ::std::vector<::std::unique_ptr<__host_copy_group>> __spare_;
+  ::std::vector<__host_copy_group*> __bound_;
+  ::std::vector<::std::unique_ptr<__host_copy_group>> __bound_owned_;
+
+  _LIBCUDACXX_HOST ::std::unique_ptr<__host_copy_group> __acquire_group()
+  {
+    if (__spare_.empty())
+    {
+      return ::std::unique_ptr<__host_copy_group>(new __host_copy_group);
+    }
+    ::std::unique_ptr<__host_copy_group> __group = ::std::move(__spare_.back());
+    __spare_.pop_back();
+    return __group;
+  }
+};
+
+_LIBCUDACXX_END_NAMESPACE_CUDA
+
+#endif // LIBCUDACXX_ENABLE_EXPERIMENTAL_HOST_MEMCPY_ASYNC
+
+_LIBCUDACXX_BEGIN_NAMESPACE_CUDA
+
+// Entry points used by the host paths of memcpy_async, barrier and pipeline.
+// Without the asynchronous host implementation, no copy is ever in flight and
+// they do nothing.
+
+// Returns false, without copying, if the copy has to be performed synchronously
+// by the caller.
+_LIBCUDACXX_HOST inline bool __host_memcpy_async_issue(char* __dest, const char* __src, _CUDA_VSTD::size_t __size)
+{
+#if defined(LIBCUDACXX_ENABLE_EXPERIMENTAL_HOST_MEMCPY_ASYNC)
+  __host_async_groups::__get().__issue(__dest, __src, __size);
+  return true;
+#else
+  (void) __dest;
+  (void) __src;
+  (void) __size;
+  return false;
+#endif
+}
+
+_LIBCUDACXX_HOST inline void __host_memcpy_async_commit()
+{
+#if defined(LIBCUDACXX_ENABLE_EXPERIMENTAL_HOST_MEMCPY_ASYNC)
+  __host_async_groups::__get().__commit();
+#endif
+}
+
+_LIBCUDACXX_HOST inline void __host_memcpy_async_wait_prior(_CUDA_VSTD::size_t __prior)
+{
+#if defined(LIBCUDACXX_ENABLE_EXPERIMENTAL_HOST_MEMCPY_ASYNC)
+  __host_async_groups::__get().__wait_prior(__prior);
+#else
+  (void) __prior;
+#endif
+}
+
+_LIBCUDACXX_HOST inline void __host_memcpy_async_wait_all()
+{
+#if defined(LIBCUDACXX_ENABLE_EXPERIMENTAL_HOST_MEMCPY_ASYNC)
+  __host_async_groups::__get().__wait_all();
+#endif
+}
+
+_LIBCUDACXX_HOST inline void __host_memcpy_async_bind()
+{
+#if defined(LIBCUDACXX_ENABLE_EXPERIMENTAL_HOST_MEMCPY_ASYNC)
+  __host_async_groups::__get().__bind();
+#endif
+}
+
+// Called by host barriers before the calling thread arrives.
+_LIBCUDACXX_HOST inline void __host_memcpy_async_before_arrive()
+{
+#if defined(LIBCUDACXX_ENABLE_EXPERIMENTAL_HOST_MEMCPY_ASYNC)
+  __host_async_groups& __groups = __host_async_groups::__get();
+  if (__groups.__has_bound())
+  {
+    __groups.__wait_bound();
+  }
+#endif
+}
+
+_LIBCUDACXX_END_NAMESPACE_CUDA
+
+#endif // !_LIBCUDACXX_COMPILER_NVRTC
+
+#endif // _LIBCUDACXX___CUDA_MEMCPY_ASYNC_HOST_H
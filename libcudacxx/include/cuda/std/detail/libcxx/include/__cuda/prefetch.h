@@ -0,0 +1,69 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___CUDA_PREFETCH_H
+#define _LIBCUDACXX___CUDA_PREFETCH_H
+
+#ifndef __cuda_std__
+#error "<__cuda/prefetch> should only be included in from <cuda/mdspan> or <cuda/annotated_ptr>"
+#endif // __cuda_std__
+
+#include <nv/target>
+
+#include "../__type_traits/integral_constant.h"
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if defined(_LIBCUDACXX_COMPILER_MSVC) && (defined(_M_X64) || defined(_M_IX86))
+#  include <intrin.h>
+#  define _LIBCUDACXX_HOST_PREFETCH(__ptr, __locality) \
+     _mm_prefetch(static_cast<const char*>(__ptr), (__locality) == 0 ? _MM_HINT_NTA : _MM_HINT_T0)
+#elif !defined(_LIBCUDACXX_COMPILER_MSVC) && !defined(_LIBCUDACXX_COMPILER_NVRTC)
+#  define _LIBCUDACXX_HOST_PREFETCH(__ptr, __locality) __builtin_prefetch(__ptr, 0, __locality)
+#endif
+
+_LIBCUDACXX_BEGIN_NAMESPACE_CUDA
+
+namespace __detail
+{
+
+// Temporal locality that a host prefetch uses for data accessed with the
+// static access property _Property, from 0 (no reuse, bypass the caches where
+// possible) to 3 (keep in all cache levels). <cuda/annotated_ptr> specializes
+// it for access_property::streaming.
+template <class _Property>
+struct __prefetch_locality : _CUDA_VSTD::integral_constant<int, 3>
+{};
+
+// Prefetches the cache line holding __ptr for reading. Prefetches never fault,
+// so __ptr need not point into an object. Device code relies on the hardware
+// and on annotated_ptr instead.
+template <int _Locality>
+_LIBCUDACXX_INLINE_VISIBILITY void __prefetch(const void* __ptr) noexcept
+{
+#if defined(_LIBCUDACXX_HOST_PREFETCH)
+  NV_IF_TARGET(NV_IS_HOST, (_LIBCUDACXX_HOST_PREFETCH(__ptr, _Locality);), ((void) __ptr;))
+#else
+  (void) __ptr;
+#endif
+}
+
+} // namespace __detail
+
+_LIBCUDACXX_END_NAMESPACE_CUDA
+
+#endif // _LIBCUDACXX___CUDA_PREFETCH_H
@@ -0,0 +1,274 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___MDSPAN_LAYOUT_PADDED_HPP
+#define _LIBCUDACXX___MDSPAN_LAYOUT_PADDED_HPP
+
+#ifndef __cuda_std__
+#include <__config>
+#endif // __cuda_std__
+
+#include "../__mdspan/dynamic_extent.h"
+#include "../__mdspan/extents.h"
+#include "../__mdspan/macros.h"
+#include "../__type_traits/enable_if.h"
+#include "../__type_traits/is_convertible.h"
+#include "../__type_traits/is_nothrow_constructible.h"
+#include "../array"
+#include "../cstddef"
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+#if _CCCL_STD_VER > 2011
+
+// layout_left_padded and layout_right_padded (P2642) lay out elements like
+// layout_left and layout_right, except that the extent of the contiguous
+// dimension is rounded up to a multiple of the padding value. With a padding
+// of a SIMD width or a cache line, every row (or column) starts aligned.
+// A padding value of dynamic_extent means that the padding is given to the
+// mapping at run time.
+template <size_t _PaddingValue = dynamic_extent>
+struct layout_left_padded {
+  template <class _Extents>
+    class mapping;
+};
+
+template <size_t _PaddingValue = dynamic_extent>
+struct layout_right_padded {
+  template <class _Extents>
+    class mapping;
+};
+
+namespace __detail {
+
+  template <class _Tp>
+  _LIBCUDACXX_HOST_DEVICE
+  constexpr _Tp __round_up_to_multiple(_Tp __n, _Tp __align) noexcept {
+    return ((__n + __align - 1) / __align) * __align;
+  }
+
+  // Implementation shared by the mappings of both padded layouts. The
+  // elements of dimension __contiguous_rank are contiguous, and its extent is
+  // padded; all other dimensions are packed.
+  template <class _Extents, size_t _PaddingValue, bool _IsLeft>
+  class __padded_mapping {
+  public:
+    using extents_type = _Extents;
+    using index_type = typename extents_type::index_type;
+    using size_type = typename extents_type::size_type;
+    using rank_type = typename extents_type::rank_type;
+
+    static constexpr size_t padding_value = _PaddingValue;
+
+  private:
+    static_assert(__detail::__is_extents_v<extents_type>, "padded layout mappings must be instantiated with a specialization of _CUDA_VSTD::extents.");
+    static_assert(_PaddingValue != 0, "the padding value of a padded layout must not be zero.");
+
+    static constexpr rank_type __rank = extents_type::rank();
+    static constexpr rank_type __contiguous_rank = (_IsLeft || __rank == 0) ? 0 : __rank - 1;
+
+    _LIBCUDACXX_HOST_DEVICE
+    static constexpr index_type __pad(index_type __extent, index_type __padding) noexcept {
+      return __rank < 2 ? __extent : __round_up_to_multiple(__extent, __padding);
+    }
+
+    _LIBCUDACXX_HOST_DEVICE
+    static constexpr index_type __contiguous_extent(const extents_type& __exts) noexcept {
+      return __rank == 0 ? index_type(1) : __exts.extent(__contiguous_rank);
+    }
+
+    // extent of dimension __r in memory
+    _LIBCUDACXX_HOST_DEVICE
+    constexpr index_type __padded_extent(rank_type __r) const noexcept {
+      return __r == __contiguous_rank ? __padded_stride : __extents.extent(__r);
+    }
+
+  public:
+    _LIBCUDACXX_HOST_DEVICE
+    constexpr __padded_mapping() noexcept
+      : __padded_mapping(extents_type())
+    { }
+
+    _LIBCUDACXX_HOST_DEVICE
+    constexpr __padded_mapping(const extents_type& __exts) noexcept
+      : __extents(__exts)
+      , __padded_stride(_PaddingValue == dynamic_extent
+                          ? __contiguous_extent(__exts)
+                          : __pad(__contiguous_extent(__exts), static_cast<index_type>(_PaddingValue)))
+    { }
+
+    // Precondition: __padding is positive, and equal to padding_value unless
+    // padding_value is dynamic_extent.
+    __MDSPAN_TEMPLATE_REQUIRES(
+      class _Size,
+      /* requires */ (
+        _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_convertible, _Size, index_type) &&
+        _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_nothrow_constructible, index_type, _Size)
+      )
+    )
+    _LIBCUDACXX_HOST_DEVICE
+    constexpr __padded_mapping(const extents_type& __exts, _Size __padding) noexcept
+      : __extents(__exts)
+      , __padded_stride(__pad(__contiguous_extent(__exts), static_cast<index_type>(__padding)))
+    { }
+
+    __MDSPAN_INLINE_FUNCTION
+    constexpr const extents_type& extents() const noexcept {
+      return __extents;
+    }
+
+    __MDSPAN_INLINE_FUNCTION
+    constexpr index_type required_span_size() const noexcept {
+      index_type __value = 1;
+      for (rank_type __r = 0; __r != __rank; ++__r) {
+        if (__extents.extent(__r) == 0) {
+          return 0;
+        }
+        __value *= __padded_extent(__r);
+      }
+      return __value;
+    }
+
+    __MDSPAN_TEMPLATE_REQUIRES(
+      class... _Indices,
+      /* requires */ (
+        (sizeof...(_Indices) == extents_type::rank()) &&
+        __MDSPAN_FOLD_AND(
+           (_LIBCUDACXX_TRAIT(_CUDA_VSTD::is_convertible, _Indices, index_type) &&
+            _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_nothrow_constructible, index_type, _Indices))
+        )
+      )
+    )
+    _LIBCUDACXX_HOST_DEVICE
+    constexpr index_type operator()(_Indices... __idxs) const noexcept {
+      return __offset(_CUDA_VSTD::array<index_type, __rank>{{static_cast<index_type>(__idxs)...}});
+    }
+
+    __MDSPAN_INLINE_FUNCTION static constexpr bool is_always_unique() noexcept { return true; }
+    __MDSPAN_INLINE_FUNCTION static constexpr bool is_always_exhaustive() noexcept {
+      return __rank < 2 ||
+             (_PaddingValue != dynamic_extent &&
+              extents_type::static_extent(__contiguous_rank) != dynamic_extent &&
+              extents_type::static_extent(__contiguous_rank) % _PaddingValue == 0);
+    }
+    __MDSPAN_INLINE_FUNCTION static constexpr bool is_always_strided() noexcept { return true; }
+
+    __MDSPAN_INLINE_FUNCTION constexpr bool is_unique() const noexcept { return true; }
+    __MDSPAN_INLINE_FUNCTION constexpr bool is_exhaustive() const noexcept {
+      return __rank < 2 || __padded_stride == __contiguous_extent(__extents);
+    }
+    __MDSPAN_INLINE_FUNCTION constexpr bool is_strided() const noexcept { return true; }
+
+    __MDSPAN_INLINE_FUNCTION
+    constexpr index_type stride(rank_type __r) const noexcept {
+      index_type __value = 1;
+      if (_IsLeft) {
+        for (rank_type __i = 0; __i < __r; ++__i) {
+          __value *= __padded_extent(__i);
+        }
+      } else {
+        for (rank_type __i = __rank; __i > __r + 1; --__i) {
+          __value *= __padded_extent(__i - 1);
+        }
+      }
+      return __value;
+    }
+
+  private:
+    // Horner's scheme, starting from the dimension with the largest stride.
+    _LIBCUDACXX_HOST_DEVICE
+    constexpr index_type __offset(const _CUDA_VSTD::array<index_type, __rank>& __idxs) const noexcept {
+      index_type __value = 0;
+      for (rank_type __i = 0; __i != __rank; ++__i) {
+        const rank_type __r = _IsLeft ? __rank - 1 - __i : __i;
+        __value = __value * __padded_extent(__r) + __idxs[__r];
+      }
+      return __value;
+    }
+
+    _LIBCUDACXX_NO_UNIQUE_ADDRESS extents_type __extents{};
+    index_type __padded_stride;
+  };
+
+} // namespace __detail
+
+template <size_t _PaddingValue>
+template <class _Extents>
+class layout_left_padded<_PaddingValue>::mapping
+  : public __detail::__padded_mapping<_Extents, _PaddingValue, true>
+{
+  using __base_t = __detail::__padded_mapping<_Extents, _PaddingValue, true>;
+
+public:
+  using layout_type = layout_left_padded<_PaddingValue>;
+
+  using __base_t::__base_t;
+
+  __MDSPAN_INLINE_FUNCTION_DEFAULTED constexpr mapping() noexcept = default;
+
+  template<class _OtherExtents>
+  __MDSPAN_INLINE_FUNCTION
+  friend constexpr bool operator==(mapping const& __lhs, mapping<_OtherExtents> const& __rhs) noexcept {
+    return __lhs.extents() == __rhs.extents() && (_Extents::rank() < 2 || __lhs.stride(1) == __rhs.stride(1));
+  }
+
+#if !(__MDSPAN_HAS_CXX_20)
+  template<class _OtherExtents>
+  __MDSPAN_INLINE_FUNCTION
+  friend constexpr bool operator!=(mapping const& __lhs, mapping<_OtherExtents> const& __rhs) noexcept {
+    return !(__lhs == __rhs);
+  }
+#endif
+};
+
+template <size_t _PaddingValue>
+template <class _Extents>
+class layout_right_padded<_PaddingValue>::mapping
+  : public __detail::__padded_mapping<_Extents, _PaddingValue, false>
+{
+  using __base_t = __detail::__padded_mapping<_Extents, _PaddingValue, false>;
+
+public:
+  using layout_type = layout_right_padded<_PaddingValue>;
+
+  using __base_t::__base_t;
+
+  __MDSPAN_INLINE_FUNCTION_DEFAULTED constexpr mapping() noexcept = default;
+
+  template<class _OtherExtents>
+  __MDSPAN_INLINE_FUNCTION
+  friend constexpr bool operator==(mapping const& __lhs, mapping<_OtherExtents> const& __rhs) noexcept {
+    return __lhs.extents() == __rhs.extents() &&
+           (_Extents::rank() < 2 || __lhs.stride(_Extents::rank() - 2) == __rhs.stride(_Extents::rank() - 2));
+  }
+
+#if !(__MDSPAN_HAS_CXX_20)
+  template<class _OtherExtents>
+  __MDSPAN_INLINE_FUNCTION
+  friend constexpr bool operator!=(mapping const& __lhs, mapping<_OtherExtents> const& __rhs) noexcept {
+    return !(__lhs == __rhs);
+  }
+#endif
+};
+
+#endif // _CCCL_STD_VER > 2011
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#endif // _LIBCUDACXX___MDSPAN_LAYOUT_PADDED_HPP
@@ -0,0 +1,485 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___MDSPAN_MDARRAY_HPP
+#define _LIBCUDACXX___MDSPAN_MDARRAY_HPP
+
+#ifndef __cuda_std__
+#include <__config>
+#endif // __cuda_std__
+
+#ifndef _LIBCUDACXX_COMPILER_NVRTC
+#include <vector>
+#endif // _LIBCUDACXX_COMPILER_NVRTC
+
+#include "../__mdspan/default_accessor.h"
+#include "../__mdspan/extents.h"
+#include "../__mdspan/layout_right.h"
+#include "../__mdspan/macros.h"
+#include "../__mdspan/mdspan.h"
+#include "../__type_traits/integral_constant.h"
+#include "../__type_traits/is_assignable.h"
+#include "../__type_traits/is_constructible.h"
+#include "../__type_traits/is_convertible.h"
+#include "../__type_traits/is_nothrow_constructible.h"
+#include "../__type_traits/void_t.h"
+#include "../__utility/declval.h"
+#include "../__utility/move.h"
+#include "../__utility/swap.h"
+#include "../array"
+#include "../cstddef"
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+#if _CCCL_STD_VER > 2011
+
+namespace __detail {
+
+  // Containers that can be resized are sized by the mdarray constructors.
+  template <class _Container, class = void>
+  struct __is_resizable_container : false_type {};
+
+  template <class _Container>
+  struct __is_resizable_container<_Container, __void_t<decltype(_CUDA_VSTD::declval<_Container&>().resize(size_t()))>> : true_type {};
+
+} // namespace __detail
+
+// mdarray (P1684) is the owning counterpart of mdspan: it stores its elements
+// in a contiguous container of mapping().required_span_size() elements and
+// hands out mdspans that view them.
+//
+// The container must provide data() and size(). Resizable containers, like
+// std::vector, are sized by the constructors; fixed size containers, like
+// array, are default constructed and must already be large enough.
+// std::vector is not available with NVRTC, so there the container must always
+// be named explicitly.
+#ifndef _LIBCUDACXX_COMPILER_NVRTC
+template <
+  class _ElementType,
+  class _Extents,
+  class _LayoutPolicy = layout_right,
+  class _Container = ::std::vector<_ElementType>
+>
+#else
+template <
+  class _ElementType,
+  class _Extents,
+  class _LayoutPolicy,
+  class _Container
+>
+#endif // _LIBCUDACXX_COMPILER_NVRTC
+class mdarray
+{
+private:
+  static_assert(__detail::__is_extents_v<_Extents>, "mdarray's Extents template parameter must be a specialization of _CUDA_VSTD::extents.");
+
+public:
+
+  //--------------------------------------------------------------------------------
+  // Domain and codomain types
+
+  using extents_type = _Extents;
+  using layout_type = _LayoutPolicy;
+  using container_type = _Container;
+  using mapping_type = typename layout_type::template mapping<extents_type>;
+  using element_type = _ElementType;
+  using mdspan_type = mdspan<element_type, extents_type, layout_type>;
+  using const_mdspan_type = mdspan<const element_type, extents_type, layout_type>;
+  using value_type = element_type;
+  using index_type = typename extents_type::index_type;
+  using size_type = typename extents_type::size_type;
+  using rank_type = typename extents_type::rank_type;
+  using data_handle_type = typename mdspan_type::data_handle_type;
+  using const_data_handle_type = typename const_mdspan_type::data_handle_type;
+  using reference = typename container_type::reference;
+  using const_reference = typename container_type::const_reference;
+
+  __MDSPAN_INLINE_FUNCTION static constexpr rank_type rank() noexcept { return extents_type::rank(); }
+  __MDSPAN_INLINE_FUNCTION static constexpr rank_type rank_dynamic() noexcept { return extents_type::rank_dynamic(); }
+  __MDSPAN_INLINE_FUNCTION static constexpr size_t static_extent(rank_type __r) noexcept { return extents_type::static_extent(__r); }
+  __MDSPAN_INLINE_FUNCTION constexpr index_type extent(rank_type __r) const noexcept { return __map.extents().extent(__r); }
+
+private:
+
+  using __sizable_container = __detail::__is_resizable_container<container_type>;
+
+  _CCCL_EXEC_CHECK_DISABLE
+  __MDSPAN_INLINE_FUNCTION
+  static container_type __make_container(size_t __n, true_type) {
+    return container_type(__n);
+  }
+
+  _CCCL_EXEC_CHECK_DISABLE
+  __MDSPAN_INLINE_FUNCTION
+  static container_type __make_container(size_t, false_type) {
+    return container_type();
+  }
+
+  _CCCL_EXEC_CHECK_DISABLE
+  __MDSPAN_INLINE_FUNCTION
+  static container_type __make_container(size_t __n, const value_type& __value, true_type) {
+    return container_type(__n, __value);
+  }
+
+  _CCCL_EXEC_CHECK_DISABLE
+  __MDSPAN_INLINE_FUNCTION
+  static container_type __make_container(size_t __n, const value_type& __value, false_type) {
+    container_type __ctr = __make_container(__n, __sizable_container());
+    for (size_t __i = 0; __i != __n; ++__i) {
+      __ctr.data()[__i] = __value;
+    }
+    return __ctr;
+  }
+
+public:
+
+  //--------------------------------------------------------------------------------
+  // mdarray constructors, assignment, and destructor
+
+  _CCCL_EXEC_CHECK_DISABLE
+  __MDSPAN_INLINE_FUNCTION
+  mdarray()
+    : mdarray(mapping_type())
+  { }
+
+  _CCCL_EXEC_CHECK_DISABLE
+  __MDSPAN_INLINE_FUNCTION_DEFAULTED mdarray(const mdarray&) = default;
+  _CCCL_EXEC_CHECK_DISABLE
+  __MDSPAN_INLINE_FUNCTION_DEFAULTED mdarray(mdarray&&) = default;
+
+  _CCCL_EXEC_CHECK_DISABLE
+  __MDSPAN_TEMPLATE_REQUIRES(
+    class... _SizeTypes,
+    /* requires */ (
+      __MDSPAN_FOLD_AND(_LIBCUDACXX_TRAIT(_CUDA_VSTD::is_convertible, _SizeTypes, index_type) /* && ... */) &&
+      __MDSPAN_FOLD_AND(_LIBCUDACXX_TRAIT(_CUDA_VSTD::is_nothrow_constructible, index_type, _SizeTypes) /* && ... */) &&
+      (sizeof...(_SizeTypes) == rank_dynamic()) && (sizeof...(_SizeTypes) != 0) &&
+      _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_constructible, mapping_type, extents_type)
+    )
+  )
+  __MDSPAN_INLINE_FUNCTION
+  explicit mdarray(_SizeTypes... __dynamic_extents)
+    : mdarray(extents_type(static_cast<index_type>(__dynamic_extents)...))
+  { }
+
+  _CCCL_EXEC_CHECK_DISABLE
+  __MDSPAN_INLINE_FUNCTION
+  explicit mdarray(const extents_type& __exts)
+    : mdarray(mapping_type(__exts))
+  { }
+
+  _CCCL_EXEC_CHECK_DISABLE
+  __MDSPAN_INLINE_FUNCTION
+  explicit mdarray(const mapping_type& __m)
+    : __map(__m)
+    , __ctr(__make_container(static_cast<size_t>(__m.required_span_size()), __sizable_container()))
+  { }
+
+  _CCCL_EXEC_CHECK_DISABLE
+  __MDSPAN_INLINE_FUNCTION
+  mdarray(const extents_type& __exts, const value_type& __value)
+    : mdarray(mapping_type(__exts), __value)
+  { }
+
+  _CCCL_EXEC_CHECK_DISABLE
+  __MDSPAN_INLINE_FUNCTION
+  mdarray(const mapping_type& __m, const value_type& __value)
+    : __map(__m)
+    , __ctr(__make_container(static_cast<size_t>(__m.required_span_size()), __value, __sizable_container()))
+  { }
+
+  // Precondition: __c.size() >= mapping().required_span_size()
+  _CCCL_EXEC_CHECK_DISABLE
+  __MDSPAN_INLINE_FUNCTION
+  mdarray(const extents_type& __exts, const container_type& __c)
+    : __map(__exts)
+    , __ctr(__c)
+  { }
+
+  _CCCL_EXEC_CHECK_DISABLE
+  __MDSPAN_INLINE_FUNCTION
+  mdarray(const mapping_type& __m, const container_type& __c)
+    : __map(__m)
+    , __ctr(__c)
+  { }
+
+  _CCCL_EXEC_CHECK_DISABLE
+  __MDSPAN_INLINE_FUNCTION
+  mdarray(const extents_type& __exts, container_type&& __c)
+    : __map(__exts)
+    , __ctr(_CUDA_VSTD::move(__c))
+  { }
+
+  _CCCL_EXEC_CHECK_DISABLE
+  __MDSPAN_INLINE_FUNCTION
+  mdarray(const mapping_type& __m, container_type&& __c)
+    : __map(__m)
+    , __ctr(_CUDA_VSTD::move(__c))
+  { }
+
+  _CCCL_EXEC_CHECK_DISABLE
+  __MDSPAN_TEMPLATE_REQUIRES(
+    class _Alloc,
+    /* requires */ (
+      !_LIBCUDACXX_TRAIT(_CUDA_VSTD::is_convertible, _Alloc, value_type) &&
+      _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_constructible, container_type, size_t, const _Alloc&)
+    )
+  )
+  __MDSPAN_INLINE_FUNCTION
+  mdarray(const mapping_type& __m, const _Alloc& __a)
+    : __map(__m)
+    , __ctr(static_cast<size_t>(__m.required_span_size()), __a)
+  { }
+
+  _CCCL_EXEC_CHECK_DISABLE
+  __MDSPAN_TEMPLATE_REQUIRES(
+    class _Alloc,
+    /* requires */ (
+      !_LIBCUDACXX_TRAIT(_CUDA_VSTD::is_convertible, _Alloc, value_type) &&
+      _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_constructible, container_type, size_t, const _Alloc&)
+    )
+  )
+  __MDSPAN_INLINE_FUNCTION
+  mdarray(const extents_type& __exts, const _Alloc& __a)
+    : mdarray(mapping_type(__exts), __a)
+  { }
+
+  _CCCL_EXEC_CHECK_DISABLE
+  __MDSPAN_TEMPLATE_REQUIRES(
+    class _Alloc,
+    /* requires */ (
+      _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_constructible, container_type, size_t, const value_type&, const _Alloc&)
+    )
+  )
+  __MDSPAN_INLINE_FUNCTION
+  mdarray(const mapping_type& __m, const value_type& __value, const _Alloc& __a)
+    : __map(__m)
+    , __ctr(static_cast<size_t>(__m.required_span_size()), __value, __a)
+  { }
+
+  _CCCL_EXEC_CHECK_DISABLE
+  __MDSPAN_TEMPLATE_REQUIRES(
+    class _Alloc,
+    /* requires */ (
+      _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_constructible, container_type, size_t, const value_type&, const _Alloc&)
+    )
+  )
+  __MDSPAN_INLINE_FUNCTION
+  mdarray(const extents_type& __exts, const value_type& __value, const _Alloc& __a)
+    : mdarray(mapping_type(__exts), __value, __a)
+  { }
+
+  _CCCL_EXEC_CHECK_DISABLE
+  __MDSPAN_INLINE_FUNCTION_DEFAULTED mdarray& operator=(const mdarray&) = default;
+  _CCCL_EXEC_CHECK_DISABLE
+  __MDSPAN_INLINE_FUNCTION_DEFAULTED mdarray& operator=(mdarray&&) = default;
+
+  //--------------------------------------------------------------------------------
+  // mdarray mapping domain multidimensional index to access codomain element
+
+  #if __MDSPAN_USE_BRACKET_OPERATOR
+  _CCCL_EXEC_CHECK_DISABLE
+  __MDSPAN_TEMPLATE_REQUIRES(
+    class... _SizeTypes,
+    /* requires */ (
+      __MDSPAN_FOLD_AND(_LIBCUDACXX_TRAIT(_CUDA_VSTD::is_convertible, _SizeTypes, index_type) /* && ... */) &&
+      __MDSPAN_FOLD_AND(_LIBCUDACXX_TRAIT(_CUDA_VSTD::is_nothrow_constructible, index_type, _SizeTypes) /* && ... */) &&
+      (rank() == sizeof...(_SizeTypes))
+    )
+  )
+  __MDSPAN_FORCE_INLINE_FUNCTION
+  reference operator[](_SizeTypes... __indices)
+  {
+    return __ctr.data()[__map(static_cast<index_type>(__indices)...)];
+  }
+
+  _CCCL_EXEC_CHECK_DISABLE
+  __MDSPAN_TEMPLATE_REQUIRES(
+    class... _SizeTypes,
+    /* requires */ (
+      __MDSPAN_FOLD_AND(_LIBCUDACXX_TRAIT(_CUDA_VSTD::is_convertible, _SizeTypes, index_type) /* && ... */) &&
+      __MDSPAN_FOLD_AND(_LIBCUDACXX_TRAIT(_CUDA_VSTD::is_nothrow_constructible, index_type, _SizeTypes) /* && ... */) &&
+      (rank() == sizeof...(_SizeTypes))
+    )
+  )
+  __MDSPAN_FORCE_INLINE_FUNCTION
+  const_reference operator[](_SizeTypes... __indices) const
+  {
+    return __ctr.data()[__map(static_cast<index_type>(__indices)...)];
+  }
+  #else
+  _CCCL_EXEC_CHECK_DISABLE
+  __MDSPAN_TEMPLATE_REQUIRES(
+    class _Index,
+    /* requires */ (
+      _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_convertible, _Index, index_type) &&
+      _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_nothrow_constructible, index_type, _Index) &&
+      extents_type::rank() == 1
+    )
+  )
+  __MDSPAN_FORCE_INLINE_FUNCTION
+  reference operator[](_Index __idx)
+  {
+    return __ctr.data()[__map(static_cast<index_type>(__idx))];
+  }
+
+  _CCCL_EXEC_CHECK_DISABLE
+  __MDSPAN_TEMPLATE_REQUIRES(
+    class _Index,
+    /* requires */ (
+      _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_convertible, _Index, index_type) &&
+      _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_nothrow_constructible, index_type, _Index) &&
+      extents_type::rank() == 1
+    )
+  )
+  __MDSPAN_FORCE_INLINE_FUNCTION
+  const_reference operator[](_Index __idx) const
+  {
+    return __ctr.data()[__map(static_cast<index_type>(__idx))];
+  }
+  #endif // __MDSPAN_USE_BRACKET_OPERATOR
+
+  #if __MDSPAN_USE_PAREN_OPERATOR
+  _CCCL_EXEC_CHECK_DISABLE
+  __MDSPAN_TEMPLATE_REQUIRES(
+    class... _SizeTypes,
+    /* requires */ (
+      __MDSPAN_FOLD_AND(_LIBCUDACXX_TRAIT(_CUDA_VSTD::is_convertible, _SizeTypes, index_type) /* && ... */) &&
+      __MDSPAN_FOLD_AND(_LIBCUDACXX_TRAIT(_CUDA_VSTD::is_nothrow_constructible, index_type, _SizeTypes) /* && ... */) &&
+      extents_type::rank() == sizeof...(_SizeTypes)
+    )
+  )
+  __MDSPAN_FORCE_INLINE_FUNCTION
+  reference operator()(_SizeTypes... __indices)
+  {
+    return __ctr.data()[__map(static_cast<index_type>(__indices)...)];
+  }
+
+  _CCCL_EXEC_CHECK_DISABLE
+  __MDSPAN_TEMPLATE_REQUIRES(
+    class... _SizeTypes,
+    /* requires */ (
+      __MDSPAN_FOLD_AND(_LIBCUDACXX_TRAIT(_CUDA_VSTD::is_convertible, _SizeTypes, index_type) /* && ... */) &&
+      __MDSPAN_FOLD_AND(_LIBCUDACXX_TRAIT(_CUDA_VSTD::is_nothrow_constructible, index_type, _SizeTypes) /* && ... */) &&
+      extents_type::rank() == sizeof...(_SizeTypes)
+    )
+  )
+  __MDSPAN_FORCE_INLINE_FUNCTION
+  const_reference operator()(_SizeTypes... __indices) const
+  {
+    return __ctr.data()[__map(static_cast<index_type>(__indices)...)];
+  }
+  #endif // __MDSPAN_USE_PAREN_OPERATOR
+
+  //--------------------------------------------------------------------------------
+  // mdarray observers
+
+  _CCCL_EXEC_CHECK_DISABLE
+  __MDSPAN_INLINE_FUNCTION data_handle_type data() noexcept { return __ctr.data(); }
+  _CCCL_EXEC_CHECK_DISABLE
+  __MDSPAN_INLINE_FUNCTION const_data_handle_type data() const noexcept { return __ctr.data(); }
+
+  _CCCL_EXEC_CHECK_DISABLE
+  __MDSPAN_INLINE_FUNCTION size_t container_size() const { return __ctr.size(); }
+
+  __MDSPAN_INLINE_FUNCTION constexpr size_t size() const noexcept {
+    size_t __value = 1;
+    for (rank_type __r = 0; __r != rank(); ++__r) {
+      __value *= static_cast<size_t>(extent(__r));
+    }
+    return __value;
+  }
+
+  __MDSPAN_INLINE_FUNCTION constexpr bool empty() const noexcept {
+    return size() == 0;
+  }
+
+  __MDSPAN_INLINE_FUNCTION constexpr const extents_type& extents() const noexcept { return __map.extents(); }
+  __MDSPAN_INLINE_FUNCTION constexpr const mapping_type& mapping() const noexcept { return __map; }
+
+  // Moves the elements out, leaving the mdarray with a moved-from container.
+  _CCCL_EXEC_CHECK_DISABLE
+  __MDSPAN_INLINE_FUNCTION container_type&& extract_container() && noexcept { return _CUDA_VSTD::move(__ctr); }
+
+  __MDSPAN_INLINE_FUNCTION static constexpr bool is_always_unique() noexcept { return mapping_type::is_always_unique(); }
+  __MDSPAN_INLINE_FUNCTION static constexpr bool is_always_exhaustive() noexcept { return mapping_type::is_always_exhaustive(); }
+  __MDSPAN_INLINE_FUNCTION static constexpr bool is_always_strided() noexcept { return mapping_type::is_always_strided(); }
+
+  __MDSPAN_INLINE_FUNCTION constexpr bool is_unique() const noexcept { return __map.is_unique(); }
+  __MDSPAN_INLINE_FUNCTION constexpr bool is_exhaustive() const noexcept { return __map.is_exhaustive(); }
+  __MDSPAN_INLINE_FUNCTION constexpr bool is_strided() const noexcept { return __map.is_strided(); }
+  __MDSPAN_INLINE_FUNCTION constexpr index_type stride(rank_type __r) const { return __map.stride(__r); }
+
+  //--------------------------------------------------------------------------------
+  // mdarray conversion to mdspan
+
+  __MDSPAN_TEMPLATE_REQUIRES(
+    class _OtherElementType, class _OtherExtents, class _OtherLayoutPolicy, class _OtherAccessor,
+    /* requires */ (
+      _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_assignable, mdspan<_OtherElementType, _OtherExtents, _OtherLayoutPolicy, _OtherAccessor>&, mdspan_type)
+    )
+  )
+  __MDSPAN_INLINE_FUNCTION
+  operator mdspan<_OtherElementType, _OtherExtents, _OtherLayoutPolicy, _OtherAccessor>() {
+    return to_mdspan();
+  }
+
+  __MDSPAN_TEMPLATE_REQUIRES(
+    class _OtherElementType, class _OtherExtents, class _OtherLayoutPolicy, class _OtherAccessor,
+    /* requires */ (
+      _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_assignable, mdspan<_OtherElementType, _OtherExtents, _OtherLayoutPolicy, _OtherAccessor>&, const_mdspan_type)
+    )
+  )
+  __MDSPAN_INLINE_FUNCTION
+  operator mdspan<_OtherElementType, _OtherExtents, _OtherLayoutPolicy, _OtherAccessor>() const {
+    return to_mdspan();
+  }
+
+  __MDSPAN_INLINE_FUNCTION
+  mdspan_type to_mdspan() {
+    return mdspan_type(data(), __map);
+  }
+
+  __MDSPAN_INLINE_FUNCTION
+  const_mdspan_type to_mdspan() const {
+    return const_mdspan_type(data(), __map);
+  }
+
+  _CCCL_EXEC_CHECK_DISABLE
+  __MDSPAN_INLINE_FUNCTION
+  friend void swap(mdarray& __x, mdarray& __y) noexcept {
+    using _CUDA_VSTD::swap;
+    swap(__x.__map, __y.__map);
+    swap(__x.__ctr, __y.__ctr);
+  }
+
+private:
+
+  mapping_type __map{};
+  container_type __ctr{};
+
+  template <class, class, class, class>
+  friend class mdarray;
+};
+
+#endif // _CCCL_STD_VER > 2011
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#endif // _LIBCUDACXX___MDSPAN_MDARRAY_HPP
@@ -0,0 +1,59 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___MEMORY_ASSUME_ALIGNED_H
+#define _LIBCUDACXX___MEMORY_ASSUME_ALIGNED_H
+
+#ifndef __cuda_std__
+#include <__config>
+#endif //__cuda_std__
+
+#include "../__type_traits/is_constant_evaluated.h"
+#include "../cstddef"
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+#if __check_builtin(builtin_assume_aligned) \
+ || defined(_LIBCUDACXX_COMPILER_GCC)       \
+ || defined(_LIBCUDACXX_COMPILER_NVCC)      \
+ || defined(_LIBCUDACXX_COMPILER_NVRTC)
+#define _LIBCUDACXX_ASSUME_ALIGNED(__ptr, __align) __builtin_assume_aligned(__ptr, __align)
+#endif // __check_builtin(builtin_assume_aligned)
+
+#if _CCCL_STD_VER > 2011
+
+// C++20 assume_aligned: tells the compiler that __ptr is aligned to _Align
+// bytes, so that loads and stores through it can use aligned vector
+// instructions.
+template <size_t _Align, class _Tp>
+_LIBCUDACXX_NODISCARD_EXT _LIBCUDACXX_INLINE_VISIBILITY
+constexpr _Tp* assume_aligned(_Tp* __ptr) noexcept {
+  static_assert(_Align != 0 && (_Align & (_Align - 1)) == 0, "alignment must be a power of two");
+#if defined(_LIBCUDACXX_ASSUME_ALIGNED)
+  if (!__libcpp_is_constant_evaluated()) {
+    return static_cast<_Tp*>(_LIBCUDACXX_ASSUME_ALIGNED(__ptr, _Align));
+  }
+#endif // _LIBCUDACXX_ASSUME_ALIGNED
+  return __ptr;
+}
+
+#endif // _CCCL_STD_VER > 2011
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#endif // _LIBCUDACXX___MEMORY_ASSUME_ALIGNED_H
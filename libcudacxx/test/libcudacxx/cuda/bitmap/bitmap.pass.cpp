@@ -0,0 +1,134 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11
+
+// <cuda/bitmap>
+
+#include <cuda/bitmap>
+#include <cuda/std/cassert>
+#include <cuda/std/cstdint>
+
+#include "test_macros.h"
+
+constexpr cuda::std::size_t num_words = 13;
+
+__host__ __device__ bool bit(const cuda::std::uint64_t* words, cuda::std::size_t i)
+{
+  return ((words[i / 64] >> (i % 64)) & 1) != 0;
+}
+
+__host__ __device__ void fill(cuda::std::uint64_t* lhs, cuda::std::uint64_t* rhs)
+{
+  cuda::std::uint64_t state = 0x9E3779B97F4A7C15ULL;
+  for (cuda::std::size_t i = 0; i < num_words; ++i)
+  {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    lhs[i] = state;
+    rhs[i] = ~state ^ (state << 3);
+  }
+  // Leave a hole so that find_next has to skip whole words.
+  lhs[5] = 0;
+  lhs[6] = 0;
+}
+
+__host__ __device__ void test_transform()
+{
+  cuda::std::uint64_t lhs[num_words];
+  cuda::std::uint64_t rhs[num_words];
+  cuda::std::uint64_t out[num_words];
+  fill(lhs, rhs);
+
+  cuda::bitmap_and(out, lhs, rhs);
+  for (cuda::std::size_t i = 0; i < num_words; ++i)
+  {
+    assert(out[i] == (lhs[i] & rhs[i]));
+  }
+  cuda::bitmap_or(out, lhs, rhs);
+  for (cuda::std::size_t i = 0; i < num_words; ++i)
+  {
+    assert(out[i] == (lhs[i] | rhs[i]));
+  }
+  cuda::bitmap_xor(out, lhs, rhs);
+  for (cuda::std::size_t i = 0; i < num_words; ++i)
+  {
+    assert(out[i] == (lhs[i] ^ rhs[i]));
+  }
+  cuda::bitmap_andnot(out, lhs, rhs);
+  for (cuda::std::size_t i = 0; i < num_words; ++i)
+  {
+    assert(out[i] == (lhs[i] & ~rhs[i]));
+  }
+
+  // In-place operation
+  cuda::std::uint64_t expected[num_words];
+  for (cuda::std::size_t i = 0; i < num_words; ++i)
+  {
+    expected[i] = lhs[i] & rhs[i];
+  }
+  cuda::bitmap_and(lhs, lhs, rhs);
+  for (cuda::std::size_t i = 0; i < num_words; ++i)
+  {
+    assert(lhs[i] == expected[i]);
+  }
+}
+
+__host__ __device__ void test_popcount()
+{
+  cuda::std::uint64_t lhs[num_words];
+  cuda::std::uint64_t rhs[num_words];
+  fill(lhs, rhs);
+
+  for (cuda::std::size_t n = 0; n <= num_words; ++n)
+  {
+    cuda::std::size_t expected = 0;
+    for (cuda::std::size_t i = 0; i < n * 64; ++i)
+    {
+      expected += bit(lhs, i);
+    }
+    assert(cuda::bitmap_popcount(cuda::std::span<const cuda::std::uint64_t>(lhs, n)) == expected);
+  }
+}
+
+__host__ __device__ void test_find_next()
+{
+  cuda::std::uint64_t lhs[num_words];
+  cuda::std::uint64_t rhs[num_words];
+  fill(lhs, rhs);
+
+  const cuda::std::span<const cuda::std::uint64_t> bits(lhs);
+  const cuda::std::size_t end = num_words * 64;
+  for (cuda::std::size_t pos = 0; pos <= end + 1; ++pos)
+  {
+    cuda::std::size_t expected = pos < end ? pos : end;
+    while (expected < end && !bit(lhs, expected))
+    {
+      ++expected;
+    }
+    assert(cuda::bitmap_find_next(bits, pos) == expected);
+  }
+  assert(cuda::bitmap_find_first(bits) == cuda::bitmap_find_next(bits, 0));
+
+  cuda::std::uint64_t zeros[3] = {0, 0, 0};
+  assert(cuda::bitmap_find_first(zeros) == 3 * 64);
+  assert(cuda::bitmap_popcount(zeros) == 0);
+  assert(cuda::bitmap_find_first(cuda::std::span<const cuda::std::uint64_t>{}) == 0);
+}
+
+int main(int, char**)
+{
+  test_transform();
+  test_popcount();
+  test_find_next();
+
+  return 0;
+}
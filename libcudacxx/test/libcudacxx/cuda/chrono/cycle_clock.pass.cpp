@@ -0,0 +1,46 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <cuda/chrono>
+
+// cycle_clock
+
+#include <cuda/chrono>
+#include <cuda/std/cassert>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+int main(int, char**)
+{
+    static_assert(cuda::std::is_same<cuda::cycle_clock::rep, decltype(cuda::cycle_clock::now())>::value, "");
+
+    const cuda::cycle_clock::rep c1 = cuda::cycle_clock::now();
+    const cuda::cycle_clock::rep c2 = cuda::cycle_clock::now();
+    assert(c2 >= c1);
+
+NV_IF_TARGET(
+NV_IS_HOST, (
+    assert(cuda::cycle_clock::ticks_per_second() > 0);
+
+    typedef cuda::std::chrono::steady_clock C;
+    const C::time_point t1 = C::now();
+    const cuda::cycle_clock::rep start = cuda::cycle_clock::now();
+    while (C::now() - t1 < cuda::std::chrono::milliseconds(20)) {}
+    const cuda::cycle_clock::rep end = cuda::cycle_clock::now();
+    const C::duration elapsed = C::now() - t1;
+
+    const auto measured = cuda::cycle_clock::to_duration<cuda::std::chrono::microseconds>(end - start);
+    assert(measured > cuda::std::chrono::milliseconds(10));
+    assert(measured <= elapsed + cuda::std::chrono::milliseconds(10));
+));
+
+  return 0;
+}
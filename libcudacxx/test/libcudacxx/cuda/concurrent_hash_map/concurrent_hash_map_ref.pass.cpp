@@ -0,0 +1,205 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+//
+// UNSUPPORTED: c++03, c++11
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: pre-sm-70
+
+// <cuda/concurrent_hash_map>
+
+#include <cuda/concurrent_hash_map>
+
+#include "test_macros.h"
+#include "concurrent_agents.h"
+#include "cuda_space_selector.h"
+
+constexpr int capacity     = 256;
+constexpr int distinct_key = 64;
+constexpr int increments   = 1000;
+
+template <cuda::thread_scope Scope>
+struct storage
+{
+  using map_type = cuda::concurrent_hash_map_ref<int, long long, Scope>;
+
+  typename map_type::control_type control[map_type::control_size(capacity)];
+  int keys[capacity];
+  long long values[capacity];
+
+  __host__ __device__ map_type map()
+  {
+    return map_type(cuda::std::span<typename map_type::control_type>(control),
+                    cuda::std::span<int>(keys),
+                    cuda::std::span<long long>(values));
+  }
+};
+
+template <cuda::thread_scope Scope>
+__host__ __device__ void test_sequential()
+{
+  storage<Scope> s;
+  auto m = s.map();
+  m.clear();
+
+  assert(m.capacity() == capacity);
+  assert(m.size() == 0);
+  assert(!m.contains(1));
+
+  assert(m.insert(1, 10));
+  assert(!m.insert(1, 20));
+  long long value = 0;
+  assert(m.find(1, value) && value == 10);
+
+  assert(!m.insert_or_assign(1, 30));
+  assert(m.find(1, value) && value == 30);
+  assert(m.insert_or_assign(2, 40));
+  assert(m.find(2, value) && value == 40);
+
+  assert(m.fetch_add(3, 5) == 0);
+  assert(m.fetch_add(3, 5) == 5);
+  assert(m.find(3, value) && value == 10);
+  assert(m.size() == 3);
+
+  const int keys[]            = {4, 5, 6, 4};
+  const long long values[]    = {1, 2, 3, 4};
+  assert(m.insert(keys, keys + 4, values) == 3);
+
+  const int queries[] = {4, 7, 6};
+  long long found[3]  = {};
+  assert(m.find(queries, queries + 3, found, -1) == 2);
+  assert(found[0] == 1 && found[1] == -1 && found[2] == 3);
+
+  m.fetch_add(keys, keys + 4, values);
+  assert(m.find(4, value) && value == 1 + 1 + 4);
+
+  // Fill the map completely; keys with colliding groups probe further.
+  m.clear();
+  for (int i = 0; i < capacity; ++i)
+  {
+    assert(m.insert(i * capacity, i));
+  }
+  assert(m.size() == capacity);
+  assert(!m.insert(-2, 0));
+  for (int i = 0; i < capacity; ++i)
+  {
+    assert(m.find(i * capacity, value) && value == i);
+  }
+  assert(!m.contains(-2));
+
+  // Keys are not reserved: any value, including -1 and 0, can be inserted.
+  m.clear();
+  assert(m.size() == 0);
+  assert(!m.contains(0));
+  assert(m.insert(-1, 1) && m.insert(0, 2));
+  assert(m.find(-1, value) && value == 1);
+  assert(m.find(0, value) && value == 2);
+}
+
+template <typename Storage, template <typename, typename> typename Selector, typename Initializer = constructor_initializer>
+__host__ __device__ void test_concurrent()
+{
+  Selector<Storage, Initializer> sel;
+  SHARED Storage* s;
+  s = sel.construct();
+  execute_on_main_thread([&] {
+    s->map().clear();
+  });
+
+  auto worker = LAMBDA()
+  {
+    auto m = s->map();
+    for (int i = 0; i < increments; ++i)
+    {
+      m.fetch_add(i % distinct_key, 1);
+    }
+  };
+
+  concurrent_agents_launch(worker, worker, worker, worker);
+
+  auto m = s->map();
+  assert(m.size() == distinct_key);
+  for (int k = 0; k < distinct_key; ++k)
+  {
+    long long value = 0;
+    assert(m.find(k, value));
+    assert(value == 4 * (increments / distinct_key + (k < increments % distinct_key ? 1 : 0)));
+  }
+}
+
+// A key found by a concurrent find always comes with the value it was
+// inserted with.
+template <typename Storage, template <typename, typename> typename Selector, typename Initializer = constructor_initializer>
+__host__ __device__ void test_concurrent_find()
+{
+  Selector<Storage, Initializer> sel;
+  SHARED Storage* s;
+  s = sel.construct();
+  execute_on_main_thread([&] {
+    s->map().clear();
+  });
+
+  auto inserter = LAMBDA()
+  {
+    auto m = s->map();
+    for (int k = 0; k < capacity / 2; ++k)
+    {
+      m.insert(k, 1000 + k);
+    }
+  };
+  auto finder = LAMBDA()
+  {
+    auto m = s->map();
+    for (int round = 0; round < 8; ++round)
+    {
+      for (int k = 0; k < capacity / 2; ++k)
+      {
+        long long value = 0;
+        if (m.find(k, value))
+        {
+          assert(value == 1000 + k);
+        }
+      }
+    }
+  };
+
+  concurrent_agents_launch(inserter, finder, inserter, finder);
+
+  auto m = s->map();
+  assert(m.size() == capacity / 2);
+}
+
+template <cuda::thread_scope Scope>
+__host__ __device__ void test()
+{
+  test_sequential<Scope>();
+
+  NV_IF_ELSE_TARGET(NV_IS_HOST,(
+    test_concurrent<storage<Scope>, local_memory_selector>();
+    test_concurrent_find<storage<Scope>, local_memory_selector>();
+  ),(
+    test_concurrent<storage<Scope>, shared_memory_selector>();
+    test_concurrent<storage<Scope>, global_memory_selector>();
+    test_concurrent_find<storage<Scope>, shared_memory_selector>();
+    test_concurrent_find<storage<Scope>, global_memory_selector>();
+  ))
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST,(
+    cuda_thread_count = 4;
+  ))
+
+  test<cuda::thread_scope_system>();
+  test<cuda::thread_scope_device>();
+  test<cuda::thread_scope_block>();
+
+  return 0;
+}
@@ -0,0 +1,93 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11
+// UNSUPPORTED: msvc && c++14, msvc && c++17
+
+// <cuda/mdspan>
+
+#include <cuda/mdspan>
+#include <cuda/std/cassert>
+
+#include "test_macros.h"
+
+constexpr auto dyn = cuda::std::dynamic_extent;
+
+using ext_t = cuda::std::extents<int, dyn, 4>;
+
+template <class Accessor>
+__host__ __device__ void test_accessor()
+{
+  using mdspan_t = cuda::std::mdspan<int, ext_t, cuda::std::layout_right, Accessor>;
+
+  static_assert(cuda::std::is_same<typename Accessor::reference, int&>::value, "");
+  static_assert(cuda::std::is_convertible<Accessor, cuda::std::default_accessor<const int>>::value, "");
+
+  int data[12] = {};
+  mdspan_t s{data, ext_t{3}};
+  for (int i = 0; i < s.extent(0); ++i)
+  {
+    for (int j = 0; j < s.extent(1); ++j)
+    {
+      s(i, j) = i * 4 + j;
+    }
+  }
+  for (int i = 0; i < 12; ++i)
+  {
+    assert(data[i] == i);
+  }
+
+  cuda::std::mdspan<const int, ext_t> c = s;
+  assert(c(2, 3) == 11);
+
+  Accessor a{};
+  assert(a.offset(data, 2) == data + 2);
+  assert(a.access(data, 7) == 7);
+}
+
+__host__ __device__ void test_restrict_accessor()
+{
+  using accessor_t = cuda::restrict_accessor<int>;
+  static_assert(cuda::std::is_same<accessor_t::offset_policy, accessor_t>::value, "");
+  static_assert(!cuda::std::is_convertible<cuda::std::default_accessor<int>, accessor_t>::value, "");
+  static_assert(cuda::std::is_constructible<accessor_t, cuda::std::default_accessor<int>>::value, "");
+  static_assert(cuda::std::is_convertible<accessor_t, cuda::restrict_accessor<const int>>::value, "");
+
+  test_accessor<accessor_t>();
+}
+
+struct not_reused
+{};
+
+__host__ __device__ void test_prefetch_accessor()
+{
+  using accessor_t = cuda::prefetch_accessor<int>;
+  static_assert(accessor_t::prefetch_distance == 128, "");
+  static_assert(cuda::prefetch_accessor<double, void, 4>::prefetch_distance == 4, "");
+  static_assert(cuda::std::is_convertible<cuda::std::default_accessor<int>, accessor_t>::value, "");
+  static_assert(cuda::std::is_convertible<accessor_t, cuda::prefetch_accessor<const int>>::value, "");
+
+  test_accessor<accessor_t>();
+  test_accessor<cuda::prefetch_accessor<int, not_reused, 1>>();
+
+  // prefetching past the end of the elements is harmless
+  int data[12] = {};
+  cuda::std::mdspan<int, ext_t> d{data, ext_t{3}};
+  cuda::std::mdspan<int, ext_t, cuda::std::layout_right, accessor_t> s = d;
+  assert(s(2, 3) == 0);
+}
+
+int main(int, char**)
+{
+  test_restrict_accessor();
+  test_prefetch_accessor();
+
+  return 0;
+}
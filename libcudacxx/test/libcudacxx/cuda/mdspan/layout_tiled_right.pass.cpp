@@ -0,0 +1,122 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11
+// UNSUPPORTED: msvc && c++14, msvc && c++17
+
+// <cuda/mdspan>
+
+#include <cuda/mdspan>
+#include <cuda/std/cassert>
+
+#include "test_macros.h"
+
+constexpr auto dyn = cuda::std::dynamic_extent;
+
+__host__ __device__ void test_offsets()
+{
+  using ext_t     = cuda::std::extents<int, dyn, dyn>;
+  using mapping_t = cuda::layout_tiled_right<2, 4>::mapping<ext_t>;
+
+  static_assert(mapping_t::tile_size() == 8, "");
+  static_assert(mapping_t::tile_extent(1) == 4, "");
+
+  // 5 x 6 elements in 3 x 2 tiles
+  mapping_t m{ext_t{5, 6}};
+  assert(m.tile_count(0) == 3);
+  assert(m.tile_count(1) == 2);
+  assert(m.required_span_size() == 48);
+
+  // elements of a tile are contiguous
+  assert(m(0, 0) == 0);
+  assert(m(0, 3) == 3);
+  assert(m(1, 0) == 4);
+  assert(m(1, 3) == 7);
+  // the next tile of the same tile row follows
+  assert(m(0, 4) == 8);
+  assert(m(1, 5) == 13);
+  // then the next tile row
+  assert(m(2, 0) == 16);
+  assert(m(4, 5) == 32 + 8 + 1);
+
+  // every index maps to a distinct offset
+  bool seen[48] = {};
+  for (int i = 0; i < 5; ++i)
+  {
+    for (int j = 0; j < 6; ++j)
+    {
+      const int offset = m(i, j);
+      assert(offset < m.required_span_size());
+      assert(!seen[offset]);
+      seen[offset] = true;
+    }
+  }
+
+  assert(m.is_unique());
+  assert(!m.is_exhaustive());
+  assert(!m.is_strided());
+  assert(m == mapping_t(ext_t{5, 6}));
+  assert(m != mapping_t(ext_t{6, 6}));
+}
+
+__host__ __device__ void test_properties()
+{
+  {
+    using ext_t     = cuda::std::extents<int, 8, 8>;
+    using mapping_t = cuda::layout_tiled_right<4, 4>::mapping<ext_t>;
+    static_assert(mapping_t::is_always_exhaustive(), "");
+    static_assert(!mapping_t::is_always_strided(), "");
+    static_assert(cuda::std::is_same<mapping_t::layout_type, cuda::layout_tiled_right<4, 4>>::value, "");
+
+    mapping_t m{};
+    assert(m.is_exhaustive());
+    assert(m.required_span_size() == 64);
+  }
+
+  // a single column of tiles is a row-major array
+  {
+    using ext_t     = cuda::std::extents<int, dyn, 4>;
+    using mapping_t = cuda::layout_tiled_right<2, 4>::mapping<ext_t>;
+    static_assert(mapping_t::is_always_strided(), "");
+
+    mapping_t m{ext_t{6}};
+    assert(m.is_strided());
+    assert(m.stride(0) == 4);
+    assert(m.stride(1) == 1);
+    for (int i = 0; i < 6; ++i)
+    {
+      for (int j = 0; j < 4; ++j)
+      {
+        assert(m(i, j) == i * 4 + j);
+      }
+    }
+  }
+}
+
+__host__ __device__ void test_mdspan()
+{
+  using ext_t   = cuda::std::extents<int, 4, 4>;
+  using layout  = cuda::layout_tiled_right<2, 2>;
+  int data[16]  = {};
+  cuda::std::mdspan<int, ext_t, layout> s{data};
+
+  s(2, 3) = 42;
+  // tile (1, 1), element (0, 1) of the tile
+  assert(data[3 * 4 + 1] == 42);
+}
+
+int main(int, char**)
+{
+  test_offsets();
+  test_properties();
+  test_mdspan();
+
+  return 0;
+}
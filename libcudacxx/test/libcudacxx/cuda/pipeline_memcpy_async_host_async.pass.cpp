@@ -0,0 +1,166 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: nvrtc, pre-sm-70
+
+#define LIBCUDACXX_ENABLE_EXPERIMENTAL_HOST_MEMCPY_ASYNC
+
+#include <cuda/barrier>
+#include <cuda/pipeline>
+
+#include <thread>
+#include <vector>
+
+#include "test_macros.h"
+
+constexpr size_t stage_size = 3 * 1024 * 1024 + 17;
+constexpr int stage_count   = 4;
+
+__host__ bool equal(const char* lhs, const char* rhs, size_t size)
+{
+  for (size_t i = 0; i < size; ++i)
+  {
+    if (lhs[i] != rhs[i])
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+__host__ void test_pipeline()
+{
+  std::vector<char> source(stage_size * stage_count);
+  std::vector<char> dest(stage_size * stage_count, 0);
+  for (size_t i = 0; i < source.size(); ++i)
+  {
+    source[i] = static_cast<char>(i * 7 + 3);
+  }
+
+  auto pipe = cuda::make_pipeline();
+
+  for (int stage = 0; stage < stage_count; ++stage)
+  {
+    pipe.producer_acquire();
+    cuda::memcpy_async(dest.data() + stage * stage_size, source.data() + stage * stage_size, stage_size, pipe);
+    pipe.producer_commit();
+  }
+
+  for (int stage = 0; stage < stage_count; ++stage)
+  {
+    pipe.consumer_wait();
+    assert(equal(dest.data() + stage * stage_size, source.data() + stage * stage_size, stage_size));
+    pipe.consumer_release();
+  }
+
+  // Small copies are performed immediately, empty commits form complete groups.
+  char small_source[16] = "host memcpy";
+  char small_dest[16]   = {};
+  pipe.producer_acquire();
+  cuda::memcpy_async(small_dest, small_source, sizeof(small_source), pipe);
+  pipe.producer_commit();
+  pipe.producer_acquire();
+  pipe.producer_commit();
+  cuda::pipeline_consumer_wait_prior<0>(pipe);
+  assert(equal(small_dest, small_source, sizeof(small_source)));
+  pipe.consumer_release();
+  pipe.consumer_release();
+
+  std::vector<char> prior_dest(2 * stage_size, 0);
+  pipe.producer_acquire();
+  cuda::memcpy_async(prior_dest.data(), source.data(), stage_size, pipe);
+  pipe.producer_commit();
+  pipe.producer_acquire();
+  cuda::memcpy_async(prior_dest.data() + stage_size, source.data() + stage_size, stage_size, pipe);
+  pipe.producer_commit();
+  cuda::pipeline_consumer_wait_prior<1>(pipe);
+  assert(equal(prior_dest.data(), source.data(), stage_size));
+  pipe.consumer_release();
+  cuda::pipeline_consumer_wait_prior<0>(pipe);
+  assert(equal(prior_dest.data() + stage_size, source.data() + stage_size, stage_size));
+  pipe.consumer_release();
+}
+
+__host__ void test_barrier()
+{
+  std::vector<char> source(stage_size);
+  std::vector<char> dest(stage_size, 0);
+  for (size_t i = 0; i < source.size(); ++i)
+  {
+    source[i] = static_cast<char>(i * 5 + 1);
+  }
+
+  cuda::barrier<cuda::thread_scope_system> bar(1);
+  cuda::memcpy_async(dest.data(), source.data(), stage_size, bar);
+  // The copy is only bound to the barrier, it is waited for on arrival.
+  assert(cuda::__host_async_groups::__get().__has_bound());
+  bar.arrive_and_wait();
+  assert(!cuda::__host_async_groups::__get().__has_bound());
+  assert(equal(dest.data(), source.data(), stage_size));
+
+  std::vector<char> block_dest(stage_size, 0);
+  cuda::barrier<cuda::thread_scope_block> block_bar(1);
+  cuda::memcpy_async(block_dest.data(), source.data(), stage_size, block_bar);
+  block_bar.wait(block_bar.arrive());
+  assert(equal(block_dest.data(), source.data(), stage_size));
+
+  std::vector<char> drop_dest(stage_size, 0);
+  cuda::barrier<cuda::thread_scope_system> drop_bar(1);
+  cuda::memcpy_async(drop_dest.data(), source.data(), stage_size, drop_bar);
+  drop_bar.arrive_and_drop();
+  assert(equal(drop_dest.data(), source.data(), stage_size));
+
+  // pipeline_producer_commit binds the copies of the pipeline to the barrier.
+  std::vector<char> pipe_dest(stage_size, 0);
+  cuda::barrier<cuda::thread_scope_system> pipe_bar(1);
+  auto pipe = cuda::make_pipeline();
+  cuda::memcpy_async(pipe_dest.data(), source.data(), stage_size, pipe);
+  cuda::pipeline_producer_commit(pipe, pipe_bar);
+  pipe_bar.arrive_and_wait();
+  assert(equal(pipe_dest.data(), source.data(), stage_size));
+}
+
+__host__ void test_barrier_threads()
+{
+  constexpr int thread_count = 4;
+  std::vector<char> source(thread_count * stage_size);
+  std::vector<char> dest(thread_count * stage_size, 0);
+  for (size_t i = 0; i < source.size(); ++i)
+  {
+    source[i] = static_cast<char>(i * 3 + 2);
+  }
+
+  // Every thread copies its part and then reads all parts after the barrier.
+  cuda::barrier<cuda::thread_scope_system> bar(thread_count);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < thread_count; ++t)
+  {
+    threads.emplace_back([&, t] {
+      cuda::memcpy_async(dest.data() + t * stage_size, source.data() + t * stage_size, stage_size, bar);
+      bar.arrive_and_wait();
+      assert(equal(dest.data(), source.data(), source.size()));
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+}
+
+int main(int argc, char** argv)
+{
+  NV_IF_TARGET(NV_IS_HOST, (
+    test_pipeline();
+    test_barrier();
+    test_barrier_threads();
+  ))
+
+  return 0;
+}
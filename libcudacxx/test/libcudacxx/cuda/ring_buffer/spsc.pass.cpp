@@ -0,0 +1,138 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+//
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: pre-sm-70
+
+// <cuda/ring_buffer>
+
+#include <cuda/ring_buffer>
+
+#include "test_macros.h"
+#include "concurrent_agents.h"
+#include "cuda_space_selector.h"
+
+constexpr int element_count = 1000;
+
+template <cuda::thread_scope Scope>
+__host__ __device__ void test_sequential()
+{
+  cuda::spsc_ring_buffer<int, 4, Scope> q;
+  static_assert(decltype(q)::capacity() == 4, "");
+  assert(q.empty());
+
+  int value = 0;
+  assert(!q.try_pop(value));
+  assert(q.try_push(1));
+  assert(q.try_push(2));
+  assert(q.size() == 2);
+
+  const int values[] = {3, 4, 5};
+  assert(q.try_push_n(values, 3) == 2);
+  assert(q.size() == 4);
+  assert(!q.try_push(6));
+
+  assert(q.try_pop(value) && value == 1);
+  int out[8] = {};
+  assert(q.try_pop_n(out, 8) == 3);
+  assert(out[0] == 2 && out[1] == 3 && out[2] == 4);
+  assert(q.try_pop_n(out, 8) == 0);
+  assert(q.empty());
+
+  // Wrap around the end of the storage.
+  for (int i = 0; i < 10; ++i)
+  {
+    q.push(i);
+    q.pop(value);
+    assert(value == i);
+  }
+}
+
+template <typename Queue, template <typename, typename> typename Selector, typename Initializer = constructor_initializer>
+__host__ __device__ void test_concurrent()
+{
+  Selector<Queue, Initializer> sel;
+  SHARED Queue* q;
+  q = sel.construct();
+
+  auto producer = LAMBDA()
+  {
+    int i = 0;
+    while (i < element_count)
+    {
+      if (i % 3 == 0)
+      {
+        q->push(i++);
+      }
+      else
+      {
+        const int batch[] = {i, i + 1, i + 2};
+        const int count   = element_count - i < 3 ? element_count - i : 3;
+        i += static_cast<int>(q->try_push_n(batch, count));
+      }
+    }
+  };
+
+  auto consumer = LAMBDA()
+  {
+    int expected = 0;
+    while (expected < element_count)
+    {
+      if (expected % 2 == 0)
+      {
+        int value = -1;
+        q->pop(value);
+        assert(value == expected);
+        ++expected;
+      }
+      else
+      {
+        int batch[5];
+        const auto count = q->try_pop_n(batch, 5);
+        for (size_t j = 0; j < count; ++j)
+        {
+          assert(batch[j] == expected);
+          ++expected;
+        }
+      }
+    }
+  };
+
+  concurrent_agents_launch(producer, consumer);
+
+  assert(q->empty());
+}
+
+template <cuda::thread_scope Scope>
+__host__ __device__ void test()
+{
+  test_sequential<Scope>();
+
+  using queue = cuda::spsc_ring_buffer<int, 8, Scope>;
+  NV_IF_ELSE_TARGET(NV_IS_HOST,(
+    test_concurrent<queue, local_memory_selector>();
+  ),(
+    test_concurrent<queue, shared_memory_selector>();
+    test_concurrent<queue, global_memory_selector>();
+  ))
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST,(
+    cuda_thread_count = 2;
+  ))
+
+  test<cuda::thread_scope_system>();
+  test<cuda::thread_scope_device>();
+  test<cuda::thread_scope_block>();
+
+  return 0;
+}
@@ -0,0 +1,122 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++11, nvrtc
+// UNSUPPORTED: msvc && c++14, msvc && c++17
+
+#include <cuda/std/mdarray>
+#include <cuda/std/array>
+#include <cuda/std/cassert>
+
+#include <memory>
+#include <vector>
+
+#include <test_macros.h>
+
+constexpr auto dyn = cuda::std::dynamic_extent;
+
+int main(int, char**)
+{
+    using ext2d_t = cuda::std::extents<int,dyn,3>;
+
+    // dynamic extents
+    {
+        cuda::std::mdarray<int, ext2d_t> a(2);
+
+        static_assert( cuda::std::is_same<decltype(a)::container_type, std::vector<int>>::value, "" );
+
+        assert( a.extent(0) == 2 );
+        assert( a.extent(1) == 3 );
+        assert( a.size() == 6 );
+        assert( a.container_size() == 6 );
+        assert( a.empty() == false );
+    }
+
+    // default construction with static extents allocates the elements
+    {
+        cuda::std::mdarray<int, cuda::std::extents<int,2,2>> a;
+        assert( a.container_size() == 4 );
+
+        cuda::std::mdarray<int, ext2d_t> b;
+        assert( b.empty() );
+    }
+
+    // fill value
+    {
+        cuda::std::mdarray<double, ext2d_t> a(ext2d_t{4}, 1.5);
+        for (int i = 0; i < 4; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                assert( a(i, j) == 1.5 );
+            }
+        }
+    }
+
+    // the container is sized for the mapping, including padding
+    {
+        using layout_t = cuda::std::layout_right_padded<4>;
+        cuda::std::mdarray<int, ext2d_t, layout_t> a(ext2d_t{2});
+
+        assert( a.size() == 6 );
+        assert( a.container_size() == 8 );
+        assert( a.stride(0) == 4 );
+        assert( a.is_exhaustive() == false );
+    }
+
+    // adopting a container
+    {
+        std::vector<int> v{0, 1, 2, 3, 4, 5};
+        const int* data = v.data();
+
+        cuda::std::mdarray<int, ext2d_t> a(ext2d_t{2}, std::move(v));
+        assert( a.data() == data );
+        assert( a(1, 0) == 3 );
+
+        cuda::std::mdarray<int, ext2d_t, cuda::std::layout_left> b(ext2d_t{2}, std::vector<int>{0, 1, 2, 3, 4, 5});
+        assert( b(1, 0) == 1 );
+        assert( b(0, 1) == 2 );
+    }
+
+    // allocator
+    {
+        cuda::std::mdarray<int, ext2d_t> a(ext2d_t{2}, std::allocator<int>{});
+        assert( a.container_size() == 6 );
+
+        cuda::std::mdarray<int, ext2d_t> b(ext2d_t{2}, 7, std::allocator<int>{});
+        assert( b(1, 2) == 7 );
+    }
+
+    // fixed size container
+    {
+        using array_t = cuda::std::array<int, 6>;
+        cuda::std::mdarray<int, cuda::std::extents<int,2,3>, cuda::std::layout_right, array_t> a(cuda::std::extents<int,2,3>{}, 3);
+
+        assert( a.container_size() == 6 );
+        assert( a(1, 1) == 3 );
+    }
+
+    // copy, move and swap
+    {
+        cuda::std::mdarray<int, ext2d_t> a(ext2d_t{2}, 1);
+        cuda::std::mdarray<int, ext2d_t> b(a);
+        b(0, 0) = 2;
+        assert( a(0, 0) == 1 );
+
+        cuda::std::mdarray<int, ext2d_t> c(ext2d_t{5}, 3);
+        swap(a, c);
+        assert( a.extent(0) == 5 );
+        assert( c.extent(0) == 2 );
+        assert( c(1, 2) == 1 );
+
+        std::vector<int> v = std::move(b).extract_container();
+        assert( v.size() == 6 );
+        assert( v[0] == 2 );
+    }
+
+    return 0;
+}
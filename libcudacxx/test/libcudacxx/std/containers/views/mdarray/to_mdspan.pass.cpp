@@ -0,0 +1,74 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++11, nvrtc
+// UNSUPPORTED: msvc && c++14, msvc && c++17
+
+#include <cuda/std/mdarray>
+#include <cuda/std/cassert>
+
+#include <test_macros.h>
+
+constexpr auto dyn = cuda::std::dynamic_extent;
+
+int sum(cuda::std::mdspan<const int, cuda::std::extents<int,dyn,dyn>> s)
+{
+    int value = 0;
+    for (int i = 0; i < s.extent(0); ++i) {
+        for (int j = 0; j < s.extent(1); ++j) {
+            value += s(i, j);
+        }
+    }
+    return value;
+}
+
+int main(int, char**)
+{
+    using ext2d_t = cuda::std::extents<int,dyn,dyn>;
+
+    {
+        cuda::std::mdarray<int, ext2d_t> a(2, 3);
+
+        auto s = a.to_mdspan();
+        static_assert( cuda::std::is_same<decltype(s), decltype(a)::mdspan_type>::value, "" );
+        assert( s.data_handle() == a.data() );
+        assert( s.extents() == a.extents() );
+
+        for (int i = 0; i < 2; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                s(i, j) = i * 3 + j;
+            }
+        }
+        assert( a(1, 2) == 5 );
+
+        const auto& c = a;
+        static_assert( cuda::std::is_same<decltype(c.to_mdspan()), decltype(a)::const_mdspan_type>::value, "" );
+        assert( c.to_mdspan()(1, 1) == 4 );
+
+        // implicit conversions
+        cuda::std::mdspan<int, ext2d_t> m = a;
+        assert( m(0, 2) == 2 );
+        assert( sum(a) == 15 );
+        assert( sum(c) == 15 );
+    }
+
+    // observers forward to the mapping
+    {
+        cuda::std::mdarray<float, ext2d_t, cuda::std::layout_left> a(4, 5);
+
+        static_assert( decltype(a)::rank() == 2, "" );
+        static_assert( decltype(a)::rank_dynamic() == 2, "" );
+        static_assert( decltype(a)::is_always_unique(), "" );
+        assert( a.stride(1) == 4 );
+        assert( a.is_exhaustive() );
+        assert( a.mapping() == cuda::std::layout_left::mapping<ext2d_t>(ext2d_t{4, 5}) );
+    }
+
+    return 0;
+}
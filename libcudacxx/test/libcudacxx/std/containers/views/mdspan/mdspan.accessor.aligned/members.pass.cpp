@@ -0,0 +1,71 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++11
+// UNSUPPORTED: msvc && c++14, msvc && c++17
+
+#include <cuda/std/mdspan>
+#include <cuda/std/cassert>
+
+#include <test_macros.h>
+
+constexpr auto dyn = cuda::std::dynamic_extent;
+
+int main(int, char**)
+{
+    using accessor_t = cuda::std::aligned_accessor<float, 32>;
+
+    static_assert( cuda::std::is_same<accessor_t::offset_policy, cuda::std::default_accessor<float>>::value, "" );
+    static_assert( cuda::std::is_same<accessor_t::data_handle_type, float*>::value, "" );
+    static_assert( cuda::std::is_same<accessor_t::reference, float&>::value, "" );
+    static_assert( accessor_t::byte_alignment == 32, "" );
+
+    // stronger alignment and added const convert implicitly
+    static_assert( cuda::std::is_convertible<cuda::std::aligned_accessor<float, 64>, accessor_t>::value, "" );
+    static_assert( cuda::std::is_convertible<accessor_t, cuda::std::aligned_accessor<const float, 16>>::value, "" );
+    static_assert( !cuda::std::is_convertible<cuda::std::aligned_accessor<float, 16>, accessor_t>::value, "" );
+
+    // default_accessor only converts explicitly, dropping the guarantee does not
+    static_assert( cuda::std::is_constructible<accessor_t, cuda::std::default_accessor<float>>::value, "" );
+    static_assert( !cuda::std::is_convertible<cuda::std::default_accessor<float>, accessor_t>::value, "" );
+    static_assert( cuda::std::is_convertible<accessor_t, cuda::std::default_accessor<const float>>::value, "" );
+
+    {
+        alignas(32) float data[16] = {};
+        accessor_t a{};
+
+        a.access(data, 3) = 1.0f;
+        assert( data[3] == 1.0f );
+        assert( a.offset(data, 5) == data + 5 );
+    }
+
+    // mdspan with an aligned accessor
+    {
+        using ext_t = cuda::std::extents<int,dyn,8>;
+        using mdspan_t = cuda::std::mdspan<float, ext_t, cuda::std::layout_right, accessor_t>;
+
+        alignas(32) float data[32] = {};
+        mdspan_t s{ data, ext_t{4} };
+        for (int i = 0; i < s.extent(0); ++i) {
+            for (int j = 0; j < s.extent(1); ++j) {
+                s(i, j) = static_cast<float>(i * 8 + j);
+            }
+        }
+        assert( data[31] == 31.0f );
+
+        cuda::std::mdspan<const float, ext_t> c = s;
+        assert( c(2, 3) == 19.0f );
+
+        cuda::std::mdspan<float, ext_t> d{ data, ext_t{4} };
+        mdspan_t e{ d };
+        assert( e(1, 1) == 9.0f );
+    }
+
+    return 0;
+}
@@ -0,0 +1,109 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++11
+// UNSUPPORTED: msvc && c++14, msvc && c++17
+
+#include <cuda/std/mdspan>
+#include <cuda/std/cassert>
+
+#include <test_macros.h>
+
+constexpr auto dyn = cuda::std::dynamic_extent;
+
+int main(int, char**)
+{
+    using index_t = size_t;
+    using ext2d_t = cuda::std::extents<index_t,dyn,dyn>;
+    using ext3d_t = cuda::std::extents<index_t,3,dyn,2>;
+
+    // static padding
+    {
+        using mapping_t = cuda::std::layout_left_padded<4>::mapping<ext2d_t>;
+        mapping_t m{ ext2d_t{5, 3} };
+
+        static_assert( cuda::std::is_same<mapping_t::layout_type, cuda::std::layout_left_padded<4>>::value, "" );
+        static_assert( mapping_t::padding_value == 4, "" );
+
+        assert( m.stride(0) == 1 );
+        assert( m.stride(1) == 8 );
+        assert( m(0, 0) == 0 );
+        assert( m(4, 0) == 4 );
+        assert( m(1, 2) == 17 );
+        assert( m.required_span_size() == 24 );
+
+        assert( m.is_unique()   == true  );
+        assert( m.is_strided()  == true  );
+        assert( m.is_exhaustive() == false );
+
+        static_assert( mapping_t::is_always_exhaustive() == false, "" );
+        static_assert( mapping_t::is_always_strided()    == true , "" );
+    }
+
+    // dynamic padding
+    {
+        using mapping_t = cuda::std::layout_left_padded<>::mapping<ext3d_t>;
+        mapping_t m{ ext3d_t{4}, 8 };
+
+        assert( m.stride(0) == 1  );
+        assert( m.stride(1) == 8  );
+        assert( m.stride(2) == 32 );
+        assert( m(2, 3, 1) == 2 + 3 * 8 + 32 );
+        assert( m.required_span_size() == 64 );
+
+        // without a padding argument the extents are packed
+        mapping_t packed{ ext3d_t{4} };
+        assert( packed.stride(1) == 3 );
+        assert( packed.is_exhaustive() == true );
+        assert( packed != m );
+        assert( packed == mapping_t(ext3d_t{4}, 1) );
+    }
+
+    // static extent divisible by the padding
+    {
+        using ext_t = cuda::std::extents<int,8,dyn>;
+        using mapping_t = cuda::std::layout_left_padded<4>::mapping<ext_t>;
+        static_assert( mapping_t::is_always_exhaustive() == true, "" );
+
+        mapping_t m{ ext_t{2} };
+        assert( m.stride(1) == 8 );
+        assert( m.required_span_size() == 16 );
+    }
+
+    // rank-1 mappings are never padded
+    {
+        using ext_t = cuda::std::extents<int,dyn>;
+        using mapping_t = cuda::std::layout_left_padded<4>::mapping<ext_t>;
+        mapping_t m{ ext_t{5} };
+
+        assert( m.required_span_size() == 5 );
+        assert( m.is_exhaustive() == true );
+    }
+
+    // an empty extent leaves nothing to map
+    {
+        using mapping_t = cuda::std::layout_left_padded<4>::mapping<ext2d_t>;
+        mapping_t m{ ext2d_t{5, 0} };
+
+        assert( m.required_span_size() == 0 );
+    }
+
+    // mdspan over padded storage
+    {
+        using mapping_t = cuda::std::layout_left_padded<4>::mapping<ext2d_t>;
+        int data[12] = {};
+        cuda::std::mdspan<int, ext2d_t, cuda::std::layout_left_padded<4>> s{ data, mapping_t{ ext2d_t{3, 3} } };
+
+        s(2, 1) = 42;
+        assert( data[6] == 42 );
+        assert( s.stride(1) == 4 );
+    }
+
+    return 0;
+}
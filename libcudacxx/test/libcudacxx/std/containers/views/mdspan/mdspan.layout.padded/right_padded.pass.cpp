@@ -0,0 +1,88 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++11
+// UNSUPPORTED: msvc && c++14, msvc && c++17
+
+#include <cuda/std/mdspan>
+#include <cuda/std/cassert>
+
+#include <test_macros.h>
+
+constexpr auto dyn = cuda::std::dynamic_extent;
+
+int main(int, char**)
+{
+    using index_t = size_t;
+    using ext2d_t = cuda::std::extents<index_t,dyn,dyn>;
+    using ext3d_t = cuda::std::extents<index_t,2,dyn,3>;
+
+    // static padding
+    {
+        using mapping_t = cuda::std::layout_right_padded<4>::mapping<ext2d_t>;
+        mapping_t m{ ext2d_t{3, 5} };
+
+        static_assert( cuda::std::is_same<mapping_t::layout_type, cuda::std::layout_right_padded<4>>::value, "" );
+
+        assert( m.stride(0) == 8 );
+        assert( m.stride(1) == 1 );
+        assert( m(0, 4) == 4 );
+        assert( m(2, 1) == 17 );
+        assert( m.required_span_size() == 24 );
+        assert( m.is_exhaustive() == false );
+
+        static_assert( mapping_t::is_always_exhaustive() == false, "" );
+    }
+
+    // dynamic padding
+    {
+        using mapping_t = cuda::std::layout_right_padded<>::mapping<ext3d_t>;
+        mapping_t m{ ext3d_t{4}, 8 };
+
+        assert( m.stride(0) == 32 );
+        assert( m.stride(1) == 8  );
+        assert( m.stride(2) == 1  );
+        assert( m(1, 3, 2) == 32 + 3 * 8 + 2 );
+        assert( m.required_span_size() == 64 );
+
+        mapping_t packed{ ext3d_t{4} };
+        assert( packed.stride(0) == 12 );
+        assert( packed.is_exhaustive() == true );
+        assert( packed != m );
+        assert( m == mapping_t(ext3d_t{4}, 8) );
+    }
+
+    // padding agrees with layout_right when the rows are already aligned
+    {
+        using ext_t = cuda::std::extents<int,dyn,8>;
+        using mapping_t = cuda::std::layout_right_padded<4>::mapping<ext_t>;
+        static_assert( mapping_t::is_always_exhaustive() == true, "" );
+
+        mapping_t m{ ext_t{3} };
+        cuda::std::layout_right::mapping<ext_t> r{ ext_t{3} };
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 8; ++j) {
+                assert( m(i, j) == r(i, j) );
+            }
+        }
+    }
+
+    // mdspan over padded storage
+    {
+        using mapping_t = cuda::std::layout_right_padded<4>::mapping<ext2d_t>;
+        int data[12] = {};
+        cuda::std::mdspan<int, ext2d_t, cuda::std::layout_right_padded<4>> s{ data, mapping_t{ ext2d_t{3, 3} } };
+
+        s(1, 2) = 42;
+        assert( data[6] == 42 );
+        assert( s.stride(0) == 4 );
+    }
+
+    return 0;
+}
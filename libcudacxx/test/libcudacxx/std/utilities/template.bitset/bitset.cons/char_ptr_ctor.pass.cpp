@@ -0,0 +1,81 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03
+
+// template <class charT>
+//     explicit bitset(const charT* str, size_t n = size_t(-1),
+//                     charT zero = charT('0'), charT one = charT('1'));
+
+#include <cuda/std/bitset>
+#include <cuda/std/cassert>
+
+#include "test_macros.h"
+
+template <cuda::std::size_t N>
+__host__ __device__ void test_char_pointer_ctor()
+{
+    {
+        const char str[] = "1010101010";
+        cuda::std::bitset<N> v(str);
+        cuda::std::size_t M = N < 10 ? N : 10;
+        for (cuda::std::size_t i = 0; i < M; ++i)
+            assert(v[i] == (str[M - 1 - i] == '1'));
+        for (cuda::std::size_t i = 10; i < v.size(); ++i)
+            assert(v[i] == false);
+    }
+    {
+        const char str[] = "1010101010";
+        cuda::std::bitset<N> v(str, 6);
+        cuda::std::size_t M = N < 6 ? N : 6;
+        for (cuda::std::size_t i = 0; i < M; ++i)
+            assert(v[i] == (str[M - 1 - i] == '1'));
+        for (cuda::std::size_t i = 6; i < v.size(); ++i)
+            assert(v[i] == false);
+    }
+    {
+        const char str[] = "abababab";
+        cuda::std::bitset<N> v(str, 8, 'a', 'b');
+        cuda::std::size_t M = N < 8 ? N : 8;
+        for (cuda::std::size_t i = 0; i < M; ++i)
+            assert(v[i] == (str[M - 1 - i] == 'b'));
+        for (cuda::std::size_t i = 8; i < v.size(); ++i)
+            assert(v[i] == false);
+    }
+}
+
+#if TEST_STD_VER > 2011
+template <cuda::std::size_t N>
+__host__ __device__ constexpr bool test_constexpr()
+{
+    cuda::std::bitset<N> v("1100");
+    return v.count() == (N < 2 ? 0 : (N < 4 ? N - 2 : 2));
+}
+#endif
+
+int main(int, char**)
+{
+    test_char_pointer_ctor<0>();
+    test_char_pointer_ctor<1>();
+    test_char_pointer_ctor<31>();
+    test_char_pointer_ctor<32>();
+    test_char_pointer_ctor<33>();
+    test_char_pointer_ctor<63>();
+    test_char_pointer_ctor<64>();
+    test_char_pointer_ctor<65>();
+    test_char_pointer_ctor<1000>();
+
+#if TEST_STD_VER > 2011
+    static_assert(test_constexpr<4>(), "");
+    static_assert(test_constexpr<64>(), "");
+    static_assert(test_constexpr<100>(), "");
+#endif
+
+    return 0;
+}
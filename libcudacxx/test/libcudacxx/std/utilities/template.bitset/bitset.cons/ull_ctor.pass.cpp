@@ -0,0 +1,50 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03
+
+// constexpr bitset(unsigned long long val) noexcept;
+
+#include <cuda/std/bitset>
+#include <cuda/std/cassert>
+
+#include "test_macros.h"
+
+template <cuda::std::size_t N>
+__host__ __device__ void test_val_ctor()
+{
+    {
+        TEST_CONSTEXPR cuda::std::bitset<N> v(0xAAAAAAAAAAAAAAAAULL);
+        assert(v.size() == N);
+        cuda::std::size_t M = N < 64 ? N : 64;
+        for (cuda::std::size_t i = 0; i < M; ++i)
+            assert(v[i] == ((i & 1) != 0));
+        for (cuda::std::size_t i = M; i < v.size(); ++i)
+            assert(v[i] == false);
+    }
+    {
+        constexpr cuda::std::bitset<N> v(0xAAAAAAAAAAAAAAAAULL);
+        static_assert(v.size() == N, "");
+    }
+}
+
+int main(int, char**)
+{
+    test_val_ctor<0>();
+    test_val_ctor<1>();
+    test_val_ctor<31>();
+    test_val_ctor<32>();
+    test_val_ctor<33>();
+    test_val_ctor<63>();
+    test_val_ctor<64>();
+    test_val_ctor<65>();
+    test_val_ctor<1000>();
+
+    return 0;
+}
@@ -0,0 +1,70 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11
+
+// constexpr size_t count() const noexcept;
+// constexpr bool all() const noexcept;
+// constexpr bool any() const noexcept;
+// constexpr bool none() const noexcept;
+
+#include <cuda/std/bitset>
+#include <cuda/std/cassert>
+
+#include "test_macros.h"
+
+template <cuda::std::size_t N>
+__host__ __device__ constexpr bool test_count()
+{
+    cuda::std::bitset<N> v;
+    assert(v.count() == 0);
+    assert(v.none());
+    assert(!v.any());
+    assert(v.all() == (N == 0));
+
+    cuda::std::size_t expected = 0;
+    for (cuda::std::size_t i = 0; i < N; i += 3)
+    {
+        v[i] = true;
+        ++expected;
+    }
+    assert(v.count() == expected);
+    assert(v.any() == (N != 0));
+    assert(v.none() == (N == 0));
+
+    v.set();
+    assert(v.count() == N);
+    assert(v.all());
+    assert(v.any() == (N != 0));
+
+    v.flip();
+    assert(v.count() == 0);
+    assert(v.none());
+
+    return true;
+}
+
+int main(int, char**)
+{
+    test_count<0>();
+    test_count<1>();
+    test_count<31>();
+    test_count<32>();
+    test_count<33>();
+    test_count<63>();
+    test_count<64>();
+    test_count<65>();
+    test_count<1000>();
+
+    static_assert(test_count<0>(), "");
+    static_assert(test_count<65>(), "");
+    static_assert(test_count<200>(), "");
+
+    return 0;
+}
@@ -0,0 +1,81 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11
+
+// constexpr bitset& set(size_t pos, bool val = true);
+// constexpr bitset& reset(size_t pos);
+// constexpr bitset& flip(size_t pos);
+// constexpr bool test(size_t pos) const;
+// constexpr reference operator[](size_t pos);
+
+#include <cuda/std/bitset>
+#include <cuda/std/cassert>
+
+#include "test_macros.h"
+
+template <cuda::std::size_t N>
+__host__ __device__ constexpr bool test_members()
+{
+    cuda::std::bitset<N> v;
+    for (cuda::std::size_t i = 0; i < N; ++i)
+    {
+        v.set(i, (i % 5) == 0);
+    }
+    for (cuda::std::size_t i = 0; i < N; ++i)
+    {
+        assert(v.test(i) == ((i % 5) == 0));
+    }
+
+    for (cuda::std::size_t i = 0; i < N; i += 2)
+    {
+        v.flip(i);
+    }
+    for (cuda::std::size_t i = 0; i < N; ++i)
+    {
+        assert(v[i] == (((i % 5) == 0) != ((i % 2) == 0)));
+    }
+
+    for (cuda::std::size_t i = 0; i < N; ++i)
+    {
+        v.reset(i);
+    }
+    assert(v.none());
+
+    if (N > 1)
+    {
+        v[0] = true;
+        v[N - 1] = v[0];
+        assert(v[N - 1]);
+        assert(!~v[N - 1]);
+        v[N - 1].flip();
+        assert(!v[N - 1]);
+    }
+
+    return true;
+}
+
+int main(int, char**)
+{
+    test_members<0>();
+    test_members<1>();
+    test_members<31>();
+    test_members<32>();
+    test_members<33>();
+    test_members<63>();
+    test_members<64>();
+    test_members<65>();
+    test_members<1000>();
+
+    static_assert(test_members<1>(), "");
+    static_assert(test_members<65>(), "");
+    static_assert(test_members<130>(), "");
+
+    return 0;
+}
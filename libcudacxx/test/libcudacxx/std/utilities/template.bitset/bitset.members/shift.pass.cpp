@@ -0,0 +1,75 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11
+
+// constexpr bitset& operator<<=(size_t pos) noexcept;
+// constexpr bitset& operator>>=(size_t pos) noexcept;
+// constexpr bitset operator<<(size_t pos) const noexcept;
+// constexpr bitset operator>>(size_t pos) const noexcept;
+
+#include <cuda/std/bitset>
+#include <cuda/std/cassert>
+
+#include "test_macros.h"
+
+template <cuda::std::size_t N>
+__host__ __device__ constexpr cuda::std::bitset<N> make_pattern()
+{
+    cuda::std::bitset<N> v;
+    for (cuda::std::size_t i = 0; i < N; ++i)
+    {
+        v[i] = ((i * 7) % 3) == 1;
+    }
+    return v;
+}
+
+template <cuda::std::size_t N>
+__host__ __device__ constexpr bool test_shifts()
+{
+    const cuda::std::bitset<N> v = make_pattern<N>();
+    const cuda::std::size_t shifts[] = {0, 1, 7, 31, 32, 33, 63, 64, 65, 127, 128, 200};
+    for (cuda::std::size_t s : shifts)
+    {
+        cuda::std::bitset<N> l = v << s;
+        cuda::std::bitset<N> r = v >> s;
+        for (cuda::std::size_t i = 0; i < N; ++i)
+        {
+            assert(l[i] == (i >= s && v[i - s]));
+            assert(r[i] == (i + s < N && v[i + s]));
+        }
+
+        cuda::std::bitset<N> l2 = v;
+        l2 <<= s;
+        assert(l2 == l);
+        cuda::std::bitset<N> r2 = v;
+        r2 >>= s;
+        assert(r2 == r);
+    }
+    return true;
+}
+
+int main(int, char**)
+{
+    test_shifts<0>();
+    test_shifts<1>();
+    test_shifts<31>();
+    test_shifts<32>();
+    test_shifts<33>();
+    test_shifts<63>();
+    test_shifts<64>();
+    test_shifts<65>();
+    test_shifts<150>();
+    test_shifts<1000>();
+
+    static_assert(test_shifts<33>(), "");
+    static_assert(test_shifts<150>(), "");
+
+    return 0;
+}
@@ -0,0 +1,57 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11
+
+// constexpr unsigned long to_ulong() const;
+// constexpr unsigned long long to_ullong() const;
+
+#include <cuda/std/bitset>
+#include <cuda/std/cassert>
+#include <cuda/std/climits>
+
+#include "test_macros.h"
+
+template <cuda::std::size_t N>
+__host__ __device__ constexpr bool test_to_ullong()
+{
+    const cuda::std::size_t M = sizeof(unsigned long long) * CHAR_BIT < N ? sizeof(unsigned long long) * CHAR_BIT : N;
+    const unsigned long long max = M == 0 ? 0 : (~0ULL) >> (sizeof(unsigned long long) * CHAR_BIT - M);
+    const unsigned long long tests[] = {0, 1, 0x5555555555555555ULL, 0xAAAAAAAAAAAAAAAAULL, ~0ULL};
+    for (unsigned long long t : tests)
+    {
+        const unsigned long long j = t & max;
+        cuda::std::bitset<N> v(j);
+        assert(j == v.to_ullong());
+        if (j <= ~0UL)
+        {
+            assert(static_cast<unsigned long>(j) == v.to_ulong());
+        }
+    }
+    return true;
+}
+
+int main(int, char**)
+{
+    test_to_ullong<0>();
+    test_to_ullong<1>();
+    test_to_ullong<31>();
+    test_to_ullong<32>();
+    test_to_ullong<33>();
+    test_to_ullong<63>();
+    test_to_ullong<64>();
+    test_to_ullong<65>();
+    test_to_ullong<1000>();
+
+    static_assert(test_to_ullong<33>(), "");
+    static_assert(test_to_ullong<64>(), "");
+    static_assert(test_to_ullong<100>(), "");
+
+    return 0;
+}
@@ -0,0 +1,75 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11
+
+// template <size_t N> constexpr bitset<N> operator&(const bitset<N>&, const bitset<N>&) noexcept;
+// template <size_t N> constexpr bitset<N> operator|(const bitset<N>&, const bitset<N>&) noexcept;
+// template <size_t N> constexpr bitset<N> operator^(const bitset<N>&, const bitset<N>&) noexcept;
+// constexpr bitset operator~() const noexcept;
+
+#include <cuda/std/bitset>
+#include <cuda/std/cassert>
+
+#include "test_macros.h"
+
+template <cuda::std::size_t N>
+__host__ __device__ constexpr bool test_operators()
+{
+    cuda::std::bitset<N> a;
+    cuda::std::bitset<N> b;
+    for (cuda::std::size_t i = 0; i < N; ++i)
+    {
+        a[i] = (i % 3) == 0;
+        b[i] = (i % 5) == 0;
+    }
+
+    const cuda::std::bitset<N> and_ = a & b;
+    const cuda::std::bitset<N> or_  = a | b;
+    const cuda::std::bitset<N> xor_ = a ^ b;
+    const cuda::std::bitset<N> not_ = ~a;
+    for (cuda::std::size_t i = 0; i < N; ++i)
+    {
+        assert(and_[i] == (a[i] && b[i]));
+        assert(or_[i] == (a[i] || b[i]));
+        assert(xor_[i] == (a[i] != b[i]));
+        assert(not_[i] == !a[i]);
+    }
+    assert(not_.count() == N - a.count());
+
+    cuda::std::bitset<N> c = a;
+    c &= b;
+    assert(c == and_);
+    c = a;
+    c |= b;
+    assert(c == or_);
+    c = a;
+    c ^= b;
+    assert(c == xor_);
+
+    return true;
+}
+
+int main(int, char**)
+{
+    test_operators<0>();
+    test_operators<1>();
+    test_operators<31>();
+    test_operators<32>();
+    test_operators<33>();
+    test_operators<63>();
+    test_operators<64>();
+    test_operators<65>();
+    test_operators<1000>();
+
+    static_assert(test_operators<65>(), "");
+    static_assert(test_operators<200>(), "");
+
+    return 0;
+}
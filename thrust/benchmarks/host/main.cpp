@@ -0,0 +1,1491 @@
+/******************************************************************************
+ * Copyright (c) 2011-2023, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the NVIDIA CORPORATION nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NVIDIA CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+
+// The runner of the host benchmarks: parses the NVBench command line,
+// enumerates the states of every benchmark, measures them and reports the
+// results as markdown on stdout and as NVBench JSON.
+
+#include <thrust/copy.h>
+#include <thrust/execution_policy.h>
+#include <thrust/fill.h>
+
+#include <nvbench/nvbench.cuh>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+#if defined(__unix__) || defined(__APPLE__)
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+#  include <omp.h>
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+#  include <tbb/global_control.h>
+#  include <tbb/task_arena.h>
+#endif
+
+namespace nvbench
+{
+
+state::state(const benchmark_base &bench, std::vector<std::size_t> value_indices)
+    : m_benchmark(bench)
+    , m_value_indices(std::move(value_indices))
+{}
+
+const axis_value &state::find_value(const std::string &axis_name, axis_type type) const
+{
+  const std::vector<axis> &axes = m_benchmark.get_axes();
+  for (std::size_t i = 0; i != axes.size(); ++i)
+  {
+    if (axes[i].name == axis_name)
+    {
+      if (axes[i].type != type)
+      {
+        throw std::runtime_error("Axis '" + axis_name + "' of benchmark '" +
+                                 m_benchmark.get_name() + "' has a different type");
+      }
+      return axes[i].values[m_value_indices[i]];
+    }
+  }
+  throw std::runtime_error("Benchmark '" + m_benchmark.get_name() + "' has no axis '" +
+                           axis_name + "'");
+}
+
+int64_t state::get_int64(const std::string &axis_name) const
+{
+  return find_value(axis_name, axis_type::int64).int64_value;
+}
+
+float64_t state::get_float64(const std::string &axis_name) const
+{
+  return find_value(axis_name, axis_type::float64).float64_value;
+}
+
+const std::string &state::get_string(const std::string &axis_name) const
+{
+  return find_value(axis_name, axis_type::string).string_value;
+}
+
+benchmark_base &benchmark_base::set_type_axes_names(std::vector<std::string> names)
+{
+  if (names.size() != m_num_type_axes)
+  {
+    throw std::runtime_error("Benchmark '" + m_name + "' has " + std::to_string(m_num_type_axes) +
+                             " type axes, but " + std::to_string(names.size()) + " names");
+  }
+  for (std::size_t i = 0; i != names.size(); ++i)
+  {
+    m_axes[i].name = std::move(names[i]);
+  }
+  return *this;
+}
+
+namespace
+{
+
+axis_value make_int64_value(int64_t value)
+{
+  axis_value result;
+  result.input_string = std::to_string(value);
+  result.int64_value  = value;
+  return result;
+}
+
+axis_value make_power_of_two_value(int64_t exponent)
+{
+  axis_value result;
+  result.int64_value  = int64_t{1} << exponent;
+  result.input_string = std::to_string(exponent);
+  result.description  = "2^" + result.input_string + " = " + std::to_string(result.int64_value);
+  return result;
+}
+
+axis_value make_float64_value(float64_t value, std::string input_string)
+{
+  axis_value result;
+  result.input_string  = std::move(input_string);
+  result.float64_value = value;
+  return result;
+}
+
+axis_value make_string_value(std::string value)
+{
+  axis_value result;
+  result.input_string = value;
+  result.string_value = std::move(value);
+  return result;
+}
+
+std::string format_float64(float64_t value)
+{
+  std::ostringstream out;
+  out << value;
+  return out.str();
+}
+
+} // namespace
+
+benchmark_base &benchmark_base::add_int64_axis(std::string name, std::vector<int64_t> values)
+{
+  axis a;
+  a.name = std::move(name);
+  a.type = axis_type::int64;
+  for (int64_t value : values)
+  {
+    a.values.push_back(make_int64_value(value));
+  }
+  m_axes.push_back(std::move(a));
+  return *this;
+}
+
+benchmark_base &benchmark_base::add_int64_power_of_two_axis(std::string name,
+                                                            std::vector<int64_t> exponents)
+{
+  axis a;
+  a.name  = std::move(name);
+  a.type  = axis_type::int64;
+  a.flags = "pow2";
+  for (int64_t exponent : exponents)
+  {
+    a.values.push_back(make_power_of_two_value(exponent));
+  }
+  m_axes.push_back(std::move(a));
+  return *this;
+}
+
+benchmark_base &benchmark_base::add_float64_axis(std::string name, std::vector<float64_t> values)
+{
+  axis a;
+  a.name = std::move(name);
+  a.type = axis_type::float64;
+  for (float64_t value : values)
+  {
+    a.values.push_back(make_float64_value(value, format_float64(value)));
+  }
+  m_axes.push_back(std::move(a));
+  return *this;
+}
+
+benchmark_base &benchmark_base::add_string_axis(std::string name, std::vector<std::string> values)
+{
+  axis a;
+  a.name = std::move(name);
+  a.type = axis_type::string;
+  for (std::string &value : values)
+  {
+    a.values.push_back(make_string_value(std::move(value)));
+  }
+  m_axes.push_back(std::move(a));
+  return *this;
+}
+
+namespace
+{
+
+//------------------------------------------------------------------------------
+// The device system
+
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+constexpr bool has_threads_axis = true;
+const char *device_system_name  = "OMP";
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+constexpr bool has_threads_axis = true;
+const char *device_system_name  = "TBB";
+#else
+constexpr bool has_threads_axis = false;
+const char *device_system_name  = "CPP";
+#endif
+
+const char *threads_axis_name = "Threads";
+
+int64_t max_threads()
+{
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+  return omp_get_max_threads();
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+  return tbb::this_task_arena::max_concurrency();
+#else
+  return 1;
+#endif
+}
+
+// Limits the device system to the given number of threads while it exists.
+class thread_limit
+{
+public:
+  explicit thread_limit(int64_t threads)
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+      : m_previous(omp_get_max_threads())
+  {
+    omp_set_num_threads(static_cast<int>(threads));
+  }
+
+  ~thread_limit()
+  {
+    omp_set_num_threads(m_previous);
+  }
+
+private:
+  int m_previous;
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+      : m_control(tbb::global_control::max_allowed_parallelism, static_cast<std::size_t>(threads))
+  {}
+
+private:
+  tbb::global_control m_control;
+#else
+  {
+    (void)threads;
+  }
+#endif
+};
+
+std::string cpu_name()
+{
+  std::ifstream cpuinfo("/proc/cpuinfo");
+  std::string line;
+  while (std::getline(cpuinfo, line))
+  {
+    if (line.compare(0, 10, "model name") == 0)
+    {
+      const std::size_t colon = line.find(':');
+      if (colon != std::string::npos && colon + 2 <= line.size())
+      {
+        return line.substr(colon + 2);
+      }
+    }
+  }
+  return "Host CPU";
+}
+
+std::size_t last_level_cache_size()
+{
+#if defined(_SC_LEVEL3_CACHE_SIZE)
+  const long l3 = sysconf(_SC_LEVEL3_CACHE_SIZE);
+  if (l3 > 0)
+  {
+    return static_cast<std::size_t>(l3);
+  }
+#endif
+#if defined(_SC_LEVEL2_CACHE_SIZE)
+  const long l2 = sysconf(_SC_LEVEL2_CACHE_SIZE);
+  if (l2 > 0)
+  {
+    return static_cast<std::size_t>(l2);
+  }
+#endif
+  return std::size_t{32} << 20;
+}
+
+//------------------------------------------------------------------------------
+// Measurement
+
+struct stopping_criterion
+{
+  int64_t min_samples{10};
+  double min_time{0.5};  // seconds of measured time
+  double max_noise{0.5}; // relative standard deviation, in percent
+  double timeout{15.0};  // seconds of wall time
+};
+
+stopping_criterion criterion;
+
+// Evicts the data of the previous sample from the caches, like NVBench does
+// with the L2 cache of a GPU before every cold sample.
+class cache_flusher
+{
+public:
+  cache_flusher()
+      : m_buffer((std::min)(2 * last_level_cache_size(), std::size_t{256} << 20))
+  {}
+
+  void flush()
+  {
+    thrust::fill(thrust::device, m_buffer.data(), m_buffer.data() + m_buffer.size(), ++m_value);
+  }
+
+private:
+  std::vector<char> m_buffer;
+  char m_value{};
+};
+
+// The bandwidth of a copy between buffers larger than the caches, for every
+// number of threads; bandwidth utilization is reported relative to it.
+class peak_bandwidth
+{
+public:
+  double get(int64_t threads)
+  {
+    auto it = m_peaks.find(threads);
+    if (it == m_peaks.end())
+    {
+      it = m_peaks.emplace(threads, measure()).first;
+    }
+    return it->second;
+  }
+
+private:
+  static double measure()
+  {
+    const std::size_t bytes =
+      (std::min)((std::max)(std::size_t{64} << 20, 4 * last_level_cache_size()), std::size_t{512} << 20);
+    std::vector<char> src(bytes, 1);
+    std::vector<char> dst(bytes);
+
+    double best = 0.0;
+    for (int i = 0; i != 11; ++i)
+    {
+      nvbench::timer t;
+      t.start();
+      thrust::copy(thrust::device, src.data(), src.data() + bytes, dst.data());
+      t.stop();
+
+      // the first copy only faults the pages of dst in
+      if (i != 0)
+      {
+        best = (std::max)(best, 2.0 * static_cast<double>(bytes) / t.get_duration());
+      }
+    }
+    return best;
+  }
+
+  std::map<int64_t, double> m_peaks;
+};
+
+struct sample_stats
+{
+  double total{};
+  double mean{};
+  double noise{}; // relative standard deviation, in percent
+};
+
+sample_stats compute_stats(const std::vector<double> &samples)
+{
+  sample_stats stats;
+  if (samples.empty())
+  {
+    return stats;
+  }
+
+  for (double s : samples)
+  {
+    stats.total += s;
+  }
+  stats.mean = stats.total / static_cast<double>(samples.size());
+
+  if (samples.size() > 1 && stats.mean > 0.0)
+  {
+    double sum_of_squares = 0.0;
+    for (double s : samples)
+    {
+      sum_of_squares += (s - stats.mean) * (s - stats.mean);
+    }
+    const double stdev = std::sqrt(sum_of_squares / static_cast<double>(samples.size() - 1));
+    stats.noise        = 100.0 * stdev / stats.mean;
+  }
+  return stats;
+}
+
+cache_flusher *flusher = nullptr;
+
+} // namespace
+
+namespace detail
+{
+
+void measure(state &s, const std::function<double()> &sample)
+{
+  using clock = std::chrono::steady_clock;
+
+  std::vector<double> &samples = s.get_samples();
+  samples.clear();
+
+  // warm up instruction caches, allocators and the pages of the buffers
+  sample();
+
+  const clock::time_point start = clock::now();
+  for (;;)
+  {
+    flusher->flush();
+    samples.push_back(sample());
+
+    const int64_t num_samples = static_cast<int64_t>(samples.size());
+    const double wall_time    = std::chrono::duration<double>(clock::now() - start).count();
+
+    if (wall_time > criterion.timeout)
+    {
+      break;
+    }
+
+    if (num_samples >= criterion.min_samples)
+    {
+      const sample_stats stats = compute_stats(samples);
+      if (stats.total >= criterion.min_time && stats.noise <= criterion.max_noise)
+      {
+        break;
+      }
+    }
+  }
+}
+
+} // namespace detail
+
+namespace
+{
+
+//------------------------------------------------------------------------------
+// JSON
+
+class json
+{
+public:
+  static json object() { return json(kind::object); }
+  static json array() { return json(kind::array); }
+
+  // a number, given as its representation
+  static json number(std::string representation)
+  {
+    json result(kind::number);
+    result.m_text = std::move(representation);
+    return result;
+  }
+
+  json(const char *text)
+      : json(std::string(text))
+  {}
+
+  json(std::string text)
+      : m_kind(kind::string)
+      , m_text(std::move(text))
+  {}
+
+  json(int64_t value)
+      : m_kind(kind::number)
+      , m_text(std::to_string(value))
+  {}
+
+  json(bool value)
+      : m_kind(kind::boolean)
+      , m_text(value ? "true" : "false")
+  {}
+
+  json &set(std::string key, json value)
+  {
+    m_members.emplace_back(std::move(key), std::move(value));
+    return *this;
+  }
+
+  json &push_back(json value)
+  {
+    m_members.emplace_back(std::string(), std::move(value));
+    return *this;
+  }
+
+  void write(std::ostream &out, int indent = 0) const
+  {
+    switch (m_kind)
+    {
+      case kind::string:
+        write_string(out, m_text);
+        return;
+      case kind::number:
+      case kind::boolean:
+        out << m_text;
+        return;
+      default:
+        break;
+    }
+
+    const bool is_object = m_kind == kind::object;
+    out << (is_object ? '{' : '[');
+    for (std::size_t i = 0; i != m_members.size(); ++i)
+    {
+      out << (i == 0 ? "\n" : ",\n") << std::string(indent + 2, ' ');
+      if (is_object)
+      {
+        write_string(out, m_members[i].first);
+        out << ": ";
+      }
+      m_members[i].second.write(out, indent + 2);
+    }
+    if (!m_members.empty())
+    {
+      out << '\n' << std::string(indent, ' ');
+    }
+    out << (is_object ? '}' : ']');
+  }
+
+private:
+  enum class kind
+  {
+    object,
+    array,
+    string,
+    number,
+    boolean
+  };
+
+  explicit json(kind k)
+      : m_kind(k)
+  {}
+
+  static void write_string(std::ostream &out, const std::string &text)
+  {
+    out << '"';
+    for (char c : text)
+    {
+      switch (c)
+      {
+        case '"':
+          out << "\\\"";
+          break;
+        case '\\':
+          out << "\\\\";
+          break;
+        case '\n':
+          out << "\\n";
+          break;
+        case '\t':
+          out << "\\t";
+          break;
+        default:
+          if (static_cast<unsigned char>(c) < 0x20)
+          {
+            char buffer[8];
+            std::snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+            out << buffer;
+          }
+          else
+          {
+            out << c;
+          }
+      }
+    }
+    out << '"';
+  }
+
+  kind m_kind;
+  std::string m_text;
+  std::vector<std::pair<std::string, json>> m_members;
+};
+
+const char *axis_type_name(axis_type type)
+{
+  switch (type)
+  {
+    case axis_type::type:
+      return "type";
+    case axis_type::int64:
+      return "int64";
+    case axis_type::float64:
+      return "float64";
+    default:
+      return "string";
+  }
+}
+
+// the value of v in the "axis_values" of a state
+std::string state_value_string(const axis &a, const axis_value &v)
+{
+  switch (a.type)
+  {
+    case axis_type::int64:
+      return std::to_string(v.int64_value);
+    case axis_type::string:
+      return v.string_value;
+    default:
+      return v.input_string;
+  }
+}
+
+json axis_to_json(const axis &a)
+{
+  json values = json::array();
+  for (const axis_value &v : a.values)
+  {
+    json value = json::object();
+    value.set("input_string", v.input_string).set("description", v.description);
+    switch (a.type)
+    {
+      case axis_type::int64:
+        value.set("value", v.int64_value);
+        break;
+      case axis_type::float64:
+        value.set("value", json::number(v.input_string));
+        break;
+      case axis_type::string:
+        value.set("value", v.string_value);
+        break;
+      default:
+        break;
+    }
+    values.push_back(std::move(value));
+  }
+
+  json result = json::object();
+  result.set("name", a.name)
+    .set("type", axis_type_name(a.type))
+    .set("flags", a.flags)
+    .set("values", std::move(values));
+  return result;
+}
+
+json device_json()
+{
+  // The fields which benchmarks/scripts expect from a GPU describe the host:
+  // every hardware thread counts as a multiprocessor.
+  json device = json::object();
+  device.set("id", int64_t{0})
+    .set("name", cpu_name())
+    .set("device_system", device_system_name)
+    .set("number_of_sms", static_cast<int64_t>(std::thread::hardware_concurrency()))
+    .set("max_threads", max_threads())
+    .set("global_memory_bus_width", int64_t{0})
+    .set("l2_cache_size", static_cast<int64_t>(last_level_cache_size()))
+    .set("ecc_state", false);
+  return device;
+}
+
+json summary(const std::string &tag, const std::string &name, json data)
+{
+  json result = json::object();
+  result.set("tag", tag).set("name", name).set("data", std::move(data));
+  return result;
+}
+
+json float64_summary(const std::string &tag, const std::string &name, double value)
+{
+  std::ostringstream out;
+  out.precision(17);
+  out << value;
+
+  json data = json::array();
+  data.push_back(json::object().set("name", "value").set("type", "float64").set("value", out.str()));
+  return summary(tag, name, std::move(data));
+}
+
+json int64_summary(const std::string &tag, const std::string &name, int64_t value)
+{
+  json data = json::array();
+  data.push_back(
+    json::object().set("name", "value").set("type", "int64").set("value", std::to_string(value)));
+  return summary(tag, name, std::move(data));
+}
+
+//------------------------------------------------------------------------------
+// Command line
+
+// one -a option
+struct axis_option
+{
+  std::string name;
+  std::string flags;
+  std::vector<std::string> values;
+};
+
+struct benchmark_options
+{
+  std::vector<axis_option> axes;
+};
+
+struct options
+{
+  bool list{};
+  bool jsonlist_benches{};
+  bool jsonlist_devices{};
+  std::string json_path;
+  bool write_samples{};
+
+  benchmark_options all;
+  bool any_selected{};
+  std::map<std::size_t, benchmark_options> selected;
+};
+
+std::vector<std::string> split(const std::string &text, char separator)
+{
+  std::vector<std::string> result;
+  std::string::size_type begin = 0;
+  for (;;)
+  {
+    const std::string::size_type end = text.find(separator, begin);
+    result.push_back(text.substr(begin, end - begin));
+    if (end == std::string::npos)
+    {
+      return result;
+    }
+    begin = end + 1;
+  }
+}
+
+int64_t parse_int64(const std::string &text)
+{
+  std::size_t parsed = 0;
+  const long long value = std::stoll(text, &parsed);
+  if (parsed != text.size())
+  {
+    throw std::runtime_error("Expected an integer, found '" + text + "'");
+  }
+  return value;
+}
+
+// Name[flags]=value, Name[flags]=[v0,v1,...] or Name[flags]=[first:last:stride]
+axis_option parse_axis_option(const std::string &spec)
+{
+  const std::string::size_type eq = spec.find('=');
+  if (eq == std::string::npos)
+  {
+    throw std::runtime_error("Expected Name=Values in axis option '" + spec + "'");
+  }
+
+  axis_option result;
+  result.name = spec.substr(0, eq);
+
+  const std::string::size_type bracket = result.name.find('[');
+  if (bracket != std::string::npos && result.name.back() == ']')
+  {
+    result.flags = result.name.substr(bracket + 1, result.name.size() - bracket - 2);
+    result.name.resize(bracket);
+  }
+
+  std::string values = spec.substr(eq + 1);
+  if (values.size() >= 2 && values.front() == '[' && values.back() == ']')
+  {
+    values = values.substr(1, values.size() - 2);
+  }
+
+  if (values.find(':') != std::string::npos)
+  {
+    const std::vector<std::string> bounds = split(values, ':');
+    if (bounds.size() < 2 || bounds.size() > 3)
+    {
+      throw std::runtime_error("Expected [first:last:stride] in axis option '" + spec + "'");
+    }
+    const int64_t stride = bounds.size() == 3 ? parse_int64(bounds[2]) : 1;
+    if (stride <= 0)
+    {
+      throw std::runtime_error("The stride must be positive in axis option '" + spec + "'");
+    }
+    for (int64_t v : range(parse_int64(bounds[0]), parse_int64(bounds[1]), stride))
+    {
+      result.values.push_back(std::to_string(v));
+    }
+  }
+  else
+  {
+    result.values = split(values, ',');
+  }
+
+  return result;
+}
+
+std::size_t find_benchmark(const std::string &name_or_index)
+{
+  const auto &benchmarks = benchmark_manager::get().get_benchmarks();
+  for (std::size_t i = 0; i != benchmarks.size(); ++i)
+  {
+    if (benchmarks[i]->get_name() == name_or_index)
+    {
+      return i;
+    }
+  }
+
+  if (!name_or_index.empty() &&
+      name_or_index.find_first_not_of("0123456789") == std::string::npos)
+  {
+    const std::size_t index = std::stoul(name_or_index);
+    if (index < benchmarks.size())
+    {
+      return index;
+    }
+  }
+
+  throw std::runtime_error("No benchmark '" + name_or_index + "'");
+}
+
+void print_help(const char *program)
+{
+  std::cout << "Usage: " << program << " [options]\n"
+            << "\n"
+            << "  -l, --list              list the benchmarks and their axes\n"
+            << "  -b, --benchmark <b>     run benchmark b, a name or an index; the -a options\n"
+            << "                          which follow apply to it\n"
+            << "  -a, --axis <spec>       override the values of an axis:\n"
+            << "                          Name[flags]=value, Name[flags]=[v0,v1,...] or\n"
+            << "                          Name[flags]=[first:last:stride]\n"
+            << "  --json <file>           write the results as JSON\n"
+            << "  --jsonbin <file>        like --json, and write the samples to <file>-bin/\n"
+            << "  --jsonlist-benches      print the benchmarks as JSON\n"
+            << "  --jsonlist-devices      print the devices as JSON\n"
+            << "  --min-samples <n>       take at least n samples (" << criterion.min_samples << ")\n"
+            << "  --min-time <s>          measure for at least s seconds (" << criterion.min_time << ")\n"
+            << "  --max-noise <p>         stop once the relative stdev is below p percent ("
+            << criterion.max_noise << ")\n"
+            << "  --timeout <s>           stop measuring a state after s seconds (" << criterion.timeout
+            << ")\n"
+            << "  -d, --devices <d>       accepted for compatibility; there is one host device\n";
+  if (has_threads_axis)
+  {
+    std::cout << "\nThe " << threads_axis_name << " axis sets the number of threads of the "
+              << device_system_name << " device system.\n";
+  }
+}
+
+options parse_options(int argc, char **argv)
+{
+  options result;
+  benchmark_options *current = &result.all;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    const std::string arg = argv[i];
+
+    auto next = [&]() -> std::string {
+      if (i + 1 >= argc)
+      {
+        throw std::runtime_error("Option '" + arg + "' requires an argument");
+      }
+      return argv[++i];
+    };
+
+    if (arg == "-h" || arg == "--help")
+    {
+      print_help(argv[0]);
+      std::exit(0);
+    }
+    else if (arg == "-l" || arg == "--list")
+    {
+      result.list = true;
+    }
+    else if (arg == "--jsonlist-benches")
+    {
+      result.jsonlist_benches = true;
+    }
+    else if (arg == "--jsonlist-devices")
+    {
+      result.jsonlist_devices = true;
+    }
+    else if (arg == "-b" || arg == "--benchmark")
+    {
+      result.any_selected = true;
+      current             = &result.selected[find_benchmark(next())];
+    }
+    else if (arg == "-a" || arg == "--axis")
+    {
+      current->axes.push_back(parse_axis_option(next()));
+    }
+    else if (arg == "--json")
+    {
+      result.json_path = next();
+    }
+    else if (arg == "--jsonbin")
+    {
+      result.json_path     = next();
+      result.write_samples = true;
+    }
+    else if (arg == "--min-samples")
+    {
+      criterion.min_samples = parse_int64(next());
+    }
+    else if (arg == "--min-time")
+    {
+      criterion.min_time = std::stod(next());
+    }
+    else if (arg == "--max-noise")
+    {
+      criterion.max_noise = std::stod(next());
+    }
+    else if (arg == "--timeout")
+    {
+      criterion.timeout = std::stod(next());
+    }
+    else if (arg == "-d" || arg == "--device" || arg == "--devices")
+    {
+      next();
+    }
+    else
+    {
+      throw std::runtime_error("Unknown option '" + arg + "'; see --help");
+    }
+  }
+
+  return result;
+}
+
+void apply_axis_option(axis &a, const axis_option &option)
+{
+  std::vector<axis_value> values;
+
+  if (a.type == axis_type::type)
+  {
+    for (const std::string &input : option.values)
+    {
+      auto it = std::find_if(a.values.begin(), a.values.end(), [&](const axis_value &v) {
+        return v.input_string == input;
+      });
+      if (it == a.values.end())
+      {
+        throw std::runtime_error("Axis '" + a.name + "' has no type '" + input + "'");
+      }
+      values.push_back(*it);
+    }
+  }
+  else if (a.type == axis_type::int64)
+  {
+    a.flags = option.flags;
+    for (const std::string &input : option.values)
+    {
+      const int64_t value = parse_int64(input);
+      values.push_back(a.flags == "pow2" ? make_power_of_two_value(value) : make_int64_value(value));
+    }
+  }
+  else if (a.type == axis_type::float64)
+  {
+    for (const std::string &input : option.values)
+    {
+      values.push_back(make_float64_value(std::stod(input), input));
+    }
+  }
+  else
+  {
+    for (const std::string &input : option.values)
+    {
+      values.push_back(make_string_value(input));
+    }
+  }
+
+  a.values = std::move(values);
+}
+
+void apply_benchmark_options(benchmark_base &bench, const benchmark_options &options)
+{
+  for (const axis_option &option : options.axes)
+  {
+    std::vector<axis> &axes = bench.get_axes();
+    auto it = std::find_if(axes.begin(), axes.end(), [&](const axis &a) {
+      return a.name == option.name;
+    });
+    if (it == axes.end())
+    {
+      throw std::runtime_error("Benchmark '" + bench.get_name() + "' has no axis '" + option.name +
+                               "'");
+    }
+    apply_axis_option(*it, option);
+  }
+}
+
+// 1, 2, 4, ... up to and including the maximal number of threads
+std::vector<int64_t> default_thread_counts()
+{
+  const int64_t n = max_threads();
+  std::vector<int64_t> result;
+  for (int64_t threads = 1; threads < n; threads *= 2)
+  {
+    result.push_back(threads);
+  }
+  result.push_back(n);
+  return result;
+}
+
+//------------------------------------------------------------------------------
+// Reporting
+
+std::string format_time(double seconds)
+{
+  char buffer[32];
+  if (seconds >= 1.0)
+  {
+    std::snprintf(buffer, sizeof(buffer), "%.3f s", seconds);
+  }
+  else if (seconds >= 1e-3)
+  {
+    std::snprintf(buffer, sizeof(buffer), "%.3f ms", seconds * 1e3);
+  }
+  else
+  {
+    std::snprintf(buffer, sizeof(buffer), "%.3f us", seconds * 1e6);
+  }
+  return buffer;
+}
+
+std::string format_rate(double value, const char *unit)
+{
+  const char *prefixes[] = {"", "K", "M", "G", "T"};
+  int prefix             = 0;
+  while (value >= 1000.0 && prefix < 4)
+  {
+    value /= 1000.0;
+    ++prefix;
+  }
+  char buffer[32];
+  std::snprintf(buffer, sizeof(buffer), "%.3f%s%s", value, prefixes[prefix], unit);
+  return buffer;
+}
+
+std::string format_percent(double value)
+{
+  char buffer[32];
+  std::snprintf(buffer, sizeof(buffer), "%.2f%%", value);
+  return buffer;
+}
+
+struct state_result
+{
+  std::vector<std::string> axis_values; // as the markdown shows them
+  json state_json;
+  std::vector<std::string> columns;
+};
+
+void make_directory(const std::string &path)
+{
+#if defined(__unix__) || defined(__APPLE__)
+  mkdir(path.c_str(), 0755);
+#else
+  (void)path;
+#endif
+}
+
+void write_samples(const std::string &path, const std::vector<double> &samples)
+{
+  std::ofstream out(path, std::ios::binary);
+  for (double sample : samples)
+  {
+    // little-endian float32, like NVBench
+    const float value = static_cast<float>(sample);
+    unsigned char bytes[4];
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    for (int b = 0; b != 4; ++b)
+    {
+      bytes[b] = static_cast<unsigned char>(bits >> (8 * b));
+    }
+    out.write(reinterpret_cast<const char *>(bytes), 4);
+  }
+  if (!out)
+  {
+    throw std::runtime_error("Unable to write samples to '" + path + "'");
+  }
+}
+
+class runner
+{
+public:
+  explicit runner(const options &opts)
+      : m_options(opts)
+  {}
+
+  json run(benchmark_base &bench, std::size_t bench_index)
+  {
+    const std::vector<axis> &axes = bench.get_axes();
+
+    std::cout << "\n## " << bench.get_name() << "\n\n";
+
+    std::vector<std::vector<std::string>> rows;
+
+    json states = json::array();
+    std::vector<std::size_t> indices(axes.size(), 0);
+    const bool empty = std::any_of(axes.begin(), axes.end(), [](const axis &a) {
+      return a.values.empty();
+    });
+
+    for (bool done = empty; !done;)
+    {
+      states.push_back(run_state(bench, indices, rows));
+
+      // the last axis varies fastest
+      done = true;
+      for (std::size_t i = axes.size(); i-- > 0;)
+      {
+        if (++indices[i] != axes[i].values.size())
+        {
+          done = false;
+          break;
+        }
+        indices[i] = 0;
+      }
+    }
+
+    print_table(axes, rows);
+
+    json result = json::object();
+    json axes_json = json::array();
+    for (const axis &a : axes)
+    {
+      axes_json.push_back(axis_to_json(a));
+    }
+
+    json devices = json::array();
+    devices.push_back(int64_t{0});
+
+    result.set("name", bench.get_name())
+      .set("index", static_cast<int64_t>(bench_index))
+      .set("min_samples", criterion.min_samples)
+      .set("devices", std::move(devices))
+      .set("axes", std::move(axes_json))
+      .set("states", std::move(states));
+    return result;
+  }
+
+private:
+  json run_state(benchmark_base &bench,
+                 const std::vector<std::size_t> &indices,
+                 std::vector<std::vector<std::string>> &rows)
+  {
+    const std::vector<axis> &axes = bench.get_axes();
+
+    std::string name = "Device=0";
+    json axis_values = json::array();
+    std::vector<std::string> row;
+    int64_t threads = 1;
+
+    for (std::size_t i = 0; i != axes.size(); ++i)
+    {
+      const axis &a        = axes[i];
+      const axis_value &v  = a.values[indices[i]];
+      const bool is_pow2   = a.flags == "pow2";
+      const std::string shown = is_pow2 ? "2^" + v.input_string : v.input_string;
+
+      name += " " + a.name + "=" + shown;
+      row.push_back(shown);
+      axis_values.push_back(json::object()
+                              .set("name", a.name)
+                              .set("type", axis_type_name(a.type))
+                              .set("value", state_value_string(a, v)));
+
+      if (has_threads_axis && a.name == threads_axis_name)
+      {
+        threads = v.int64_value;
+      }
+    }
+
+    state s(bench, indices);
+    {
+      thread_limit limit(threads);
+      bench.run(s);
+
+      if (!s.is_skipped() && s.get_samples().empty())
+      {
+        s.skip("The benchmark did not call state.exec");
+      }
+    }
+
+    json summaries = json::array();
+
+    if (s.is_skipped())
+    {
+      std::cout << "Skip: " << name << ": " << s.get_skip_reason() << std::endl;
+    }
+    else
+    {
+      const std::vector<double> &samples = s.get_samples();
+      const sample_stats stats           = compute_stats(samples);
+      const int64_t num_samples          = static_cast<int64_t>(samples.size());
+
+      summaries.push_back(int64_summary("nv/cold/sample_size", "Samples", num_samples));
+      summaries.push_back(float64_summary("nv/cold/time/cpu/mean", "CPU Time", stats.mean));
+      summaries.push_back(float64_summary("nv/cold/time/cpu/stdev/relative", "Noise", stats.noise / 100.0));
+
+      row.push_back(std::to_string(num_samples));
+      row.push_back(format_time(stats.mean));
+      row.push_back(format_percent(stats.noise));
+
+      if (s.get_element_count() > 0)
+      {
+        const double rate = static_cast<double>(s.get_element_count()) / stats.mean;
+        summaries.push_back(float64_summary("nv/cold/bw/item_rate", "Elem/s", rate));
+        row.push_back(format_rate(rate, ""));
+      }
+      else
+      {
+        row.push_back("");
+      }
+
+      if (s.get_global_memory_bytes() > 0)
+      {
+        const double bandwidth = static_cast<double>(s.get_global_memory_bytes()) / stats.mean;
+        double peak;
+        {
+          thread_limit limit(threads);
+          peak = m_peaks.get(threads);
+        }
+        const double utilization = bandwidth / peak;
+
+        summaries.push_back(
+          float64_summary("nv/cold/bw/global/bytes_per_second", "GlobalMem BW", bandwidth));
+        summaries.push_back(
+          float64_summary("nv/cold/bw/global/utilization", "BWUtil", utilization));
+        row.push_back(format_rate(bandwidth, "B/s"));
+        row.push_back(format_percent(100.0 * utilization));
+      }
+      else
+      {
+        row.push_back("");
+        row.push_back("");
+      }
+
+      if (m_options.write_samples)
+      {
+        const std::string directory = m_options.json_path + "-bin";
+        const std::string path      = directory + "/" + std::to_string(m_num_sample_files++) + ".bin";
+        make_directory(directory);
+        write_samples(path, samples);
+
+        json data = json::array();
+        data.push_back(json::object().set("name", "filename").set("type", "string").set("value", path));
+        data.push_back(json::object()
+                         .set("name", "size")
+                         .set("type", "int64")
+                         .set("value", std::to_string(num_samples)));
+        summaries.push_back(summary("nv/json/bin:nv/cold/sample_times", "Samples Times File", std::move(data)));
+      }
+
+      std::cout << "Pass: " << name << ": " << format_time(stats.mean) << ", " << num_samples
+                << " samples" << std::endl;
+    }
+
+    if (!s.is_skipped())
+    {
+      rows.push_back(std::move(row));
+    }
+
+    json result = json::object();
+    result.set("name", name)
+      .set("min_samples", criterion.min_samples)
+      .set("device", int64_t{0})
+      .set("type_config_index", static_cast<int64_t>(type_config_index(bench, indices)))
+      .set("axis_values", std::move(axis_values))
+      .set("summaries", std::move(summaries))
+      .set("is_skipped", s.is_skipped())
+      .set("skip_reason", s.get_skip_reason());
+    return result;
+  }
+
+  static std::size_t type_config_index(const benchmark_base &bench, const std::vector<std::size_t> &indices)
+  {
+    std::size_t result = 0;
+    for (std::size_t i = 0; i != bench.get_num_type_axes(); ++i)
+    {
+      result = result * bench.get_axes()[i].values.size() + indices[i];
+    }
+    return result;
+  }
+
+  static void print_table(const std::vector<axis> &axes, const std::vector<std::vector<std::string>> &rows)
+  {
+    std::vector<std::string> header;
+    for (const axis &a : axes)
+    {
+      header.push_back(a.name);
+    }
+    for (const char *column : {"Samples", "CPU Time", "Noise", "Elem/s", "GlobalMem BW", "BWUtil"})
+    {
+      header.push_back(column);
+    }
+
+    std::vector<std::size_t> widths(header.size());
+    for (std::size_t c = 0; c != header.size(); ++c)
+    {
+      widths[c] = header[c].size();
+      for (const auto &row : rows)
+      {
+        widths[c] = (std::max)(widths[c], row[c].size());
+      }
+    }
+
+    auto print_row = [&](const std::vector<std::string> &row) {
+      std::cout << '|';
+      for (std::size_t c = 0; c != row.size(); ++c)
+      {
+        std::cout << ' ' << std::string(widths[c] - row[c].size(), ' ') << row[c] << " |";
+      }
+      std::cout << '\n';
+    };
+
+    std::cout << '\n';
+    print_row(header);
+    std::cout << '|';
+    for (std::size_t w : widths)
+    {
+      std::cout << std::string(w + 1, '-') << ":|";
+    }
+    std::cout << '\n';
+    for (const auto &row : rows)
+    {
+      print_row(row);
+    }
+    std::cout << std::flush;
+  }
+
+  const options &m_options;
+  peak_bandwidth m_peaks;
+  std::size_t m_num_sample_files{};
+};
+
+int run(int argc, char **argv)
+{
+  const auto &benchmarks = benchmark_manager::get().get_benchmarks();
+
+  if (has_threads_axis)
+  {
+    for (const auto &bench : benchmarks)
+    {
+      bench->add_int64_axis(threads_axis_name, default_thread_counts());
+    }
+  }
+
+  const options opts = parse_options(argc, argv);
+
+  std::vector<std::size_t> selected;
+  for (std::size_t i = 0; i != benchmarks.size(); ++i)
+  {
+    if (!opts.any_selected || opts.selected.count(i))
+    {
+      apply_benchmark_options(*benchmarks[i], opts.all);
+      if (opts.any_selected)
+      {
+        apply_benchmark_options(*benchmarks[i], opts.selected.at(i));
+      }
+      selected.push_back(i);
+    }
+  }
+
+  if (opts.jsonlist_devices)
+  {
+    json devices = json::array();
+    devices.push_back(device_json());
+    json root = json::object();
+    root.set("devices", std::move(devices));
+    root.write(std::cout);
+    std::cout << std::endl;
+    return 0;
+  }
+
+  if (opts.jsonlist_benches || opts.list)
+  {
+    json list = json::array();
+    for (std::size_t i : selected)
+    {
+      json axes = json::array();
+      for (const axis &a : benchmarks[i]->get_axes())
+      {
+        axes.push_back(axis_to_json(a));
+
+        if (opts.list)
+        {
+          std::cout << i << ". " << benchmarks[i]->get_name() << ": " << a.name
+                    << (a.flags.empty() ? "" : "[" + a.flags + "]") << " =";
+          for (const axis_value &v : a.values)
+          {
+            std::cout << ' ' << v.input_string;
+          }
+          std::cout << '\n';
+        }
+      }
+      list.push_back(json::object()
+                       .set("name", benchmarks[i]->get_name())
+                       .set("index", static_cast<int64_t>(i))
+                       .set("axes", std::move(axes)));
+    }
+
+    if (opts.jsonlist_benches)
+    {
+      json root = json::object();
+      root.set("benchmarks", std::move(list));
+      root.write(std::cout);
+      std::cout << std::endl;
+    }
+    return 0;
+  }
+
+  cache_flusher cache;
+  flusher = &cache;
+
+  std::cout << "# Devices\n\n"
+            << "## [0] `" << cpu_name() << "` (" << device_system_name << ", " << max_threads()
+            << " threads)\n\n# Benchmark Results\n";
+
+  runner r(opts);
+  json results = json::array();
+  for (std::size_t i : selected)
+  {
+    results.push_back(r.run(*benchmarks[i], i));
+  }
+
+  flusher = nullptr;
+
+  if (!opts.json_path.empty())
+  {
+    json argv_json = json::array();
+    for (int i = 0; i < argc; ++i)
+    {
+      argv_json.push_back(argv[i]);
+    }
+
+    json devices = json::array();
+    devices.push_back(device_json());
+
+    json root = json::object();
+    root.set("meta", json::object().set("argv", std::move(argv_json)))
+      .set("devices", std::move(devices))
+      .set("benchmarks", std::move(results));
+
+    std::ofstream out(opts.json_path);
+    root.write(out);
+    out << '\n';
+    if (!out)
+    {
+      throw std::runtime_error("Unable to write '" + opts.json_path + "'");
+    }
+  }
+
+  return 0;
+}
+
+} // namespace
+} // namespace nvbench
+
+int main(int argc, char **argv)
+{
+  try
+  {
+    return nvbench::run(argc, argv);
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
+  }
+}
@@ -0,0 +1,521 @@
+/******************************************************************************
+ * Copyright (c) 2011-2023, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the NVIDIA CORPORATION nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NVIDIA CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+
+// A host implementation of the subset of the NVBench API used by the Thrust
+// benchmarks, so that the benchmarks in ../bench build unchanged for the CPP,
+// OMP and TBB device systems. Benchmarks, axes and states behave like their
+// NVBench counterparts; samples are measured with a steady host clock. The
+// command line and the JSON results follow NVBench, so the scripts in
+// benchmarks/scripts consume them like the results of a CUDA build.
+//
+// Benchmarks of parallel device systems get an additional `Threads` axis,
+// which sets the number of worker threads of the device system.
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+// The benchmarks annotate functors for CUDA builds; host compilers ignore them.
+#if !defined(__CUDACC__)
+#  ifndef __host__
+#    define __host__
+#  endif
+#  ifndef __device__
+#    define __device__
+#  endif
+#  ifndef __forceinline__
+#    define __forceinline__ inline
+#  endif
+#endif
+
+namespace nvbench
+{
+
+using std::int8_t;
+using std::int16_t;
+using std::int32_t;
+using std::int64_t;
+using std::uint8_t;
+using std::uint16_t;
+using std::uint32_t;
+using std::uint64_t;
+using float32_t = float;
+using float64_t = double;
+
+template <class... Ts>
+struct type_list
+{};
+
+namespace tl
+{
+namespace detail
+{
+
+template <std::size_t I, class List>
+struct get_impl;
+
+template <class T, class... Ts>
+struct get_impl<0, type_list<T, Ts...>>
+{
+  using type = T;
+};
+
+template <std::size_t I, class T, class... Ts>
+struct get_impl<I, type_list<T, Ts...>> : get_impl<I - 1, type_list<Ts...>>
+{};
+
+} // namespace detail
+
+template <std::size_t I, class List>
+using get = typename detail::get_impl<I, List>::type;
+
+} // namespace tl
+
+// [start, end] with the given stride
+inline std::vector<int64_t> range(int64_t start, int64_t end, int64_t stride = 1)
+{
+  std::vector<int64_t> result;
+  for (int64_t value = start; value <= end; value += stride)
+  {
+    result.push_back(value);
+  }
+  return result;
+}
+
+// The strings which name a type on the command line and in the results.
+template <class T>
+struct type_strings
+{
+  static std::string input_string() { return typeid(T).name(); }
+  static std::string description() { return typeid(T).name(); }
+};
+
+} // namespace nvbench
+
+#define NVBENCH_DECLARE_TYPE_STRINGS(Type, InputString, Description)                              \
+  namespace nvbench                                                                                \
+  {                                                                                                \
+  template <>                                                                                      \
+  struct type_strings<Type>                                                                        \
+  {                                                                                                \
+    static std::string input_string() { return InputString; }                                      \
+    static std::string description() { return Description; }                                       \
+  };                                                                                               \
+  }
+
+NVBENCH_DECLARE_TYPE_STRINGS(bool, "bool", "bool");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::int8_t, "I8", "int8_t");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::int16_t, "I16", "int16_t");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::int32_t, "I32", "int32_t");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::int64_t, "I64", "int64_t");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::uint8_t, "U8", "uint8_t");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::uint16_t, "U16", "uint16_t");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::uint32_t, "U32", "uint32_t");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::uint64_t, "U64", "uint64_t");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::float32_t, "F32", "float");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::float64_t, "F64", "double");
+
+namespace nvbench
+{
+
+enum class axis_type
+{
+  type,
+  int64,
+  float64,
+  string
+};
+
+struct axis_value
+{
+  std::string input_string;
+  std::string description;
+  int64_t int64_value{};
+  float64_t float64_value{};
+  std::string string_value;
+};
+
+struct axis
+{
+  std::string name;
+  axis_type type{axis_type::int64};
+  std::string flags; // "pow2" for power of two axes
+  std::vector<axis_value> values;
+};
+
+namespace exec_tag
+{
+namespace impl
+{
+
+enum : unsigned
+{
+  timer_flag    = 1u,
+  no_batch_flag = 2u,
+  sync_flag     = 4u
+};
+
+template <unsigned Flags>
+struct tag_type
+{
+  static constexpr unsigned flags = Flags;
+};
+
+template <unsigned A, unsigned B>
+constexpr tag_type<A | B> operator|(tag_type<A>, tag_type<B>)
+{
+  return {};
+}
+
+} // namespace impl
+
+// Host samples are never batched and always synchronous; the tags only
+// select whether the launcher measures the time itself.
+constexpr impl::tag_type<0u> none{};
+constexpr impl::tag_type<impl::timer_flag> timer{};
+constexpr impl::tag_type<impl::no_batch_flag> no_batch{};
+constexpr impl::tag_type<impl::sync_flag> sync{};
+
+} // namespace exec_tag
+
+// Host work runs on the calling thread, so there is no stream to hand out.
+class launch
+{};
+
+// Measures the region between start() and stop() for exec_tag::timer.
+class timer
+{
+public:
+  void start() { m_start = clock::now(); }
+  void stop() { m_stop = clock::now(); }
+
+  double get_duration() const { return std::chrono::duration<double>(m_stop - m_start).count(); }
+
+private:
+  using clock = std::chrono::steady_clock;
+
+  clock::time_point m_start{};
+  clock::time_point m_stop{};
+};
+
+class benchmark_base;
+class state;
+
+namespace detail
+{
+
+// Collects the samples of a state; defined with the runner.
+void measure(state &s, const std::function<double()> &sample);
+
+} // namespace detail
+
+class state
+{
+public:
+  state(const benchmark_base &bench, std::vector<std::size_t> value_indices);
+
+  const benchmark_base &get_benchmark() const { return m_benchmark; }
+
+  // the index of the selected value of every axis of the benchmark
+  const std::vector<std::size_t> &get_value_indices() const { return m_value_indices; }
+
+  int64_t get_int64(const std::string &axis_name) const;
+  float64_t get_float64(const std::string &axis_name) const;
+  const std::string &get_string(const std::string &axis_name) const;
+
+  void add_element_count(std::size_t elements, std::string = {}) { m_elements += elements; }
+
+  template <class T>
+  void add_global_memory_reads(std::size_t count, std::string = {})
+  {
+    m_bytes_read += count * sizeof(T);
+  }
+
+  template <class T>
+  void add_global_memory_writes(std::size_t count, std::string = {})
+  {
+    m_bytes_written += count * sizeof(T);
+  }
+
+  void skip(std::string reason)
+  {
+    m_is_skipped  = true;
+    m_skip_reason = std::move(reason);
+  }
+
+  bool is_skipped() const { return m_is_skipped; }
+  const std::string &get_skip_reason() const { return m_skip_reason; }
+
+  std::size_t get_element_count() const { return m_elements; }
+  std::size_t get_global_memory_bytes() const { return m_bytes_read + m_bytes_written; }
+
+  std::vector<double> &get_samples() { return m_samples; }
+  const std::vector<double> &get_samples() const { return m_samples; }
+
+  template <unsigned Flags, class KernelLauncher>
+  void exec(exec_tag::impl::tag_type<Flags>, KernelLauncher &&kernel_launcher)
+  {
+    using tag_type = exec_tag::impl::tag_type<Flags>;
+
+    if (m_is_skipped)
+    {
+      return;
+    }
+
+    nvbench::launch launch;
+    detail::measure(*this, [&]() -> double {
+      return sample(std::integral_constant<bool, (tag_type::flags & exec_tag::impl::timer_flag) != 0>{},
+                    kernel_launcher,
+                    launch);
+    });
+  }
+
+  template <class KernelLauncher>
+  void exec(KernelLauncher &&kernel_launcher)
+  {
+    exec(exec_tag::none, kernel_launcher);
+  }
+
+private:
+  template <class KernelLauncher>
+  static double sample(std::true_type /* timer */, KernelLauncher &kernel_launcher, nvbench::launch &launch)
+  {
+    nvbench::timer t;
+    kernel_launcher(launch, t);
+    return t.get_duration();
+  }
+
+  template <class KernelLauncher>
+  static double sample(std::false_type /* timer */, KernelLauncher &kernel_launcher, nvbench::launch &launch)
+  {
+    nvbench::timer t;
+    t.start();
+    kernel_launcher(launch);
+    t.stop();
+    return t.get_duration();
+  }
+
+  const axis_value &find_value(const std::string &axis_name, axis_type type) const;
+
+  const benchmark_base &m_benchmark;
+  std::vector<std::size_t> m_value_indices;
+
+  std::size_t m_elements{};
+  std::size_t m_bytes_read{};
+  std::size_t m_bytes_written{};
+
+  bool m_is_skipped{};
+  std::string m_skip_reason;
+
+  std::vector<double> m_samples;
+};
+
+class benchmark_base
+{
+public:
+  virtual ~benchmark_base() = default;
+
+  benchmark_base &set_name(std::string name)
+  {
+    m_name = std::move(name);
+    return *this;
+  }
+
+  const std::string &get_name() const { return m_name; }
+
+  benchmark_base &set_type_axes_names(std::vector<std::string> names);
+
+  benchmark_base &add_int64_axis(std::string name, std::vector<int64_t> values);
+  benchmark_base &add_int64_power_of_two_axis(std::string name, std::vector<int64_t> exponents);
+  benchmark_base &add_float64_axis(std::string name, std::vector<float64_t> values);
+  benchmark_base &add_string_axis(std::string name, std::vector<std::string> values);
+
+  // Type axes come first, in the order of the type lists.
+  const std::vector<axis> &get_axes() const { return m_axes; }
+  std::vector<axis> &get_axes() { return m_axes; }
+
+  std::size_t get_num_type_axes() const { return m_num_type_axes; }
+
+  // runs the benchmark for the types selected by the type axes of s
+  virtual void run(state &s) const = 0;
+
+protected:
+  explicit benchmark_base(std::string name)
+      : m_name(std::move(name))
+  {}
+
+  template <class... Ts>
+  void add_type_axis(type_list<Ts...>)
+  {
+    axis a;
+    a.name   = "T" + std::to_string(m_num_type_axes++);
+    a.type   = axis_type::type;
+    a.values = {axis_value{type_strings<Ts>::input_string(), type_strings<Ts>::description(), 0, 0.0, {}}...};
+    m_axes.push_back(std::move(a));
+  }
+
+private:
+  std::string m_name;
+  std::vector<axis> m_axes;
+  std::size_t m_num_type_axes{};
+};
+
+namespace detail
+{
+
+// Calls Callable with the types of the cartesian product of Lists which the
+// type indices select.
+template <class Callable, class Chosen, class... Lists>
+struct type_dispatch;
+
+template <class Callable, class... Chosen>
+struct type_dispatch<Callable, type_list<Chosen...>>
+{
+  static void run(state &s, const std::size_t *)
+  {
+    Callable{}(s, type_list<Chosen...>{});
+  }
+};
+
+template <class Callable, class... Chosen, class... Ts, class... Lists>
+struct type_dispatch<Callable, type_list<Chosen...>, type_list<Ts...>, Lists...>
+{
+  static void run(state &s, const std::size_t *type_indices)
+  {
+    using function_type = void (*)(state &, const std::size_t *);
+
+    constexpr function_type table[] = {
+      &type_dispatch<Callable, type_list<Chosen..., Ts>, Lists...>::run...};
+
+    table[*type_indices](s, type_indices + 1);
+  }
+};
+
+} // namespace detail
+
+template <class Callable, class TypeAxes>
+class benchmark;
+
+template <class Callable, class... TypeAxes>
+class benchmark<Callable, type_list<TypeAxes...>> : public benchmark_base
+{
+public:
+  explicit benchmark(std::string name)
+      : benchmark_base(std::move(name))
+  {
+    int expand[] = {0, (add_type_axis(TypeAxes{}), 0)...};
+    (void)expand;
+  }
+
+  void run(state &s) const override
+  {
+    detail::type_dispatch<Callable, type_list<>, TypeAxes...>::run(s, s.get_value_indices().data());
+  }
+};
+
+class benchmark_manager
+{
+public:
+  static benchmark_manager &get()
+  {
+    static benchmark_manager manager;
+    return manager;
+  }
+
+  benchmark_base &add(std::unique_ptr<benchmark_base> bench)
+  {
+    m_benchmarks.push_back(std::move(bench));
+    return *m_benchmarks.back();
+  }
+
+  const std::vector<std::unique_ptr<benchmark_base>> &get_benchmarks() const
+  {
+    return m_benchmarks;
+  }
+
+private:
+  benchmark_manager() = default;
+
+  std::vector<std::unique_ptr<benchmark_base>> m_benchmarks;
+};
+
+} // namespace nvbench
+
+#define NVBENCH_TYPE_AXES(...) nvbench::type_list<__VA_ARGS__>
+
+#define NVBENCH_DETAIL_CONCAT_IMPL(a, b) a##b
+#define NVBENCH_DETAIL_CONCAT(a, b) NVBENCH_DETAIL_CONCAT_IMPL(a, b)
+#define NVBENCH_UNIQUE_IDENTIFIER(prefix) NVBENCH_DETAIL_CONCAT(prefix##_line_, __LINE__)
+
+#define NVBENCH_DEFINE_CALLABLE_TEMPLATE(function, callable_name)                                  \
+  struct callable_name                                                                             \
+  {                                                                                                \
+    template <class... Ts>                                                                         \
+    void operator()(nvbench::state &s, nvbench::type_list<Ts...> tl) const                         \
+    {                                                                                              \
+      function(s, tl);                                                                             \
+    }                                                                                              \
+  }
+
+#define NVBENCH_DEFINE_CALLABLE(function, callable_name)                                           \
+  struct callable_name                                                                             \
+  {                                                                                                \
+    void operator()(nvbench::state &s, nvbench::type_list<>) const                                 \
+    {                                                                                              \
+      function(s);                                                                                 \
+    }                                                                                              \
+  }
+
+#define NVBENCH_BENCH_TYPES(KernelGenerator, TypeAxes)                                             \
+  NVBENCH_DEFINE_CALLABLE_TEMPLATE(KernelGenerator,                                                \
+                                   NVBENCH_UNIQUE_IDENTIFIER(nvbench_callable_##KernelGenerator)); \
+  static nvbench::benchmark_base &NVBENCH_UNIQUE_IDENTIFIER(nvbench_benchmark_##KernelGenerator) = \
+    nvbench::benchmark_manager::get().add(                                                         \
+      std::unique_ptr<nvbench::benchmark_base>(                                                    \
+        new nvbench::benchmark<NVBENCH_UNIQUE_IDENTIFIER(nvbench_callable_##KernelGenerator),      \
+                               TypeAxes>(#KernelGenerator)))
+
+#define NVBENCH_BENCH(KernelGenerator)                                                             \
+  NVBENCH_DEFINE_CALLABLE(KernelGenerator,                                                         \
+                          NVBENCH_UNIQUE_IDENTIFIER(nvbench_callable_##KernelGenerator));          \
+  static nvbench::benchmark_base &NVBENCH_UNIQUE_IDENTIFIER(nvbench_benchmark_##KernelGenerator) = \
+    nvbench::benchmark_manager::get().add(                                                         \
+      std::unique_ptr<nvbench::benchmark_base>(                                                    \
+        new nvbench::benchmark<NVBENCH_UNIQUE_IDENTIFIER(nvbench_callable_##KernelGenerator),      \
+                               nvbench::type_list<>>(#KernelGenerator)))
@@ -7,6 +7,7 @@
 #include <iterator>
 #include <thrust/detail/config.h>
 #include <thrust/sequence.h>
+#include <thrust/fill.h>
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/constant_iterator.h>
@@ -558,6 +559,33 @@ void TestCopyZipIterator(void)
 };
 DECLARE_VECTOR_UNITTEST(TestCopyZipIterator);
 
+template <typename Vector>
+void TestCopyLargeTriviallyRelocatable(void)
+{
+    typedef typename Vector::value_type T;
+
+    // large enough to be split into several chunks by the parallel host
+    // backends, and offset so that the chunks are not aligned with the data
+    const size_t n = (size_t(3) << 20) / sizeof(T) + 7;
+
+    Vector src(n + 1);
+    thrust::sequence(src.begin(), src.end());
+
+    Vector dst(n + 2, T(0));
+    typename Vector::iterator result = thrust::copy(src.begin() + 1, src.end(), dst.begin() + 1);
+    ASSERT_EQUAL_QUIET(dst.begin() + n + 1, result);
+
+    Vector reference(n + 2, T(0));
+    thrust::sequence(reference.begin() + 1, reference.end() - 1, T(1));
+    ASSERT_EQUAL(reference, dst);
+
+    thrust::fill(dst.begin(), dst.end(), T(0));
+    result = thrust::copy_n(src.begin() + 1, n, dst.begin() + 1);
+    ASSERT_EQUAL_QUIET(dst.begin() + n + 1, result);
+    ASSERT_EQUAL(reference, dst);
+}
+DECLARE_INTEGRAL_VECTOR_UNITTEST(TestCopyLargeTriviallyRelocatable);
+
 template <typename Vector>
 void TestCopyConstantIteratorToZipIterator(void)
 {
@@ -0,0 +1,166 @@
+#include <unittest/unittest.h>
+
+#if _CCCL_STD_VER >= 2014
+
+#include <thrust/mdspan.h>
+#include <thrust/functional.h>
+#include <thrust/sequence.h>
+
+template <typename T>
+struct count_visits
+{
+  T *counts;
+
+  template <typename Index>
+  __host__ __device__
+  void operator()(Index i, Index j, Index k) const
+  {
+    counts[(i * 4 + j) * 5 + k] += 1;
+  }
+};
+
+void TestForEachIndexVisitsEveryIndexOnce(void)
+{
+  thrust::device_vector<int> counts(3 * 4 * 5, 0);
+
+  cuda::std::extents<int, 3, cuda::std::dynamic_extent, 5> extents(4);
+
+  thrust::for_each_index(thrust::device, extents, count_visits<int>{thrust::raw_pointer_cast(counts.data())});
+
+  thrust::host_vector<int> h_counts = counts;
+  ASSERT_EQUAL(h_counts, thrust::host_vector<int>(3 * 4 * 5, 1));
+
+  thrust::fill(counts.begin(), counts.end(), 0);
+
+  thrust::for_each_index(cuda::std::dextents<int, 3>(3, 4, 5), count_visits<int>{thrust::raw_pointer_cast(counts.data())});
+
+  h_counts = counts;
+  ASSERT_EQUAL(h_counts, thrust::host_vector<int>(3 * 4 * 5, 1));
+}
+DECLARE_UNITTEST(TestForEachIndexVisitsEveryIndexOnce);
+
+struct count_calls
+{
+  int *count;
+
+  __host__ __device__
+  void operator()() const
+  {
+    ++*count;
+  }
+};
+
+void TestForEachIndexEmptyAndRankZero(void)
+{
+  int count = 0;
+
+  thrust::for_each_index(thrust::host, cuda::std::extents<int>(), count_calls{&count});
+  ASSERT_EQUAL(count, 1);
+
+  thrust::for_each_index(thrust::host, cuda::std::dextents<int, 3>(0, 4, 5), count_visits<int>{nullptr});
+  thrust::for_each_index(thrust::host, cuda::std::dextents<int, 3>(3, 4, 0), count_visits<int>{nullptr});
+}
+DECLARE_UNITTEST(TestForEachIndexEmptyAndRankZero);
+
+template <typename T>
+struct increment
+{
+  __host__ __device__
+  T operator()(T x) const
+  {
+    return x + 1;
+  }
+};
+
+template <typename Vector>
+void TestTransformMdspan(void)
+{
+  typedef typename Vector::value_type T;
+  typedef cuda::std::dextents<int, 3> extents_type;
+
+  Vector in(2 * 3 * 4);
+  Vector out(2 * 3 * 4);
+  thrust::sequence(in.begin(), in.end());
+
+  extents_type extents(2, 3, 4);
+
+  // the input is row-major, the output column-major
+  cuda::std::mdspan<const T, extents_type> in_view(thrust::raw_pointer_cast(in.data()), extents);
+  cuda::std::mdspan<T, extents_type, cuda::std::layout_left> out_view(thrust::raw_pointer_cast(out.data()), extents);
+
+  thrust::transform(thrust::device, in_view, out_view, increment<T>());
+
+  thrust::host_vector<T> h_out = out;
+  for (int i = 0; i < 2; ++i)
+  {
+    for (int j = 0; j < 3; ++j)
+    {
+      for (int k = 0; k < 4; ++k)
+      {
+        const T x = static_cast<T>((i * 3 + j) * 4 + k);
+        ASSERT_EQUAL(h_out[(k * 3 + j) * 2 + i], static_cast<T>(x + 1));
+      }
+    }
+  }
+}
+DECLARE_INTEGRAL_VECTOR_UNITTEST(TestTransformMdspan);
+
+void TestReduceMdspan(void)
+{
+  typedef cuda::std::dextents<int, 2> extents_type;
+  typedef cuda::std::layout_right_padded<4> layout_type;
+
+  // a 3 x 3 matrix whose rows are padded to 4 elements, with a padding
+  // element which must not contribute to the result
+  thrust::device_vector<int> data(3 * 4, 100);
+  for (int i = 0; i < 3; ++i)
+  {
+    for (int j = 0; j < 3; ++j)
+    {
+      data[i * 4 + j] = i * 3 + j + 1;
+    }
+  }
+
+  cuda::std::mdspan<int, extents_type, layout_type> view(thrust::raw_pointer_cast(data.data()), extents_type(3, 3));
+
+  ASSERT_EQUAL(thrust::reduce(thrust::device, view, 0), 45);
+  ASSERT_EQUAL(thrust::reduce(thrust::device, view, 0, thrust::maximum<int>()), 9);
+  ASSERT_EQUAL(thrust::reduce(thrust::device, view, 10, thrust::maximum<int>()), 10);
+
+  cuda::std::mdspan<int, extents_type> empty(thrust::raw_pointer_cast(data.data()), extents_type(0, 3));
+  ASSERT_EQUAL(thrust::reduce(thrust::device, empty, 7), 7);
+
+  thrust::host_vector<int> h_data = data;
+  cuda::std::mdspan<int, extents_type, layout_type> h_view(h_data.data(), extents_type(3, 3));
+  ASSERT_EQUAL(thrust::reduce(h_view, 0), 45);
+}
+DECLARE_UNITTEST(TestReduceMdspan);
+
+template <typename T>
+struct concatenate_digits
+{
+  __host__ __device__
+  T operator()(T x, T y) const
+  {
+    T shift = 1;
+    for (T z = y; z > 0; z /= 10)
+    {
+      shift *= 10;
+    }
+    return x * shift + y;
+  }
+};
+
+void TestReduceMdspanIsOrdered(void)
+{
+  typedef cuda::std::dextents<int, 2> extents_type;
+
+  // column-major, so the elements are visited in the order 1, 2, ..., 6
+  long long values[] = {1, 2, 3, 4, 5, 6};
+  cuda::std::mdspan<long long, extents_type, cuda::std::layout_left> view(values, extents_type(2, 3));
+
+  ASSERT_EQUAL(thrust::reduce(thrust::host, view, 0ll, concatenate_digits<long long>()), 123456ll);
+}
+DECLARE_UNITTEST(TestReduceMdspanIsOrdered);
+
+#endif // _CCCL_STD_VER >= 2014
@@ -0,0 +1,7 @@
+# Link the framework built with THRUST_ENABLE_PROFILING, which defines the
+# macro for this test as well.
+get_target_property(test_libs ${test_target} LINK_LIBRARIES)
+list(TRANSFORM test_libs
+  REPLACE "^${config_framework_target}$" "${config_framework_target}.profiling"
+)
+set_property(TARGET ${test_target} PROPERTY LINK_LIBRARIES ${test_libs})
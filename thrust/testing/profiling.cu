@@ -0,0 +1,159 @@
+#include <unittest/unittest.h>
+
+#include <thrust/profiling.h>
+#include <thrust/reduce.h>
+#include <thrust/sort.h>
+#include <thrust/system/cpp/execution_policy.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+struct recording_callback : thrust::profiling::callback
+{
+  std::vector<thrust::profiling::event> events;
+
+  void record(const thrust::profiling::event &e) override
+  {
+    events.push_back(e);
+  }
+};
+
+// installs a callback for the duration of a test
+struct callback_guard
+{
+  thrust::profiling::callback *previous;
+
+  explicit callback_guard(thrust::profiling::callback *cb)
+      : previous(thrust::profiling::set_callback(cb))
+  {}
+
+  ~callback_guard()
+  {
+    thrust::profiling::set_callback(previous);
+  }
+};
+
+// the algorithms called outside of the tests, e.g. to generate their inputs,
+// would otherwise be reported by the default summary at exit
+struct discard_events_outside_tests
+{
+  discard_events_outside_tests()
+  {
+    thrust::profiling::set_callback(nullptr);
+  }
+
+  ~discard_events_outside_tests()
+  {
+    thrust::profiling::set_callback(nullptr);
+  }
+};
+
+static discard_events_outside_tests discard_outside_tests;
+
+void TestProfilingDiscardsOutsideTests(void)
+{
+  ASSERT_EQUAL(thrust::profiling::get_callback() == nullptr, true);
+}
+DECLARE_UNITTEST(TestProfilingDiscardsOutsideTests);
+
+void TestProfilingRecordsOutermostCall(void)
+{
+  thrust::host_vector<int> v = unittest::random_integers<int>(1000);
+
+  recording_callback recorder;
+  {
+    callback_guard guard(&recorder);
+    thrust::stable_sort(thrust::cpp::par, v.begin(), v.end());
+  }
+
+  ASSERT_EQUAL(recorder.events.empty(), false);
+
+  // the outermost call is reported last
+  const thrust::profiling::event &e = recorder.events.back();
+  ASSERT_EQUAL(std::string(e.algorithm), "stable_sort");
+  ASSERT_EQUAL(std::string(e.system), "cpp");
+  ASSERT_EQUAL(e.num_items, 1000lu);
+  ASSERT_EQUAL(e.depth, 0);
+
+  for (std::size_t i = 0; i + 1 < recorder.events.size(); ++i)
+  {
+    ASSERT_EQUAL(recorder.events[i].depth > 0, true);
+    ASSERT_EQUAL(recorder.events[i].temporary_bytes <= e.temporary_bytes, true);
+  }
+}
+DECLARE_UNITTEST(TestProfilingRecordsOutermostCall);
+
+void TestProfilingDiscardsWithoutCallback(void)
+{
+  thrust::host_vector<int> v(10, 1);
+
+  recording_callback recorder;
+  {
+    callback_guard guard(&recorder);
+    callback_guard disabled(nullptr);
+    ASSERT_EQUAL(thrust::reduce(thrust::cpp::par, v.begin(), v.end()), 10);
+  }
+
+  ASSERT_EQUAL(recorder.events.size(), 0lu);
+}
+DECLARE_UNITTEST(TestProfilingDiscardsWithoutCallback);
+
+void TestProfilingSummary(void)
+{
+  thrust::host_vector<int> v(100, 1);
+
+  thrust::profiling::summary summary;
+  {
+    callback_guard guard(&summary);
+    thrust::reduce(thrust::cpp::par, v.begin(), v.end());
+    thrust::reduce(thrust::cpp::par, v.begin(), v.begin() + 50);
+    thrust::sort(thrust::cpp::par, v.begin(), v.end());
+  }
+
+  std::vector<thrust::profiling::summary::row> rows = summary.rows();
+  ASSERT_EQUAL(rows.size(), 2lu);
+
+  for (const auto &r : rows)
+  {
+    ASSERT_EQUAL(r.system, "cpp");
+    if (r.algorithm == "reduce")
+    {
+      ASSERT_EQUAL(r.calls, 2lu);
+      ASSERT_EQUAL(r.num_items, 150lu);
+    }
+    else
+    {
+      ASSERT_EQUAL(r.algorithm, "sort");
+      ASSERT_EQUAL(r.calls, 1lu);
+    }
+  }
+
+  std::ostringstream table;
+  summary.print(table);
+  ASSERT_EQUAL(table.str().find("| reduce") != std::string::npos, true);
+
+  summary.clear();
+  ASSERT_EQUAL(summary.rows().size(), 0lu);
+}
+DECLARE_UNITTEST(TestProfilingSummary);
+
+void TestProfilingChromeTrace(void)
+{
+  thrust::host_vector<int> v(100, 1);
+
+  thrust::profiling::chrome_trace trace;
+  {
+    callback_guard guard(&trace);
+    thrust::reduce(thrust::cpp::par, v.begin(), v.end());
+  }
+
+  std::ostringstream json;
+  trace.write(json);
+
+  const std::string s = json.str();
+  ASSERT_EQUAL(s.find("\"traceEvents\"") != std::string::npos, true);
+  ASSERT_EQUAL(s.find("\"name\":\"reduce\",\"cat\":\"cpp\",\"ph\":\"X\"") != std::string::npos, true);
+  ASSERT_EQUAL(s.find("\"items\":100") != std::string::npos, true);
+}
+DECLARE_UNITTEST(TestProfilingChromeTrace);
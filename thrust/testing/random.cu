@@ -739,6 +739,489 @@ void TestRanlux48Unequal(void)
 DECLARE_UNITTEST(TestRanlux48Unequal);
 
 
+void TestPhilox4x32Validation(void)
+{
+  typedef thrust::random::philox4x32 Engine;
+
+  TestEngineValidation<Engine,1955073260u>();
+}
+DECLARE_UNITTEST(TestPhilox4x32Validation);
+
+
+void TestPhilox4x32Min(void)
+{
+  typedef thrust::random::philox4x32 Engine;
+
+  TestEngineMin<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x32Min);
+
+
+void TestPhilox4x32Max(void)
+{
+  typedef thrust::random::philox4x32 Engine;
+
+  TestEngineMax<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x32Max);
+
+
+void TestPhilox4x32SaveRestore(void)
+{
+  typedef thrust::random::philox4x32 Engine;
+
+  TestEngineSaveRestore<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x32SaveRestore);
+
+
+void TestPhilox4x32Equal(void)
+{
+  typedef thrust::random::philox4x32 Engine;
+
+  TestEngineEqual<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x32Equal);
+
+
+void TestPhilox4x32Unequal(void)
+{
+  typedef thrust::random::philox4x32 Engine;
+
+  TestEngineUnequal<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x32Unequal);
+
+
+void TestPhilox4x64Validation(void)
+{
+  typedef thrust::random::philox4x64 Engine;
+
+  TestEngineValidation<Engine,3409172418970261260ull>();
+}
+DECLARE_UNITTEST(TestPhilox4x64Validation);
+
+
+void TestPhilox4x64Min(void)
+{
+  typedef thrust::random::philox4x64 Engine;
+
+  TestEngineMin<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x64Min);
+
+
+void TestPhilox4x64Max(void)
+{
+  typedef thrust::random::philox4x64 Engine;
+
+  TestEngineMax<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x64Max);
+
+
+void TestPhilox4x64SaveRestore(void)
+{
+  typedef thrust::random::philox4x64 Engine;
+
+  TestEngineSaveRestore<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x64SaveRestore);
+
+
+void TestPhilox4x64Equal(void)
+{
+  typedef thrust::random::philox4x64 Engine;
+
+  TestEngineEqual<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x64Equal);
+
+
+void TestPhilox4x64Unequal(void)
+{
+  typedef thrust::random::philox4x64 Engine;
+
+  TestEngineUnequal<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x64Unequal);
+
+
+void TestThreefry4x32Validation(void)
+{
+  typedef thrust::random::threefry4x32 Engine;
+
+  TestEngineValidation<Engine,112810865u>();
+}
+DECLARE_UNITTEST(TestThreefry4x32Validation);
+
+
+void TestThreefry4x32Min(void)
+{
+  typedef thrust::random::threefry4x32 Engine;
+
+  TestEngineMin<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x32Min);
+
+
+void TestThreefry4x32Max(void)
+{
+  typedef thrust::random::threefry4x32 Engine;
+
+  TestEngineMax<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x32Max);
+
+
+void TestThreefry4x32SaveRestore(void)
+{
+  typedef thrust::random::threefry4x32 Engine;
+
+  TestEngineSaveRestore<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x32SaveRestore);
+
+
+void TestThreefry4x32Equal(void)
+{
+  typedef thrust::random::threefry4x32 Engine;
+
+  TestEngineEqual<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x32Equal);
+
+
+void TestThreefry4x32Unequal(void)
+{
+  typedef thrust::random::threefry4x32 Engine;
+
+  TestEngineUnequal<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x32Unequal);
+
+
+void TestThreefry4x64Validation(void)
+{
+  typedef thrust::random::threefry4x64 Engine;
+
+  TestEngineValidation<Engine,9253438642465275567ull>();
+}
+DECLARE_UNITTEST(TestThreefry4x64Validation);
+
+
+void TestThreefry4x64Min(void)
+{
+  typedef thrust::random::threefry4x64 Engine;
+
+  TestEngineMin<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x64Min);
+
+
+void TestThreefry4x64Max(void)
+{
+  typedef thrust::random::threefry4x64 Engine;
+
+  TestEngineMax<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x64Max);
+
+
+void TestThreefry4x64SaveRestore(void)
+{
+  typedef thrust::random::threefry4x64 Engine;
+
+  TestEngineSaveRestore<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x64SaveRestore);
+
+
+void TestThreefry4x64Equal(void)
+{
+  typedef thrust::random::threefry4x64 Engine;
+
+  TestEngineEqual<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x64Equal);
+
+
+void TestThreefry4x64Unequal(void)
+{
+  typedef thrust::random::threefry4x64 Engine;
+
+  TestEngineUnequal<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x64Unequal);
+
+
+template<typename Engine>
+  struct ValidateCounterBasedEngineDiscard
+{
+  __host__ __device__
+  bool operator()(void) const
+  {
+    bool result = true;
+
+    // discard from every position within a block, by amounts which end
+    // within the current block, at a block boundary, and further away
+    const unsigned long long offsets[] = {0, 1, 2, 3, 4, 5, 7, 8, 13, 1000};
+
+    for(int i = 0; i < 10; ++i)
+    {
+      for(int j = 0; j < 10; ++j)
+      {
+        Engine e0, e1;
+        e0.discard(offsets[i]);
+        e1.discard(offsets[i]);
+
+        e0.discard(offsets[j]);
+        for(unsigned long long k = 0; k < offsets[j]; ++k)
+        {
+          e1();
+        }
+
+        result &= (e0 == e1);
+        result &= (e0() == e1());
+      }
+    }
+
+    return result;
+  }
+};
+
+
+template<typename Engine>
+void TestCounterBasedEngineDiscard(void)
+{
+  // test host
+  thrust::host_vector<bool> h(1);
+  thrust::generate(h.begin(), h.end(), ValidateCounterBasedEngineDiscard<Engine>());
+
+  ASSERT_EQUAL(true, h[0]);
+
+  // test device
+  thrust::device_vector<bool> d(1);
+  thrust::generate(d.begin(), d.end(), ValidateCounterBasedEngineDiscard<Engine>());
+
+  ASSERT_EQUAL(true, d[0]);
+
+  // a discard far beyond what could be iterated carries into the counter's
+  // upper words, and lands on the block set_counter selects
+  Engine e0, e1;
+  e0.discard(4ull << 40);
+
+  ::cuda::std::array<typename Engine::result_type, 4> counter = {{0, 0, 0, 0}};
+  counter[Engine::word_size == 32 ? 2 : 3] = Engine::word_size == 32 ? 256 : (1ull << 40);
+  e1.set_counter(counter);
+
+  ASSERT_EQUAL(true, e0 == e1);
+  ASSERT_EQUAL(e0(), e1());
+}
+
+
+void TestPhilox4x32Discard(void)
+{
+  TestCounterBasedEngineDiscard<thrust::random::philox4x32>();
+}
+DECLARE_UNITTEST(TestPhilox4x32Discard);
+
+
+void TestThreefry4x64Discard(void)
+{
+  TestCounterBasedEngineDiscard<thrust::random::threefry4x64>();
+}
+DECLARE_UNITTEST(TestThreefry4x64Discard);
+
+
+template<typename Engine>
+void TestCounterBasedEngineGenerate(void)
+{
+  typedef typename Engine::result_type T;
+
+  for(size_t offset = 0; offset < 5; ++offset)
+  {
+    for(size_t n = 0; n < 12; ++n)
+    {
+      Engine e0, e1;
+      e0.discard(offset);
+      e1.discard(offset);
+
+      thrust::host_vector<T> h0(n), h1(n);
+      e0.generate(h0.begin(), h0.end());
+      for(size_t i = 0; i < n; ++i)
+      {
+        h1[i] = e1();
+      }
+
+      ASSERT_EQUAL(h0, h1);
+      ASSERT_EQUAL(true, e0 == e1);
+      ASSERT_EQUAL(e0(), e1());
+    }
+  }
+}
+
+
+void TestPhilox4x64Generate(void)
+{
+  TestCounterBasedEngineGenerate<thrust::random::philox4x64>();
+}
+DECLARE_UNITTEST(TestPhilox4x64Generate);
+
+
+void TestThreefry4x32Generate(void)
+{
+  TestCounterBasedEngineGenerate<thrust::random::threefry4x32>();
+}
+DECLARE_UNITTEST(TestThreefry4x32Generate);
+
+
+template<typename Engine>
+  struct ValidateEngineDiscard
+{
+  __host__ __device__
+  bool operator()(void) const
+  {
+    bool result = true;
+
+    // amounts on either side of the points where the engines switch from
+    // stepping to jumping
+    const unsigned long long offsets[] = {0, 1, 2, 23, 1023, 2591, 2592, 2593, 16383, 16385};
+
+    Engine e0, e1;
+    for(int i = 0; i < 10; ++i)
+    {
+      e0.discard(offsets[i]);
+      for(unsigned long long k = 0; k < offsets[i]; ++k)
+      {
+        e1();
+      }
+
+      result &= (e0 == e1);
+      result &= (e0() == e1());
+    }
+
+    return result;
+  }
+};
+
+
+template<typename Engine>
+void TestEngineDiscard(void)
+{
+  // test host
+  thrust::host_vector<bool> h(1);
+  thrust::generate(h.begin(), h.end(), ValidateEngineDiscard<Engine>());
+
+  ASSERT_EQUAL(true, h[0]);
+
+  // test device
+  thrust::device_vector<bool> d(1);
+  thrust::generate(d.begin(), d.end(), ValidateEngineDiscard<Engine>());
+
+  ASSERT_EQUAL(true, d[0]);
+
+  // discards far beyond what could be iterated compose
+  const unsigned long long x = 1000000007ull * 1000003ull;
+  const unsigned long long y = (1ull << 62) + 12345;
+
+  Engine e0, e1;
+  e0.discard(x);
+  e0.discard(y);
+  e1.discard(y);
+  e1.discard(x);
+
+  ASSERT_EQUAL(true, e0 == e1);
+
+  Engine e2;
+  e2.discard(x + y);
+
+  ASSERT_EQUAL(true, e0 == e2);
+  ASSERT_EQUAL(e0(), e2());
+}
+
+
+void TestMinstdRand0Discard(void)
+{
+  TestEngineDiscard<thrust::random::minstd_rand0>();
+}
+DECLARE_UNITTEST(TestMinstdRand0Discard);
+
+
+void TestLinearCongruentialEngineDiscard(void)
+{
+  // an increment, and a modulus which is not a power of two
+  TestEngineDiscard<thrust::random::linear_congruential_engine<thrust::detail::uint32_t, 48271u, 12345u, 2147483647u> >();
+  TestEngineDiscard<thrust::random::linear_congruential_engine<thrust::detail::uint64_t, 40692ull, 7ull, 2147483399ull> >();
+
+  // a modulus of 2^64
+  TestEngineDiscard<thrust::random::linear_congruential_engine<thrust::detail::uint64_t, 6364136223846793005ull, 1442695040888963407ull, 0ull> >();
+}
+DECLARE_UNITTEST(TestLinearCongruentialEngineDiscard);
+
+
+template<typename Engine>
+void TestEngineDiscardSteps(void)
+{
+  // test host
+  thrust::host_vector<bool> h(1);
+  thrust::generate(h.begin(), h.end(), ValidateEngineDiscard<Engine>());
+
+  ASSERT_EQUAL(true, h[0]);
+
+  // test device
+  thrust::device_vector<bool> d(1);
+  thrust::generate(d.begin(), d.end(), ValidateEngineDiscard<Engine>());
+
+  ASSERT_EQUAL(true, d[0]);
+}
+
+
+void TestLinearCongruentialEngineDiscardInexactModulo(void)
+{
+  // multipliers and moduli for which operator() computes a * x mod m with
+  // Schrage's method, although m % a >= m / a
+  TestEngineDiscardSteps<thrust::random::linear_congruential_engine<thrust::detail::uint32_t, 1103515245u, 12345u, 2147483648u> >();
+  TestEngineDiscardSteps<thrust::random::linear_congruential_engine<thrust::detail::uint64_t, 25214903917ull, 11ull, 281474976710656ull> >();
+}
+DECLARE_UNITTEST(TestLinearCongruentialEngineDiscardInexactModulo);
+
+
+void TestRanlux24BaseDiscard(void)
+{
+  TestEngineDiscard<thrust::random::ranlux24_base>();
+}
+DECLARE_UNITTEST(TestRanlux24BaseDiscard);
+
+
+void TestRanlux48BaseDiscard(void)
+{
+  TestEngineDiscard<thrust::random::ranlux48_base>();
+}
+DECLARE_UNITTEST(TestRanlux48BaseDiscard);
+
+
+void TestRanlux24Discard(void)
+{
+  TestEngineDiscard<thrust::random::ranlux24>();
+}
+DECLARE_UNITTEST(TestRanlux24Discard);
+
+
+void TestRanlux48Discard(void)
+{
+  TestEngineDiscard<thrust::random::ranlux48>();
+}
+DECLARE_UNITTEST(TestRanlux48Discard);
+
+
+void TestTaus88Discard(void)
+{
+  TestEngineDiscard<thrust::random::taus88>();
+}
+DECLARE_UNITTEST(TestTaus88Discard);
+
+
 THRUST_DISABLE_MSVC_WARNING_BEGIN(4305) // truncation warning
 template<typename Distribution, typename Validator>
   void ValidateDistributionCharacteristic(void)
@@ -926,3 +1409,141 @@ void TestNormalDistributionSaveRestore(void)
 }
 DECLARE_UNITTEST(TestNormalDistributionSaveRestore);
 
+
+
+template<typename Engine, typename IntType>
+void TestUniformIntDistributionUnbiased(void)
+{
+  // each value of a small range is about equally likely
+  {
+    Engine e;
+    thrust::random::uniform_int_distribution<IntType> d(-3, 6);
+
+    int counts[10] = {0};
+    for(int i = 0; i < 20000; ++i)
+    {
+      const IntType x = d(e);
+      ASSERT_EQUAL(true, -3 <= x && x <= 6);
+      ++counts[x + 3];
+    }
+
+    for(int i = 0; i < 10; ++i)
+    {
+      ASSERT_EQUAL(true, 1700 < counts[i] && counts[i] < 2300);
+    }
+  }
+
+  // so is each half of the whole range of IntType, even if it is wider than the range of Engine
+  {
+    Engine e;
+    thrust::random::uniform_int_distribution<IntType> d;
+
+    int upper = 0;
+    for(int i = 0; i < 20000; ++i)
+    {
+      upper += d(e) > d.max() / 2;
+    }
+
+    ASSERT_EQUAL(true, 9500 < upper && upper < 10500);
+  }
+
+  // and of a range which is not a power of two, and spans most of IntType
+  {
+    Engine e;
+    const IntType b = thrust::detail::integer_traits<IntType>::const_max / 3 * 2;
+    thrust::random::uniform_int_distribution<IntType> d(0, b);
+
+    int lower = 0;
+    for(int i = 0; i < 20000; ++i)
+    {
+      lower += d(e) <= b / 2;
+    }
+
+    ASSERT_EQUAL(true, 9500 < lower && lower < 10500);
+  }
+}
+
+
+void TestUniformIntDistributionUnbiased(void)
+{
+  // engines of ranges which are and are not powers of two, narrower and wider than the distribution
+  TestUniformIntDistributionUnbiased<thrust::minstd_rand, int>();
+  TestUniformIntDistributionUnbiased<thrust::minstd_rand, long long>();
+  TestUniformIntDistributionUnbiased<thrust::taus88, int>();
+  TestUniformIntDistributionUnbiased<thrust::ranlux24, long long>();
+  TestUniformIntDistributionUnbiased<thrust::ranlux48, int>();
+  TestUniformIntDistributionUnbiased<thrust::random::philox4x64, short>();
+}
+DECLARE_UNITTEST(TestUniformIntDistributionUnbiased);
+
+
+template<typename Distribution, typename Engine>
+void TestDistributionGenerate(Distribution d0)
+{
+  typedef typename Distribution::result_type T;
+
+  Engine e0, e1;
+  Distribution d1 = d0;
+
+  thrust::host_vector<T> h0(1000), h1(1000);
+  d0.generate(e0, h0.begin(), h0.end());
+  for(size_t i = 0; i < h1.size(); ++i)
+  {
+    h1[i] = d1(e1);
+  }
+
+  ASSERT_EQUAL(h0, h1);
+  ASSERT_EQUAL(true, e0 == e1);
+}
+
+
+void TestDistributionGenerate(void)
+{
+  TestDistributionGenerate<thrust::random::uniform_int_distribution<int>, thrust::minstd_rand>(
+    thrust::random::uniform_int_distribution<int>(-7, 1000000));
+  TestDistributionGenerate<thrust::random::uniform_int_distribution<unsigned long long>, thrust::taus88>(
+    thrust::random::uniform_int_distribution<unsigned long long>());
+  TestDistributionGenerate<thrust::random::uniform_real_distribution<float>, thrust::minstd_rand>(
+    thrust::random::uniform_real_distribution<float>(-1.0f, 3.0f));
+  TestDistributionGenerate<thrust::random::normal_distribution<double>, thrust::ranlux24>(
+    thrust::random::normal_distribution<double>(5.0, 2.0));
+}
+DECLARE_UNITTEST(TestDistributionGenerate);
+
+
+template<typename RealType, typename Engine>
+void TestNormalDistributionMoments(void)
+{
+  Engine e;
+  thrust::random::normal_distribution<RealType> d(1, 2);
+
+  const int n = 100000;
+
+  double mean = 0, variance = 0, tail = 0;
+  for(int i = 0; i < n; ++i)
+  {
+    const double x = (d(e) - 1) / 2;
+    mean     += x;
+    variance += x * x;
+    tail     += (x < -2 || x > 2);
+  }
+  mean     /= n;
+  variance /= n;
+  tail     /= n;
+
+  ASSERT_EQUAL(true, -0.02 < mean && mean < 0.02);
+  ASSERT_EQUAL(true, 0.97 < variance && variance < 1.03);
+
+  // P(|x| > 2) = 0.0455
+  ASSERT_EQUAL(true, 0.041 < tail && tail < 0.050);
+}
+
+
+void TestNormalDistributionMoments(void)
+{
+  TestNormalDistributionMoments<float,  thrust::minstd_rand>();
+  TestNormalDistributionMoments<double, thrust::minstd_rand>();
+  TestNormalDistributionMoments<float,  thrust::taus88>();
+  TestNormalDistributionMoments<double, thrust::ranlux48>();
+}
+DECLARE_UNITTEST(TestNormalDistributionMoments);
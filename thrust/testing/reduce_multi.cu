@@ -0,0 +1,123 @@
+#include <unittest/unittest.h>
+#include <thrust/reduce_multi.h>
+#include <thrust/reduce.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/retag.h>
+#include <limits>
+
+
+template<typename InputIterator, typename Tuple, typename... BinaryFunctions>
+Tuple reduce_multi(my_system &system, InputIterator, InputIterator, Tuple init, thrust::tuple<BinaryFunctions...>)
+{
+    system.validate_dispatch();
+    return init;
+}
+
+void TestReduceMultiDispatchExplicit()
+{
+    thrust::device_vector<int> vec;
+
+    my_system sys(0);
+    thrust::reduce_multi(sys, vec.begin(), vec.end(), thrust::make_tuple(0), thrust::plus<int>());
+
+    ASSERT_EQUAL(true, sys.is_valid());
+}
+DECLARE_UNITTEST(TestReduceMultiDispatchExplicit);
+
+
+template <class Vector>
+void TestReduceMultiSimple(void)
+{
+    typedef typename Vector::value_type T;
+
+    Vector v(3);
+    v[0] = 1; v[1] = 5; v[2] = 3;
+
+    thrust::tuple<T, T, T> result =
+      thrust::reduce_multi(v.begin(), v.end(),
+                           thrust::make_tuple(T(4), T(0), T(10)),
+                           thrust::minimum<T>(),
+                           thrust::maximum<T>(),
+                           thrust::plus<T>());
+
+    ASSERT_EQUAL(thrust::get<0>(result), T(1));
+    ASSERT_EQUAL(thrust::get<1>(result), T(5));
+    ASSERT_EQUAL(thrust::get<2>(result), T(19));
+
+    // an empty range yields the initial values
+    result = thrust::reduce_multi(v.begin(), v.begin(),
+                                  thrust::make_tuple(T(4), T(0), T(10)),
+                                  thrust::minimum<T>(),
+                                  thrust::maximum<T>(),
+                                  thrust::plus<T>());
+
+    ASSERT_EQUAL(thrust::get<0>(result), T(4));
+    ASSERT_EQUAL(thrust::get<1>(result), T(0));
+    ASSERT_EQUAL(thrust::get<2>(result), T(10));
+}
+DECLARE_VECTOR_UNITTEST(TestReduceMultiSimple);
+
+
+template <typename T>
+struct TestReduceMulti
+{
+    void operator()(const size_t n)
+    {
+        thrust::host_vector<T>   h_data = unittest::random_integers<T>(n);
+        thrust::device_vector<T> d_data = h_data;
+
+        const thrust::tuple<T, T, T> init =
+          thrust::make_tuple(std::numeric_limits<T>::max(), std::numeric_limits<T>::min(), T(13));
+
+        thrust::tuple<T, T, T> h_result =
+          thrust::reduce_multi(h_data.begin(), h_data.end(), init,
+                               thrust::minimum<T>(), thrust::maximum<T>(), thrust::plus<T>());
+        thrust::tuple<T, T, T> d_result =
+          thrust::reduce_multi(d_data.begin(), d_data.end(), init,
+                               thrust::minimum<T>(), thrust::maximum<T>(), thrust::plus<T>());
+
+        ASSERT_EQUAL(thrust::get<0>(h_result), thrust::reduce(h_data.begin(), h_data.end(), thrust::get<0>(init), thrust::minimum<T>()));
+        ASSERT_EQUAL(thrust::get<1>(h_result), thrust::reduce(h_data.begin(), h_data.end(), thrust::get<1>(init), thrust::maximum<T>()));
+        ASSERT_EQUAL(thrust::get<2>(h_result), thrust::reduce(h_data.begin(), h_data.end(), thrust::get<2>(init)));
+
+        ASSERT_EQUAL(thrust::get<0>(h_result), thrust::get<0>(d_result));
+        ASSERT_EQUAL(thrust::get<1>(h_result), thrust::get<1>(d_result));
+        ASSERT_EQUAL(thrust::get<2>(h_result), thrust::get<2>(d_result));
+    }
+};
+VariableUnitTest<TestReduceMulti, IntegralTypes> TestReduceMultiInstance;
+
+
+void TestReduceMultiMixedTypes(void)
+{
+    // the elements are converted to the type of each accumulator
+    thrust::device_vector<float> v(4);
+    v[0] = 1.5f; v[1] = 2.5f; v[2] = 3.5f; v[3] = 4.5f;
+
+    thrust::tuple<int, double> result =
+      thrust::reduce_multi(thrust::device, v.begin(), v.end(),
+                           thrust::make_tuple(0, 0.5),
+                           thrust::plus<int>(),
+                           thrust::plus<double>());
+
+    ASSERT_EQUAL(thrust::get<0>(result), 10);
+    ASSERT_EQUAL(thrust::get<1>(result), 12.5);
+}
+DECLARE_UNITTEST(TestReduceMultiMixedTypes);
+
+
+void TestReduceMultiNonContiguous(void)
+{
+    thrust::counting_iterator<long long> first(1);
+
+    thrust::tuple<long long, long long> result =
+      thrust::reduce_multi(thrust::device, first, first + 1000,
+                           thrust::make_tuple(0ll, 0ll),
+                           thrust::plus<long long>(),
+                           thrust::maximum<long long>());
+
+    ASSERT_EQUAL(thrust::get<0>(result), 500500ll);
+    ASSERT_EQUAL(thrust::get<1>(result), 1000ll);
+}
+DECLARE_UNITTEST(TestReduceMultiNonContiguous);
@@ -0,0 +1,235 @@
+#include <unittest/unittest.h>
+
+#include <thrust/small_vector.h>
+
+#include <list>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+template <typename T>
+struct counting_allocator : std::allocator<T>
+{
+    typedef T value_type;
+
+    template <typename U>
+    struct rebind
+    {
+        typedef counting_allocator<U> other;
+    };
+
+    static int allocations;
+
+    counting_allocator() {}
+
+    template <typename U>
+    counting_allocator(const counting_allocator<U> &) {}
+
+    T *allocate(std::size_t n)
+    {
+        ++allocations;
+        return std::allocator<T>::allocate(n);
+    }
+};
+
+template <typename T>
+int counting_allocator<T>::allocations = 0;
+
+void TestSmallVectorStaysInline(void)
+{
+    typedef thrust::small_vector<int, 4, counting_allocator<int> > Vector;
+
+    counting_allocator<int>::allocations = 0;
+
+    Vector v;
+    ASSERT_EQUAL(v.size(), 0lu);
+    ASSERT_EQUAL(v.capacity(), Vector::inline_capacity);
+    ASSERT_EQUAL(v.is_inline(), true);
+
+    v.push_back(0);
+    v.push_back(1);
+    v.emplace_back(2);
+    v.push_back(3);
+
+    ASSERT_EQUAL(v.is_inline(), true);
+    ASSERT_EQUAL(counting_allocator<int>::allocations, 0);
+
+    v.push_back(4);
+
+    ASSERT_EQUAL(v.is_inline(), false);
+    ASSERT_EQUAL(counting_allocator<int>::allocations, 1);
+    ASSERT_EQUAL(v.size(), 5lu);
+
+    for (int i = 0; i < 5; ++i)
+    {
+        ASSERT_EQUAL(v[i], i);
+    }
+
+    v.resize(3);
+    v.shrink_to_fit();
+
+    ASSERT_EQUAL(v.is_inline(), true);
+    ASSERT_EQUAL(v.size(), 3lu);
+    ASSERT_EQUAL(v.back(), 2);
+}
+DECLARE_UNITTEST(TestSmallVectorStaysInline);
+
+void TestSmallVectorInsertErase(void)
+{
+    thrust::small_vector<int, 3> v = {0, 1, 2};
+
+    v.insert(v.begin() + 1, 10);
+    v.insert(v.end(), 2, 20);
+    v.insert(v.begin(), v.begin() + 3, v.end());
+
+    const int expected[] = {2, 20, 20, 0, 10, 1, 2, 20, 20};
+    ASSERT_EQUAL(v.size(), 9lu);
+    for (int i = 0; i < 9; ++i)
+    {
+        ASSERT_EQUAL(v[i], expected[i]);
+    }
+
+    v.erase(v.begin(), v.begin() + 2);
+    v.erase(v.end() - 1);
+
+    const int remaining[] = {20, 0, 10, 1, 2, 20};
+    ASSERT_EQUAL(v.size(), 6lu);
+    for (int i = 0; i < 6; ++i)
+    {
+        ASSERT_EQUAL(v[i], remaining[i]);
+    }
+
+    // the argument refers to an element which the insertion moves
+    v.insert(v.begin(), v[2]);
+    ASSERT_EQUAL(v.front(), 10);
+
+    ASSERT_THROWS(v.at(v.size()), std::out_of_range);
+}
+DECLARE_UNITTEST(TestSmallVectorInsertErase);
+
+void TestSmallVectorAppend(void)
+{
+    thrust::small_vector<int, 2> v(2, 7);
+
+    std::list<int> l;
+    l.push_back(1);
+    l.push_back(2);
+
+    v.append(l.begin(), l.end());
+    v.append(v.begin(), v.end());
+
+    const int expected[] = {7, 7, 1, 2, 7, 7, 1, 2};
+    ASSERT_EQUAL(v.size(), 8lu);
+    for (int i = 0; i < 8; ++i)
+    {
+        ASSERT_EQUAL(v[i], expected[i]);
+    }
+}
+DECLARE_UNITTEST(TestSmallVectorAppend);
+
+void TestSmallVectorCopyMoveSwap(void)
+{
+    typedef thrust::small_vector<std::string, 2> Vector;
+
+    Vector a;
+    a.push_back("a");
+
+    Vector b;
+    b.push_back("b");
+    b.push_back("c");
+    b.push_back("d");
+
+    Vector c(a);
+    ASSERT_EQUAL(c == a, true);
+
+    // inline elements are moved one by one
+    Vector d(std::move(a));
+    ASSERT_EQUAL(d.size(), 1lu);
+    ASSERT_EQUAL(d[0], "a");
+    ASSERT_EQUAL(a.empty(), true);
+
+    // allocated storage changes owner
+    const std::string *storage = b.data();
+    Vector e(std::move(b));
+    ASSERT_EQUAL(e.data() == storage, true);
+    ASSERT_EQUAL(b.is_inline(), true);
+
+    swap(d, e);
+    ASSERT_EQUAL(d.size(), 3lu);
+    ASSERT_EQUAL(d[2], "d");
+    ASSERT_EQUAL(e.size(), 1lu);
+    ASSERT_EQUAL(e[0], "a");
+
+    e = d;
+    ASSERT_EQUAL(e == d, true);
+
+    d = std::move(c);
+    ASSERT_EQUAL(d.size(), 1lu);
+    ASSERT_EQUAL(d[0], "a");
+    ASSERT_EQUAL(d != e, true);
+}
+DECLARE_UNITTEST(TestSmallVectorCopyMoveSwap);
+
+template <std::size_t N>
+void TestSmallVectorStringInsertEraseImpl(void)
+{
+    typedef thrust::small_vector<std::string, N> Vector;
+
+    Vector v;
+    std::vector<std::string> ref;
+    for (int i = 0; i < 6; ++i)
+    {
+        v.push_back(std::string(20, static_cast<char>('a' + i)));
+        ref.push_back(std::string(20, static_cast<char>('a' + i)));
+    }
+
+    // an empty range leaves every element intact
+    typename Vector::iterator pos = v.erase(v.begin() + 3, v.begin() + 3);
+    ASSERT_EQUAL(pos == v.begin() + 3, true);
+    ASSERT_EQUAL(v.size(), ref.size());
+    for (std::size_t i = 0; i < ref.size(); ++i)
+    {
+        ASSERT_EQUAL(v[i], ref[i]);
+    }
+
+    pos = v.erase(v.end(), v.end());
+    ASSERT_EQUAL(pos == v.end(), true);
+
+    v.erase(v.begin() + 1, v.begin() + 3);
+    ref.erase(ref.begin() + 1, ref.begin() + 3);
+
+    v.insert(v.begin() + 1, std::string("inserted"));
+    ref.insert(ref.begin() + 1, std::string("inserted"));
+
+    v.insert(v.begin(), 3, std::string(30, 'x'));
+    ref.insert(ref.begin(), 3, std::string(30, 'x'));
+
+    const std::vector<std::string> head(ref.begin(), ref.begin() + 2);
+    v.insert(v.end(), head.begin(), head.end());
+    ref.insert(ref.end(), head.begin(), head.end());
+
+    v.erase(v.begin() + 2);
+    ref.erase(ref.begin() + 2);
+
+    v.erase(v.begin(), v.begin() + 4);
+    ref.erase(ref.begin(), ref.begin() + 4);
+
+    ASSERT_EQUAL(v.size(), ref.size());
+    for (std::size_t i = 0; i < ref.size(); ++i)
+    {
+        ASSERT_EQUAL(v[i], ref[i]);
+    }
+
+    v.erase(v.begin(), v.end());
+    ASSERT_EQUAL(v.empty(), true);
+}
+
+void TestSmallVectorStringInsertErase(void)
+{
+    // elements stay inline
+    TestSmallVectorStringInsertEraseImpl<16>();
+    // elements spill to allocated storage
+    TestSmallVectorStringInsertEraseImpl<2>();
+}
+DECLARE_UNITTEST(TestSmallVectorStringInsertErase);
@@ -891,3 +891,49 @@ void TestTransformWithIndirection(void)
 }
 DECLARE_INTEGRAL_VECTOR_UNITTEST(TestTransformWithIndirection);
 
+
+
+template <typename T>
+struct negate_mutable_reference
+{
+    __host__ __device__
+    T operator()(T &x) const
+    {
+        return -x;
+    }
+};
+
+template <typename T>
+struct minus_mutable_reference
+{
+    __host__ __device__
+    T operator()(T &x, T &y) const
+    {
+        return x - y;
+    }
+};
+
+template <typename Vector>
+void TestTransformMutableReferenceFunctor(void)
+{
+    typedef typename Vector::value_type T;
+
+    Vector input1(3);
+    Vector input2(3);
+    Vector output(3);
+    input1[0] =  1; input1[1] = -2; input1[2] =  3;
+    input2[0] = -4; input2[1] =  5; input2[2] =  6;
+
+    thrust::transform(input1.begin(), input1.end(), output.begin(), negate_mutable_reference<T>());
+
+    ASSERT_EQUAL(output[0], T(-1));
+    ASSERT_EQUAL(output[1], T(2));
+    ASSERT_EQUAL(output[2], T(-3));
+
+    thrust::transform(input1.begin(), input1.end(), input2.begin(), output.begin(), minus_mutable_reference<T>());
+
+    ASSERT_EQUAL(output[0], T(5));
+    ASSERT_EQUAL(output[1], T(-7));
+    ASSERT_EQUAL(output[2], T(-3));
+}
+DECLARE_INTEGRAL_VECTOR_UNITTEST(TestTransformMutableReferenceFunctor);
@@ -1,12 +1,15 @@
 #include <unittest/unittest.h>
 
 #include <thrust/detail/config.h>
+#include <thrust/count.h>
 #include <thrust/sequence.h>
 #include <thrust/device_malloc_allocator.h>
+#include <thrust/type_traits/is_trivially_relocatable.h>
 
 #if _CCCL_STD_VER >= 2011
 #include <initializer_list>
 #endif
+#include <atomic>
 #include <vector>
 #include <list>
 #include <limits>
@@ -638,6 +641,281 @@ void TestVectorResizing(void)
 }
 DECLARE_VECTOR_UNITTEST(TestVectorResizing);
 
+template <class Vector>
+void TestVectorDefaultInitResizing(void)
+{
+    Vector v(3, thrust::default_init);
+
+    ASSERT_EQUAL(v.size(), 3lu);
+
+    v[0] = 0; v[1] = 1; v[2] = 2;
+
+    v.resize(5, thrust::default_init);
+
+    ASSERT_EQUAL(v.size(), 5lu);
+
+    ASSERT_EQUAL(v[0], 0);
+    ASSERT_EQUAL(v[1], 1);
+    ASSERT_EQUAL(v[2], 2);
+
+    v[3] = 3; v[4] = 4;
+
+    v.resize(64, thrust::default_init);
+
+    ASSERT_EQUAL(v.size(), 64lu);
+
+    ASSERT_EQUAL(v[0], 0);
+    ASSERT_EQUAL(v[3], 3);
+    ASSERT_EQUAL(v[4], 4);
+
+    v.resize(2, thrust::default_init);
+
+    ASSERT_EQUAL(v.size(), 2lu);
+
+    ASSERT_EQUAL(v[0], 0);
+    ASSERT_EQUAL(v[1], 1);
+
+    Vector w(0, thrust::default_init);
+
+    ASSERT_EQUAL(w.size(), 0lu);
+}
+DECLARE_VECTOR_UNITTEST(TestVectorDefaultInitResizing);
+
+template <class Vector>
+void TestVectorNoInitResizing(void)
+{
+    Vector v(3, thrust::no_init);
+
+    ASSERT_EQUAL(v.size(), 3lu);
+
+    thrust::sequence(v.begin(), v.end());
+
+    v.resize(64, thrust::no_init);
+
+    ASSERT_EQUAL(v.size(), 64lu);
+
+    ASSERT_EQUAL(v[0], 0);
+    ASSERT_EQUAL(v[1], 1);
+    ASSERT_EQUAL(v[2], 2);
+
+    v.resize(1, thrust::no_init);
+
+    ASSERT_EQUAL(v.size(), 1lu);
+    ASSERT_EQUAL(v[0], 0);
+}
+DECLARE_INTEGRAL_VECTOR_UNITTEST(TestVectorNoInitResizing);
+
+struct default_constructed_42
+{
+    int value;
+
+    __host__ __device__
+    default_constructed_42() : value(42) {}
+};
+
+void TestVectorDefaultInitConstructsNonTrivialTypes(void)
+{
+    thrust::host_vector<default_constructed_42> v(3, thrust::default_init);
+
+    ASSERT_EQUAL(v.size(), 3lu);
+    ASSERT_EQUAL(v[0].value, 42);
+    ASSERT_EQUAL(v[2].value, 42);
+
+    v.resize(10, thrust::default_init);
+
+    ASSERT_EQUAL(v[3].value, 42);
+    ASSERT_EQUAL(v[9].value, 42);
+}
+DECLARE_UNITTEST(TestVectorDefaultInitConstructsNonTrivialTypes);
+
+struct is_42
+{
+    __host__ __device__
+    bool operator()(const default_constructed_42 &x) const { return x.value == 42; }
+};
+
+void TestHostVectorConstructsLargeVectors(void)
+{
+    // large enough to be constructed in parallel on the OpenMP and TBB systems
+    const size_t n = 1 << 20;
+
+    thrust::host_vector<int> v(n);
+    ASSERT_EQUAL(static_cast<size_t>(thrust::count(v.begin(), v.end(), 0)), n);
+
+    v.resize(2 * n);
+    ASSERT_EQUAL(static_cast<size_t>(thrust::count(v.begin(), v.end(), 0)), 2 * n);
+
+    thrust::host_vector<default_constructed_42> w(n, thrust::default_init);
+    ASSERT_EQUAL(static_cast<size_t>(thrust::count_if(w.begin(), w.end(), is_42())), n);
+
+    thrust::host_vector<int> u(n, 13);
+    ASSERT_EQUAL(static_cast<size_t>(thrust::count(u.begin(), u.end(), 13)), n);
+
+    u.resize(2 * n, 7);
+    ASSERT_EQUAL(static_cast<size_t>(thrust::count(u.begin(), u.end(), 13)), n);
+    ASSERT_EQUAL(static_cast<size_t>(thrust::count(u.begin(), u.end(), 7)), n);
+}
+DECLARE_UNITTEST(TestHostVectorConstructsLargeVectors);
+
+struct destruction_counted
+{
+    static std::atomic<size_t> destructions;
+
+    int value;
+
+    destruction_counted(int value = 0) : value(value) {}
+    ~destruction_counted() { ++destructions; }
+};
+
+std::atomic<size_t> destruction_counted::destructions(0);
+
+struct is_13
+{
+    bool operator()(const destruction_counted &x) const { return x.value == 13; }
+};
+
+void TestHostVectorDestroysLargeVectors(void)
+{
+    // large enough to be constructed and destroyed in parallel on the OpenMP
+    // and TBB systems
+    const size_t n = 1 << 20;
+
+    {
+        thrust::host_vector<destruction_counted> v(2 * n, destruction_counted(13));
+        ASSERT_EQUAL(static_cast<size_t>(thrust::count_if(v.begin(), v.end(), is_13())), 2 * n);
+
+        destruction_counted::destructions = 0;
+
+        v.resize(n);
+        ASSERT_EQUAL(destruction_counted::destructions.load(), n);
+        ASSERT_EQUAL(static_cast<size_t>(thrust::count_if(v.begin(), v.end(), is_13())), n);
+
+        destruction_counted::destructions = 0;
+    }
+
+    ASSERT_EQUAL(destruction_counted::destructions.load(), n);
+}
+DECLARE_UNITTEST(TestHostVectorDestroysLargeVectors);
+
+struct relocatable_counted
+{
+    static int copies;
+    static int destructions;
+
+    int value;
+
+    relocatable_counted(int value = 0) : value(value) {}
+    relocatable_counted(const relocatable_counted &other) : value(other.value) { ++copies; }
+    relocatable_counted &operator=(const relocatable_counted &other) { value = other.value; return *this; }
+    ~relocatable_counted() { ++destructions; }
+};
+
+int relocatable_counted::copies       = 0;
+int relocatable_counted::destructions = 0;
+
+THRUST_PROCLAIM_TRIVIALLY_RELOCATABLE(relocatable_counted);
+
+void TestVectorGrowthRelocatesTriviallyRelocatableTypes(void)
+{
+    thrust::host_vector<relocatable_counted> v;
+
+    for (int i = 0; i < 4; ++i)
+    {
+        v.push_back(relocatable_counted(i));
+    }
+
+    // growing the storage moves the elements without copying or destroying them
+    relocatable_counted::copies       = 0;
+    relocatable_counted::destructions = 0;
+
+    v.reserve(100);
+
+    ASSERT_EQUAL(relocatable_counted::copies, 0);
+    ASSERT_EQUAL(relocatable_counted::destructions, 0);
+
+    v.resize(200);
+    v.insert(v.begin() + 1, relocatable_counted(-1));
+
+    ASSERT_EQUAL(v.size(), 201lu);
+    ASSERT_EQUAL(v[0].value, 0);
+    ASSERT_EQUAL(v[1].value, -1);
+    ASSERT_EQUAL(v[2].value, 1);
+    ASSERT_EQUAL(v[4].value, 3);
+    ASSERT_EQUAL(v[5].value, 0);
+}
+DECLARE_UNITTEST(TestVectorGrowthRelocatesTriviallyRelocatableTypes);
+
+template <class Vector>
+void TestVectorEmplaceBack(void)
+{
+    typedef typename Vector::value_type T;
+
+    Vector v;
+
+    for (int i = 0; i < 10; ++i)
+    {
+        v.emplace_back(T(i));
+    }
+
+    ASSERT_EQUAL(v.size(), 10lu);
+    ASSERT_EQUAL(v.back(), T(9));
+
+    for (int i = 0; i < 10; ++i)
+    {
+        ASSERT_EQUAL(v[i], T(i));
+    }
+
+    // the argument refers to an element which the growth moves
+    v.shrink_to_fit();
+    v.push_back(v[0]);
+    v.emplace_back(v[1]);
+
+    ASSERT_EQUAL(v.size(), 12lu);
+    ASSERT_EQUAL(v[10], T(0));
+    ASSERT_EQUAL(v[11], T(1));
+}
+DECLARE_VECTOR_UNITTEST(TestVectorEmplaceBack);
+
+template <class Vector>
+void TestVectorAppend(void)
+{
+    typedef typename Vector::value_type T;
+
+    Vector v(3);
+    thrust::sequence(v.begin(), v.end());
+
+    std::vector<T> other(4);
+    other[0] = T(10); other[1] = T(11); other[2] = T(12); other[3] = T(13);
+
+    v.append(other.begin(), other.end());
+
+    ASSERT_EQUAL(v.size(), 7lu);
+    ASSERT_EQUAL(v[2], T(2));
+    ASSERT_EQUAL(v[3], T(10));
+    ASSERT_EQUAL(v[6], T(13));
+
+    // append a range of this vector, with and without reallocation
+    v.reserve(20);
+    v.append(v.begin(), v.begin() + 2);
+    v.shrink_to_fit();
+    v.append(v.begin(), v.end());
+
+    ASSERT_EQUAL(v.size(), 18lu);
+    ASSERT_EQUAL(v[7], T(0));
+    ASSERT_EQUAL(v[8], T(1));
+    ASSERT_EQUAL(v[9], T(0));
+    ASSERT_EQUAL(v[17], T(1));
+
+    // input iterators are appended one at a time
+    std::list<T> l(other.begin(), other.end());
+    v.append(l.begin(), l.end());
+
+    ASSERT_EQUAL(v.size(), 22lu);
+    ASSERT_EQUAL(v[18], T(10));
+    ASSERT_EQUAL(v[21], T(13));
+}
+DECLARE_VECTOR_UNITTEST(TestVectorAppend);
+
 
 
 template <class Vector>
@@ -28,6 +28,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/adjacent_difference.h>
 #include <thrust/system/detail/adl/adjacent_difference.h>
+#include <thrust/detail/profiling.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -38,6 +39,7 @@ OutputIterator adjacent_difference(const thrust::detail::execution_policy_base<D
                                    InputIterator first, InputIterator last,
                                    OutputIterator result)
 {
+  THRUST_PROFILE_ALGORITHM("adjacent_difference", exec, first, last);
   using thrust::system::detail::generic::adjacent_difference;
 
   return adjacent_difference(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result);
@@ -52,6 +54,7 @@ OutputIterator adjacent_difference(const thrust::detail::execution_policy_base<D
                                    OutputIterator result,
                                    BinaryFunction binary_op)
 {
+  THRUST_PROFILE_ALGORITHM("adjacent_difference", exec, first, last);
   using thrust::system::detail::generic::adjacent_difference;
 
   return adjacent_difference(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, binary_op);
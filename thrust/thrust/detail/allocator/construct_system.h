@@ -0,0 +1,74 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/allocator/allocator_traits.h>
+#include <thrust/iterator/detail/device_system_tag.h>
+
+#include <memory>
+
+THRUST_NAMESPACE_BEGIN
+namespace detail
+{
+namespace allocator_traits_detail
+{
+
+
+// the system that constructs and destroys the elements of an allocation
+template<typename Allocator>
+  struct construct_system
+{
+  typedef typename allocator_system<Allocator>::get_result_type get_result_type;
+
+  _CCCL_HOST_DEVICE
+  static get_result_type get(Allocator &a)
+  {
+    return allocator_system<Allocator>::get(a);
+  }
+};
+
+
+#if THRUST_HOST_SYSTEM == THRUST_HOST_SYSTEM_CPP \
+ && (THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP || THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB)
+// std::allocator's system is the sequential host system, but its memory is
+// also memory of the OpenMP and TBB device systems: construct and destroy in
+// parallel there
+template<typename U>
+  struct construct_system<std::allocator<U> >
+{
+  typedef thrust::device_system_tag get_result_type;
+
+  static get_result_type get(std::allocator<U> &)
+  {
+    return get_result_type();
+  }
+};
+#endif
+
+
+} // end allocator_traits_detail
+} // end detail
+THRUST_NAMESPACE_END
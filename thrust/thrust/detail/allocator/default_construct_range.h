@@ -36,6 +36,13 @@ _CCCL_HOST_DEVICE
 inline void default_construct_range(Allocator &a, Pointer p, Size n);
 
 
+// like default_construct_range, but leaves elements with a trivial default
+// constructor uninitialized
+template<typename Allocator, typename Pointer, typename Size>
+_CCCL_HOST_DEVICE
+inline void default_init_range(Allocator &a, Pointer p, Size n);
+
+
 } // end detail
 THRUST_NAMESPACE_END
 
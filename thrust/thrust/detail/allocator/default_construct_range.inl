@@ -26,6 +26,7 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/detail/allocator/allocator_traits.h>
+#include <thrust/detail/allocator/construct_system.h>
 #include <thrust/detail/type_traits.h>
 #include <thrust/detail/type_traits/pointer_traits.h>
 #include <thrust/for_each.h>
@@ -86,7 +87,7 @@ _CCCL_HOST_DEVICE
   >::type
     default_construct_range(Allocator &a, Pointer p, Size n)
 {
-  thrust::for_each_n(allocator_system<Allocator>::get(a), p, n, construct1_via_allocator<Allocator>(a));
+  thrust::for_each_n(construct_system<Allocator>::get(a), p, n, construct1_via_allocator<Allocator>(a));
 }
 
 
@@ -100,7 +101,33 @@ _CCCL_HOST_DEVICE
   >::type
     default_construct_range(Allocator &a, Pointer p, Size n)
 {
-  thrust::uninitialized_fill_n(allocator_system<Allocator>::get(a), p, n, typename pointer_element<Pointer>::type());
+  thrust::uninitialized_fill_n(construct_system<Allocator>::get(a), p, n, typename pointer_element<Pointer>::type());
+}
+
+
+template<typename Allocator, typename Pointer, typename Size>
+_CCCL_HOST_DEVICE
+  typename disable_if<
+    has_trivial_constructor<
+      typename pointer_element<Pointer>::type
+    >::value
+  >::type
+    default_init_range(Allocator &a, Pointer p, Size n)
+{
+  allocator_traits_detail::default_construct_range(a,p,n);
+}
+
+
+template<typename Allocator, typename Pointer, typename Size>
+_CCCL_HOST_DEVICE
+  typename enable_if<
+    has_trivial_constructor<
+      typename pointer_element<Pointer>::type
+    >::value
+  >::type
+    default_init_range(Allocator &, Pointer, Size)
+{
+  // no op
 }
 
 
@@ -115,6 +142,14 @@ _CCCL_HOST_DEVICE
 }
 
 
+template<typename Allocator, typename Pointer, typename Size>
+_CCCL_HOST_DEVICE
+  void default_init_range(Allocator &a, Pointer p, Size n)
+{
+  return allocator_traits_detail::default_init_range(a,p,n);
+}
+
+
 } // end detail
 THRUST_NAMESPACE_END
 
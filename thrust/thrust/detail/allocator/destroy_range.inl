@@ -28,6 +28,7 @@
 
 #include <thrust/detail/allocator/destroy_range.h>
 #include <thrust/detail/allocator/allocator_traits.h>
+#include <thrust/detail/allocator/construct_system.h>
 #include <thrust/detail/type_traits/pointer_traits.h>
 #include <thrust/for_each.h>
 #include <thrust/detail/memory_wrapper.h>
@@ -123,7 +124,7 @@ _CCCL_HOST_DEVICE
   typename enable_if_destroy_range_case1<Allocator,Pointer>::type
     destroy_range(Allocator &a, Pointer p, Size n)
 {
-  thrust::for_each_n(allocator_system<Allocator>::get(a), p, n, destroy_via_allocator<Allocator>(a));
+  thrust::for_each_n(construct_system<Allocator>::get(a), p, n, destroy_via_allocator<Allocator>(a));
 }
 
 
@@ -145,7 +146,7 @@ _CCCL_HOST_DEVICE
   typename enable_if_destroy_range_case2<Allocator,Pointer>::type
     destroy_range(Allocator &a, Pointer p, Size n)
 {
-  thrust::for_each_n(allocator_system<Allocator>::get(a), p, n, gozer());
+  thrust::for_each_n(construct_system<Allocator>::get(a), p, n, gozer());
 }
 
 
@@ -0,0 +1,84 @@
+/*
+ *  Copyright 2023 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/allocator/emplace_construct.h>
+#include <thrust/detail/allocator/allocator_traits.h>
+#include <thrust/detail/allocator/fill_construct_range.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/type_traits/pointer_traits.h>
+#include <thrust/system/cpp/detail/execution_policy.h>
+
+#include <utility>
+
+THRUST_NAMESPACE_BEGIN
+namespace detail
+{
+namespace allocator_traits_detail
+{
+
+// emplace_construct has 2 cases:
+// if the allocator's system is a host system:
+//   1. construct through a raw pointer to the object
+// else
+//   2. construct a temporary and copy it via fill_construct_range
+
+_CCCL_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy, typename Allocator, typename Pointer, typename... Args>
+_CCCL_HOST_DEVICE
+  void emplace_construct(const thrust::system::cpp::detail::execution_policy<DerivedPolicy> &,
+                         Allocator &a, Pointer p, Args&&... args)
+{
+  allocator_traits<Allocator>::construct(a, thrust::raw_pointer_cast(p), ::std::forward<Args>(args)...);
+}
+
+
+_CCCL_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy, typename Allocator, typename Pointer, typename... Args>
+_CCCL_HOST_DEVICE
+  void emplace_construct(const thrust::execution_policy<DerivedPolicy> &,
+                         Allocator &a, Pointer p, Args&&... args)
+{
+  typename pointer_element<Pointer>::type value(::std::forward<Args>(args)...);
+  fill_construct_range(a, p, 1, value);
+}
+
+
+} // end allocator_traits_detail
+
+
+template<typename Allocator, typename Pointer, typename... Args>
+_CCCL_HOST_DEVICE
+  void emplace_construct(Allocator &a, Pointer p, Args&&... args)
+{
+  allocator_traits_detail::emplace_construct(allocator_system<Allocator>::get(a), a, p, ::std::forward<Args>(args)...);
+}
+
+
+} // end detail
+THRUST_NAMESPACE_END
@@ -27,6 +27,7 @@
 #endif // no system header
 #include <thrust/detail/type_traits.h>
 #include <thrust/detail/allocator/allocator_traits.h>
+#include <thrust/detail/allocator/construct_system.h>
 #include <thrust/detail/type_traits/pointer_traits.h>
 #include <thrust/for_each.h>
 #include <thrust/uninitialized_fill.h>
@@ -87,7 +88,7 @@ _CCCL_HOST_DEVICE
   >::type
     fill_construct_range(Allocator &a, Pointer p, Size n, const T &value)
 {
-  thrust::for_each_n(allocator_system<Allocator>::get(a), p, n, construct2_via_allocator<Allocator,T>(a, value));
+  thrust::for_each_n(construct_system<Allocator>::get(a), p, n, construct2_via_allocator<Allocator,T>(a, value));
 }
 
 
@@ -102,7 +103,7 @@ _CCCL_HOST_DEVICE
   >::type
     fill_construct_range(Allocator &a, Pointer p, Size n, const T &value)
 {
-  thrust::uninitialized_fill_n(allocator_system<Allocator>::get(a), p, n, value);
+  thrust::uninitialized_fill_n(construct_system<Allocator>::get(a), p, n, value);
 }
 
 
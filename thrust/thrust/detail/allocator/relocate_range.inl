@@ -0,0 +1,71 @@
+/*
+ *  Copyright 2023 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/allocator/relocate_range.h>
+#include <thrust/detail/allocator/allocator_traits.h>
+#include <thrust/detail/copy.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/type_traits/is_trivially_relocatable.h>
+#include <thrust/detail/memory_wrapper.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace detail
+{
+
+
+template<typename Allocator, typename T>
+  struct is_trivially_relocatable_with_allocator
+    : integral_constant<
+        bool,
+        thrust::is_trivially_relocatable<T>::value &&
+        !allocator_traits_detail::has_member_construct2<Allocator,T,T>::value &&
+        !allocator_traits_detail::has_member_destroy<Allocator,T>::value
+      >
+{};
+
+
+// std::allocator::construct & destroy only invoke T's copy constructor &
+// destructor, which relocation is allowed to elide
+template<typename U, typename T>
+  struct is_trivially_relocatable_with_allocator<std::allocator<U>, T>
+    : thrust::is_trivially_relocatable<T>
+{};
+
+
+template<typename Allocator, typename Pointer, typename Size>
+_CCCL_HOST_DEVICE
+  Pointer relocate_range_n(Allocator &a, Pointer p, Size n, Pointer result)
+{
+  // trivially relocatable contiguous ranges are copied as raw bytes by
+  // every system's copy
+  return thrust::copy_n(allocator_system<Allocator>::get(a), p, n, result);
+}
+
+
+} // end detail
+THRUST_NAMESPACE_END
@@ -28,6 +28,7 @@
 #include <thrust/detail/allocator/temporary_allocator.h>
 #include <thrust/detail/temporary_buffer.h>
 #include <thrust/system/detail/bad_alloc.h>
+#include <thrust/detail/profiling.h>
 #include <cassert>
 
 #include <nv/target>
@@ -69,6 +70,8 @@ _CCCL_HOST_DEVICE
 #endif
   } // end if
 
+  THRUST_PROFILE_TEMPORARY_ALLOCATION(cnt * sizeof(T));
+
   return result.first;
 } // end temporary_allocator::allocate()
 
@@ -30,6 +30,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/binary_search.h>
 #include <thrust/system/detail/adl/binary_search.h>
+#include <thrust/detail/profiling.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -41,6 +42,7 @@ ForwardIterator lower_bound(const thrust::detail::execution_policy_base<DerivedP
                             ForwardIterator last,
                             const LessThanComparable &value)
 {
+    THRUST_PROFILE_ALGORITHM("lower_bound", exec, first, last);
     using thrust::system::detail::generic::lower_bound;
     return lower_bound(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value);
 }
@@ -55,6 +57,7 @@ ForwardIterator lower_bound(const thrust::detail::execution_policy_base<DerivedP
                             const T &value,
                             StrictWeakOrdering comp)
 {
+    THRUST_PROFILE_ALGORITHM("lower_bound", exec, first, last);
     using thrust::system::detail::generic::lower_bound;
     return lower_bound(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value, comp);
 }
@@ -68,6 +71,7 @@ ForwardIterator upper_bound(const thrust::detail::execution_policy_base<DerivedP
                             ForwardIterator last,
                             const LessThanComparable &value)
 {
+    THRUST_PROFILE_ALGORITHM("upper_bound", exec, first, last);
     using thrust::system::detail::generic::upper_bound;
     return upper_bound(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value);
 }
@@ -82,6 +86,7 @@ ForwardIterator upper_bound(const thrust::detail::execution_policy_base<DerivedP
                             const T &value,
                             StrictWeakOrdering comp)
 {
+    THRUST_PROFILE_ALGORITHM("upper_bound", exec, first, last);
     using thrust::system::detail::generic::upper_bound;
     return upper_bound(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value, comp);
 }
@@ -95,6 +100,7 @@ bool binary_search(const thrust::detail::execution_policy_base<DerivedPolicy> &e
                    ForwardIterator last,
                    const LessThanComparable& value)
 {
+    THRUST_PROFILE_ALGORITHM("binary_search", exec, first, last);
     using thrust::system::detail::generic::binary_search;
     return binary_search(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value);
 }
@@ -109,6 +115,7 @@ bool binary_search(const thrust::detail::execution_policy_base<DerivedPolicy> &e
                    const T& value,
                    StrictWeakOrdering comp)
 {
+    THRUST_PROFILE_ALGORITHM("binary_search", exec, first, last);
     using thrust::system::detail::generic::binary_search;
     return binary_search(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value, comp);
 }
@@ -124,6 +131,7 @@ equal_range(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
             const T& value,
             StrictWeakOrdering comp)
 {
+    THRUST_PROFILE_ALGORITHM("equal_range", exec, first, last);
     using thrust::system::detail::generic::equal_range;
     return equal_range(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value, comp);
 }
@@ -138,6 +146,7 @@ equal_range(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
             ForwardIterator last,
             const LessThanComparable& value)
 {
+    THRUST_PROFILE_ALGORITHM("equal_range", exec, first, last);
     using thrust::system::detail::generic::equal_range;
     return equal_range(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value);
 }
@@ -153,6 +162,7 @@ OutputIterator lower_bound(const thrust::detail::execution_policy_base<DerivedPo
                            InputIterator values_last,
                            OutputIterator output)
 {
+    THRUST_PROFILE_ALGORITHM("lower_bound", exec, first, last);
     using thrust::system::detail::generic::lower_bound;
     return lower_bound(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, values_first, values_last, output);
 }
@@ -169,6 +179,7 @@ OutputIterator lower_bound(const thrust::detail::execution_policy_base<DerivedPo
                            OutputIterator output,
                            StrictWeakOrdering comp)
 {
+    THRUST_PROFILE_ALGORITHM("lower_bound", exec, first, last);
     using thrust::system::detail::generic::lower_bound;
     return lower_bound(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, values_first, values_last, output, comp);
 }
@@ -184,6 +195,7 @@ OutputIterator upper_bound(const thrust::detail::execution_policy_base<DerivedPo
                            InputIterator values_last,
                            OutputIterator output)
 {
+    THRUST_PROFILE_ALGORITHM("upper_bound", exec, first, last);
     using thrust::system::detail::generic::upper_bound;
     return upper_bound(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, values_first, values_last, output);
 }
@@ -200,6 +212,7 @@ OutputIterator upper_bound(const thrust::detail::execution_policy_base<DerivedPo
                            OutputIterator output,
                            StrictWeakOrdering comp)
 {
+    THRUST_PROFILE_ALGORITHM("upper_bound", exec, first, last);
     using thrust::system::detail::generic::upper_bound;
     return upper_bound(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, values_first, values_last, output, comp);
 }
@@ -215,6 +228,7 @@ OutputIterator binary_search(const thrust::detail::execution_policy_base<Derived
                              InputIterator values_last,
                              OutputIterator output)
 {
+    THRUST_PROFILE_ALGORITHM("binary_search", exec, first, last);
     using thrust::system::detail::generic::binary_search;
     return binary_search(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, values_first, values_last, output);
 }
@@ -231,6 +245,7 @@ OutputIterator binary_search(const thrust::detail::execution_policy_base<Derived
                              OutputIterator output,
                              StrictWeakOrdering comp)
 {
+    THRUST_PROFILE_ALGORITHM("binary_search", exec, first, last);
     using thrust::system::detail::generic::binary_search;
     return binary_search(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, values_first, values_last, output, comp);
 }
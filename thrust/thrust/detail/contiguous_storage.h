@@ -29,6 +29,7 @@
 #include <thrust/iterator/detail/normal_iterator.h>
 #include <thrust/detail/execution_policy.h>
 #include <thrust/detail/allocator/allocator_traits.h>
+#include <thrust/detail/allocator/relocate_range.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -57,6 +58,9 @@ template<typename T, typename Alloc>
     typedef thrust::detail::normal_iterator<pointer>       iterator;
     typedef thrust::detail::normal_iterator<const_pointer> const_iterator;
 
+    // whether uninitialized_relocate may be used
+    typedef is_trivially_relocatable_with_allocator<Alloc,T> is_trivially_relocatable;
+
     _CCCL_EXEC_CHECK_DISABLE
     _CCCL_HOST_DEVICE
     explicit contiguous_storage(const allocator_type &alloc = allocator_type());
@@ -123,6 +127,9 @@ template<typename T, typename Alloc>
     _CCCL_HOST_DEVICE
     void default_construct_n(iterator first, size_type n);
 
+    _CCCL_HOST_DEVICE
+    void default_init_n(iterator first, size_type n);
+
     _CCCL_HOST_DEVICE
     void uninitialized_fill_n(iterator first, size_type n, const value_type &value);
 
@@ -148,6 +155,16 @@ template<typename T, typename Alloc>
                                   Size n,
                                   iterator result);
 
+    // constructs a single element at position from args
+    template<typename... Args>
+    _CCCL_HOST_DEVICE
+    void emplace_construct(iterator position, Args&&... args);
+
+    // moves [first, last) to result by copying bytes, leaving [first, last)
+    // uninitialized; requires is_trivially_relocatable
+    _CCCL_HOST_DEVICE
+    iterator uninitialized_relocate(iterator first, iterator last, iterator result);
+
     _CCCL_HOST_DEVICE
     void destroy(iterator first, iterator last);
 
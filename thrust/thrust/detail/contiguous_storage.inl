@@ -31,6 +31,7 @@
 #include <thrust/detail/allocator/copy_construct_range.h>
 #include <thrust/detail/allocator/default_construct_range.h>
 #include <thrust/detail/allocator/destroy_range.h>
+#include <thrust/detail/allocator/emplace_construct.h>
 #include <thrust/detail/allocator/fill_construct_range.h>
 
 #include <nv/target>
@@ -264,6 +265,14 @@ _CCCL_HOST_DEVICE
   default_construct_range(m_allocator, first.base(), n);
 } // end contiguous_storage::default_construct_n()
 
+template<typename T, typename Alloc>
+_CCCL_HOST_DEVICE
+  void contiguous_storage<T,Alloc>
+    ::default_init_n(iterator first, size_type n)
+{
+  default_init_range(m_allocator, first.base(), n);
+} // end contiguous_storage::default_init_n()
+
 template<typename T, typename Alloc>
 _CCCL_HOST_DEVICE
   void contiguous_storage<T,Alloc>
@@ -318,6 +327,24 @@ template<typename T, typename Alloc>
   return iterator(copy_construct_range_n(from_system, m_allocator, first, n, result.base()));
 } // end contiguous_storage::uninitialized_copy_n()
 
+template<typename T, typename Alloc>
+  template<typename... Args>
+  _CCCL_HOST_DEVICE
+    void contiguous_storage<T,Alloc>
+      ::emplace_construct(iterator position, Args&&... args)
+{
+  thrust::detail::emplace_construct(m_allocator, position.base(), ::std::forward<Args>(args)...);
+} // end contiguous_storage::emplace_construct()
+
+template<typename T, typename Alloc>
+_CCCL_HOST_DEVICE
+  typename contiguous_storage<T,Alloc>::iterator
+    contiguous_storage<T,Alloc>
+      ::uninitialized_relocate(iterator first, iterator last, iterator result)
+{
+  return iterator(relocate_range_n(m_allocator, first.base(), last - first, result.base()));
+} // end contiguous_storage::uninitialized_relocate()
+
 template<typename T, typename Alloc>
 _CCCL_HOST_DEVICE
   void contiguous_storage<T,Alloc>
@@ -29,6 +29,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/copy.h>
 #include <thrust/system/detail/adl/copy.h>
+#include <thrust/detail/profiling.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -40,6 +41,7 @@ _CCCL_HOST_DEVICE
                       InputIterator last,
                       OutputIterator result)
 {
+  THRUST_PROFILE_ALGORITHM("copy", exec, first, last);
   using thrust::system::detail::generic::copy;
   return copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result);
 } // end copy()
@@ -53,6 +55,7 @@ _CCCL_HOST_DEVICE
                         Size n,
                         OutputIterator result)
 {
+  THRUST_PROFILE_ALGORITHM_N("copy_n", exec, n);
   using thrust::system::detail::generic::copy_n;
   return copy_n(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, n, result);
 } // end copy_n()
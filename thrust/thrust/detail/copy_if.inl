@@ -30,6 +30,7 @@
 #include <thrust/system/detail/generic/copy_if.h>
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/adl/copy_if.h>
+#include <thrust/detail/profiling.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -45,6 +46,7 @@ _CCCL_HOST_DEVICE
                          OutputIterator result,
                          Predicate pred)
 {
+  THRUST_PROFILE_ALGORITHM("copy_if", exec, first, last);
   using thrust::system::detail::generic::copy_if;
   return copy_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, pred);
 } // end copy_if()
@@ -64,6 +66,7 @@ _CCCL_HOST_DEVICE
                          OutputIterator result,
                          Predicate pred)
 {
+  THRUST_PROFILE_ALGORITHM("copy_if", exec, first, last);
   using thrust::system::detail::generic::copy_if;
   return copy_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, result, pred);
 } // end copy_if()
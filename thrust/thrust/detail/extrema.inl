@@ -30,6 +30,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/extrema.h>
 #include <thrust/system/detail/adl/extrema.h>
+#include <thrust/detail/profiling.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -38,6 +39,7 @@ template<typename DerivedPolicy, typename ForwardIterator>
 _CCCL_HOST_DEVICE
 ForwardIterator min_element(const thrust::detail::execution_policy_base<DerivedPolicy> &exec, ForwardIterator first, ForwardIterator last)
 {
+  THRUST_PROFILE_ALGORITHM("min_element", exec, first, last);
   using thrust::system::detail::generic::min_element;
   return min_element(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end min_element()
@@ -48,6 +50,7 @@ template<typename DerivedPolicy, typename ForwardIterator, typename BinaryPredic
 _CCCL_HOST_DEVICE
 ForwardIterator min_element(const thrust::detail::execution_policy_base<DerivedPolicy> &exec, ForwardIterator first, ForwardIterator last, BinaryPredicate comp)
 {
+  THRUST_PROFILE_ALGORITHM("min_element", exec, first, last);
   using thrust::system::detail::generic::min_element;
   return min_element(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, comp);
 } // end min_element()
@@ -58,6 +61,7 @@ template<typename DerivedPolicy, typename ForwardIterator>
 _CCCL_HOST_DEVICE
 ForwardIterator max_element(const thrust::detail::execution_policy_base<DerivedPolicy> &exec, ForwardIterator first, ForwardIterator last)
 {
+  THRUST_PROFILE_ALGORITHM("max_element", exec, first, last);
   using thrust::system::detail::generic::max_element;
   return max_element(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end max_element()
@@ -68,6 +72,7 @@ template<typename DerivedPolicy, typename ForwardIterator, typename BinaryPredic
 _CCCL_HOST_DEVICE
 ForwardIterator max_element(const thrust::detail::execution_policy_base<DerivedPolicy> &exec, ForwardIterator first, ForwardIterator last, BinaryPredicate comp)
 {
+  THRUST_PROFILE_ALGORITHM("max_element", exec, first, last);
   using thrust::system::detail::generic::max_element;
   return max_element(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, comp);
 } // end max_element()
@@ -78,6 +83,7 @@ template<typename DerivedPolicy, typename ForwardIterator>
 _CCCL_HOST_DEVICE
 thrust::pair<ForwardIterator,ForwardIterator> minmax_element(const thrust::detail::execution_policy_base<DerivedPolicy> &exec, ForwardIterator first, ForwardIterator last)
 {
+  THRUST_PROFILE_ALGORITHM("minmax_element", exec, first, last);
   using thrust::system::detail::generic::minmax_element;
   return minmax_element(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end minmax_element()
@@ -88,6 +94,7 @@ template<typename DerivedPolicy, typename ForwardIterator, typename BinaryPredic
 _CCCL_HOST_DEVICE
 thrust::pair<ForwardIterator,ForwardIterator> minmax_element(const thrust::detail::execution_policy_base<DerivedPolicy> &exec, ForwardIterator first, ForwardIterator last, BinaryPredicate comp)
 {
+  THRUST_PROFILE_ALGORITHM("minmax_element", exec, first, last);
   using thrust::system::detail::generic::minmax_element;
   return minmax_element(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, comp);
 } // end minmax_element()
@@ -29,6 +29,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/find.h>
 #include <thrust/system/detail/adl/find.h>
+#include <thrust/detail/profiling.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -40,6 +41,7 @@ InputIterator find(const thrust::detail::execution_policy_base<DerivedPolicy> &e
                    InputIterator last,
                    const T& value)
 {
+  THRUST_PROFILE_ALGORITHM("find", exec, first, last);
   using thrust::system::detail::generic::find;
   return find(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value);
 } // end find()
@@ -53,6 +55,7 @@ InputIterator find_if(const thrust::detail::execution_policy_base<DerivedPolicy>
                       InputIterator last,
                       Predicate pred)
 {
+  THRUST_PROFILE_ALGORITHM("find_if", exec, first, last);
   using thrust::system::detail::generic::find_if;
   return find_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end find_if()
@@ -66,6 +69,7 @@ InputIterator find_if_not(const thrust::detail::execution_policy_base<DerivedPol
                           InputIterator last,
                           Predicate pred)
 {
+  THRUST_PROFILE_ALGORITHM("find_if_not", exec, first, last);
   using thrust::system::detail::generic::find_if_not;
   return find_if_not(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end find_if_not()
@@ -30,6 +30,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/for_each.h>
 #include <thrust/system/detail/adl/for_each.h>
+#include <thrust/detail/profiling.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -43,6 +44,7 @@ _CCCL_HOST_DEVICE
                          InputIterator last,
                          UnaryFunction f)
 {
+  THRUST_PROFILE_ALGORITHM("for_each", exec, first, last);
   using thrust::system::detail::generic::for_each;
 
   return for_each(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, f);
@@ -70,6 +72,7 @@ _CCCL_HOST_DEVICE
                            Size n,
                            UnaryFunction f)
 {
+  THRUST_PROFILE_ALGORITHM_N("for_each_n", exec, n);
   using thrust::system::detail::generic::for_each_n;
 
   return for_each_n(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, n, f);
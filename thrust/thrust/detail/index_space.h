@@ -0,0 +1,273 @@
+/*
+ *  Copyright 2023 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_STD_VER >= 2014
+
+#include <thrust/detail/type_traits.h>
+
+#include <cuda/std/array>
+#include <cuda/std/cstddef>
+#include <cuda/std/mdspan>
+#include <cuda/std/utility>
+
+THRUST_NAMESPACE_BEGIN
+namespace detail
+{
+
+// Column-major layouts store the first index contiguously; every other layout
+// is traversed in row-major order.
+template <typename Layout>
+struct is_column_major_layout : false_type
+{};
+
+template <>
+struct is_column_major_layout<::cuda::std::layout_left> : true_type
+{};
+
+template <::cuda::std::size_t PaddingValue>
+struct is_column_major_layout<::cuda::std::layout_left_padded<PaddingValue> > : true_type
+{};
+
+// calls f(idx[0], idx[1], ..., idx[N-1])
+template <typename Function, typename IndexArray, ::cuda::std::size_t... Is>
+_CCCL_HOST_DEVICE
+auto apply_index(Function &f, const IndexArray &idx, ::cuda::std::index_sequence<Is...>)
+  -> decltype(f(idx[Is]...))
+{
+  return f(idx[Is]...);
+}
+
+// index_space describes the index space of an extents object, traversed
+// with the index along the dimension fastest_rank() varying fastest.
+//
+// The space is cut into lines: runs of indices along the fastest dimension.
+// Backends partition the space into contiguous ranges of lines, and
+// for_each_in_lines decodes the multidimensional index once per range and
+// then steps through it like an odometer, so that visiting an element costs
+// no division or modulo.
+template <typename Extents, bool ColumnMajor = false>
+class index_space
+{
+public:
+  typedef Extents                         extents_type;
+  typedef typename Extents::index_type    index_type;
+  typedef typename Extents::rank_type     rank_type;
+
+  // one element too many for rank 0, which keeps fastest_rank() addressable
+  typedef ::cuda::std::array<index_type, (Extents::rank() == 0 ? 1 : Extents::rank())> index_array;
+
+  _CCCL_HOST_DEVICE
+  explicit index_space(const extents_type &extents)
+    : m_extents(extents)
+  {}
+
+  _CCCL_HOST_DEVICE
+  const extents_type &extents() const
+  {
+    return m_extents;
+  }
+
+  _CCCL_HOST_DEVICE
+  static constexpr rank_type rank()
+  {
+    return Extents::rank();
+  }
+
+  _CCCL_HOST_DEVICE
+  static constexpr rank_type fastest_rank()
+  {
+    return (ColumnMajor || rank() == 0) ? 0 : rank() - 1;
+  }
+
+  // the number of elements in the space
+  _CCCL_HOST_DEVICE
+  index_type size() const
+  {
+    index_type result = 1;
+    for (rank_type r = 0; r != rank(); ++r)
+    {
+      result *= m_extents.extent(r);
+    }
+    return result;
+  }
+
+  _CCCL_HOST_DEVICE
+  index_type line_size() const
+  {
+    return rank() == 0 ? index_type(1) : m_extents.extent(fastest_rank());
+  }
+
+  _CCCL_HOST_DEVICE
+  index_type num_lines() const
+  {
+    const index_type n = line_size();
+    return n == 0 ? index_type(0) : size() / n;
+  }
+
+  // converts the position of an element in traversal order to its index
+  _CCCL_HOST_DEVICE
+  void decode(index_type linear, index_array &idx) const
+  {
+    idx[0] = 0;
+    for (rank_type i = 0; i != rank(); ++i)
+    {
+      const rank_type r = dimension(i);
+      const index_type e = m_extents.extent(r);
+      idx[r] = linear % e;
+      linear /= e;
+    }
+  }
+
+  // calls f(i0, i1, ..., iN-1) for the index of every element of lines
+  // [first_line, last_line), in traversal order
+  template <typename Function>
+  _CCCL_HOST_DEVICE
+  void for_each_in_lines(index_type first_line, index_type last_line, Function &f) const
+  {
+    if (first_line >= last_line)
+    {
+      return;
+    }
+
+    const index_type n = line_size();
+
+    index_array idx;
+    decode(first_line * n, idx);
+
+    for (index_type line = first_line; line != last_line; ++line)
+    {
+      for (index_type j = 0; j != n; ++j)
+      {
+        idx[fastest_rank()] = j;
+        apply(f, idx);
+      }
+      next_line(idx);
+    }
+  }
+
+  // folds f(i0, i1, ..., iN-1) over the elements of lines
+  // [first_line, last_line) into init, from left to right
+  template <typename OutputType, typename Function, typename BinaryFunction>
+  _CCCL_HOST_DEVICE
+  OutputType reduce_lines(index_type first_line,
+                          index_type last_line,
+                          Function &f,
+                          OutputType init,
+                          BinaryFunction &binary_op) const
+  {
+    if (first_line >= last_line)
+    {
+      return init;
+    }
+
+    index_array idx;
+    decode(first_line * line_size(), idx);
+
+    return fold(idx, 0, first_line, last_line, f, init, binary_op);
+  }
+
+  // like reduce_lines, but seeded with the first element of the lines, which
+  // must not be empty
+  template <typename OutputType, typename Function, typename BinaryFunction>
+  _CCCL_HOST_DEVICE
+  OutputType reduce_lines(index_type first_line,
+                          index_type last_line,
+                          Function &f,
+                          BinaryFunction &binary_op) const
+  {
+    index_array idx;
+    decode(first_line * line_size(), idx);
+
+    OutputType init = apply(f, idx);
+
+    return fold(idx, 1, first_line, last_line, f, init, binary_op);
+  }
+
+  template <typename Function>
+  _CCCL_HOST_DEVICE
+  static auto apply(Function &f, const index_array &idx)
+    -> decltype(apply_index(f, idx, ::cuda::std::make_index_sequence<Extents::rank()>()))
+  {
+    return apply_index(f, idx, ::cuda::std::make_index_sequence<Extents::rank()>());
+  }
+
+private:
+  // the dimension which is i-th fastest in traversal order
+  _CCCL_HOST_DEVICE
+  static constexpr rank_type dimension(rank_type i)
+  {
+    return ColumnMajor ? i : rank() - 1 - i;
+  }
+
+  // advances idx, whose fastest index is ignored, to the start of the next line
+  _CCCL_HOST_DEVICE
+  void next_line(index_array &idx) const
+  {
+    for (rank_type i = 1; i < rank(); ++i)
+    {
+      const rank_type r = dimension(i);
+      if (++idx[r] != m_extents.extent(r))
+      {
+        return;
+      }
+      idx[r] = 0;
+    }
+  }
+
+  template <typename OutputType, typename Function, typename BinaryFunction>
+  _CCCL_HOST_DEVICE
+  OutputType fold(index_array &idx,
+                  index_type first_j,
+                  index_type first_line,
+                  index_type last_line,
+                  Function &f,
+                  OutputType sum,
+                  BinaryFunction &binary_op) const
+  {
+    const index_type n = line_size();
+
+    for (index_type line = first_line; line != last_line; ++line, first_j = 0)
+    {
+      for (index_type j = first_j; j < n; ++j)
+      {
+        idx[fastest_rank()] = j;
+        sum = binary_op(sum, apply(f, idx));
+      }
+      next_line(idx);
+    }
+
+    return sum;
+  }
+
+  extents_type m_extents;
+};
+
+} // end namespace detail
+THRUST_NAMESPACE_END
+
+#endif // _CCCL_STD_VER >= 2014
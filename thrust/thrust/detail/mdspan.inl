@@ -0,0 +1,223 @@
+/*
+ *  Copyright 2023 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/mdspan.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/iterator/detail/device_system_tag.h>
+#include <thrust/detail/index_space.h>
+#include <thrust/system/detail/generic/select_system.h>
+#include <thrust/system/detail/generic/for_each_index.h>
+#include <thrust/system/detail/adl/for_each_index.h>
+#include <thrust/detail/profiling.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace detail
+{
+
+template <typename Layout>
+struct index_space_for_layout
+{
+  template <typename Extents>
+  struct apply
+  {
+    typedef index_space<Extents, is_column_major_layout<Layout>::value> type;
+  };
+};
+
+// the element of an mdspan, whatever its accessor and operator() flavor
+template <typename Mdspan, typename... Indices>
+_CCCL_HOST_DEVICE
+typename Mdspan::reference mdspan_access(const Mdspan &x, Indices... idx)
+{
+  return x.accessor().access(x.data_handle(), x.mapping()(idx...));
+}
+
+template <typename InMdspan, typename OutMdspan, typename UnaryFunction>
+struct mdspan_transform_functor
+{
+  InMdspan in;
+  OutMdspan out;
+  UnaryFunction op;
+
+  _CCCL_EXEC_CHECK_DISABLE
+  template <typename... Indices>
+  _CCCL_HOST_DEVICE
+  void operator()(Indices... idx)
+  {
+    mdspan_access(out, idx...) = op(mdspan_access(in, idx...));
+  }
+};
+
+template <typename Mdspan>
+struct mdspan_element_functor
+{
+  Mdspan x;
+
+  template <typename... Indices>
+  _CCCL_HOST_DEVICE
+  typename Mdspan::reference operator()(Indices... idx) const
+  {
+    return mdspan_access(x, idx...);
+  }
+};
+
+} // end namespace detail
+
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename IndexType, ::cuda::std::size_t... Extents, typename Function>
+_CCCL_HOST_DEVICE
+void for_each_index(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                    const ::cuda::std::extents<IndexType, Extents...> &extents,
+                    Function f)
+{
+  using thrust::system::detail::generic::for_each_index;
+
+  typedef thrust::detail::index_space< ::cuda::std::extents<IndexType, Extents...> > space_type;
+
+  THRUST_PROFILE_ALGORITHM_N("for_each_index", exec, space_type(extents).size());
+
+  for_each_index(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), space_type(extents), f);
+} // end for_each_index()
+
+
+template <typename IndexType, ::cuda::std::size_t... Extents, typename Function>
+void for_each_index(const ::cuda::std::extents<IndexType, Extents...> &extents,
+                    Function f)
+{
+  thrust::device_system_tag system;
+  thrust::for_each_index(system, extents, f);
+} // end for_each_index()
+
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename T, typename InExtents, typename InLayout, typename InAccessor,
+          typename U, typename OutExtents, typename OutLayout, typename OutAccessor,
+          typename UnaryFunction>
+_CCCL_HOST_DEVICE
+void transform(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+               const ::cuda::std::mdspan<T, InExtents, InLayout, InAccessor> &in,
+               const ::cuda::std::mdspan<U, OutExtents, OutLayout, OutAccessor> &out,
+               UnaryFunction op)
+{
+  using thrust::system::detail::generic::for_each_index;
+
+  typedef ::cuda::std::mdspan<T, InExtents, InLayout, InAccessor>     in_type;
+  typedef ::cuda::std::mdspan<U, OutExtents, OutLayout, OutAccessor>  out_type;
+  typedef typename thrust::detail::index_space_for_layout<OutLayout>::template apply<OutExtents>::type space_type;
+
+  THRUST_PROFILE_ALGORITHM_N("transform", exec, out.size());
+
+  thrust::detail::mdspan_transform_functor<in_type, out_type, UnaryFunction> f = {in, out, op};
+
+  for_each_index(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), space_type(out.extents()), f);
+} // end transform()
+
+
+template <typename T, typename InExtents, typename InLayout, typename InAccessor,
+          typename U, typename OutExtents, typename OutLayout, typename OutAccessor,
+          typename UnaryFunction>
+void transform(const ::cuda::std::mdspan<T, InExtents, InLayout, InAccessor> &in,
+               const ::cuda::std::mdspan<U, OutExtents, OutLayout, OutAccessor> &out,
+               UnaryFunction op)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<typename InAccessor::data_handle_type>::type  System1;
+  typedef typename thrust::iterator_system<typename OutAccessor::data_handle_type>::type System2;
+
+  System1 system1;
+  System2 system2;
+
+  thrust::transform(select_system(system1,system2), in, out, op);
+} // end transform()
+
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename T, typename Extents, typename Layout, typename Accessor,
+          typename OutputType, typename BinaryFunction>
+_CCCL_HOST_DEVICE
+OutputType reduce(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                  const ::cuda::std::mdspan<T, Extents, Layout, Accessor> &x,
+                  OutputType init,
+                  BinaryFunction binary_op)
+{
+  using thrust::system::detail::generic::transform_reduce_index;
+
+  typedef ::cuda::std::mdspan<T, Extents, Layout, Accessor> mdspan_type;
+  typedef typename thrust::detail::index_space_for_layout<Layout>::template apply<Extents>::type space_type;
+
+  THRUST_PROFILE_ALGORITHM_N("reduce", exec, x.size());
+
+  thrust::detail::mdspan_element_functor<mdspan_type> f = {x};
+
+  return transform_reduce_index(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), space_type(x.extents()), f, init, binary_op);
+} // end reduce()
+
+
+template <typename DerivedPolicy,
+          typename T, typename Extents, typename Layout, typename Accessor,
+          typename OutputType>
+_CCCL_HOST_DEVICE
+OutputType reduce(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                  const ::cuda::std::mdspan<T, Extents, Layout, Accessor> &x,
+                  OutputType init)
+{
+  return thrust::reduce(exec, x, init, thrust::plus<OutputType>());
+} // end reduce()
+
+
+template <typename T, typename Extents, typename Layout, typename Accessor,
+          typename OutputType, typename BinaryFunction>
+OutputType reduce(const ::cuda::std::mdspan<T, Extents, Layout, Accessor> &x,
+                  OutputType init,
+                  BinaryFunction binary_op)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<typename Accessor::data_handle_type>::type System;
+
+  System system;
+
+  return thrust::reduce(select_system(system), x, init, binary_op);
+} // end reduce()
+
+
+template <typename T, typename Extents, typename Layout, typename Accessor,
+          typename OutputType>
+OutputType reduce(const ::cuda::std::mdspan<T, Extents, Layout, Accessor> &x,
+                  OutputType init)
+{
+  return thrust::reduce(x, init, thrust::plus<OutputType>());
+} // end reduce()
+
+
+THRUST_NAMESPACE_END
+
@@ -31,6 +31,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/merge.h>
 #include <thrust/system/detail/adl/merge.h>
+#include <thrust/detail/profiling.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -47,6 +48,7 @@ _CCCL_HOST_DEVICE
                        InputIterator2 last2,
                        OutputIterator result)
 {
+  THRUST_PROFILE_ALGORITHM("merge", exec, first1, last1);
   using thrust::system::detail::generic::merge;
   return merge(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result);
 } // end merge()
@@ -67,6 +69,7 @@ _CCCL_HOST_DEVICE
                        OutputIterator result,
                        StrictWeakCompare comp)
 {
+  THRUST_PROFILE_ALGORITHM("merge", exec, first1, last1);
   using thrust::system::detail::generic::merge;
   return merge(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result, comp);
 } // end merge()
@@ -83,6 +86,7 @@ _CCCL_HOST_DEVICE
                  OutputIterator1 keys_result,
                  OutputIterator2 values_result)
 {
+  THRUST_PROFILE_ALGORITHM("merge_by_key", exec, keys_first1, keys_last1);
   using thrust::system::detail::generic::merge_by_key;
   return merge_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first1, keys_last1, keys_first2, keys_last2, values_first1, values_first2, keys_result, values_result);
 } // end merge_by_key()
@@ -100,6 +104,7 @@ _CCCL_HOST_DEVICE
                  OutputIterator2 values_result,
                  Compare comp)
 {
+  THRUST_PROFILE_ALGORITHM("merge_by_key", exec, keys_first1, keys_last1);
   using thrust::system::detail::generic::merge_by_key;
   return merge_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first1, keys_last1, keys_first2, keys_last2, values_first1, values_first2, keys_result, values_result, comp);
 } // end merge_by_key()
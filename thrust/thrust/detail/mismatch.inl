@@ -30,6 +30,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/mismatch.h>
 #include <thrust/system/detail/adl/mismatch.h>
+#include <thrust/detail/profiling.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -41,6 +42,7 @@ thrust::pair<InputIterator1, InputIterator2> mismatch(const thrust::detail::exec
                                                       InputIterator1 last1,
                                                       InputIterator2 first2)
 {
+  THRUST_PROFILE_ALGORITHM("mismatch", exec, first1, last1);
   using thrust::system::detail::generic::mismatch;
   return mismatch(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2);
 } // end mismatch()
@@ -55,6 +57,7 @@ thrust::pair<InputIterator1, InputIterator2> mismatch(const thrust::detail::exec
                                                       InputIterator2 first2,
                                                       BinaryPredicate pred)
 {
+  THRUST_PROFILE_ALGORITHM("mismatch", exec, first1, last1);
   using thrust::system::detail::generic::mismatch;
   return mismatch(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, pred);
 } // end mismatch()
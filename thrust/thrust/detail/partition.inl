@@ -30,6 +30,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/partition.h>
 #include <thrust/system/detail/adl/partition.h>
+#include <thrust/detail/profiling.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -43,6 +44,7 @@ _CCCL_HOST_DEVICE
                             ForwardIterator last,
                             Predicate pred)
 {
+  THRUST_PROFILE_ALGORITHM("partition", exec, first, last);
   using thrust::system::detail::generic::partition;
   return partition(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end partition()
@@ -60,6 +62,7 @@ _CCCL_HOST_DEVICE
                             InputIterator stencil,
                             Predicate pred)
 {
+  THRUST_PROFILE_ALGORITHM("partition", exec, first, last);
   using thrust::system::detail::generic::partition;
   return partition(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, pred);
 } // end partition()
@@ -80,6 +83,7 @@ _CCCL_HOST_DEVICE
                    OutputIterator2 out_false,
                    Predicate pred)
 {
+  THRUST_PROFILE_ALGORITHM("partition_copy", exec, first, last);
   using thrust::system::detail::generic::partition_copy;
   return partition_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, out_true, out_false, pred);
 } // end partition_copy()
@@ -102,6 +106,7 @@ _CCCL_HOST_DEVICE
                    OutputIterator2 out_false,
                    Predicate pred)
 {
+  THRUST_PROFILE_ALGORITHM("partition_copy", exec, first, last);
   using thrust::system::detail::generic::partition_copy;
   return partition_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, out_true, out_false, pred);
 } // end partition_copy()
@@ -117,6 +122,7 @@ _CCCL_HOST_DEVICE
                                    ForwardIterator last,
                                    Predicate pred)
 {
+  THRUST_PROFILE_ALGORITHM("stable_partition", exec, first, last);
   using thrust::system::detail::generic::stable_partition;
   return stable_partition(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end stable_partition()
@@ -134,6 +140,7 @@ _CCCL_HOST_DEVICE
                                    InputIterator stencil,
                                    Predicate pred)
 {
+  THRUST_PROFILE_ALGORITHM("stable_partition", exec, first, last);
   using thrust::system::detail::generic::stable_partition;
   return stable_partition(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, pred);
 } // end stable_partition()
@@ -154,6 +161,7 @@ _CCCL_HOST_DEVICE
                           OutputIterator2 out_false,
                           Predicate pred)
 {
+  THRUST_PROFILE_ALGORITHM("stable_partition_copy", exec, first, last);
   using thrust::system::detail::generic::stable_partition_copy;
   return stable_partition_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, out_true, out_false, pred);
 } // end stable_partition_copy()
@@ -176,6 +184,7 @@ _CCCL_HOST_DEVICE
                           OutputIterator2 out_false,
                           Predicate pred)
 {
+  THRUST_PROFILE_ALGORITHM("stable_partition_copy", exec, first, last);
   using thrust::system::detail::generic::stable_partition_copy;
   return stable_partition_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, out_true, out_false, pred);
 } // end stable_partition_copy()
@@ -189,6 +198,7 @@ _CCCL_HOST_DEVICE
                                   ForwardIterator last,
                                   Predicate pred)
 {
+  THRUST_PROFILE_ALGORITHM("partition_point", exec, first, last);
   using thrust::system::detail::generic::partition_point;
   return partition_point(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end partition_point()
@@ -202,6 +212,7 @@ _CCCL_HOST_DEVICE
                       InputIterator last,
                       Predicate pred)
 {
+  THRUST_PROFILE_ALGORITHM("is_partitioned", exec, first, last);
   using thrust::system::detail::generic::is_partitioned;
   return is_partitioned(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end is_partitioned()
@@ -0,0 +1,279 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+// The instrumentation of the algorithm entry points. Unless
+// THRUST_ENABLE_PROFILING is defined, the macros below expand to nothing.
+//
+// THRUST_PROFILE_ALGORITHM(name, exec, first, last) and
+// THRUST_PROFILE_ALGORITHM_N(name, exec, n) time the rest of the enclosing
+// block and report it to the installed thrust::profiling::callback.
+// THRUST_PROFILE_TEMPORARY_ALLOCATION(bytes) attributes an allocation of
+// temporary storage to the innermost profiled algorithm.
+
+#if defined(THRUST_ENABLE_PROFILING) && _CCCL_STD_VER >= 2011
+
+#include <thrust/detail/execution_policy.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/profiling.h>
+
+#include <nv/target>
+
+#include <chrono>
+#include <cstddef>
+#include <thread>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+template <typename> struct execution_policy;
+} // end sequential
+} // end detail
+namespace cpp
+{
+namespace detail
+{
+template <typename> struct execution_policy;
+} // end detail
+} // end cpp
+namespace omp
+{
+namespace detail
+{
+template <typename> struct execution_policy;
+} // end detail
+} // end omp
+namespace tbb
+{
+namespace detail
+{
+template <typename> struct execution_policy;
+} // end detail
+} // end tbb
+} // end system
+
+namespace cuda_cub
+{
+template <class> struct execution_policy;
+} // end cuda_cub
+
+namespace detail
+{
+namespace profiling
+{
+
+// The policies of a system derive from its execution_policy template, so
+// overload resolution picks the most derived system. Declarations suffice
+// because the policy is only bound to a reference.
+template <typename DerivedPolicy>
+const char *system_name(const thrust::detail::execution_policy_base<DerivedPolicy> &)
+{
+  return "unknown";
+}
+
+template <typename DerivedPolicy>
+const char *system_name(const thrust::system::detail::sequential::execution_policy<DerivedPolicy> &)
+{
+  return "seq";
+}
+
+template <typename DerivedPolicy>
+const char *system_name(const thrust::system::cpp::detail::execution_policy<DerivedPolicy> &)
+{
+  return "cpp";
+}
+
+template <typename DerivedPolicy>
+const char *system_name(const thrust::system::omp::detail::execution_policy<DerivedPolicy> &)
+{
+  return "omp";
+}
+
+template <typename DerivedPolicy>
+const char *system_name(const thrust::system::tbb::detail::execution_policy<DerivedPolicy> &)
+{
+  return "tbb";
+}
+
+template <typename DerivedPolicy>
+const char *system_name(const thrust::cuda_cub::execution_policy<DerivedPolicy> &)
+{
+  return "cuda";
+}
+
+// counting the elements of other ranges would cost a traversal, or consume
+// the range
+template <typename Iterator>
+std::size_t range_size(Iterator first, Iterator last, thrust::random_access_traversal_tag)
+{
+  return static_cast<std::size_t>(last - first);
+}
+
+template <typename Iterator>
+std::size_t range_size(Iterator, Iterator, thrust::incrementable_traversal_tag)
+{
+  return 0;
+}
+
+template <typename Iterator>
+std::size_t range_size(Iterator first, Iterator last)
+{
+  return range_size(first, last, typename thrust::iterator_traversal<Iterator>::type());
+}
+
+// A profiled call on the host. Scopes nest per thread, so that temporary
+// storage is attributed to the innermost algorithm and the depth of nested
+// algorithms is known. No state is kept when no callback is installed.
+class scope
+{
+public:
+  template <typename DerivedPolicy, typename Iterator>
+  _CCCL_HOST_DEVICE
+  scope(const char *algorithm,
+        const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+        Iterator first,
+        Iterator last)
+      : m_active(false)
+  {
+    NV_IF_TARGET(NV_IS_HOST, (
+      begin(algorithm, system_name(thrust::detail::derived_cast(exec)), range_size(first, last));
+    ), (
+      (void)algorithm; (void)exec; (void)first; (void)last;
+    ));
+  }
+
+  template <typename DerivedPolicy, typename Size>
+  _CCCL_HOST_DEVICE
+  scope(const char *algorithm,
+        const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+        Size n)
+      : m_active(false)
+  {
+    NV_IF_TARGET(NV_IS_HOST, (
+      begin(algorithm, system_name(thrust::detail::derived_cast(exec)), n > 0 ? static_cast<std::size_t>(n) : 0);
+    ), (
+      (void)algorithm; (void)exec; (void)n;
+    ));
+  }
+
+  _CCCL_HOST_DEVICE
+  ~scope()
+  {
+    NV_IF_TARGET(NV_IS_HOST, (
+      if (m_active)
+      {
+        end();
+      }
+    ));
+  }
+
+  static void add_temporary_bytes(std::size_t bytes)
+  {
+    if (scope *s = current())
+    {
+      s->m_event.temporary_bytes += bytes;
+    }
+  }
+
+private:
+  scope(const scope &);
+  scope &operator=(const scope &);
+
+  static scope *&current()
+  {
+    static thread_local scope *s = nullptr;
+    return s;
+  }
+
+  void begin(const char *algorithm, const char *system, std::size_t num_items)
+  {
+    if (thrust::profiling::get_callback() == nullptr)
+    {
+      return;
+    }
+
+    m_active = true;
+    m_parent = current();
+    current() = this;
+
+    m_event.algorithm       = algorithm;
+    m_event.system          = system;
+    m_event.num_items       = num_items;
+    m_event.temporary_bytes = 0;
+    m_event.depth           = m_parent ? m_parent->m_event.depth + 1 : 0;
+    m_event.thread          = std::this_thread::get_id();
+    m_event.duration        = std::chrono::steady_clock::duration::zero();
+    m_event.start           = std::chrono::steady_clock::now();
+  }
+
+  void end()
+  {
+    m_event.duration = std::chrono::steady_clock::now() - m_event.start;
+
+    current() = m_parent;
+    if (m_parent)
+    {
+      m_parent->m_event.temporary_bytes += m_event.temporary_bytes;
+    }
+
+    if (thrust::profiling::callback *cb = thrust::profiling::get_callback())
+    {
+      cb->record(m_event);
+    }
+  }
+
+  bool m_active;
+  scope *m_parent;
+  thrust::profiling::event m_event;
+};
+
+} // end profiling
+} // end detail
+
+THRUST_NAMESPACE_END
+
+#define THRUST_PROFILE_ALGORITHM(name, exec, first, last) \
+  ::thrust::detail::profiling::scope thrust_profiling_scope(name, exec, first, last)
+
+#define THRUST_PROFILE_ALGORITHM_N(name, exec, n) \
+  ::thrust::detail::profiling::scope thrust_profiling_scope(name, exec, n)
+
+#define THRUST_PROFILE_TEMPORARY_ALLOCATION(bytes)                                      \
+  NV_IF_TARGET(NV_IS_HOST, (::thrust::detail::profiling::scope::add_temporary_bytes(bytes);))
+
+#else // THRUST_ENABLE_PROFILING
+
+#define THRUST_PROFILE_ALGORITHM(name, exec, first, last)
+#define THRUST_PROFILE_ALGORITHM_N(name, exec, n)
+#define THRUST_PROFILE_TEMPORARY_ALLOCATION(bytes)
+
+#endif // THRUST_ENABLE_PROFILING
@@ -0,0 +1,286 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/profiling.h>
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+THRUST_NAMESPACE_BEGIN
+namespace profiling
+{
+namespace detail
+{
+
+// the summary installed by default, which reports at program exit
+class summary_at_exit : public summary
+{
+public:
+  ~summary_at_exit()
+  {
+    if (!rows().empty())
+    {
+      std::cerr << "Thrust profiling summary:\n";
+      print(std::cerr);
+    }
+  }
+};
+
+inline std::atomic<callback *> &installed_callback()
+{
+  static summary_at_exit default_summary;
+  static std::atomic<callback *> cb(&default_summary);
+  return cb;
+}
+
+inline std::string format_duration(std::chrono::steady_clock::duration d)
+{
+  const double us = std::chrono::duration<double, std::micro>(d).count();
+
+  std::ostringstream os;
+  os << std::fixed << std::setprecision(3);
+  if (us >= 1e6)
+  {
+    os << us / 1e6 << " s";
+  }
+  else if (us >= 1e3)
+  {
+    os << us / 1e3 << " ms";
+  }
+  else
+  {
+    os << us << " us";
+  }
+  return os.str();
+}
+
+inline std::string format_bytes(std::size_t bytes)
+{
+  const char *units[] = {"B", "KiB", "MiB", "GiB", "TiB"};
+
+  double value = static_cast<double>(bytes);
+  int unit     = 0;
+  while (value >= 1024.0 && unit < 4)
+  {
+    value /= 1024.0;
+    ++unit;
+  }
+
+  std::ostringstream os;
+  os << std::fixed << std::setprecision(unit == 0 ? 0 : 2) << value << ' ' << units[unit];
+  return os.str();
+}
+
+} // end detail
+
+
+inline callback *set_callback(callback *cb)
+{
+  return detail::installed_callback().exchange(cb);
+} // end set_callback()
+
+
+inline callback *get_callback()
+{
+  return detail::installed_callback().load(std::memory_order_acquire);
+} // end get_callback()
+
+
+inline void summary::record(const event &e)
+{
+  if (e.depth != 0)
+  {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  row &r = m_rows[std::make_pair(std::string(e.algorithm), std::string(e.system))];
+  if (r.calls == 0)
+  {
+    r.algorithm = e.algorithm;
+    r.system    = e.system;
+  }
+  r.calls += 1;
+  r.num_items += e.num_items;
+  r.temporary_bytes += e.temporary_bytes;
+  r.time += e.duration;
+} // end summary::record()
+
+
+inline std::vector<summary::row> summary::rows() const
+{
+  std::vector<row> result;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto &kv : m_rows)
+    {
+      result.push_back(kv.second);
+    }
+  }
+
+  std::stable_sort(result.begin(), result.end(), [](const row &lhs, const row &rhs) {
+    return lhs.time > rhs.time;
+  });
+
+  return result;
+} // end summary::rows()
+
+
+inline void summary::print(std::ostream &os) const
+{
+  const std::vector<row> rs = rows();
+
+  std::chrono::steady_clock::duration total{};
+  for (const row &r : rs)
+  {
+    total += r.time;
+  }
+
+  std::vector<std::vector<std::string>> table;
+  table.push_back({"Algorithm", "System", "Calls", "Items", "Temporary", "Time", "Mean", "%"});
+  for (const row &r : rs)
+  {
+    std::ostringstream share;
+    share << std::fixed << std::setprecision(1)
+          << (total.count() > 0 ? 100.0 * static_cast<double>(r.time.count()) / static_cast<double>(total.count())
+                                : 0.0);
+
+    table.push_back({r.algorithm,
+                     r.system,
+                     std::to_string(r.calls),
+                     std::to_string(r.num_items),
+                     detail::format_bytes(r.temporary_bytes),
+                     detail::format_duration(r.time),
+                     detail::format_duration(r.time / static_cast<std::ptrdiff_t>(r.calls)),
+                     share.str()});
+  }
+
+  std::vector<std::size_t> widths(table.front().size(), 0);
+  for (const auto &cells : table)
+  {
+    for (std::size_t i = 0; i < cells.size(); ++i)
+    {
+      widths[i] = (std::max)(widths[i], cells[i].size());
+    }
+  }
+
+  for (std::size_t line = 0; line < table.size(); ++line)
+  {
+    for (std::size_t i = 0; i < widths.size(); ++i)
+    {
+      // names are left aligned, numbers right aligned
+      os << "| " << (i < 2 ? std::left : std::right) << std::setw(static_cast<int>(widths[i])) << table[line][i]
+         << ' ';
+    }
+    os << "|\n";
+
+    if (line == 0)
+    {
+      for (std::size_t i = 0; i < widths.size(); ++i)
+      {
+        os << '|' << std::string(widths[i] + 2, '-');
+      }
+      os << "|\n";
+    }
+  }
+  os << std::right;
+} // end summary::print()
+
+
+inline void summary::clear()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_rows.clear();
+} // end summary::clear()
+
+
+inline chrome_trace::chrome_trace()
+    : m_epoch(std::chrono::steady_clock::now())
+{} // end chrome_trace::chrome_trace()
+
+
+inline chrome_trace::chrome_trace(std::string filename)
+    : m_filename(std::move(filename))
+    , m_epoch(std::chrono::steady_clock::now())
+{} // end chrome_trace::chrome_trace()
+
+
+inline chrome_trace::~chrome_trace()
+{
+  if (!m_filename.empty())
+  {
+    std::ofstream file(m_filename);
+    write(file);
+  }
+} // end chrome_trace::~chrome_trace()
+
+
+inline void chrome_trace::record(const event &e)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_events.push_back(e);
+} // end chrome_trace::record()
+
+
+inline void chrome_trace::write(std::ostream &os) const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  // threads are numbered in the order of their first event
+  std::vector<std::thread::id> threads;
+
+  os << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+  for (std::size_t i = 0; i < m_events.size(); ++i)
+  {
+    const event &e = m_events[i];
+
+    std::size_t tid = std::find(threads.begin(), threads.end(), e.thread) - threads.begin();
+    if (tid == threads.size())
+    {
+      threads.push_back(e.thread);
+    }
+
+    const double ts  = std::chrono::duration<double, std::micro>(e.start - m_epoch).count();
+    const double dur = std::chrono::duration<double, std::micro>(e.duration).count();
+
+    os << (i == 0 ? "\n" : ",\n") << std::fixed << std::setprecision(3) << "{\"name\":\"" << e.algorithm
+       << "\",\"cat\":\"" << e.system << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << tid << ",\"ts\":" << ts
+       << ",\"dur\":" << dur << ",\"args\":{\"items\":" << e.num_items
+       << ",\"temporary_bytes\":" << e.temporary_bytes << "}}";
+  }
+  os << "\n]}\n";
+} // end chrome_trace::write()
+
+
+} // end profiling
+THRUST_NAMESPACE_END
@@ -0,0 +1,77 @@
+/*
+ *  Copyright 2023 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/reduce_multi.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/select_system.h>
+#include <thrust/system/detail/generic/reduce_multi.h>
+#include <thrust/system/detail/adl/reduce_multi.h>
+#include <thrust/detail/profiling.h>
+
+THRUST_NAMESPACE_BEGIN
+
+_CCCL_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename... Ts,
+         typename... BinaryFunctions>
+_CCCL_HOST_DEVICE
+  thrust::tuple<Ts...> reduce_multi(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                    InputIterator first,
+                                    InputIterator last,
+                                    thrust::tuple<Ts...> init,
+                                    BinaryFunctions... binary_ops)
+{
+  THRUST_PROFILE_ALGORITHM("reduce_multi", exec, first, last);
+  static_assert(sizeof...(Ts) == sizeof...(BinaryFunctions),
+                "reduce_multi requires one binary function per initial value");
+
+  using thrust::system::detail::generic::reduce_multi;
+
+  return reduce_multi(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, init, thrust::tuple<BinaryFunctions...>(binary_ops...));
+} // end reduce_multi()
+
+
+template<typename InputIterator,
+         typename... Ts,
+         typename... BinaryFunctions>
+  thrust::tuple<Ts...> reduce_multi(InputIterator first,
+                                    InputIterator last,
+                                    thrust::tuple<Ts...> init,
+                                    BinaryFunctions... binary_ops)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<InputIterator>::type System;
+
+  System system;
+
+  return thrust::reduce_multi(select_system(system), first, last, init, binary_ops...);
+} // end reduce_multi()
+
+THRUST_NAMESPACE_END
+
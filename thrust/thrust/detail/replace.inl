@@ -30,6 +30,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/replace.h>
 #include <thrust/system/detail/adl/replace.h>
+#include <thrust/detail/profiling.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -42,6 +43,7 @@ _CCCL_HOST_DEVICE
                const T &old_value,
                const T &new_value)
 {
+  THRUST_PROFILE_ALGORITHM("replace", exec, first, last);
   using thrust::system::detail::generic::replace;
   return replace(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, old_value, new_value);
 } // end replace()
@@ -55,6 +57,7 @@ _CCCL_HOST_DEVICE
                   Predicate pred,
                   const T &new_value)
 {
+  THRUST_PROFILE_ALGORITHM("replace_if", exec, first, last);
   using thrust::system::detail::generic::replace_if;
   return replace_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred, new_value);
 } // end replace_if()
@@ -69,6 +72,7 @@ _CCCL_HOST_DEVICE
                   Predicate pred,
                   const T &new_value)
 {
+  THRUST_PROFILE_ALGORITHM("replace_if", exec, first, last);
   using thrust::system::detail::generic::replace_if;
   return replace_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, pred, new_value);
 } // end replace_if()
@@ -83,6 +87,7 @@ _CCCL_HOST_DEVICE
                               const T &old_value,
                               const T &new_value)
 {
+  THRUST_PROFILE_ALGORITHM("replace_copy", exec, first, last);
   using thrust::system::detail::generic::replace_copy;
   return replace_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, old_value, new_value);
 } // end replace_copy()
@@ -97,6 +102,7 @@ _CCCL_HOST_DEVICE
                                  Predicate pred,
                                  const T &new_value)
 {
+  THRUST_PROFILE_ALGORITHM("replace_copy_if", exec, first, last);
   using thrust::system::detail::generic::replace_copy_if;
   return replace_copy_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, pred, new_value);
 } // end replace_copy_if()
@@ -112,6 +118,7 @@ _CCCL_HOST_DEVICE
                                  Predicate pred,
                                  const T &new_value)
 {
+  THRUST_PROFILE_ALGORITHM("replace_copy_if", exec, first, last);
   using thrust::system::detail::generic::replace_copy_if;
   return replace_copy_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, result, pred, new_value);
 } // end replace_copy_if()
@@ -30,6 +30,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/reverse.h>
 #include <thrust/system/detail/adl/reverse.h>
+#include <thrust/detail/profiling.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -41,6 +42,7 @@ _CCCL_HOST_DEVICE
                BidirectionalIterator first,
                BidirectionalIterator last)
 {
+  THRUST_PROFILE_ALGORITHM("reverse", exec, first, last);
   using thrust::system::detail::generic::reverse;
   return reverse(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end reverse()
@@ -54,6 +56,7 @@ _CCCL_HOST_DEVICE
                               BidirectionalIterator last,
                               OutputIterator result)
 {
+  THRUST_PROFILE_ALGORITHM("reverse_copy", exec, first, last);
   using thrust::system::detail::generic::reverse_copy;
   return reverse_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result);
 } // end reverse_copy()
@@ -32,6 +32,7 @@
 #include <thrust/system/detail/generic/scan_by_key.h>
 #include <thrust/system/detail/adl/scan.h>
 #include <thrust/system/detail/adl/scan_by_key.h>
+#include <thrust/detail/profiling.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -46,6 +47,7 @@ _CCCL_HOST_DEVICE
                                 InputIterator last,
                                 OutputIterator result)
 {
+  THRUST_PROFILE_ALGORITHM("inclusive_scan", exec, first, last);
   using thrust::system::detail::generic::inclusive_scan;
   return inclusive_scan(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result);
 } // end inclusive_scan()
@@ -63,6 +65,7 @@ _CCCL_HOST_DEVICE
                                 OutputIterator result,
                                 AssociativeOperator binary_op)
 {
+  THRUST_PROFILE_ALGORITHM("inclusive_scan", exec, first, last);
   using thrust::system::detail::generic::inclusive_scan;
   return inclusive_scan(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, binary_op);
 } // end inclusive_scan()
@@ -78,6 +81,7 @@ _CCCL_HOST_DEVICE
                                 InputIterator last,
                                 OutputIterator result)
 {
+  THRUST_PROFILE_ALGORITHM("exclusive_scan", exec, first, last);
   using thrust::system::detail::generic::exclusive_scan;
   return exclusive_scan(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result);
 } // end exclusive_scan()
@@ -95,6 +99,7 @@ _CCCL_HOST_DEVICE
                                 OutputIterator result,
                                 T init)
 {
+  THRUST_PROFILE_ALGORITHM("exclusive_scan", exec, first, last);
   using thrust::system::detail::generic::exclusive_scan;
   return exclusive_scan(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, init);
 } // end exclusive_scan()
@@ -114,6 +119,7 @@ _CCCL_HOST_DEVICE
                                 T init,
                                 AssociativeOperator binary_op)
 {
+  THRUST_PROFILE_ALGORITHM("exclusive_scan", exec, first, last);
   using thrust::system::detail::generic::exclusive_scan;
   return exclusive_scan(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, init, binary_op);
 } // end exclusive_scan()
@@ -131,6 +137,7 @@ _CCCL_HOST_DEVICE
                                        InputIterator2 first2,
                                        OutputIterator result)
 {
+  THRUST_PROFILE_ALGORITHM("inclusive_scan_by_key", exec, first1, last1);
   using thrust::system::detail::generic::inclusive_scan_by_key;
   return inclusive_scan_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, result);
 } // end inclusive_scan_by_key()
@@ -150,6 +157,7 @@ _CCCL_HOST_DEVICE
                                        OutputIterator result,
                                        BinaryPredicate binary_pred)
 {
+  THRUST_PROFILE_ALGORITHM("inclusive_scan_by_key", exec, first1, last1);
   using thrust::system::detail::generic::inclusive_scan_by_key;
   return inclusive_scan_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, result, binary_pred);
 } // end inclusive_scan_by_key()
@@ -171,6 +179,7 @@ _CCCL_HOST_DEVICE
                                        BinaryPredicate binary_pred,
                                        AssociativeOperator binary_op)
 {
+  THRUST_PROFILE_ALGORITHM("inclusive_scan_by_key", exec, first1, last1);
   using thrust::system::detail::generic::inclusive_scan_by_key;
   return inclusive_scan_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, result, binary_pred, binary_op);
 } // end inclusive_scan_by_key()
@@ -188,6 +197,7 @@ _CCCL_HOST_DEVICE
                                        InputIterator2 first2,
                                        OutputIterator result)
 {
+  THRUST_PROFILE_ALGORITHM("exclusive_scan_by_key", exec, first1, last1);
   using thrust::system::detail::generic::exclusive_scan_by_key;
   return exclusive_scan_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, result);
 } // end exclusive_scan_by_key()
@@ -207,6 +217,7 @@ _CCCL_HOST_DEVICE
                                        OutputIterator result,
                                        T init)
 {
+  THRUST_PROFILE_ALGORITHM("exclusive_scan_by_key", exec, first1, last1);
   using thrust::system::detail::generic::exclusive_scan_by_key;
   return exclusive_scan_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, result, init);
 } // end exclusive_scan_by_key()
@@ -228,6 +239,7 @@ _CCCL_HOST_DEVICE
                                        T init,
                                        BinaryPredicate binary_pred)
 {
+  THRUST_PROFILE_ALGORITHM("exclusive_scan_by_key", exec, first1, last1);
   using thrust::system::detail::generic::exclusive_scan_by_key;
   return exclusive_scan_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, result, init, binary_pred);
 } // end exclusive_scan_by_key()
@@ -251,6 +263,7 @@ _CCCL_HOST_DEVICE
                                        BinaryPredicate binary_pred,
                                        AssociativeOperator binary_op)
 {
+  THRUST_PROFILE_ALGORITHM("exclusive_scan_by_key", exec, first1, last1);
   using thrust::system::detail::generic::exclusive_scan_by_key;
   return exclusive_scan_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, result, init, binary_pred, binary_op);
 } // end exclusive_scan_by_key()
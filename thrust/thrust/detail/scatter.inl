@@ -31,6 +31,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/scatter.h>
 #include <thrust/system/detail/adl/scatter.h>
+#include <thrust/detail/profiling.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -47,6 +48,7 @@ _CCCL_HOST_DEVICE
                InputIterator2 map,
                RandomAccessIterator output)
 {
+  THRUST_PROFILE_ALGORITHM("scatter", exec, first, last);
   using thrust::system::detail::generic::scatter;
   return scatter(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, map, output);
 } // end scatter()
@@ -66,6 +68,7 @@ _CCCL_HOST_DEVICE
                   InputIterator3 stencil,
                   RandomAccessIterator output)
 {
+  THRUST_PROFILE_ALGORITHM("scatter_if", exec, first, last);
   using thrust::system::detail::generic::scatter_if;
   return scatter_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, map, stencil, output);
 } // end scatter_if()
@@ -87,6 +90,7 @@ _CCCL_HOST_DEVICE
                   RandomAccessIterator output,
                   Predicate pred)
 {
+  THRUST_PROFILE_ALGORITHM("scatter_if", exec, first, last);
   using thrust::system::detail::generic::scatter_if;
   return scatter_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, map, stencil, output, pred);
 } // end scatter_if()
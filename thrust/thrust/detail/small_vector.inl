@@ -0,0 +1,1026 @@
+/*
+ *  Copyright 2023 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/small_vector.h>
+#include <thrust/detail/allocator/relocate_range.h>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace detail
+{
+namespace small_vector_detail
+{
+
+template<typename Alloc, typename Pointer>
+  void destroy(Alloc &a, Pointer first, Pointer last)
+{
+  for(; first != last; ++first)
+  {
+    std::allocator_traits<Alloc>::destroy(a, first);
+  }
+}
+
+// the constructors below construct n elements at result, or none if one throws
+
+// constructs no elements
+struct construct_nothing
+{
+  template<typename Alloc, typename Pointer>
+  void operator()(Alloc &, Pointer) const {}
+};
+
+// value-initializes n elements
+struct construct_value
+{
+  std::size_t n;
+
+  construct_value(std::size_t n) : n(n) {}
+
+  template<typename Alloc, typename Pointer>
+  void operator()(Alloc &a, Pointer result) const
+  {
+    Pointer current = result;
+    try
+    {
+      for(std::size_t i = 0; i < n; ++i, ++current)
+      {
+        std::allocator_traits<Alloc>::construct(a, current);
+      }
+    }
+    catch(...)
+    {
+      destroy(a, result, current);
+      throw;
+    }
+  }
+};
+
+// constructs n copies of an exemplar
+template<typename T>
+struct construct_fill
+{
+  const T &x;
+  std::size_t n;
+
+  construct_fill(const T &x, std::size_t n) : x(x), n(n) {}
+
+  template<typename Alloc, typename Pointer>
+  void operator()(Alloc &a, Pointer result) const
+  {
+    Pointer current = result;
+    try
+    {
+      for(std::size_t i = 0; i < n; ++i, ++current)
+      {
+        std::allocator_traits<Alloc>::construct(a, current, x);
+      }
+    }
+    catch(...)
+    {
+      destroy(a, result, current);
+      throw;
+    }
+  }
+};
+
+// constructs copies of a range
+template<typename ForwardIterator>
+struct construct_copy
+{
+  ForwardIterator first, last;
+
+  construct_copy(ForwardIterator first, ForwardIterator last) : first(first), last(last) {}
+
+  template<typename Alloc, typename Pointer>
+  void operator()(Alloc &a, Pointer result) const
+  {
+    Pointer current = result;
+    try
+    {
+      for(ForwardIterator i = first; i != last; ++i, ++current)
+      {
+        std::allocator_traits<Alloc>::construct(a, current, *i);
+      }
+    }
+    catch(...)
+    {
+      destroy(a, result, current);
+      throw;
+    }
+  }
+};
+
+// moves a single element
+template<typename T>
+struct construct_move
+{
+  T &x;
+
+  construct_move(T &x) : x(x) {}
+
+  template<typename Alloc, typename Pointer>
+  void operator()(Alloc &a, Pointer result) const
+  {
+    std::allocator_traits<Alloc>::construct(a, result, std::move(x));
+  }
+};
+
+} // end small_vector_detail
+} // end detail
+
+template<typename T, std::size_t N, typename Alloc>
+  const typename small_vector<T,N,Alloc>::size_type small_vector<T,N,Alloc>::inline_capacity;
+
+template<typename T, std::size_t N, typename Alloc>
+  small_vector<T,N,Alloc>
+    ::small_vector(void)
+      :m_allocator(),
+       m_begin(inline_data()),
+       m_size(0),
+       m_capacity(N)
+{
+  ;
+} // end small_vector::small_vector()
+
+template<typename T, std::size_t N, typename Alloc>
+  small_vector<T,N,Alloc>
+    ::small_vector(const Alloc &alloc)
+      :m_allocator(alloc),
+       m_begin(inline_data()),
+       m_size(0),
+       m_capacity(N)
+{
+  ;
+} // end small_vector::small_vector()
+
+template<typename T, std::size_t N, typename Alloc>
+  small_vector<T,N,Alloc>
+    ::small_vector(size_type n, const Alloc &alloc)
+      :m_allocator(alloc),
+       m_begin(inline_data()),
+       m_size(0),
+       m_capacity(N)
+{
+  append_n(n, detail::small_vector_detail::construct_value(n));
+} // end small_vector::small_vector()
+
+template<typename T, std::size_t N, typename Alloc>
+  small_vector<T,N,Alloc>
+    ::small_vector(size_type n, const value_type &value, const Alloc &alloc)
+      :m_allocator(alloc),
+       m_begin(inline_data()),
+       m_size(0),
+       m_capacity(N)
+{
+  append_n(n, detail::small_vector_detail::construct_fill<T>(value, n));
+} // end small_vector::small_vector()
+
+template<typename T, std::size_t N, typename Alloc>
+  template<typename InputIterator, typename>
+    small_vector<T,N,Alloc>
+      ::small_vector(InputIterator first, InputIterator last, const Alloc &alloc)
+        :m_allocator(alloc),
+         m_begin(inline_data()),
+         m_size(0),
+         m_capacity(N)
+{
+  append(first, last);
+} // end small_vector::small_vector()
+
+template<typename T, std::size_t N, typename Alloc>
+  small_vector<T,N,Alloc>
+    ::small_vector(std::initializer_list<T> il, const Alloc &alloc)
+      :m_allocator(alloc),
+       m_begin(inline_data()),
+       m_size(0),
+       m_capacity(N)
+{
+  append(il.begin(), il.end());
+} // end small_vector::small_vector()
+
+template<typename T, std::size_t N, typename Alloc>
+  small_vector<T,N,Alloc>
+    ::small_vector(const small_vector &v)
+      :m_allocator(alloc_traits::select_on_container_copy_construction(v.m_allocator)),
+       m_begin(inline_data()),
+       m_size(0),
+       m_capacity(N)
+{
+  append(v.begin(), v.end());
+} // end small_vector::small_vector()
+
+template<typename T, std::size_t N, typename Alloc>
+  small_vector<T,N,Alloc>
+    ::small_vector(small_vector &&v)
+      :m_allocator(v.m_allocator),
+       m_begin(inline_data()),
+       m_size(0),
+       m_capacity(N)
+{
+  steal(v);
+} // end small_vector::small_vector()
+
+template<typename T, std::size_t N, typename Alloc>
+  small_vector<T,N,Alloc>
+    ::~small_vector(void)
+{
+  clear();
+  release();
+} // end small_vector::~small_vector()
+
+template<typename T, std::size_t N, typename Alloc>
+  small_vector<T,N,Alloc> &
+    small_vector<T,N,Alloc>
+      ::operator=(const small_vector &v)
+{
+  if(this != &v)
+  {
+    assign(v.begin(), v.end());
+  } // end if
+
+  return *this;
+} // end small_vector::operator=()
+
+template<typename T, std::size_t N, typename Alloc>
+  small_vector<T,N,Alloc> &
+    small_vector<T,N,Alloc>
+      ::operator=(small_vector &&v)
+{
+  if(this != &v)
+  {
+    clear();
+
+    if(alloc_traits::propagate_on_container_move_assignment::value || m_allocator == v.m_allocator)
+    {
+      // v's storage may be adopted
+      release();
+      propagate_allocator(v, detail::integral_constant<bool, alloc_traits::propagate_on_container_move_assignment::value>());
+      steal(v);
+    } // end if
+    else
+    {
+      append(std::make_move_iterator(v.begin()), std::make_move_iterator(v.end()));
+      v.clear();
+    } // end else
+  } // end if
+
+  return *this;
+} // end small_vector::operator=()
+
+template<typename T, std::size_t N, typename Alloc>
+  small_vector<T,N,Alloc> &
+    small_vector<T,N,Alloc>
+      ::operator=(std::initializer_list<T> il)
+{
+  assign(il.begin(), il.end());
+  return *this;
+} // end small_vector::operator=()
+
+template<typename T, std::size_t N, typename Alloc>
+  void small_vector<T,N,Alloc>
+    ::assign(size_type n, const value_type &x)
+{
+  // x may be an element of this small_vector
+  value_type exemplar(x);
+
+  clear();
+  append_n(n, detail::small_vector_detail::construct_fill<T>(exemplar, n));
+} // end small_vector::assign()
+
+template<typename T, std::size_t N, typename Alloc>
+  template<typename InputIterator, typename>
+    void small_vector<T,N,Alloc>
+      ::assign(InputIterator first, InputIterator last)
+{
+  clear();
+  append(first, last);
+} // end small_vector::assign()
+
+template<typename T, std::size_t N, typename Alloc>
+  typename small_vector<T,N,Alloc>::allocator_type
+    small_vector<T,N,Alloc>
+      ::get_allocator(void) const
+{
+  return m_allocator;
+} // end small_vector::get_allocator()
+
+template<typename T, std::size_t N, typename Alloc>
+  typename small_vector<T,N,Alloc>::iterator
+    small_vector<T,N,Alloc>
+      ::begin(void)
+{
+  return m_begin;
+} // end small_vector::begin()
+
+template<typename T, std::size_t N, typename Alloc>
+  typename small_vector<T,N,Alloc>::const_iterator
+    small_vector<T,N,Alloc>
+      ::begin(void) const
+{
+  return m_begin;
+} // end small_vector::begin()
+
+template<typename T, std::size_t N, typename Alloc>
+  typename small_vector<T,N,Alloc>::const_iterator
+    small_vector<T,N,Alloc>
+      ::cbegin(void) const
+{
+  return m_begin;
+} // end small_vector::cbegin()
+
+template<typename T, std::size_t N, typename Alloc>
+  typename small_vector<T,N,Alloc>::iterator
+    small_vector<T,N,Alloc>
+      ::end(void)
+{
+  return m_begin + m_size;
+} // end small_vector::end()
+
+template<typename T, std::size_t N, typename Alloc>
+  typename small_vector<T,N,Alloc>::const_iterator
+    small_vector<T,N,Alloc>
+      ::end(void) const
+{
+  return m_begin + m_size;
+} // end small_vector::end()
+
+template<typename T, std::size_t N, typename Alloc>
+  typename small_vector<T,N,Alloc>::const_iterator
+    small_vector<T,N,Alloc>
+      ::cend(void) const
+{
+  return m_begin + m_size;
+} // end small_vector::cend()
+
+template<typename T, std::size_t N, typename Alloc>
+  typename small_vector<T,N,Alloc>::reverse_iterator
+    small_vector<T,N,Alloc>
+      ::rbegin(void)
+{
+  return reverse_iterator(end());
+} // end small_vector::rbegin()
+
+template<typename T, std::size_t N, typename Alloc>
+  typename small_vector<T,N,Alloc>::const_reverse_iterator
+    small_vector<T,N,Alloc>
+      ::rbegin(void) const
+{
+  return const_reverse_iterator(end());
+} // end small_vector::rbegin()
+
+template<typename T, std::size_t N, typename Alloc>
+  typename small_vector<T,N,Alloc>::const_reverse_iterator
+    small_vector<T,N,Alloc>
+      ::crbegin(void) const
+{
+  return const_reverse_iterator(end());
+} // end small_vector::crbegin()
+
+template<typename T, std::size_t N, typename Alloc>
+  typename small_vector<T,N,Alloc>::reverse_iterator
+    small_vector<T,N,Alloc>
+      ::rend(void)
+{
+  return reverse_iterator(begin());
+} // end small_vector::rend()
+
+template<typename T, std::size_t N, typename Alloc>
+  typename small_vector<T,N,Alloc>::const_reverse_iterator
+    small_vector<T,N,Alloc>
+      ::rend(void) const
+{
+  return const_reverse_iterator(begin());
+} // end small_vector::rend()
+
+template<typename T, std::size_t N, typename Alloc>
+  typename small_vector<T,N,Alloc>::const_reverse_iterator
+    small_vector<T,N,Alloc>
+      ::crend(void) const
+{
+  return const_reverse_iterator(begin());
+} // end small_vector::crend()
+
+template<typename T, std::size_t N, typename Alloc>
+  typename small_vector<T,N,Alloc>::size_type
+    small_vector<T,N,Alloc>
+      ::size(void) const
+{
+  return m_size;
+} // end small_vector::size()
+
+template<typename T, std::size_t N, typename Alloc>
+  typename small_vector<T,N,Alloc>::size_type
+    small_vector<T,N,Alloc>
+      ::max_size(void) const
+{
+  return alloc_traits::max_size(m_allocator);
+} // end small_vector::max_size()
+
+template<typename T, std::size_t N, typename Alloc>
+  typename small_vector<T,N,Alloc>::size_type
+    small_vector<T,N,Alloc>
+      ::capacity(void) const
+{
+  return m_capacity;
+} // end small_vector::capacity()
+
+template<typename T, std::size_t N, typename Alloc>
+  bool small_vector<T,N,Alloc>
+    ::empty(void) const
+{
+  return m_size == 0;
+} // end small_vector::empty()
+
+template<typename T, std::size_t N, typename Alloc>
+  bool small_vector<T,N,Alloc>
+    ::is_inline(void) const
+{
+  return static_cast<const void *>(m_begin) == static_cast<const void *>(m_inline);
+} // end small_vector::is_inline()
+
+template<typename T, std::size_t N, typename Alloc>
+  void small_vector<T,N,Alloc>
+    ::reserve(size_type n)
+{
+  if(n > capacity())
+  {
+    if(n > max_size())
+    {
+      throw std::length_error("reserve(): n exceeds max_size().");
+    } // end if
+
+    append_n(0, detail::small_vector_detail::construct_nothing(), n);
+  } // end if
+} // end small_vector::reserve()
+
+template<typename T, std::size_t N, typename Alloc>
+  void small_vector<T,N,Alloc>
+    ::shrink_to_fit(void)
+{
+  if(!is_inline() && size() < capacity())
+  {
+    if(size() <= N)
+    {
+      // move the elements back inside
+      pointer old_begin = m_begin;
+      relocate(old_begin, old_begin + m_size, inline_data());
+      alloc_traits::deallocate(m_allocator, old_begin, m_capacity);
+      m_begin    = inline_data();
+      m_capacity = N;
+    } // end if
+    else
+    {
+      small_vector temp(get_allocator());
+      temp.append_n(0, detail::small_vector_detail::construct_nothing(), size());
+      relocate(begin(), end(), temp.m_begin);
+      temp.m_size = m_size;
+      m_size      = 0;
+      swap(temp);
+    } // end else
+  } // end if
+} // end small_vector::shrink_to_fit()
+
+template<typename T, std::size_t N, typename Alloc>
+  void small_vector<T,N,Alloc>
+    ::resize(size_type new_size)
+{
+  if(new_size < size())
+  {
+    erase(begin() + new_size, end());
+  } // end if
+  else
+  {
+    append_n(new_size - size(), detail::small_vector_detail::construct_value(new_size - size()));
+  } // end else
+} // end small_vector::resize()
+
+template<typename T, std::size_t N, typename Alloc>
+  void small_vector<T,N,Alloc>
+    ::resize(size_type new_size, const value_type &x)
+{
+  if(new_size < size())
+  {
+    erase(begin() + new_size, end());
+  } // end if
+  else
+  {
+    append_n(new_size - size(), detail::small_vector_detail::construct_fill<T>(x, new_size - size()));
+  } // end else
+} // end small_vector::resize()
+
+template<typename T, std::size_t N, typename Alloc>
+  typename small_vector<T,N,Alloc>::reference
+    small_vector<T,N,Alloc>
+      ::operator[](size_type n)
+{
+  return m_begin[n];
+} // end small_vector::operator[]
+
+template<typename T, std::size_t N, typename Alloc>
+  typename small_vector<T,N,Alloc>::const_reference
+    small_vector<T,N,Alloc>
+      ::operator[](size_type n) const
+{
+  return m_begin[n];
+} // end small_vector::operator[]
+
+template<typename T, std::size_t N, typename Alloc>
+  typename small_vector<T,N,Alloc>::reference
+    small_vector<T,N,Alloc>
+      ::at(size_type n)
+{
+  if(n >= size())
+  {
+    throw std::out_of_range("at(): n is out of range.");
+  } // end if
+
+  return m_begin[n];
+} // end small_vector::at()
+
+template<typename T, std::size_t N, typename Alloc>
+  typename small_vector<T,N,Alloc>::const_reference
+    small_vector<T,N,Alloc>
+      ::at(size_type n) const
+{
+  if(n >= size())
+  {
+    throw std::out_of_range("at(): n is out of range.");
+  } // end if
+
+  return m_begin[n];
+} // end small_vector::at()
+
+template<typename T, std::size_t N, typename Alloc>
+  typename small_vector<T,N,Alloc>::reference
+    small_vector<T,N,Alloc>
+      ::front(void)
+{
+  return *begin();
+} // end small_vector::front()
+
+template<typename T, std::size_t N, typename Alloc>
+  typename small_vector<T,N,Alloc>::const_reference
+    small_vector<T,N,Alloc>
+      ::front(void) const
+{
+  return *begin();
+} // end small_vector::front()
+
+template<typename T, std::size_t N, typename Alloc>
+  typename small_vector<T,N,Alloc>::reference
+    small_vector<T,N,Alloc>
+      ::back(void)
+{
+  return *(end() - 1);
+} // end small_vector::back()
+
+template<typename T, std::size_t N, typename Alloc>
+  typename small_vector<T,N,Alloc>::const_reference
+    small_vector<T,N,Alloc>
+      ::back(void) const
+{
+  return *(end() - 1);
+} // end small_vector::back()
+
+template<typename T, std::size_t N, typename Alloc>
+  typename small_vector<T,N,Alloc>::pointer
+    small_vector<T,N,Alloc>
+      ::data(void)
+{
+  return m_begin;
+} // end small_vector::data()
+
+template<typename T, std::size_t N, typename Alloc>
+  typename small_vector<T,N,Alloc>::const_pointer
+    small_vector<T,N,Alloc>
+      ::data(void) const
+{
+  return m_begin;
+} // end small_vector::data()
+
+template<typename T, std::size_t N, typename Alloc>
+  void small_vector<T,N,Alloc>
+    ::push_back(const value_type &x)
+{
+  emplace_back(x);
+} // end small_vector::push_back()
+
+template<typename T, std::size_t N, typename Alloc>
+  void small_vector<T,N,Alloc>
+    ::push_back(value_type &&x)
+{
+  emplace_back(std::move(x));
+} // end small_vector::push_back()
+
+template<typename T, std::size_t N, typename Alloc>
+  template<typename... Args>
+    typename small_vector<T,N,Alloc>::reference
+      small_vector<T,N,Alloc>
+        ::emplace_back(Args&&... args)
+{
+  if(size() < capacity())
+  {
+    // construct the new element in place
+    alloc_traits::construct(m_allocator, end(), std::forward<Args>(args)...);
+    ++m_size;
+  } // end if
+  else
+  {
+    // args may refer to elements of this small_vector, so construct the new
+    // element before the storage is reallocated
+    value_type x(std::forward<Args>(args)...);
+    append_n(1, detail::small_vector_detail::construct_move<T>(x));
+  } // end else
+
+  return back();
+} // end small_vector::emplace_back()
+
+template<typename T, std::size_t N, typename Alloc>
+  template<typename InputIterator>
+    void small_vector<T,N,Alloc>
+      ::append(InputIterator first, InputIterator last)
+{
+  // dispatch on category
+  append(first, last, typename std::iterator_traits<InputIterator>::iterator_category());
+} // end small_vector::append()
+
+template<typename T, std::size_t N, typename Alloc>
+  template<typename InputIterator>
+    void small_vector<T,N,Alloc>
+      ::append(InputIterator first, InputIterator last, std::input_iterator_tag)
+{
+  for(; first != last; ++first)
+    emplace_back(*first);
+} // end small_vector::append()
+
+template<typename T, std::size_t N, typename Alloc>
+  template<typename ForwardIterator>
+    void small_vector<T,N,Alloc>
+      ::append(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+{
+  const size_type n = std::distance(first, last);
+  append_n(n, detail::small_vector_detail::construct_copy<ForwardIterator>(first, last));
+} // end small_vector::append()
+
+template<typename T, std::size_t N, typename Alloc>
+  void small_vector<T,N,Alloc>
+    ::pop_back(void)
+{
+  --m_size;
+  alloc_traits::destroy(m_allocator, end());
+} // end small_vector::pop_back()
+
+template<typename T, std::size_t N, typename Alloc>
+  template<typename... Args>
+    typename small_vector<T,N,Alloc>::iterator
+      small_vector<T,N,Alloc>
+        ::emplace(const_iterator position, Args&&... args)
+{
+  const size_type index = position - begin();
+
+  // append the new element and rotate it into place
+  emplace_back(std::forward<Args>(args)...);
+  std::rotate(begin() + index, end() - 1, end());
+
+  return begin() + index;
+} // end small_vector::emplace()
+
+template<typename T, std::size_t N, typename Alloc>
+  typename small_vector<T,N,Alloc>::iterator
+    small_vector<T,N,Alloc>
+      ::insert(const_iterator position, const value_type &x)
+{
+  return emplace(position, x);
+} // end small_vector::insert()
+
+template<typename T, std::size_t N, typename Alloc>
+  typename small_vector<T,N,Alloc>::iterator
+    small_vector<T,N,Alloc>
+      ::insert(const_iterator position, value_type &&x)
+{
+  return emplace(position, std::move(x));
+} // end small_vector::insert()
+
+template<typename T, std::size_t N, typename Alloc>
+  typename small_vector<T,N,Alloc>::iterator
+    small_vector<T,N,Alloc>
+      ::insert(const_iterator position, size_type n, const value_type &x)
+{
+  const size_type index    = position - begin();
+  const size_type old_size = size();
+
+  // append the new elements and rotate them into place
+  append_n(n, detail::small_vector_detail::construct_fill<T>(x, n));
+  std::rotate(begin() + index, begin() + old_size, end());
+
+  return begin() + index;
+} // end small_vector::insert()
+
+template<typename T, std::size_t N, typename Alloc>
+  template<typename InputIterator, typename>
+    typename small_vector<T,N,Alloc>::iterator
+      small_vector<T,N,Alloc>
+        ::insert(const_iterator position, InputIterator first, InputIterator last)
+{
+  const size_type index    = position - begin();
+  const size_type old_size = size();
+
+  // append the new elements and rotate them into place
+  append(first, last);
+  std::rotate(begin() + index, begin() + old_size, end());
+
+  return begin() + index;
+} // end small_vector::insert()
+
+template<typename T, std::size_t N, typename Alloc>
+  typename small_vector<T,N,Alloc>::iterator
+    small_vector<T,N,Alloc>
+      ::erase(const_iterator pos)
+{
+  return erase(pos, pos + 1);
+} // end small_vector::erase()
+
+template<typename T, std::size_t N, typename Alloc>
+  typename small_vector<T,N,Alloc>::iterator
+    small_vector<T,N,Alloc>
+      ::erase(const_iterator first, const_iterator last)
+{
+  iterator result = begin() + (first - cbegin());
+
+  // moving the elements onto themselves would leave them moved-from
+  if(first == last)
+  {
+    return result;
+  } // end if
+
+  // move the elements following the range and destroy the leftovers
+  iterator new_end = std::move(result + (last - first), end(), result);
+  destroy(new_end, end());
+  m_size = new_end - begin();
+
+  return result;
+} // end small_vector::erase()
+
+template<typename T, std::size_t N, typename Alloc>
+  void small_vector<T,N,Alloc>
+    ::clear(void)
+{
+  destroy(begin(), end());
+  m_size = 0;
+} // end small_vector::clear()
+
+template<typename T, std::size_t N, typename Alloc>
+  void small_vector<T,N,Alloc>
+    ::swap(small_vector &v)
+{
+  if(!is_inline() && !v.is_inline())
+  {
+    // exchange the allocated storage
+    std::swap(m_begin,    v.m_begin);
+    std::swap(m_size,     v.m_size);
+    std::swap(m_capacity, v.m_capacity);
+    swap_allocators(v, detail::integral_constant<bool, alloc_traits::propagate_on_container_swap::value>());
+  } // end if
+  else
+  {
+    // at least one side is stored inline, so the elements must be moved
+    small_vector temp(std::move(v));
+    v     = std::move(*this);
+    *this = std::move(temp);
+  } // end else
+} // end small_vector::swap()
+
+template<typename T, std::size_t N, typename Alloc>
+  typename small_vector<T,N,Alloc>::pointer
+    small_vector<T,N,Alloc>
+      ::inline_data(void)
+{
+  return reinterpret_cast<pointer>(m_inline);
+} // end small_vector::inline_data()
+
+template<typename T, std::size_t N, typename Alloc>
+  void small_vector<T,N,Alloc>
+    ::steal(small_vector &v)
+{
+  if(v.is_inline())
+  {
+    relocate(v.begin(), v.end(), inline_data());
+  } // end if
+  else
+  {
+    m_begin    = v.m_begin;
+    m_capacity = v.m_capacity;
+
+    v.m_begin    = v.inline_data();
+    v.m_capacity = N;
+  } // end else
+
+  m_size   = v.m_size;
+  v.m_size = 0;
+} // end small_vector::steal()
+
+template<typename T, std::size_t N, typename Alloc>
+  void small_vector<T,N,Alloc>
+    ::release(void)
+{
+  if(!is_inline())
+  {
+    alloc_traits::deallocate(m_allocator, m_begin, m_capacity);
+    m_begin    = inline_data();
+    m_capacity = N;
+  } // end if
+} // end small_vector::release()
+
+template<typename T, std::size_t N, typename Alloc>
+  void small_vector<T,N,Alloc>
+    ::propagate_allocator(small_vector &v, detail::true_type)
+{
+  m_allocator = v.m_allocator;
+} // end small_vector::propagate_allocator()
+
+template<typename T, std::size_t N, typename Alloc>
+  void small_vector<T,N,Alloc>
+    ::propagate_allocator(small_vector &, detail::false_type)
+{
+  ;
+} // end small_vector::propagate_allocator()
+
+template<typename T, std::size_t N, typename Alloc>
+  void small_vector<T,N,Alloc>
+    ::swap_allocators(small_vector &v, detail::true_type)
+{
+  std::swap(m_allocator, v.m_allocator);
+} // end small_vector::swap_allocators()
+
+template<typename T, std::size_t N, typename Alloc>
+  void small_vector<T,N,Alloc>
+    ::swap_allocators(small_vector &, detail::false_type)
+{
+  ;
+} // end small_vector::swap_allocators()
+
+template<typename T, std::size_t N, typename Alloc>
+  typename small_vector<T,N,Alloc>::size_type
+    small_vector<T,N,Alloc>
+      ::grown_capacity(size_type n) const
+{
+  if(max_size() - size() < n)
+  {
+    throw std::length_error("small_vector: growth exceeds max_size().");
+  } // end if
+
+  // allocate exponentially larger new storage, but do not exceed maximum storage
+  size_type new_capacity = (std::max)(size() + n, 2 * capacity());
+  return (std::min)(new_capacity, max_size());
+} // end small_vector::grown_capacity()
+
+template<typename T, std::size_t N, typename Alloc>
+  template<typename Constructor>
+    void small_vector<T,N,Alloc>
+      ::append_n(size_type n, Constructor construct)
+{
+  if(capacity() - size() >= n)
+  {
+    // we've got room for all of them
+    construct(m_allocator, end());
+  } // end if
+  else
+  {
+    append_n(n, construct, grown_capacity(n));
+  } // end else
+
+  m_size += n;
+} // end small_vector::append_n()
+
+template<typename T, std::size_t N, typename Alloc>
+  template<typename Constructor>
+    void small_vector<T,N,Alloc>
+      ::append_n(size_type n, Constructor construct, size_type new_capacity)
+{
+  pointer new_begin = alloc_traits::allocate(m_allocator, new_capacity);
+
+  try
+  {
+    // construct the new elements first, while the old storage, which
+    // they may be copied from, is still intact
+    construct(m_allocator, new_begin + m_size);
+  } // end try
+  catch(...)
+  {
+    alloc_traits::deallocate(m_allocator, new_begin, new_capacity);
+    throw;
+  } // end catch
+
+  try
+  {
+    relocate(begin(), end(), new_begin);
+  } // end try
+  catch(...)
+  {
+    destroy(new_begin + m_size, new_begin + m_size + n);
+    alloc_traits::deallocate(m_allocator, new_begin, new_capacity);
+    throw;
+  } // end catch
+
+  // record the new state; the caller accounts for the n new elements
+  release();
+  m_begin    = new_begin;
+  m_capacity = new_capacity;
+} // end small_vector::append_n()
+
+template<typename T, std::size_t N, typename Alloc>
+  void small_vector<T,N,Alloc>
+    ::destroy(pointer first, pointer last)
+{
+  detail::small_vector_detail::destroy(m_allocator, first, last);
+} // end small_vector::destroy()
+
+template<typename T, std::size_t N, typename Alloc>
+  void small_vector<T,N,Alloc>
+    ::relocate(pointer first, pointer last, pointer result)
+{
+  relocate(first, last, result,
+    detail::is_trivially_relocatable_with_allocator<Alloc,T>());
+} // end small_vector::relocate()
+
+template<typename T, std::size_t N, typename Alloc>
+  void small_vector<T,N,Alloc>
+    ::relocate(pointer first, pointer last, pointer result, detail::true_type)
+{
+  if(first != last)
+  {
+    std::memcpy(static_cast<void *>(result), static_cast<const void *>(first), (last - first) * sizeof(T));
+  } // end if
+} // end small_vector::relocate()
+
+template<typename T, std::size_t N, typename Alloc>
+  void small_vector<T,N,Alloc>
+    ::relocate(pointer first, pointer last, pointer result, detail::false_type)
+{
+  pointer current = result;
+
+  try
+  {
+    for(pointer i = first; i != last; ++i, ++current)
+    {
+      alloc_traits::construct(m_allocator, current, std::move_if_noexcept(*i));
+    } // end for
+  } // end try
+  catch(...)
+  {
+    // the original elements are intact unless moving them threw
+    destroy(result, current);
+    throw;
+  } // end catch
+
+  destroy(first, last);
+} // end small_vector::relocate()
+
+template<typename T, std::size_t N, typename Alloc>
+  void swap(small_vector<T,N,Alloc> &a, small_vector<T,N,Alloc> &b)
+{
+  a.swap(b);
+} // end swap()
+
+template<typename T, std::size_t N, typename Alloc>
+  bool operator==(const small_vector<T,N,Alloc> &lhs, const small_vector<T,N,Alloc> &rhs)
+{
+  return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+} // end operator==()
+
+template<typename T, std::size_t N, typename Alloc>
+  bool operator!=(const small_vector<T,N,Alloc> &lhs, const small_vector<T,N,Alloc> &rhs)
+{
+  return !(lhs == rhs);
+} // end operator!=()
+
+THRUST_NAMESPACE_END
@@ -31,6 +31,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/swap_ranges.h>
 #include <thrust/system/detail/adl/swap_ranges.h>
+#include <thrust/detail/profiling.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -45,6 +46,7 @@ _CCCL_HOST_DEVICE
                                ForwardIterator1 last1,
                                ForwardIterator2 first2)
 {
+  THRUST_PROFILE_ALGORITHM("swap_ranges", exec, first1, last1);
   using thrust::system::detail::generic::swap_ranges;
   return swap_ranges(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2);
 } // end swap_ranges()
@@ -30,6 +30,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/tabulate.h>
 #include <thrust/system/detail/adl/tabulate.h>
+#include <thrust/detail/profiling.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -42,6 +43,7 @@ _CCCL_HOST_DEVICE
                 ForwardIterator last,
                 UnaryOperation unary_op)
 {
+  THRUST_PROFILE_ALGORITHM("tabulate", exec, first, last);
   using thrust::system::detail::generic::tabulate;
   return tabulate(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, unary_op);
 } // end tabulate()
@@ -31,6 +31,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/transform.h>
 #include <thrust/system/detail/adl/transform.h>
+#include <thrust/detail/profiling.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -46,6 +47,7 @@ _CCCL_HOST_DEVICE
                            OutputIterator result,
                            UnaryFunction op)
 {
+  THRUST_PROFILE_ALGORITHM("transform", exec, first, last);
   using thrust::system::detail::generic::transform;
   return transform(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, op);
 } // end transform()
@@ -64,6 +66,7 @@ _CCCL_HOST_DEVICE
                            OutputIterator result,
                            BinaryFunction op)
 {
+  THRUST_PROFILE_ALGORITHM("transform", exec, first1, last1);
   using thrust::system::detail::generic::transform;
   return transform(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, result, op);
 } // end transform()
@@ -82,6 +85,7 @@ _CCCL_HOST_DEVICE
                                UnaryFunction op,
                                Predicate pred)
 {
+  THRUST_PROFILE_ALGORITHM("transform_if", exec, first, last);
   using thrust::system::detail::generic::transform_if;
   return transform_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, op, pred);
 } // end transform_if()
@@ -102,6 +106,7 @@ _CCCL_HOST_DEVICE
                                UnaryFunction op,
                                Predicate pred)
 {
+  THRUST_PROFILE_ALGORITHM("transform_if", exec, first, last);
   using thrust::system::detail::generic::transform_if;
   return transform_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, result, op, pred);
 } // end transform_if()
@@ -124,6 +129,7 @@ _CCCL_HOST_DEVICE
                                BinaryFunction binary_op,
                                Predicate pred)
 {
+  THRUST_PROFILE_ALGORITHM("transform_if", exec, first1, last1);
   using thrust::system::detail::generic::transform_if;
   return transform_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, stencil, result, binary_op, pred);
 } // end transform_if()
@@ -31,6 +31,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/uninitialized_copy.h>
 #include <thrust/system/detail/adl/uninitialized_copy.h>
+#include <thrust/detail/profiling.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -43,6 +44,7 @@ _CCCL_HOST_DEVICE
                                      InputIterator last,
                                      ForwardIterator result)
 {
+  THRUST_PROFILE_ALGORITHM("uninitialized_copy", exec, first, last);
   using thrust::system::detail::generic::uninitialized_copy;
   return uninitialized_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result);
 } // end uninitialized_copy()
@@ -56,6 +58,7 @@ _CCCL_HOST_DEVICE
                                        Size n,
                                        ForwardIterator result)
 {
+  THRUST_PROFILE_ALGORITHM_N("uninitialized_copy_n", exec, n);
   using thrust::system::detail::generic::uninitialized_copy_n;
   return uninitialized_copy_n(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, n, result);
 } // end uninitialized_copy_n()
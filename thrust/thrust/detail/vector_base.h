@@ -43,9 +43,44 @@
 
 THRUST_NAMESPACE_BEGIN
 
+/*! \addtogroup containers
+ *  \{
+ */
+
+/*! Tag type of \p default_init.
+ */
+struct default_init_t {};
+
+/*! Tag selecting the vector constructors and \p resize overloads that
+ *  default-initialize new elements instead of value-initializing them:
+ *  elements whose type has a trivial default constructor are left
+ *  uninitialized, other elements are default constructed.
+ */
+THRUST_INLINE_CONSTANT default_init_t default_init{};
+
+/*! Tag type of \p no_init.
+ */
+struct no_init_t {};
+
+/*! Tag selecting the vector constructors and \p resize overloads that leave
+ *  new elements uninitialized, without calling the allocator's \p construct.
+ *  The element type must be trivially default constructible.
+ *
+ *  The memory of the new elements is not touched, so that its pages are
+ *  first written, and on NUMA systems placed, by the algorithm that fills it.
+ */
+THRUST_INLINE_CONSTANT no_init_t no_init{};
+
+/*! \} // containers
+ */
+
 namespace detail
 {
 
+// construction policy of the elements created by vector_base's constructors
+// and resize without an exemplar
+struct value_init_t {};
+
 template<typename T, typename Alloc>
   class vector_base
 {
@@ -91,6 +126,30 @@ template<typename T, typename Alloc>
      */
     explicit vector_base(size_type n, const Alloc &alloc);
 
+    /*! This constructor creates a vector_base with default-initialized
+     *  elements.
+     *  \param n The number of elements to create.
+     */
+    vector_base(size_type n, default_init_t);
+
+    /*! This constructor creates a vector_base with default-initialized
+     *  elements.
+     *  \param n The number of elements to create.
+     *  \param alloc The allocator to use by this vector_base.
+     */
+    vector_base(size_type n, default_init_t, const Alloc &alloc);
+
+    /*! This constructor creates a vector_base with uninitialized elements.
+     *  \param n The number of elements to create.
+     */
+    vector_base(size_type n, no_init_t);
+
+    /*! This constructor creates a vector_base with uninitialized elements.
+     *  \param n The number of elements to create.
+     *  \param alloc The allocator to use by this vector_base.
+     */
+    vector_base(size_type n, no_init_t, const Alloc &alloc);
+
     /*! This constructor creates a vector_base with copies
      *  of an exemplar element.
      *  \param n The number of elements to initially create.
@@ -229,6 +288,28 @@ template<typename T, typename Alloc>
      */
     void resize(size_type new_size, const value_type &x);
 
+    /*! \brief Resizes this vector_base to the specified number of elements.
+     *  \param new_size Number of elements this vector_base should contain.
+     *  \throw std::length_error If n exceeds max_size().
+     *
+     *  This method will resize this vector_base to the specified number of
+     *  elements. If the number is smaller than this vector_base's current
+     *  size this vector_base is truncated, otherwise this vector_base is
+     *  extended and new elements are default-initialized.
+     */
+    void resize(size_type new_size, default_init_t);
+
+    /*! \brief Resizes this vector_base to the specified number of elements.
+     *  \param new_size Number of elements this vector_base should contain.
+     *  \throw std::length_error If n exceeds max_size().
+     *
+     *  This method will resize this vector_base to the specified number of
+     *  elements. If the number is smaller than this vector_base's current
+     *  size this vector_base is truncated, otherwise this vector_base is
+     *  extended and new elements are left uninitialized.
+     */
+    void resize(size_type new_size, no_init_t);
+
     /*! Returns the number of elements in this vector_base.
      */
     _CCCL_HOST_DEVICE
@@ -423,6 +504,29 @@ template<typename T, typename Alloc>
      */
     void push_back(const value_type &x);
 
+    /*! This method appends the given element to the end of this vector_base.
+     *  \param x The element to move to the end.
+     */
+    void push_back(value_type &&x);
+
+    /*! This method appends an element constructed from the given arguments
+     *  to the end of this vector_base. Host-accessible storage constructs the
+     *  element in place.
+     *  \param args The arguments to construct the element from.
+     *  \return A reference to the new element.
+     */
+    template<typename... Args>
+      reference emplace_back(Args&&... args);
+
+    /*! This method appends copies of the range <tt>[first,last)</tt> to the
+     *  end of this vector_base. Unlike <tt>insert(end(), first, last)</tt>,
+     *  no existing elements are moved unless the storage must grow.
+     *  \param first The beginning of the range to append.
+     *  \param last The end of the range to append.
+     */
+    template<typename InputIterator>
+      void append(InputIterator first, InputIterator last);
+
     /*! This method erases the last element of this vector_base, invalidating
      *  all iterators and references to it.
      */
@@ -523,6 +627,9 @@ template<typename T, typename Alloc>
 
     void default_init(size_type n);
 
+    template<typename InitPolicy>
+      void uninitialized_init(size_type n, InitPolicy init);
+
     void fill_init(size_type n, const T &x);
 
     // these methods resolve the ambiguity of the insert() template of form (iterator, InputIterator, InputIterator)
@@ -533,8 +640,23 @@ template<typename T, typename Alloc>
     template<typename InputIteratorOrIntegralType>
       void insert_dispatch(iterator position, InputIteratorOrIntegralType n, InputIteratorOrIntegralType x, true_type);
 
-    // this method appends n default-constructed elements at the end
-    void append(size_type n);
+    // this method resizes to new_size, constructing new elements according to init
+    template<typename InitPolicy>
+      void resize_dispatch(size_type new_size, InitPolicy init);
+
+    // this method appends n elements constructed according to init at the end
+    template<typename InitPolicy>
+      void append_init(size_type n, InitPolicy init);
+
+    // these methods append a range at the end
+    template<typename InputIterator>
+      void append(InputIterator first, InputIterator last, thrust::incrementable_traversal_tag);
+
+    template<typename ForwardIterator>
+      void append(ForwardIterator first, ForwardIterator last, thrust::random_access_traversal_tag);
+
+    // this method returns the capacity to grow to in order to fit n more elements
+    size_type grown_capacity(size_type n) const;
 
     // this method performs insertion from a fill value
     void fill_insert(iterator position, size_type n, const T &x);
@@ -566,6 +688,19 @@ template<typename T, typename Alloc>
     // this method performs assignment from a fill value
     void fill_assign(size_type n, const T &x);
 
+    // this method moves the elements to new storage of new_capacity elements,
+    // in which it constructs n new elements at position with construct
+    template<typename Constructor>
+      void reallocate_and_construct(size_type new_capacity, iterator position, size_type n, Constructor construct);
+
+    // this method relocates the elements by copying their bytes
+    template<typename Constructor>
+      void reallocate_and_construct(size_type new_capacity, iterator position, size_type n, Constructor construct, true_type);
+
+    // this method copy constructs the elements and destroys the originals
+    template<typename Constructor>
+      void reallocate_and_construct(size_type new_capacity, iterator position, size_type n, Constructor construct, false_type);
+
     // this method allocates new storage and construct copies the given range
     template<typename ForwardIterator>
     void allocate_and_copy(size_type requested_size,
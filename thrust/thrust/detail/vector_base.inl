@@ -35,13 +35,91 @@
 #include <thrust/detail/minmax.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/detail/temporary_array.h>
+#include <thrust/detail/static_assert.h>
 
 #include <stdexcept>
+#include <utility>
 
 THRUST_NAMESPACE_BEGIN
 
 namespace detail
 {
+namespace vector_base_detail
+{
+
+// constructs no elements
+struct construct_nothing
+{
+  template<typename Storage, typename Iterator>
+  void operator()(Storage &, Iterator) const {}
+};
+
+// constructs n copies of an exemplar
+template<typename T, typename Size>
+struct construct_fill
+{
+  const T &x;
+  Size n;
+
+  construct_fill(const T &x, Size n) : x(x), n(n) {}
+
+  template<typename Storage, typename Iterator>
+  void operator()(Storage &storage, Iterator result) const
+  {
+    storage.uninitialized_fill_n(result, n, x);
+  }
+};
+
+// constructs copies of a range
+template<typename InputIterator>
+struct construct_copy
+{
+  InputIterator first, last;
+
+  construct_copy(InputIterator first, InputIterator last) : first(first), last(last) {}
+
+  template<typename Storage, typename Iterator>
+  void operator()(Storage &storage, Iterator result) const
+  {
+    storage.uninitialized_copy(first, last, result);
+  }
+};
+
+// constructs n elements according to an initialization policy
+template<typename Size, typename InitPolicy>
+struct construct_init
+{
+  Size n;
+
+  construct_init(Size n) : n(n) {}
+
+  template<typename Storage, typename Iterator>
+  void operator()(Storage &storage, Iterator result) const
+  {
+    construct_n(storage, result, InitPolicy());
+  }
+
+  template<typename Storage, typename Iterator>
+  void construct_n(Storage &storage, Iterator result, value_init_t) const
+  {
+    storage.default_construct_n(result, n);
+  }
+
+  template<typename Storage, typename Iterator>
+  void construct_n(Storage &storage, Iterator result, default_init_t) const
+  {
+    storage.default_init_n(result, n);
+  }
+
+  template<typename Storage, typename Iterator>
+  void construct_n(Storage &, Iterator, no_init_t) const
+  {
+    THRUST_STATIC_ASSERT_MSG(thrust::detail::has_trivial_constructor<typename Storage::value_type>::value,
+                             "thrust::no_init requires a trivially default constructible element type");
+  }
+};
+
+} // end vector_base_detail
 
 template<typename T, typename Alloc>
   vector_base<T,Alloc>
@@ -79,6 +157,42 @@ template<typename T, typename Alloc>
   default_init(n);
 } // end vector_base::vector_base()
 
+template<typename T, typename Alloc>
+  vector_base<T,Alloc>
+    ::vector_base(size_type n, default_init_t)
+      :m_storage(),
+       m_size(0)
+{
+  uninitialized_init(n, default_init_t());
+} // end vector_base::vector_base()
+
+template<typename T, typename Alloc>
+  vector_base<T,Alloc>
+    ::vector_base(size_type n, default_init_t, const Alloc &alloc)
+      :m_storage(alloc),
+       m_size(0)
+{
+  uninitialized_init(n, default_init_t());
+} // end vector_base::vector_base()
+
+template<typename T, typename Alloc>
+  vector_base<T,Alloc>
+    ::vector_base(size_type n, no_init_t)
+      :m_storage(),
+       m_size(0)
+{
+  uninitialized_init(n, no_init_t());
+} // end vector_base::vector_base()
+
+template<typename T, typename Alloc>
+  vector_base<T,Alloc>
+    ::vector_base(size_type n, no_init_t, const Alloc &alloc)
+      :m_storage(alloc),
+       m_size(0)
+{
+  uninitialized_init(n, no_init_t());
+} // end vector_base::vector_base()
+
 template<typename T, typename Alloc>
   vector_base<T,Alloc>
     ::vector_base(size_type n, const value_type &value)
@@ -244,15 +358,24 @@ template<typename T, typename Alloc>
 template<typename T, typename Alloc>
   void vector_base<T,Alloc>
     ::default_init(size_type n)
+{
+  uninitialized_init(n, value_init_t());
+} // end vector_base::default_init()
+
+template<typename T, typename Alloc>
+  template<typename InitPolicy>
+    void vector_base<T,Alloc>
+      ::uninitialized_init(size_type n, InitPolicy)
 {
   if(n > 0)
   {
     m_storage.allocate(n);
     m_size = n;
 
-    m_storage.default_construct_n(begin(), size());
+    vector_base_detail::construct_init<size_type,InitPolicy> construct(n);
+    construct(m_storage, begin());
   } // end if
-} // end vector_base::default_init()
+} // end vector_base::uninitialized_init()
 
 template<typename T, typename Alloc>
   void vector_base<T,Alloc>
@@ -345,6 +468,28 @@ template<typename T, typename Alloc>
 template<typename T, typename Alloc>
   void vector_base<T,Alloc>
     ::resize(size_type new_size)
+{
+  resize_dispatch(new_size, value_init_t());
+} // end vector_base::resize()
+
+template<typename T, typename Alloc>
+  void vector_base<T,Alloc>
+    ::resize(size_type new_size, default_init_t)
+{
+  resize_dispatch(new_size, default_init_t());
+} // end vector_base::resize()
+
+template<typename T, typename Alloc>
+  void vector_base<T,Alloc>
+    ::resize(size_type new_size, no_init_t)
+{
+  resize_dispatch(new_size, no_init_t());
+} // end vector_base::resize()
+
+template<typename T, typename Alloc>
+  template<typename InitPolicy>
+    void vector_base<T,Alloc>
+      ::resize_dispatch(size_type new_size, InitPolicy init)
 {
   if(new_size < size())
   {
@@ -354,9 +499,9 @@ template<typename T, typename Alloc>
   } // end if
   else
   {
-    append(new_size - size());
+    append_init(new_size - size(), init);
   } // end else
-} // end vector_base::resize()
+} // end vector_base::resize_dispatch()
 
 template<typename T, typename Alloc>
   void vector_base<T,Alloc>
@@ -404,32 +549,8 @@ template<typename T, typename Alloc>
     // do not exceed maximum storage
     new_capacity = thrust::min THRUST_PREVENT_MACRO_SUBSTITUTION <size_type>(new_capacity, max_size());
 
-    // create new storage
-    storage_type new_storage(copy_allocator_t(), m_storage, new_capacity);
-
-    // record how many constructors we invoke in the try block below
-    iterator new_end = new_storage.begin();
-
-    try
-    {
-      // construct copy all elements into the newly allocated storage
-      new_end = m_storage.uninitialized_copy(begin(), end(), new_storage.begin());
-    } // end try
-    catch(...)
-    {
-      // something went wrong, so destroy & deallocate the new storage
-      new_storage.destroy(new_storage.begin(), new_end);
-      new_storage.deallocate();
-
-      // rethrow
-      throw;
-    } // end catch
-
-    // call destructors on the elements in the old storage
-    m_storage.destroy(begin(), end());
-
-    // record the vector's new state
-    m_storage.swap(new_storage);
+    // move all elements into the newly allocated storage
+    reallocate_and_construct(new_capacity, end(), 0, vector_base_detail::construct_nothing());
   } // end if
 } // end vector_base::reserve()
 
@@ -666,9 +787,124 @@ template<typename T, typename Alloc>
   void vector_base<T,Alloc>
     ::push_back(const value_type &x)
 {
-  insert(end(), x);
+  if(size() < capacity())
+  {
+    // construct the new element in place
+    m_storage.emplace_construct(end(), x);
+  } // end if
+  else
+  {
+    // move the elements into the newly allocated storage, followed by a copy of x,
+    // which may refer to an element of this vector_base
+    reallocate_and_construct(grown_capacity(1), end(), 1,
+                             vector_base_detail::construct_fill<T,size_type>(x, 1));
+  } // end else
+
+  ++m_size;
 } // end vector_base::push_back()
 
+template<typename T, typename Alloc>
+  void vector_base<T,Alloc>
+    ::push_back(value_type &&x)
+{
+  emplace_back(std::move(x));
+} // end vector_base::push_back()
+
+template<typename T, typename Alloc>
+  template<typename... Args>
+    typename vector_base<T,Alloc>::reference
+      vector_base<T,Alloc>
+        ::emplace_back(Args&&... args)
+{
+  if(size() < capacity())
+  {
+    // construct the new element in place
+    m_storage.emplace_construct(end(), std::forward<Args>(args)...);
+  } // end if
+  else
+  {
+    // args may refer to elements of this vector_base, so construct the new
+    // element before the storage is reallocated
+    value_type x(std::forward<Args>(args)...);
+
+    reallocate_and_construct(grown_capacity(1), end(), 0, vector_base_detail::construct_nothing());
+
+    m_storage.emplace_construct(end(), std::move(x));
+  } // end else
+
+  ++m_size;
+
+  return back();
+} // end vector_base::emplace_back()
+
+template<typename T, typename Alloc>
+  template<typename InputIterator>
+    void vector_base<T,Alloc>
+      ::append(InputIterator first, InputIterator last)
+{
+  // dispatch on traversal
+  append(first, last,
+    typename thrust::iterator_traversal<InputIterator>::type());
+} // end vector_base::append()
+
+template<typename T, typename Alloc>
+  template<typename InputIterator>
+    void vector_base<T,Alloc>
+      ::append(InputIterator first,
+               InputIterator last,
+               thrust::incrementable_traversal_tag)
+{
+  for(; first != last; ++first)
+    push_back(*first);
+} // end vector_base::append()
+
+template<typename T, typename Alloc>
+  template<typename ForwardIterator>
+    void vector_base<T,Alloc>
+      ::append(ForwardIterator first,
+               ForwardIterator last,
+               thrust::random_access_traversal_tag)
+{
+  const size_type n = thrust::distance(first, last);
+
+  if(n != 0)
+  {
+    if(capacity() - size() >= n)
+    {
+      // we've got room for all of them
+
+      // construct copy the range at the end of the vector
+      m_storage.uninitialized_copy(first, last, end());
+    } // end if
+    else
+    {
+      // move the elements into the newly allocated storage, followed by copies of the range,
+      // which may refer to elements of this vector_base
+      reallocate_and_construct(grown_capacity(n), end(), n,
+                               vector_base_detail::construct_copy<ForwardIterator>(first, last));
+    } // end else
+
+    // record the vector's new state
+    m_size += n;
+  } // end if
+} // end vector_base::append()
+
+template<typename T, typename Alloc>
+  typename vector_base<T,Alloc>::size_type
+    vector_base<T,Alloc>
+      ::grown_capacity(size_type n) const
+{
+  if(max_size() - size() < n)
+  {
+    throw std::length_error("vector_base: growth exceeds max_size().");
+  } // end if
+
+  // allocate exponentially larger new storage, but do not exceed maximum storage
+  size_type new_capacity = size() + thrust::max THRUST_PREVENT_MACRO_SUBSTITUTION (size(), n);
+  new_capacity = thrust::max THRUST_PREVENT_MACRO_SUBSTITUTION <size_type>(new_capacity, 2 * capacity());
+  return thrust::min THRUST_PREVENT_MACRO_SUBSTITUTION <size_type>(new_capacity, max_size());
+} // end vector_base::grown_capacity()
+
 template<typename T, typename Alloc>
   void vector_base<T,Alloc>
     ::pop_back(void)
@@ -885,47 +1121,20 @@ template<typename T, typename Alloc>
         throw std::length_error("insert(): insertion exceeds max_size().");
       } // end if
 
-      storage_type new_storage(copy_allocator_t(), m_storage, new_capacity);
-
-      // record how many constructors we invoke in the try block below
-      iterator new_end = new_storage.begin();
-
-      try
-      {
-        // construct copy elements before the insertion to the beginning of the newly
-        // allocated storage
-        new_end = m_storage.uninitialized_copy(begin(), position, new_storage.begin());
-
-        // construct copy elements to insert
-        new_end = m_storage.uninitialized_copy(first, last, new_end);
-
-        // construct copy displaced elements from the old storage to the new storage
-        // remember [position, end()) refers to the old storage
-        new_end = m_storage.uninitialized_copy(position, end(), new_end);
-      } // end try
-      catch(...)
-      {
-        // something went wrong, so destroy & deallocate the new storage
-        m_storage.destroy(new_storage.begin(), new_end);
-        new_storage.deallocate();
-
-        // rethrow
-        throw;
-      } // end catch
-
-      // call destructors on the elements in the old storage
-      m_storage.destroy(begin(), end());
+      // move the elements into the newly allocated storage around copies of the range
+      reallocate_and_construct(new_capacity, position, num_new_elements,
+                               vector_base_detail::construct_copy<ForwardIterator>(first, last));
 
       // record the vector's new state
-      m_storage.swap(new_storage);
       m_size = old_size + num_new_elements;
     } // end else
   } // end if
 } // end vector_base::copy_insert()
 
 template<typename T, typename Alloc>
-  void vector_base<T,Alloc>
-    ::append(size_type n)
+  template<typename InitPolicy>
+    void vector_base<T,Alloc>
+      ::append_init(size_type n, InitPolicy)
 {
   if(n != 0)
   {
@@ -933,8 +1142,9 @@ template<typename T, typename Alloc>
     {
       // we've got room for all of them
 
-      // default construct new elements at the end of the vector
-      m_storage.default_construct_n(end(), n);
+      // construct new elements at the end of the vector
+      vector_base_detail::construct_init<size_type,InitPolicy> construct(n);
+      construct(m_storage, end());
 
       // extend the size
       m_size += n;
@@ -952,40 +1162,15 @@ template<typename T, typename Alloc>
       // do not exceed maximum storage
       new_capacity = thrust::min THRUST_PREVENT_MACRO_SUBSTITUTION <size_type>(new_capacity, max_size());
 
-      // create new storage
-      storage_type new_storage(copy_allocator_t(), m_storage, new_capacity);
-
-      // record how many constructors we invoke in the try block below
-      iterator new_end = new_storage.begin();
-
-      try
-      {
-        // construct copy all elements into the newly allocated storage
-        new_end = m_storage.uninitialized_copy(begin(), end(), new_storage.begin());
-
-        // construct new elements to insert
-        new_storage.default_construct_n(new_end, n);
-        new_end += n;
-      } // end try
-      catch(...)
-      {
-        // something went wrong, so destroy & deallocate the new storage
-        new_storage.destroy(new_storage.begin(), new_end);
-        new_storage.deallocate();
-
-        // rethrow
-        throw;
-      } // end catch
-
-      // call destructors on the elements in the old storage
-      m_storage.destroy(begin(), end());
+      // move the elements into the newly allocated storage, followed by new elements
+      reallocate_and_construct(new_capacity, end(), n,
+                               vector_base_detail::construct_init<size_type,InitPolicy>(n));
 
       // record the vector's new state
-      m_storage.swap(new_storage);
       m_size    = old_size + n;
     } // end else
   } // end if
-} // end vector_base::append()
+} // end vector_base::append_init()
 
 template<typename T, typename Alloc>
   void vector_base<T,Alloc>
@@ -1053,40 +1238,11 @@ template<typename T, typename Alloc>
         throw std::length_error("insert(): insertion exceeds max_size().");
       } // end if
 
-      storage_type new_storage(copy_allocator_t(), m_storage, new_capacity);
-
-      // record how many constructors we invoke in the try block below
-      iterator new_end = new_storage.begin();
-
-      try
-      {
-        // construct copy elements before the insertion to the beginning of the newly
-        // allocated storage
-        new_end = m_storage.uninitialized_copy(begin(), position, new_storage.begin());
-
-        // construct new elements to insert
-        m_storage.uninitialized_fill_n(new_end, n, x);
-        new_end += n;
-
-        // construct copy displaced elements from the old storage to the new storage
-        // remember [position, end()) refers to the old storage
-        new_end = m_storage.uninitialized_copy(position, end(), new_end);
-      } // end try
-      catch(...)
-      {
-        // something went wrong, so destroy & deallocate the new storage
-        m_storage.destroy(new_storage.begin(), new_end);
-        new_storage.deallocate();
-
-        // rethrow
-        throw;
-      } // end catch
-
-      // call destructors on the elements in the old storage
-      m_storage.destroy(begin(), end());
+      // move the elements into the newly allocated storage around copies of x
+      reallocate_and_construct(new_capacity, position, n,
+                               vector_base_detail::construct_fill<T,size_type>(x, n));
 
       // record the vector's new state
-      m_storage.swap(new_storage);
       m_size    = old_size + n;
     } // end else
   } // end if
@@ -1217,6 +1373,102 @@ template<typename T, typename Alloc>
   } // end else
 } // end vector_base::fill_assign()
 
+template<typename T, typename Alloc>
+  template<typename Constructor>
+    void vector_base<T,Alloc>
+      ::reallocate_and_construct(size_type new_capacity,
+                                 iterator position,
+                                 size_type n,
+                                 Constructor construct)
+{
+  reallocate_and_construct(new_capacity, position, n, construct,
+    typename storage_type::is_trivially_relocatable());
+} // end vector_base::reallocate_and_construct()
+
+template<typename T, typename Alloc>
+  template<typename Constructor>
+    void vector_base<T,Alloc>
+      ::reallocate_and_construct(size_type new_capacity,
+                                 iterator position,
+                                 size_type n,
+                                 Constructor construct,
+                                 true_type)
+{
+  storage_type new_storage(copy_allocator_t(), m_storage, new_capacity);
+
+  iterator new_position = new_storage.begin();
+  thrust::advance(new_position, position - begin());
+
+  try
+  {
+    // construct the new elements first, while the old storage, which
+    // they may be copied from, is still intact
+    construct(m_storage, new_position);
+  } // end try
+  catch(...)
+  {
+    // something went wrong, so deallocate the new storage
+    new_storage.deallocate();
+
+    // rethrow
+    throw;
+  } // end catch
+
+  // relocate the elements around the new ones, which cannot fail
+  // remember [begin(), end()) refers to the old storage
+  m_storage.uninitialized_relocate(begin(), position, new_storage.begin());
+  m_storage.uninitialized_relocate(position, end(), new_position + n);
+
+  // record the vector's new state; the old storage holds no elements anymore
+  // and is deallocated along with new_storage
+  m_storage.swap(new_storage);
+} // end vector_base::reallocate_and_construct()
+
+template<typename T, typename Alloc>
+  template<typename Constructor>
+    void vector_base<T,Alloc>
+      ::reallocate_and_construct(size_type new_capacity,
+                                 iterator position,
+                                 size_type n,
+                                 Constructor construct,
+                                 false_type)
+{
+  storage_type new_storage(copy_allocator_t(), m_storage, new_capacity);
+
+  // record how many constructors we invoke in the try block below
+  iterator new_end = new_storage.begin();
+
+  try
+  {
+    // construct copy elements before the insertion to the beginning of the newly
+    // allocated storage
+    new_end = m_storage.uninitialized_copy(begin(), position, new_storage.begin());
+
+    // construct new elements to insert
+    construct(m_storage, new_end);
+    new_end += n;
+
+    // construct copy displaced elements from the old storage to the new storage
+    // remember [position, end()) refers to the old storage
+    new_end = m_storage.uninitialized_copy(position, end(), new_end);
+  } // end try
+  catch(...)
+  {
+    // something went wrong, so destroy & deallocate the new storage
+    m_storage.destroy(new_storage.begin(), new_end);
+    new_storage.deallocate();
+
+    // rethrow
+    throw;
+  } // end catch
+
+  // call destructors on the elements in the old storage
+  m_storage.destroy(begin(), end());
+
+  // record the vector's new state
+  m_storage.swap(new_storage);
+} // end vector_base::reallocate_and_construct()
+
 template<typename T, typename Alloc>
   template<typename ForwardIterator>
     void vector_base<T,Alloc>
@@ -0,0 +1,260 @@
+/*
+ *  Copyright 2023 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file mdspan.h
+ *  \brief Algorithms over multidimensional index spaces and mdspans
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_STD_VER >= 2014
+
+#include <thrust/detail/execution_policy.h>
+
+#include <cuda/std/cstddef>
+#include <cuda/std/mdspan>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup modifying
+ *  \ingroup transformations
+ *  \{
+ */
+
+
+/*! \p for_each_index calls a function for every multidimensional index of an
+ *  index space, given as a \c cuda::std::extents. For a space of rank \c N,
+ *  \p f is called as <tt>f(i0, i1, ..., iN-1)</tt>; for a space of rank zero,
+ *  \p f is called once, with no arguments. The order of the calls is
+ *  unspecified.
+ *
+ *  Unlike a \p for_each over a \p counting_iterator, \p for_each_index does
+ *  not decode every index from a linear position. The CPU backends split the
+ *  space into contiguous groups of rows, that is runs of indices along the
+ *  last dimension, and each thread walks its rows in order.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param extents The index space.
+ *  \param f The function to call for every index.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam IndexType The index type of the extents.
+ *  \tparam Extents The static extents of the index space.
+ *  \tparam Function is callable with \c N arguments of type \p IndexType.
+ *
+ *  The following code snippet demonstrates how to use \p for_each_index to
+ *  compute a Laplacian of the interior of a 3-D grid using the
+ *  \p thrust::omp::par execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/mdspan.h>
+ *  #include <thrust/system/omp/execution_policy.h>
+ *  ...
+ *  struct laplacian
+ *  {
+ *    cuda::std::mdspan<const float, cuda::std::dextents<int, 3>> in;
+ *    cuda::std::mdspan<float, cuda::std::dextents<int, 3>> out;
+ *
+ *    void operator()(int i, int j, int k) const
+ *    {
+ *      out(i + 1, j + 1, k + 1) = in(i, j + 1, k + 1) + in(i + 2, j + 1, k + 1)
+ *                               + in(i + 1, j, k + 1) + in(i + 1, j + 2, k + 1)
+ *                               + in(i + 1, j + 1, k) + in(i + 1, j + 1, k + 2)
+ *                               - 6 * in(i + 1, j + 1, k + 1);
+ *    }
+ *  };
+ *  ...
+ *  cuda::std::dextents<int, 3> interior(nx - 2, ny - 2, nz - 2);
+ *  thrust::for_each_index(thrust::omp::par, interior, laplacian{in, out});
+ *  \endcode
+ *
+ *  \see for_each
+ */
+template <typename DerivedPolicy, typename IndexType, ::cuda::std::size_t... Extents, typename Function>
+_CCCL_HOST_DEVICE
+void for_each_index(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                    const ::cuda::std::extents<IndexType, Extents...> &extents,
+                    Function f);
+
+
+/*! \p for_each_index calls a function for every multidimensional index of an
+ *  index space. This version runs on the device system.
+ *
+ *  \param extents The index space.
+ *  \param f The function to call for every index.
+ *
+ *  \see for_each_index
+ */
+template <typename IndexType, ::cuda::std::size_t... Extents, typename Function>
+void for_each_index(const ::cuda::std::extents<IndexType, Extents...> &extents,
+                    Function f);
+
+
+/*! This version of \p transform applies a unary function to every element of
+ *  an mdspan and stores the result in the element with the same index of
+ *  another mdspan: for every index <tt>i...</tt> of <tt>in.extents()</tt>, it
+ *  performs the assignment <tt>out(i...) = op(in(i...))</tt>.
+ *
+ *  The index space is traversed in the storage order of \p out, so that
+ *  \c layout_left outputs are walked column by column.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param in The input mdspan.
+ *  \param out The output mdspan.
+ *  \param op The transformation operation.
+ *
+ *  \pre <tt>in.extents() == out.extents()</tt>.
+ *  \pre \p in and \p out may refer to the same elements if their mappings
+ *       are equal, but may otherwise not overlap.
+ *
+ *  \see for_each_index
+ */
+template <typename DerivedPolicy,
+          typename T, typename InExtents, typename InLayout, typename InAccessor,
+          typename U, typename OutExtents, typename OutLayout, typename OutAccessor,
+          typename UnaryFunction>
+_CCCL_HOST_DEVICE
+void transform(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+               const ::cuda::std::mdspan<T, InExtents, InLayout, InAccessor> &in,
+               const ::cuda::std::mdspan<U, OutExtents, OutLayout, OutAccessor> &out,
+               UnaryFunction op);
+
+
+/*! This version of \p transform applies a unary function to every element of
+ *  an mdspan and stores the result in the element with the same index of
+ *  another mdspan. The system is selected from the data handle types of the
+ *  mdspans.
+ *
+ *  \param in The input mdspan.
+ *  \param out The output mdspan.
+ *  \param op The transformation operation.
+ *
+ *  \pre <tt>in.extents() == out.extents()</tt>.
+ *
+ *  \see for_each_index
+ */
+template <typename T, typename InExtents, typename InLayout, typename InAccessor,
+          typename U, typename OutExtents, typename OutLayout, typename OutAccessor,
+          typename UnaryFunction>
+void transform(const ::cuda::std::mdspan<T, InExtents, InLayout, InAccessor> &in,
+               const ::cuda::std::mdspan<U, OutExtents, OutLayout, OutAccessor> &out,
+               UnaryFunction op);
+
+
+/*! \} // end modifying
+ */
+
+
+/*! \addtogroup reductions
+ *  \{
+ */
+
+
+/*! This version of \p reduce reduces the elements of an mdspan with
+ *  \p binary_op, starting from \p init. The elements are visited in storage
+ *  order, so \p binary_op must be associative but need not be commutative.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param x The mdspan to reduce.
+ *  \param init The initial value.
+ *  \param binary_op The binary function used to 'sum' values.
+ *  \return The result of the reduction.
+ *
+ *  \see for_each_index
+ */
+template <typename DerivedPolicy,
+          typename T, typename Extents, typename Layout, typename Accessor,
+          typename OutputType, typename BinaryFunction>
+_CCCL_HOST_DEVICE
+OutputType reduce(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                  const ::cuda::std::mdspan<T, Extents, Layout, Accessor> &x,
+                  OutputType init,
+                  BinaryFunction binary_op);
+
+
+/*! This version of \p reduce sums the elements of an mdspan, starting from
+ *  \p init.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param x The mdspan to reduce.
+ *  \param init The initial value.
+ *  \return The result of the reduction.
+ */
+template <typename DerivedPolicy,
+          typename T, typename Extents, typename Layout, typename Accessor,
+          typename OutputType>
+_CCCL_HOST_DEVICE
+OutputType reduce(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                  const ::cuda::std::mdspan<T, Extents, Layout, Accessor> &x,
+                  OutputType init);
+
+
+/*! This version of \p reduce reduces the elements of an mdspan with
+ *  \p binary_op, starting from \p init. The system is selected from the data
+ *  handle type of the mdspan.
+ *
+ *  \param x The mdspan to reduce.
+ *  \param init The initial value.
+ *  \param binary_op The binary function used to 'sum' values.
+ *  \return The result of the reduction.
+ */
+template <typename T, typename Extents, typename Layout, typename Accessor,
+          typename OutputType, typename BinaryFunction>
+OutputType reduce(const ::cuda::std::mdspan<T, Extents, Layout, Accessor> &x,
+                  OutputType init,
+                  BinaryFunction binary_op);
+
+
+/*! This version of \p reduce sums the elements of an mdspan, starting from
+ *  \p init. The system is selected from the data handle type of the mdspan.
+ *
+ *  \param x The mdspan to reduce.
+ *  \param init The initial value.
+ *  \return The result of the reduction.
+ */
+template <typename T, typename Extents, typename Layout, typename Accessor,
+          typename OutputType>
+OutputType reduce(const ::cuda::std::mdspan<T, Extents, Layout, Accessor> &x,
+                  OutputType init);
+
+
+/*! \} // end reductions
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/mdspan.inl>
+
+#endif // _CCCL_STD_VER >= 2014
@@ -0,0 +1,214 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file thrust/profiling.h
+ *  \brief Callbacks which observe the algorithms called through Thrust
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/cpp11_required.h>
+
+#if _CCCL_STD_VER >= 2011
+
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup utility
+ *  \{
+ */
+
+/*! \p thrust::profiling observes the calls of Thrust algorithms on the host.
+ *
+ *  Profiling is disabled unless \c THRUST_ENABLE_PROFILING is defined before
+ *  any Thrust header is included; when it is disabled the algorithms contain
+ *  no instrumentation at all. The macro must be defined consistently across
+ *  all translation units of a program.
+ *
+ *  When it is enabled, every call of an algorithm such as \p thrust::sort,
+ *  \p thrust::reduce or \p thrust::inclusive_scan through an execution
+ *  policy, explicit or selected from the iterators, is reported to the
+ *  installed \p callback when it returns. Algorithms which other algorithms
+ *  call internally are reported as well, with a larger \p event::depth.
+ *
+ *  Unless another callback is installed, events are collected by a
+ *  \p summary which is printed to \c std::cerr at program exit.
+ */
+namespace profiling
+{
+
+/*! \p event describes one call of a Thrust algorithm.
+ */
+struct event
+{
+  /*! The name of the algorithm, e.g. \c "sort".
+   */
+  const char *algorithm;
+
+  /*! The backend system which executed the algorithm: \c "cpp", \c "omp",
+   *  \c "tbb", \c "cuda", \c "seq" or \c "unknown".
+   */
+  const char *system;
+
+  /*! The number of elements of the (first) input range. Zero if its
+   *  iterators do not provide random access.
+   */
+  std::size_t num_items;
+
+  /*! The number of bytes allocated through \p temporary_array during the
+   *  call, including the allocations of nested algorithms.
+   */
+  std::size_t temporary_bytes;
+
+  /*! The time at which the algorithm was called.
+   */
+  std::chrono::steady_clock::time_point start;
+
+  /*! The wall time the call took.
+   */
+  std::chrono::steady_clock::duration duration;
+
+  /*! The number of profiled algorithms which were executing on the calling
+   *  thread when this one was called.
+   */
+  int depth;
+
+  /*! The calling thread.
+   */
+  std::thread::id thread;
+};
+
+/*! \p callback is the interface of the receivers of profiling events.
+ */
+class callback
+{
+public:
+  virtual ~callback() {}
+
+  /*! Called when a profiled algorithm returns. Algorithms called on several
+   *  threads at once record concurrently, so implementations must synchronize.
+   */
+  virtual void record(const event &e) = 0;
+};
+
+/*! Installs \p cb as the receiver of profiling events; \c nullptr discards
+ *  them. The callback must outlive its installation.
+ *
+ *  \return The previously installed callback.
+ */
+inline callback *set_callback(callback *cb);
+
+/*! \return The installed callback.
+ */
+inline callback *get_callback();
+
+/*! \p summary aggregates the time and the temporary storage of the
+ *  outermost algorithm calls, i.e. those with a depth of zero, per algorithm
+ *  and system.
+ */
+class summary : public callback
+{
+public:
+  /*! One row of the summary.
+   */
+  struct row
+  {
+    std::string algorithm;
+    std::string system;
+    std::size_t calls;
+    std::size_t num_items;
+    std::size_t temporary_bytes;
+    std::chrono::steady_clock::duration time;
+  };
+
+  void record(const event &e) override;
+
+  /*! \return The rows of the summary, the most expensive first.
+   */
+  std::vector<row> rows() const;
+
+  /*! Prints the rows as a table.
+   */
+  void print(std::ostream &os) const;
+
+  /*! Forgets all recorded events.
+   */
+  void clear();
+
+private:
+  mutable std::mutex m_mutex;
+  std::map<std::pair<std::string, std::string>, row> m_rows;
+};
+
+/*! \p chrome_trace writes the recorded events in the Trace Event Format,
+ *  which \c chrome://tracing and Perfetto display as a timeline with one
+ *  track per thread.
+ */
+class chrome_trace : public callback
+{
+public:
+  /*! Creates a trace which is only written on request.
+   */
+  chrome_trace();
+
+  /*! Creates a trace which is written to the file \p filename when it is
+   *  destroyed.
+   */
+  explicit chrome_trace(std::string filename);
+
+  ~chrome_trace();
+
+  void record(const event &e) override;
+
+  /*! Writes the events recorded so far as JSON.
+   */
+  void write(std::ostream &os) const;
+
+private:
+  std::string m_filename;
+  std::chrono::steady_clock::time_point m_epoch;
+  mutable std::mutex m_mutex;
+  std::vector<event> m_events;
+};
+
+} // end profiling
+
+/*! \} // end utility
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/profiling.inl>
+
+#endif // _CCCL_STD_VER >= 2011
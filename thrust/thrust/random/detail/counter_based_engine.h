@@ -0,0 +1,274 @@
+/*
+ *  Copyright 2023 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/random/detail/random_core_access.h>
+
+#include <cuda/std/array>
+
+#include <cstddef> // for size_t
+#include <iostream>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+namespace detail
+{
+
+// The part shared by the counter-based engines, whose n-word output blocks
+// are a keyed bijection of an n-word counter. Derived is the engine, and
+// supplies
+//
+//   void generate_block(const result_type (&counter)[n], result_type (&block)[n]) const;
+//
+// which applies the bijection with the key in m_k. The state is the counter
+// of the next block X, the current block Y and the index j of the element of
+// Y which was returned last. Because the blocks are independent, discarding
+// any number of values costs an addition to the counter and one block.
+template<typename Derived, typename UIntType, size_t w, size_t n, size_t key_size>
+  class counter_based_engine
+{
+  public:
+    typedef UIntType result_type;
+
+    static const size_t word_size = w;
+
+    static const size_t word_count = n;
+
+    static const result_type min = 0;
+
+    static const result_type max = ((UIntType(1) << (w - 1)) - 1) * 2 + 1;
+
+    static const result_type default_seed = 20111115u;
+
+    _CCCL_HOST_DEVICE
+    void seed(result_type value = default_seed)
+    {
+      m_k[0] = value & max;
+      for(size_t i = 1; i < key_size; ++i)
+      {
+        m_k[i] = 0;
+      }
+
+      reset_counter();
+    }
+
+    _CCCL_HOST_DEVICE
+    void set_counter(const ::cuda::std::array<result_type, n> &counter)
+    {
+      // counter[0] is the most significant word, as for std::philox_engine
+      for(size_t i = 0; i < n; ++i)
+      {
+        m_x[n - 1 - i] = counter[i] & max;
+      }
+
+      m_j = n - 1;
+    }
+
+    _CCCL_HOST_DEVICE
+    result_type operator()(void)
+    {
+      if(++m_j == n)
+      {
+        next_block();
+        m_j = 0;
+      }
+
+      return m_y[m_j];
+    }
+
+    _CCCL_HOST_DEVICE
+    void discard(unsigned long long z)
+    {
+      const unsigned long long buffered = n - 1 - m_j;
+
+      if(z <= buffered)
+      {
+        m_j += static_cast<size_t>(z);
+        return;
+      }
+
+      z -= buffered;
+
+      // skip the whole blocks, then generate the block the remaining values
+      // come from
+      add_to_counter(z / n);
+
+      const size_t remainder = static_cast<size_t>(z % n);
+
+      if(remainder == 0)
+      {
+        m_j = n - 1;
+      }
+      else
+      {
+        next_block();
+        m_j = remainder - 1;
+      }
+    }
+
+    template<typename OutputIterator>
+    _CCCL_HOST_DEVICE
+    void generate(OutputIterator first, OutputIterator last)
+    {
+      // drain the current block
+      for(; first != last && m_j != n - 1; ++first)
+      {
+        *first = m_y[++m_j];
+      }
+
+      // whole blocks straight from the bijection
+      for(; first != last; )
+      {
+        next_block();
+
+        size_t i = 0;
+        for(; i != n && first != last; ++i, ++first)
+        {
+          *first = m_y[i];
+        }
+
+        m_j = i - 1;
+      }
+    }
+
+  protected:
+    friend struct thrust::random::detail::random_core_access;
+
+    result_type m_x[n];
+    result_type m_k[key_size];
+    result_type m_y[n];
+    size_t m_j;
+
+    _CCCL_HOST_DEVICE
+    void reset_counter()
+    {
+      for(size_t i = 0; i < n; ++i)
+      {
+        m_x[i] = 0;
+      }
+
+      m_j = n - 1;
+    }
+
+    _CCCL_HOST_DEVICE
+    bool equal(const counter_based_engine &rhs) const
+    {
+      bool result = (m_j == rhs.m_j);
+
+      for(size_t i = 0; i < n; ++i)
+      {
+        result &= (m_x[i] == rhs.m_x[i]);
+      }
+
+      for(size_t i = 0; i < key_size; ++i)
+      {
+        result &= (m_k[i] == rhs.m_k[i]);
+      }
+
+      return result;
+    }
+
+    template<typename CharT, typename Traits>
+    std::basic_ostream<CharT,Traits>& stream_out(std::basic_ostream<CharT,Traits> &os) const
+    {
+      typedef std::basic_ostream<CharT,Traits> ostream_type;
+      typedef typename ostream_type::ios_base  ios_base;
+
+      const typename ios_base::fmtflags flags = os.flags();
+      const CharT fill  = os.fill();
+      const CharT space = os.widen(' ');
+      os.flags(ios_base::dec | ios_base::fixed | ios_base::left);
+      os.fill(space);
+
+      for(size_t i = 0; i < key_size; ++i)
+        os << m_k[i] << space;
+      for(size_t i = 0; i < n; ++i)
+        os << m_x[i] << space;
+      for(size_t i = 0; i < n; ++i)
+        os << m_y[i] << space;
+      os << m_j;
+
+      os.flags(flags);
+      os.fill(fill);
+      return os;
+    }
+
+    template<typename CharT, typename Traits>
+    std::basic_istream<CharT,Traits>& stream_in(std::basic_istream<CharT,Traits> &is)
+    {
+      typedef std::basic_istream<CharT,Traits> istream_type;
+      typedef typename istream_type::ios_base  ios_base;
+
+      const typename ios_base::fmtflags flags = is.flags();
+      is.flags(ios_base::dec | ios_base::skipws);
+
+      for(size_t i = 0; i < key_size; ++i)
+        is >> m_k[i];
+      for(size_t i = 0; i < n; ++i)
+        is >> m_x[i];
+      for(size_t i = 0; i < n; ++i)
+        is >> m_y[i];
+      is >> m_j;
+
+      is.flags(flags);
+      return is;
+    }
+
+  private:
+    // Y = bijection(X), X = X + 1
+    _CCCL_HOST_DEVICE
+    void next_block()
+    {
+      static_cast<const Derived&>(*this).generate_block(m_x, m_y);
+      add_to_counter(1);
+    }
+
+    // X = X + z, modulo 2^(n w)
+    _CCCL_HOST_DEVICE
+    void add_to_counter(unsigned long long z)
+    {
+      for(size_t i = 0; i < n && z != 0; ++i)
+      {
+        const result_type word = static_cast<result_type>(z & max);
+        const result_type sum  = (m_x[i] + word) & max;
+
+        // z's bits above the word, plus the carry out of it
+        z = (w < 64 ? (z >> (w % 64)) : 0) + (sum < word ? 1 : 0);
+
+        m_x[i] = sum;
+      }
+    }
+}; // end counter_based_engine
+
+} // end detail
+
+} // end random
+
+THRUST_NAMESPACE_END
+
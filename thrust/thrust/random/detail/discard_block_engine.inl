@@ -103,11 +103,32 @@ template<typename Engine, size_t p, size_t r>
   void discard_block_engine<Engine,p,r>
     ::discard(unsigned long long z)
 {
-  // XXX this should be accelerated
-  for(; z > 0; --z)
+  // the values left in the current block
+  const unsigned long long left = used_block - m_n;
+
+  if(z <= left)
   {
-    this->operator()();
-  } // end for
+    m_e.discard(z);
+    m_n += static_cast<unsigned int>(z);
+    return;
+  }
+
+  // after the current block come some full blocks, and finally a block of
+  // which rest values are used; the base engine skips block_size - used_block
+  // values before each of them
+  z -= left;
+  unsigned long long blocks = (z - 1) / used_block;
+  const unsigned long long rest = z - blocks * used_block;
+
+  // keep the number of base values to discard from overflowing
+  const unsigned long long max_blocks = (~0ull - 2 * block_size) / block_size;
+  for(; blocks > max_blocks; blocks -= max_blocks)
+  {
+    m_e.discard(max_blocks * block_size);
+  }
+
+  m_e.discard(left + blocks * block_size + (block_size - used_block) + rest);
+  m_n = static_cast<unsigned int>(rest);
 }
 
 
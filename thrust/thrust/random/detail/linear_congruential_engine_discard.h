@@ -38,51 +38,108 @@ namespace detail
 {
 
 
-template<typename UIntType, UIntType a, unsigned long long c, UIntType m>
-  struct linear_congruential_engine_discard_implementation
+// computes (x * y) mod m, where a modulus of zero stands for 2^w and the
+// product is allowed to wrap around
+template<typename UIntType>
+_CCCL_HOST_DEVICE
+  UIntType mul_mod(UIntType x, UIntType y, UIntType m)
 {
-  _CCCL_HOST_DEVICE
-  static void discard(UIntType &state, unsigned long long z)
+  if(m == 0)
   {
-    for(; z > 0; --z)
+    return static_cast<UIntType>(static_cast<unsigned long long>(x) * y);
+  }
+
+  THRUST_IF_CONSTEXPR(sizeof(UIntType) <= sizeof(thrust::detail::uint32_t))
+  {
+    return static_cast<UIntType>((static_cast<unsigned long long>(x) * y) % m);
+  }
+  else
+  {
+#if defined(__SIZEOF_INT128__)
+    return static_cast<UIntType>((static_cast<unsigned __int128>(x) * y) % m);
+#else
+    // double-and-add, which never overflows as long as x, y < m
+    x %= m;
+    y %= m;
+
+    UIntType result = 0;
+    for(; y > 0; y >>= 1)
     {
-      state = detail::mod<UIntType,a,c,m>(state);
+      if(y & 1)
+      {
+        result = (result >= m - x) ? result - (m - x) : result + x;
+      }
+      x = (x >= m - x) ? x - (m - x) : x + x;
     }
+
+    return result;
+#endif
   }
-}; // end linear_congruential_engine_discard
+} // end mul_mod()
+
+
+// computes (x + y) mod m, where x, y < m and a modulus of zero stands for 2^w
+template<typename UIntType>
+_CCCL_HOST_DEVICE
+  UIntType add_mod(UIntType x, UIntType y, UIntType m)
+{
+  if(m == 0)
+  {
+    return static_cast<UIntType>(x + y);
+  }
+
+  return (x >= m - y) ? static_cast<UIntType>(x - (m - y)) : static_cast<UIntType>(x + y);
+} // end add_mod()
 
 
-// specialize for small integers and c == 0
-// XXX figure out a robust implemenation of this for any unsigned integer type later
-template<thrust::detail::uint32_t a, thrust::detail::uint32_t m>
-  struct linear_congruential_engine_discard_implementation<thrust::detail::uint32_t,a,0,m>
+// The transition x -> a * x + c (mod m) is an affine map, and z transitions
+// are the affine map x -> A * x + C, where A = a^z and C = c * (a^(z-1) + ... + 1).
+// Composing the maps of the bits of z by repeated squaring computes A and C
+// in O(log z) steps.
+template<typename UIntType, UIntType a, unsigned long long c, UIntType m,
+         bool = static_mod<UIntType,a,static_cast<UIntType>(c),m>::is_exact>
+  struct linear_congruential_engine_discard_implementation
 {
   _CCCL_HOST_DEVICE
-  static void discard(thrust::detail::uint32_t &state, unsigned long long z)
+  static void discard(UIntType &state, unsigned long long z)
   {
-    const thrust::detail::uint32_t modulus = m;
+    // the map of 2^i transitions, i being the current bit of z
+    UIntType multiplier = a;
+    UIntType increment  = static_cast<UIntType>(c);
 
-    // XXX we need to use unsigned long long here or we will encounter overflow in the
-    //     multiplies below
-    //     figure out a robust implementation of this later
-    unsigned long long multiplier = a;
-    unsigned long long multiplier_to_z = 1;
+    // the map of the transitions of the bits of z visited so far
+    UIntType multiplier_to_z = 1;
+    UIntType increment_to_z  = 0;
 
-    // see http://en.wikipedia.org/wiki/Modular_exponentiation
-    while(z > 0)
+    for(; z > 0; z >>= 1)
     {
       if(z & 1)
       {
-        // multiply in this bit's contribution while using modulus to keep result small
-        multiplier_to_z = (multiplier_to_z * multiplier) % modulus;
+        multiplier_to_z = mul_mod<UIntType>(multiplier, multiplier_to_z, m);
+        increment_to_z  = add_mod<UIntType>(mul_mod<UIntType>(multiplier, increment_to_z, m), increment, m);
       }
 
-      // move to the next bit of the exponent, square (and mod) the base accordingly
-      z >>= 1;
-      multiplier = (multiplier * multiplier) % modulus;
+      increment  = add_mod<UIntType>(mul_mod<UIntType>(multiplier, increment, m), increment, m);
+      multiplier = mul_mod<UIntType>(multiplier, multiplier, m);
     }
 
-    state = static_cast<thrust::detail::uint32_t>((multiplier_to_z * state) % modulus);
+    state = add_mod<UIntType>(mul_mod<UIntType>(multiplier_to_z, state, m), increment_to_z, m);
+  }
+}; // end linear_congruential_engine_discard
+
+
+// operator() does not compute a * x + c (mod m) when Schrage's method is not
+// exact for a and m, so its values are no affine map and have to be stepped
+template<typename UIntType, UIntType a, unsigned long long c, UIntType m>
+  struct linear_congruential_engine_discard_implementation<UIntType,a,c,m,false>
+{
+  _CCCL_HOST_DEVICE
+  static void discard(UIntType &state, unsigned long long z)
+  {
+    for(; z > 0; --z)
+    {
+      state = detail::mod<UIntType,a,static_cast<UIntType>(c),m>(state);
+    }
   }
 }; // end linear_congruential_engine_discard
 
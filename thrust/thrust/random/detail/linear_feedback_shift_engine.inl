@@ -67,10 +67,7 @@ template<typename UIntType, size_t w, size_t k, size_t q, size_t s>
   void linear_feedback_shift_engine<UIntType,w,k,q,s>
     ::discard(unsigned long long z)
 {
-  for(; z > 0; --z)
-  {
-    this->operator()();
-  } // end for
+  thrust::random::detail::linear_feedback_shift_engine_discard::discard(*this,z);
 } // end linear_feedback_shift_engine::discard()
 
 
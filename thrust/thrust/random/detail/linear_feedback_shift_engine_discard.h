@@ -0,0 +1,122 @@
+/*
+ *  Copyright 2023 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cstddef> // for size_t
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+namespace detail
+{
+
+
+// The transition of a linear_feedback_shift_engine is a linear map of its
+// w-bit state over GF(2). gf2_matrix stores such a map as its w columns: the
+// images of the state words with a single bit set.
+template<typename UIntType, size_t w>
+  struct gf2_matrix
+{
+  UIntType column[w];
+
+  _CCCL_HOST_DEVICE
+  UIntType operator()(UIntType x) const
+  {
+    UIntType result = 0;
+    for(size_t i = 0; i < w; ++i)
+    {
+      // xor in column i if bit i of x is set
+      result ^= column[i] & (UIntType(0) - ((x >> i) & 1u));
+    }
+    return result;
+  }
+
+  _CCCL_HOST_DEVICE
+  void square()
+  {
+    gf2_matrix copy = *this;
+    for(size_t i = 0; i < w; ++i)
+    {
+      column[i] = copy(copy.column[i]);
+    }
+  }
+}; // end gf2_matrix
+
+
+struct linear_feedback_shift_engine_discard
+{
+  // z transitions multiply the state by the z-th power of the transition
+  // matrix, which repeated squaring computes in O(w^2 log z) steps
+  template<typename LinearFeedbackShiftEngine>
+  _CCCL_HOST_DEVICE
+  static void discard(LinearFeedbackShiftEngine &lfsr, unsigned long long z)
+  {
+    typedef typename LinearFeedbackShiftEngine::result_type result_type;
+    const size_t w = LinearFeedbackShiftEngine::word_size;
+
+    // squaring the matrix costs about as much as w^2 transitions, and a jump
+    // by less than 16 w^2 does not pay off
+    if(z < 16 * w * w)
+    {
+      for(; z > 0; --z)
+      {
+        lfsr();
+      }
+      return;
+    }
+
+    gf2_matrix<result_type,w> matrix;
+    for(size_t i = 0; i < w; ++i)
+    {
+      LinearFeedbackShiftEngine unit(result_type(1) << i);
+      matrix.column[i] = unit();
+    }
+
+    for(; z > 0; z >>= 1)
+    {
+      if(z & 1)
+      {
+        lfsr.m_value = matrix(lfsr.m_value);
+      }
+
+      if(z > 1)
+      {
+        matrix.square();
+      }
+    }
+  }
+}; // end linear_feedback_shift_engine_discard
+
+
+} // end detail
+
+} // end random
+
+THRUST_NAMESPACE_END
+
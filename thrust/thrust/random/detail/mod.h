@@ -40,6 +40,10 @@ template<typename T, T a, T c, T m, bool = (m == 0)>
   static const T q = m / a;
   static const T r = m % a;
 
+  // Schrage's method only computes a * x mod m when r < q, otherwise t2 may
+  // overflow or exceed t1 by more than m
+  static const bool is_exact = (a == 1) || (r < q);
+
   _CCCL_HOST_DEVICE
   T operator()(T x) const
   {
@@ -83,6 +87,8 @@ template<typename T, T a, T c, T m, bool = (m == 0)>
 template<typename T, T a, T c, T m>
   struct static_mod<T,a,c,m,true>
 {
+  static const bool is_exact = true;
+
   _CCCL_HOST_DEVICE
   T operator()(T x) const
   {
@@ -0,0 +1,80 @@
+/*
+ *  Copyright 2023 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/cstdint.h>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+namespace detail
+{
+
+// the high and low words of the 2w-bit product of a and b
+_CCCL_HOST_DEVICE
+inline void mulhilo(thrust::detail::uint32_t a, thrust::detail::uint32_t b,
+                    thrust::detail::uint32_t &hi, thrust::detail::uint32_t &lo)
+{
+  const thrust::detail::uint64_t product = static_cast<thrust::detail::uint64_t>(a) * b;
+  hi = static_cast<thrust::detail::uint32_t>(product >> 32);
+  lo = static_cast<thrust::detail::uint32_t>(product);
+}
+
+_CCCL_HOST_DEVICE
+inline void mulhilo(thrust::detail::uint64_t a, thrust::detail::uint64_t b,
+                    thrust::detail::uint64_t &hi, thrust::detail::uint64_t &lo)
+{
+#if defined(__SIZEOF_INT128__)
+  const unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+  hi = static_cast<thrust::detail::uint64_t>(product >> 64);
+  lo = static_cast<thrust::detail::uint64_t>(product);
+#else
+  // schoolbook multiplication of 32-bit halves
+  const thrust::detail::uint64_t mask = 0xFFFFFFFFull;
+  const thrust::detail::uint64_t a_lo = a & mask, a_hi = a >> 32;
+  const thrust::detail::uint64_t b_lo = b & mask, b_hi = b >> 32;
+
+  const thrust::detail::uint64_t ll = a_lo * b_lo;
+  const thrust::detail::uint64_t lh = a_lo * b_hi;
+  const thrust::detail::uint64_t hl = a_hi * b_lo;
+  const thrust::detail::uint64_t hh = a_hi * b_hi;
+
+  const thrust::detail::uint64_t middle = (ll >> 32) + (lh & mask) + (hl & mask);
+
+  hi = hh + (lh >> 32) + (hl >> 32) + (middle >> 32);
+  lo = (middle << 32) | (ll & mask);
+#endif
+}
+
+} // end detail
+
+} // end random
+
+THRUST_NAMESPACE_END
+
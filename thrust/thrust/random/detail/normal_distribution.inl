@@ -94,6 +94,30 @@ template<typename RealType>
 } // end normal_distribution::operator()()
 
 
+template<typename RealType>
+  template<typename UniformRandomNumberGenerator, typename ForwardIterator>
+    _CCCL_HOST_DEVICE
+    void normal_distribution<RealType>
+      ::generate(UniformRandomNumberGenerator &urng, ForwardIterator first, ForwardIterator last)
+{
+  generate(urng, first, last, m_param);
+} // end normal_distribution::generate()
+
+
+template<typename RealType>
+  template<typename UniformRandomNumberGenerator, typename ForwardIterator>
+    _CCCL_HOST_DEVICE
+    void normal_distribution<RealType>
+      ::generate(UniformRandomNumberGenerator &urng, ForwardIterator first, ForwardIterator last,
+                 const param_type &parm)
+{
+  for(; first != last; ++first)
+  {
+    *first = operator()(urng, parm);
+  }
+} // end normal_distribution::generate()
+
+
 template<typename RealType>
   _CCCL_HOST_DEVICE
   typename normal_distribution<RealType>::param_type
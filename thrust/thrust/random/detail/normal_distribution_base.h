@@ -34,6 +34,10 @@
 #endif // no system header
 #include <thrust/pair.h>
 #include <thrust/random/uniform_real_distribution.h>
+#include <thrust/random/detail/normal_ziggurat_tables.h>
+#include <thrust/random/detail/random_bits.h>
+#include <thrust/detail/cstdint.h>
+#include <thrust/detail/type_traits.h>
 #include <limits>
 #include <cmath>
 
@@ -140,13 +144,121 @@ template<typename RealType>
     bool m_valid;
 };
 
+// this version samples the normal distribution with the Ziggurat method of
+// Marsaglia & Tsang: one value of the urng usually suffices, and the
+// transcendental functions are only needed for the rare samples which fall
+// outside of the rectangles of the Ziggurat
+template<typename RealType>
+  class normal_distribution_ziggurat
+{
+  protected:
+    // no-op
+    _CCCL_HOST_DEVICE
+    void reset() {}
+
+    template<typename UniformRandomNumberGenerator>
+    _CCCL_HOST_DEVICE
+    RealType sample(UniformRandomNumberGenerator &urng, const RealType mean, const RealType stddev)
+    {
+      return mean + stddev * standard_sample(urng);
+    }
+
+  private:
+    typedef normal_ziggurat_tables<> tables;
+
+    // the number of random bits of the uniform variates
+    static const int digits = std::numeric_limits<RealType>::digits < 56 ? std::numeric_limits<RealType>::digits : 56;
+
+    typedef typename thrust::detail::conditional<
+      (digits + 7 > 32),
+      thrust::detail::uint64_t,
+      thrust::detail::uint32_t
+    >::type word_type;
+
+    // uniform in (0, 1]
+    template<typename UniformRandomNumberGenerator>
+    _CCCL_HOST_DEVICE
+    static RealType unit(UniformRandomNumberGenerator &urng)
+    {
+      const RealType scale = RealType(1) / RealType(1ull << digits);
+      return RealType(random_bits<word_type>(urng, digits) + 1) * scale;
+    }
+
+    template<typename UniformRandomNumberGenerator>
+    _CCCL_HOST_DEVICE
+    static RealType standard_sample(UniformRandomNumberGenerator &urng)
+    {
+      // allow for Koenig lookup
+      using std::exp; using std::log;
+
+      const RealType scale = RealType(1) / RealType(1ull << digits);
+
+      for(;;)
+      {
+        // the low bits choose a layer, and the others a point in it
+        const word_type bits = random_bits<word_type>(urng, digits + 7);
+        const int i = static_cast<int>(bits & (tables::layers - 1));
+
+        // u is uniform in (-1, 1)
+        const long long v = 2 * static_cast<long long>(bits >> 7) + 1 - (1ll << digits);
+        const RealType u = static_cast<RealType>(v) * scale;
+
+        const RealType xi = static_cast<RealType>(tables::x[i]);
+        const RealType x  = u * xi;
+
+        // inside the rectangle which lies entirely under the density
+        if((u < 0 ? -u : u) < static_cast<RealType>(tables::ratio[i]))
+        {
+          return x;
+        }
+
+        if(i == 0)
+        {
+          return tail(urng, u < 0);
+        }
+
+        // in the wedge between layers i and i + 1
+        const RealType xj = static_cast<RealType>(tables::x[i + 1]);
+        const RealType f0 = exp(RealType(-0.5) * (xi * xi - x * x));
+        const RealType f1 = exp(RealType(-0.5) * (xj * xj - x * x));
+
+        if(f1 + unit(urng) * (f0 - f1) < RealType(1))
+        {
+          return x;
+        }
+      }
+    }
+
+    // samples the tail beyond r = x[1] with Marsaglia's method
+    template<typename UniformRandomNumberGenerator>
+    _CCCL_HOST_DEVICE
+    static RealType tail(UniformRandomNumberGenerator &urng, bool negative)
+    {
+      using std::log;
+
+      const RealType r = static_cast<RealType>(tables::x[1]);
+
+      RealType x, y;
+      do
+      {
+        x = log(unit(urng)) / r;
+        y = log(unit(urng));
+      }
+      while(-(y + y) < x * x);
+
+      return negative ? x - r : r - x;
+    }
+};
+
 template<typename RealType>
   struct normal_distribution_base
 {
 #if THRUST_DEVICE_COMPILER == THRUST_DEVICE_COMPILER_NVCC && !defined(_NVHPC_CUDA)
   typedef normal_distribution_nvcc<RealType> type;
-#else
+#elif defined(_NVHPC_CUDA)
   typedef normal_distribution_portable<RealType> type;
+#else
+  typedef normal_distribution_ziggurat<RealType> type;
 #endif
 };
 
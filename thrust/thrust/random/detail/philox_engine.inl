@@ -0,0 +1,163 @@
+/*
+ *  Copyright 2023 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/random/philox_engine.h>
+#include <thrust/random/detail/random_core_access.h>
+#include <thrust/random/detail/mulhilo.h>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+namespace detail
+{
+
+// the i-th of the values Vs
+template<typename T, T... Vs>
+  struct value_pack;
+
+template<typename T, T V, T... Vs>
+  struct value_pack<T, V, Vs...>
+{
+  _CCCL_HOST_DEVICE
+  static constexpr T get(size_t i)
+  {
+    return i == 0 ? V : value_pack<T, Vs...>::get(i - 1);
+  }
+};
+
+template<typename T>
+  struct value_pack<T>
+{
+  _CCCL_HOST_DEVICE
+  static constexpr T get(size_t)
+  {
+    return T(0);
+  }
+};
+
+} // end detail
+
+
+template<typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+  _CCCL_HOST_DEVICE
+  philox_engine<UIntType,w,n,r,consts...>
+    ::philox_engine(result_type value)
+{
+  this->seed(value);
+} // end philox_engine::philox_engine()
+
+
+template<typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+  _CCCL_HOST_DEVICE
+  void philox_engine<UIntType,w,n,r,consts...>
+    ::generate_block(const result_type (&counter)[n], result_type (&block)[n]) const
+{
+  typedef detail::value_pack<UIntType, consts...> constants;
+
+  result_type key[n / 2];
+  for(size_t i = 0; i < n / 2; ++i)
+  {
+    key[i] = this->m_k[i];
+  }
+
+  for(size_t i = 0; i < n; ++i)
+  {
+    block[i] = counter[i];
+  }
+
+  for(size_t round = 0; round < r; ++round)
+  {
+    // the words of the block in the order 2, 1, 0, 3 (for n == 4) or 0, 1
+    // (for n == 2); the even ones are multiplied, the odd ones xored in
+    result_type v[n];
+    for(size_t i = 0; i < n; ++i)
+    {
+      v[i] = block[(n == 4 && i % 2 == 0) ? 2 - i : i];
+    }
+
+    for(size_t i = 0; i < n / 2; ++i)
+    {
+      result_type hi, lo;
+      detail::mulhilo(v[2 * i], constants::get(2 * i), hi, lo);
+
+      block[2 * i]     = hi ^ key[i] ^ v[2 * i + 1];
+      block[2 * i + 1] = lo;
+    }
+
+    for(size_t i = 0; i < n / 2; ++i)
+    {
+      key[i] += constants::get(2 * i + 1);
+    }
+  }
+} // end philox_engine::generate_block()
+
+
+template<typename UIntType, size_t w, size_t n, size_t r, UIntType... consts,
+         typename CharT, typename Traits>
+  std::basic_ostream<CharT,Traits>&
+    operator<<(std::basic_ostream<CharT,Traits> &os,
+               const philox_engine<UIntType,w,n,r,consts...> &e)
+{
+  return thrust::random::detail::random_core_access::stream_out(os,e);
+}
+
+
+template<typename UIntType, size_t w, size_t n, size_t r, UIntType... consts,
+         typename CharT, typename Traits>
+  std::basic_istream<CharT,Traits>&
+    operator>>(std::basic_istream<CharT,Traits> &is,
+               philox_engine<UIntType,w,n,r,consts...> &e)
+{
+  return thrust::random::detail::random_core_access::stream_in(is,e);
+}
+
+
+template<typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+  _CCCL_HOST_DEVICE
+  bool operator==(const philox_engine<UIntType,w,n,r,consts...> &lhs,
+                  const philox_engine<UIntType,w,n,r,consts...> &rhs)
+{
+  return thrust::random::detail::random_core_access::equal(lhs,rhs);
+}
+
+
+template<typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+  _CCCL_HOST_DEVICE
+  bool operator!=(const philox_engine<UIntType,w,n,r,consts...> &lhs,
+                  const philox_engine<UIntType,w,n,r,consts...> &rhs)
+{
+  return !(lhs == rhs);
+}
+
+
+} // end random
+
+THRUST_NAMESPACE_END
+
@@ -0,0 +1,267 @@
+/*
+ *  Copyright 2023 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/cstdint.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/random/detail/mulhilo.h>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+namespace detail
+{
+
+
+_CCCL_HOST_DEVICE
+constexpr int floor_log2(unsigned long long x)
+{
+  return x <= 1 ? 0 : 1 + floor_log2(x >> 1);
+}
+
+
+// describes the values urng() - UniformRandomNumberGenerator::min
+template<typename UniformRandomNumberGenerator>
+  struct urng_range
+{
+  // the largest value
+  static const unsigned long long max =
+    static_cast<unsigned long long>(UniformRandomNumberGenerator::max - UniformRandomNumberGenerator::min);
+
+  // whether there are 2^bits values, each of whose bits is random
+  static const bool is_power_of_two = ((max + 1) & max) == 0;
+
+  // the number of bits of the largest power of two not greater than the number of values
+  static const int bits = (max == ~0ull) ? 64 : floor_log2(max + 1);
+};
+
+
+// returns a value whose count low bits are uniformly random and whose other
+// bits are zero, consuming as many values of urng as necessary
+template<typename UIntType, typename UniformRandomNumberGenerator>
+_CCCL_HOST_DEVICE
+  UIntType random_bits(UniformRandomNumberGenerator &urng, int count)
+{
+  typedef urng_range<UniformRandomNumberGenerator> range;
+
+  UIntType result;
+
+  // concatenate whole values
+  THRUST_IF_CONSTEXPR(range::is_power_of_two)
+  {
+    result = static_cast<UIntType>(urng() - UniformRandomNumberGenerator::min);
+    for(int i = range::bits; i < count; i += range::bits)
+    {
+      result = static_cast<UIntType>(result << range::bits) |
+               static_cast<UIntType>(urng() - UniformRandomNumberGenerator::min);
+    }
+  }
+  else
+  {
+    // concatenate the low k bits of values, rejecting the values of the last,
+    // incomplete run of 2^k
+    const int k = range::bits > 8 ? range::bits - 7 : 1;
+    const unsigned long long past = ((range::max + 1) >> k) << k;
+
+    result = 0;
+    for(int i = 0; i < count; i += k)
+    {
+      unsigned long long x;
+      do
+      {
+        x = static_cast<unsigned long long>(urng() - UniformRandomNumberGenerator::min);
+      }
+      while(x >= past);
+
+      result = (i == 0 ? UIntType(0) : static_cast<UIntType>(result << k)) |
+               static_cast<UIntType>(x & ((1ull << k) - 1));
+    }
+  }
+
+  if(count < static_cast<int>(8 * sizeof(UIntType)))
+  {
+    result &= static_cast<UIntType>((UIntType(1) << count) - 1);
+  }
+
+  return result;
+} // end random_bits()
+
+
+// Samples [0, s) with Lemire's multiply-shift method: for x uniform in
+// [0, N), floor(x s / N) is uniform once the values with x s mod N < N mod s
+// are rejected. N mod s costs a division, but it is only needed when
+// x s mod N < s, which is rare for s much smaller than N.
+//
+// s == 0 stands for the whole range of UIntType. x is a single value of urng
+// when urng has at least s values, and is made by random_bits otherwise.
+template<typename UIntType, typename UniformRandomNumberGenerator>
+  class uniform_int_sampler
+{
+  typedef urng_range<UniformRandomNumberGenerator> range;
+
+  // the word in which mulhilo computes x s
+  typedef typename thrust::detail::conditional<
+    (sizeof(UIntType) > 4 || range::bits > 32),
+    thrust::detail::uint64_t,
+    thrust::detail::uint32_t
+  >::type word_type;
+
+  static const int word_bits = 8 * sizeof(word_type);
+
+  public:
+    // the threshold is computed up front, for sampling many values
+    _CCCL_HOST_DEVICE
+    explicit uniform_int_sampler(UIntType s)
+      : m_s(s), m_threshold(s)
+    {
+      if(s != 0)
+      {
+        m_threshold = compute_threshold(s);
+      }
+    }
+
+    _CCCL_HOST_DEVICE
+    UIntType operator()(UniformRandomNumberGenerator &urng)
+    {
+      return sample(urng, m_s, m_threshold);
+    }
+
+    // the threshold is only computed if it is needed
+    _CCCL_HOST_DEVICE
+    static UIntType sample(UniformRandomNumberGenerator &urng, UIntType s)
+    {
+      UIntType threshold = s;
+      return sample(urng, s, threshold);
+    }
+
+  private:
+    UIntType m_s, m_threshold;
+
+    // whether a single value of urng covers [0, s)
+    _CCCL_HOST_DEVICE
+    static bool single_draw(UIntType s)
+    {
+      return s != 0 &&
+             static_cast<unsigned long long>(s - 1) <= range::max &&
+             (range::is_power_of_two || range::max < (1ull << 32));
+    }
+
+    // N mod s, where N is the number of values x takes
+    _CCCL_HOST_DEVICE
+    static UIntType compute_threshold(UIntType s)
+    {
+      if(!single_draw(s))
+      {
+        return static_cast<UIntType>((UIntType(0) - s) % s);
+      }
+
+      if(range::max == ~0ull)
+      {
+        return static_cast<UIntType>((0ull - s) % s);
+      }
+
+      return static_cast<UIntType>((range::max + 1) % s);
+    }
+
+    _CCCL_HOST_DEVICE
+    static word_type draw(UniformRandomNumberGenerator &urng, bool single)
+    {
+      return single ? static_cast<word_type>(urng() - UniformRandomNumberGenerator::min)
+                    : random_bits<word_type>(urng, 8 * sizeof(UIntType));
+    }
+
+    // threshold == s means that it has not been computed yet
+    _CCCL_HOST_DEVICE
+    static UIntType sample(UniformRandomNumberGenerator &urng, UIntType s, UIntType &threshold)
+    {
+      const bool single = single_draw(s);
+
+      if(s == 0)
+      {
+        return static_cast<UIntType>(draw(urng, false));
+      }
+
+      THRUST_IF_CONSTEXPR(!range::is_power_of_two)
+      {
+        if(single)
+        {
+          // N is a constant, so dividing by it is cheap
+          const unsigned long long n = range::max + 1;
+
+          unsigned long long m = draw(urng, true) * static_cast<unsigned long long>(s);
+          if(m % n < s)
+          {
+            if(threshold == s)
+            {
+              threshold = compute_threshold(s);
+            }
+
+            while(m % n < threshold)
+            {
+              m = draw(urng, true) * static_cast<unsigned long long>(s);
+            }
+          }
+
+          return static_cast<UIntType>(m / n);
+        }
+      }
+
+      // x is uniform in [0, 2^bits); shifting it to the top of the word puts
+      // floor(x s / 2^bits) into the high word of the product, and
+      // x s mod 2^bits into the top of the low word
+      const int bits  = single ? range::bits : static_cast<int>(8 * sizeof(UIntType));
+      const int shift = word_bits - bits;
+
+      word_type hi, lo;
+      mulhilo(static_cast<word_type>(draw(urng, single) << shift), static_cast<word_type>(s), hi, lo);
+
+      if((lo >> shift) < s)
+      {
+        if(threshold == s)
+        {
+          threshold = compute_threshold(s);
+        }
+
+        while((lo >> shift) < threshold)
+        {
+          mulhilo(static_cast<word_type>(draw(urng, single) << shift), static_cast<word_type>(s), hi, lo);
+        }
+      }
+
+      return static_cast<UIntType>(hi);
+    }
+}; // end uniform_int_sampler
+
+
+} // end detail
+
+} // end random
+
+THRUST_NAMESPACE_END
+
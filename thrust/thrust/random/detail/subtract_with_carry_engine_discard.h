@@ -0,0 +1,388 @@
+/*
+ *  Copyright 2023 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/cstdint.h>
+#include <cstddef> // for size_t
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+namespace detail
+{
+
+
+// a fixed-size unsigned integer of Limbs 32-bit limbs, least significant first,
+// with just the arithmetic which subtract_with_carry_engine_discard needs
+template<size_t Limbs>
+  struct big_uint
+{
+  typedef thrust::detail::uint32_t limb_type;
+
+  limb_type limb[Limbs];
+
+  _CCCL_HOST_DEVICE
+  explicit big_uint(unsigned long long value = 0)
+  {
+    for(size_t i = 0; i < Limbs; ++i)
+    {
+      limb[i] = static_cast<limb_type>(i < 2 ? (value >> (32 * i)) : 0);
+    }
+  }
+
+  // returns 2^k
+  _CCCL_HOST_DEVICE
+  static big_uint power_of_two(size_t k)
+  {
+    big_uint result;
+    result.limb[k / 32] = limb_type(1) << (k % 32);
+    return result;
+  }
+
+  // returns bits [pos, pos + count) as an integer, count <= 64
+  _CCCL_HOST_DEVICE
+  unsigned long long bits(size_t pos, size_t count) const
+  {
+    unsigned long long result = 0;
+    for(size_t i = 0; i < count;)
+    {
+      const size_t offset = (pos + i) % 32;
+      const size_t n      = (32 - offset < count - i) ? 32 - offset : count - i;
+      const unsigned long long chunk = (limb[(pos + i) / 32] >> offset) & ((1ull << n) - 1);
+      result |= chunk << i;
+      i += n;
+    }
+    return result;
+  }
+
+  // ors the count <= 64 low bits of value into bits [pos, pos + count)
+  _CCCL_HOST_DEVICE
+  void set_bits(size_t pos, size_t count, unsigned long long value)
+  {
+    for(size_t i = 0; i < count;)
+    {
+      const size_t offset = (pos + i) % 32;
+      const size_t n      = (32 - offset < count - i) ? 32 - offset : count - i;
+      const limb_type chunk = static_cast<limb_type>((value >> i) & ((1ull << n) - 1));
+      limb[(pos + i) / 32] |= chunk << offset;
+      i += n;
+    }
+  }
+
+  _CCCL_HOST_DEVICE
+  big_uint operator>>(size_t k) const
+  {
+    big_uint result;
+    const size_t q = k / 32, r = k % 32;
+    for(size_t i = 0; i + q < Limbs; ++i)
+    {
+      unsigned long long x = limb[i + q];
+      if(i + q + 1 < Limbs)
+      {
+        x |= static_cast<unsigned long long>(limb[i + q + 1]) << 32;
+      }
+      result.limb[i] = static_cast<limb_type>(x >> r);
+    }
+    return result;
+  }
+
+  _CCCL_HOST_DEVICE
+  big_uint operator<<(size_t k) const
+  {
+    big_uint result;
+    const size_t q = k / 32, r = k % 32;
+    for(size_t i = q; i < Limbs; ++i)
+    {
+      unsigned long long x = static_cast<unsigned long long>(limb[i - q]) << 32;
+      if(i > q)
+      {
+        x |= limb[i - q - 1];
+      }
+      result.limb[i] = static_cast<limb_type>(x >> (32 - r));
+    }
+    return result;
+  }
+
+  // keeps the k low bits
+  _CCCL_HOST_DEVICE
+  big_uint low_bits(size_t k) const
+  {
+    big_uint result = *this;
+    for(size_t i = k / 32; i < Limbs; ++i)
+    {
+      result.limb[i] = (i == k / 32) ? limb[i] & ((limb_type(1) << (k % 32)) - 1) : 0;
+    }
+    return result;
+  }
+
+  _CCCL_HOST_DEVICE
+  big_uint &operator+=(const big_uint &rhs)
+  {
+    unsigned long long carry = 0;
+    for(size_t i = 0; i < Limbs; ++i)
+    {
+      carry += static_cast<unsigned long long>(limb[i]) + rhs.limb[i];
+      limb[i] = static_cast<limb_type>(carry);
+      carry >>= 32;
+    }
+    return *this;
+  }
+
+  // requires *this >= rhs
+  _CCCL_HOST_DEVICE
+  big_uint &operator-=(const big_uint &rhs)
+  {
+    limb_type borrow = 0;
+    for(size_t i = 0; i < Limbs; ++i)
+    {
+      const unsigned long long difference =
+        static_cast<unsigned long long>(limb[i]) - rhs.limb[i] - borrow;
+      limb[i] = static_cast<limb_type>(difference);
+      borrow  = static_cast<limb_type>(difference >> 63);
+    }
+    return *this;
+  }
+
+  // the product, truncated to Limbs limbs
+  _CCCL_HOST_DEVICE
+  big_uint operator*(const big_uint &rhs) const
+  {
+    big_uint result;
+    const size_t n = size(), rhs_n = rhs.size();
+    for(size_t i = 0; i < n; ++i)
+    {
+      unsigned long long carry = 0;
+      for(size_t j = 0; j < rhs_n && i + j < Limbs; ++j)
+      {
+        carry += static_cast<unsigned long long>(limb[i]) * rhs.limb[j] + result.limb[i + j];
+        result.limb[i + j] = static_cast<limb_type>(carry);
+        carry >>= 32;
+      }
+      if(i + rhs_n < Limbs)
+      {
+        result.limb[i + rhs_n] = static_cast<limb_type>(carry);
+      }
+    }
+    return result;
+  }
+
+  _CCCL_HOST_DEVICE
+  bool operator<(const big_uint &rhs) const
+  {
+    for(size_t i = Limbs; i > 0; --i)
+    {
+      if(limb[i - 1] != rhs.limb[i - 1])
+      {
+        return limb[i - 1] < rhs.limb[i - 1];
+      }
+    }
+    return false;
+  }
+
+  _CCCL_HOST_DEVICE
+  bool operator==(const big_uint &rhs) const
+  {
+    for(size_t i = 0; i < Limbs; ++i)
+    {
+      if(limb[i] != rhs.limb[i])
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  _CCCL_HOST_DEVICE
+  bool is_zero() const
+  {
+    return *this == big_uint();
+  }
+
+private:
+  // the number of limbs up to the most significant nonzero one
+  _CCCL_HOST_DEVICE
+  size_t size() const
+  {
+    size_t n = Limbs;
+    while(n > 0 && limb[n - 1] == 0)
+    {
+      --n;
+    }
+    return n;
+  }
+}; // end big_uint
+
+
+// Marsaglia & Zaman showed that subtract with carry is a linear congruential
+// generator in disguise: with m = 2^w and b = m^r - m^s + 1, the state
+// (x_{n-r}, ..., x_{n-1}, c) corresponds to
+//
+//   Y_n = D_n - floor(D_n / m^(r-s)) + c   (mod b),  D_n = sum_j x_{n-r+j} * m^j,
+//
+// and each transition multiplies Y_n by a = m^-1 = b - (b-1)/m (mod b). So z
+// transitions multiply Y_n by a^z, which repeated squaring computes in O(log z)
+// multiplications of (w r)-bit integers.
+//
+// A state with c == 1 and a state with c == 0 may correspond to the same Y,
+// so the state computed from Y after the jump is not necessarily the one that
+// stepping would reach. The two agree again once r more words have been
+// produced, so the jump stops r transitions short and steps the rest.
+struct subtract_with_carry_engine_discard
+{
+  template<typename SubtractWithCarryEngine>
+  _CCCL_HOST_DEVICE
+  static void discard(SubtractWithCarryEngine &swc, unsigned long long z)
+  {
+    typedef typename SubtractWithCarryEngine::result_type result_type;
+
+    const size_t w = SubtractWithCarryEngine::word_size;
+    const size_t s = SubtractWithCarryEngine::short_lag;
+    const size_t r = SubtractWithCarryEngine::long_lag;
+
+    // the number of limbs of b
+    const size_t n = (w * r + 31) / 32;
+
+    // a short jump costs about as much as 8 n^2 transitions
+    if(z < 8 * n * n)
+    {
+      for(; z > 0; --z)
+      {
+        swc();
+      }
+      return;
+    }
+
+    // room for the product of two integers modulo b
+    typedef big_uint<2 * n + 1> integer;
+
+    const integer one(1);
+
+    // b = m^r - m^s + 1, a = b - (m^(r-1) - m^(s-1))
+    integer b = integer::power_of_two(w * r);
+    b -= integer::power_of_two(w * s);
+    b += one;
+
+    integer a = b;
+    a -= integer::power_of_two(w * (r - 1));
+    a += integer::power_of_two(w * (s - 1));
+
+    integer d;
+    for(size_t j = 0; j < r; ++j)
+    {
+      d.set_bits(w * j, w, swc.m_x[(swc.m_k + j) % r]);
+    }
+
+    integer y = d;
+    y -= d >> (w * (r - s));
+    y += integer(swc.m_carry);
+
+    // the words m - 1 with c == 1 are a fixed point, the only state whose Y is b
+    if(y == b)
+    {
+      return;
+    }
+
+    // y = y * a^(z - r) mod b
+    for(z -= r; z > 0; z >>= 1)
+    {
+      if(z & 1)
+      {
+        y = reduce(y * a, b, w * r, w * s);
+      }
+
+      if(z > 1)
+      {
+        a = reduce(a * a, b, w * r, w * s);
+      }
+    }
+
+    // the state with c == 0 is the fixed point of D = Y + floor(D / m^(r-s))
+    d = y;
+    for(;;)
+    {
+      integer next = y;
+      next += d >> (w * (r - s));
+
+      if(next == d)
+      {
+        break;
+      }
+
+      d = next;
+    }
+
+    for(size_t j = 0; j < r; ++j)
+    {
+      swc.m_x[j] = static_cast<result_type>(d.bits(w * j, w));
+    }
+    swc.m_k     = 0;
+    swc.m_carry = 0;
+
+    for(size_t j = 0; j < r; ++j)
+    {
+      swc();
+    }
+  }
+
+private:
+  // computes x mod b for x < b^2, using m^r = m^s - 1 (mod b)
+  template<typename Integer>
+  _CCCL_HOST_DEVICE
+  static Integer reduce(Integer x, const Integer &b, size_t wr, size_t ws)
+  {
+    for(;;)
+    {
+      const Integer high = x >> wr;
+
+      if(high.is_zero())
+      {
+        break;
+      }
+
+      x = x.low_bits(wr);
+      x += high << ws;
+      x -= high;
+    }
+
+    while(!(x < b))
+    {
+      x -= b;
+    }
+
+    return x;
+  }
+}; // end subtract_with_carry_engine_discard
+
+
+} // end detail
+
+} // end random
+
+THRUST_NAMESPACE_END
+
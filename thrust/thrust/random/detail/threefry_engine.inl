@@ -0,0 +1,214 @@
+/*
+ *  Copyright 2023 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/random/threefry_engine.h>
+#include <thrust/random/detail/random_core_access.h>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+namespace detail
+{
+
+// The key schedule parity and rotation distances of Threefry, from Random123.
+// rotation(i) is the distance of the i-th rotation of a cycle of eight
+// rounds, each of which rotates n/2 words.
+template<size_t w, size_t n>
+  struct threefry_constants;
+
+template<>
+  struct threefry_constants<32, 2>
+{
+  static const thrust::detail::uint32_t parity = 0x1BD11BDAu;
+
+  _CCCL_HOST_DEVICE
+  static unsigned int rotation(size_t i)
+  {
+    const unsigned int r[8] = {13, 15, 26, 6, 17, 29, 16, 24};
+    return r[i];
+  }
+};
+
+template<>
+  struct threefry_constants<32, 4>
+{
+  static const thrust::detail::uint32_t parity = 0x1BD11BDAu;
+
+  _CCCL_HOST_DEVICE
+  static unsigned int rotation(size_t i)
+  {
+    const unsigned int r[16] = {10, 26, 11, 21, 13, 27, 23, 5, 6, 20, 17, 11, 25, 10, 18, 20};
+    return r[i];
+  }
+};
+
+template<>
+  struct threefry_constants<64, 2>
+{
+  static const thrust::detail::uint64_t parity = 0x1BD11BDAA9FC1A22ull;
+
+  _CCCL_HOST_DEVICE
+  static unsigned int rotation(size_t i)
+  {
+    const unsigned int r[8] = {16, 42, 12, 31, 16, 32, 24, 21};
+    return r[i];
+  }
+};
+
+template<>
+  struct threefry_constants<64, 4>
+{
+  static const thrust::detail::uint64_t parity = 0x1BD11BDAA9FC1A22ull;
+
+  _CCCL_HOST_DEVICE
+  static unsigned int rotation(size_t i)
+  {
+    const unsigned int r[16] = {14, 16, 52, 57, 23, 40, 5, 37, 25, 33, 46, 12, 58, 22, 32, 32};
+    return r[i];
+  }
+};
+
+
+// x = x + y, y = rotl(y, distance) ^ x
+template<typename UIntType, size_t w>
+_CCCL_HOST_DEVICE
+void threefry_mix(UIntType &x, UIntType &y, unsigned int distance)
+{
+  x += y;
+  y = static_cast<UIntType>((y << distance) | (y >> (w - distance)));
+  y ^= x;
+}
+
+} // end detail
+
+
+template<typename UIntType, size_t w, size_t n, size_t r>
+  _CCCL_HOST_DEVICE
+  threefry_engine<UIntType,w,n,r>
+    ::threefry_engine(result_type value)
+{
+  this->seed(value);
+} // end threefry_engine::threefry_engine()
+
+
+template<typename UIntType, size_t w, size_t n, size_t r>
+  _CCCL_HOST_DEVICE
+  void threefry_engine<UIntType,w,n,r>
+    ::generate_block(const result_type (&counter)[n], result_type (&block)[n]) const
+{
+  typedef detail::threefry_constants<w, n> constants;
+
+  // the key schedule: the key and its parity word
+  result_type ks[n + 1];
+  ks[n] = constants::parity;
+  for(size_t i = 0; i < n; ++i)
+  {
+    ks[i] = this->m_k[i];
+    ks[n] ^= ks[i];
+    block[i] = counter[i] + ks[i];
+  }
+
+  for(size_t round = 0; round < r; ++round)
+  {
+    const size_t c = round % 8;
+
+    if(n == 2)
+    {
+      detail::threefry_mix<UIntType,w>(block[0], block[1], constants::rotation(c));
+    }
+    else if(round % 2 == 0)
+    {
+      detail::threefry_mix<UIntType,w>(block[0], block[1],     constants::rotation(2 * c));
+      detail::threefry_mix<UIntType,w>(block[n - 2], block[n - 1], constants::rotation(2 * c + 1));
+    }
+    else
+    {
+      detail::threefry_mix<UIntType,w>(block[0], block[n - 1], constants::rotation(2 * c));
+      detail::threefry_mix<UIntType,w>(block[n - 2], block[1],     constants::rotation(2 * c + 1));
+    }
+
+    // inject the key schedule, rotated by one word each time
+    if(round % 4 == 3)
+    {
+      const size_t s = (round + 1) / 4;
+
+      for(size_t i = 0; i < n; ++i)
+      {
+        block[i] += ks[(s + i) % (n + 1)];
+      }
+
+      block[n - 1] += static_cast<result_type>(s);
+    }
+  }
+} // end threefry_engine::generate_block()
+
+
+template<typename UIntType, size_t w, size_t n, size_t r,
+         typename CharT, typename Traits>
+  std::basic_ostream<CharT,Traits>&
+    operator<<(std::basic_ostream<CharT,Traits> &os,
+               const threefry_engine<UIntType,w,n,r> &e)
+{
+  return thrust::random::detail::random_core_access::stream_out(os,e);
+}
+
+
+template<typename UIntType, size_t w, size_t n, size_t r,
+         typename CharT, typename Traits>
+  std::basic_istream<CharT,Traits>&
+    operator>>(std::basic_istream<CharT,Traits> &is,
+               threefry_engine<UIntType,w,n,r> &e)
+{
+  return thrust::random::detail::random_core_access::stream_in(is,e);
+}
+
+
+template<typename UIntType, size_t w, size_t n, size_t r>
+  _CCCL_HOST_DEVICE
+  bool operator==(const threefry_engine<UIntType,w,n,r> &lhs,
+                  const threefry_engine<UIntType,w,n,r> &rhs)
+{
+  return thrust::random::detail::random_core_access::equal(lhs,rhs);
+}
+
+
+template<typename UIntType, size_t w, size_t n, size_t r>
+  _CCCL_HOST_DEVICE
+  bool operator!=(const threefry_engine<UIntType,w,n,r> &lhs,
+                  const threefry_engine<UIntType,w,n,r> &rhs)
+{
+  return !(lhs == rhs);
+}
+
+
+} // end random
+
+THRUST_NAMESPACE_END
+
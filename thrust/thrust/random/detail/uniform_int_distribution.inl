@@ -27,7 +27,8 @@
 #endif // no system header
 
 #include <thrust/random/uniform_int_distribution.h>
-#include <thrust/random/uniform_real_distribution.h>
+#include <thrust/random/detail/random_bits.h>
+#include <thrust/detail/cstdint.h>
 #include <thrust/detail/type_traits.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -35,6 +36,21 @@ THRUST_NAMESPACE_BEGIN
 namespace random
 {
 
+namespace detail
+{
+
+// the unsigned type in which uniform_int_distribution<IntType> computes
+template<typename IntType>
+  struct uniform_int_distribution_word
+    : thrust::detail::conditional<
+        (sizeof(IntType) > 4),
+        thrust::detail::uint64_t,
+        thrust::detail::uint32_t
+      >
+{};
+
+} // end detail
+
 
 template<typename IntType>
   _CCCL_HOST_DEVICE
@@ -80,23 +96,47 @@ template<typename IntType>
       uniform_int_distribution<IntType>
         ::operator()(UniformRandomNumberGenerator &urng, const param_type &parm)
 {
-  // XXX this implementation is somewhat hacky and will skip
-  //     values if the range of the RNG is smaller than the range of the distribution
-  //     we should improve this implementation in a later version
+  typedef typename detail::uniform_int_distribution_word<IntType>::type word_type;
 
-  typedef typename thrust::detail::largest_available_float::type float_type;
+  // the number of values in [a, b], zero if it is 2^w
+  const word_type s = static_cast<word_type>(static_cast<word_type>(parm.second) - static_cast<word_type>(parm.first) + 1u);
 
-  const float_type real_min(static_cast<float_type>(parm.first));
-  const float_type real_max(static_cast<float_type>(parm.second));
+  const word_type x = detail::uniform_int_sampler<word_type,UniformRandomNumberGenerator>::sample(urng, s);
 
-  // add one to the right end of the interval because it is half-open
-  // XXX adding 1.0 to a potentially large floating point number seems like a bad idea
-  uniform_real_distribution<float_type> real_dist(real_min, real_max + float_type(1));
-
-  return static_cast<result_type>(real_dist(urng));
+  return static_cast<result_type>(static_cast<word_type>(parm.first) + x);
 } // end uniform_int_distribution::operator()()
 
 
+template<typename IntType>
+  template<typename UniformRandomNumberGenerator, typename ForwardIterator>
+    _CCCL_HOST_DEVICE
+    void uniform_int_distribution<IntType>
+      ::generate(UniformRandomNumberGenerator &urng, ForwardIterator first, ForwardIterator last)
+{
+  generate(urng, first, last, m_param);
+} // end uniform_int_distribution::generate()
+
+
+template<typename IntType>
+  template<typename UniformRandomNumberGenerator, typename ForwardIterator>
+    _CCCL_HOST_DEVICE
+    void uniform_int_distribution<IntType>
+      ::generate(UniformRandomNumberGenerator &urng, ForwardIterator first, ForwardIterator last,
+                 const param_type &parm)
+{
+  typedef typename detail::uniform_int_distribution_word<IntType>::type word_type;
+
+  const word_type s = static_cast<word_type>(static_cast<word_type>(parm.second) - static_cast<word_type>(parm.first) + 1u);
+
+  detail::uniform_int_sampler<word_type,UniformRandomNumberGenerator> sampler(s);
+
+  for(; first != last; ++first)
+  {
+    *first = static_cast<result_type>(static_cast<word_type>(parm.first) + sampler(urng));
+  }
+} // end uniform_int_distribution::generate()
+
+
 template<typename IntType>
   _CCCL_HOST_DEVICE
   typename uniform_int_distribution<IntType>::result_type
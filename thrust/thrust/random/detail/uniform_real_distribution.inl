@@ -105,6 +105,30 @@ template<typename RealType>
   return m_param.second;
 } // end uniform_real_distribution::b()
 
+template<typename RealType>
+  template<typename UniformRandomNumberGenerator, typename ForwardIterator>
+    _CCCL_HOST_DEVICE
+    void uniform_real_distribution<RealType>
+      ::generate(UniformRandomNumberGenerator &urng, ForwardIterator first, ForwardIterator last)
+{
+  generate(urng, first, last, m_param);
+} // end uniform_real::generate()
+
+
+template<typename RealType>
+  template<typename UniformRandomNumberGenerator, typename ForwardIterator>
+    _CCCL_HOST_DEVICE
+    void uniform_real_distribution<RealType>
+      ::generate(UniformRandomNumberGenerator &urng, ForwardIterator first, ForwardIterator last,
+                 const param_type &parm)
+{
+  for(; first != last; ++first)
+  {
+    *first = operator()(urng, parm);
+  }
+} // end uniform_real::generate()
+
+
 template<typename RealType>
   _CCCL_HOST_DEVICE
   typename uniform_real_distribution<RealType>::param_type
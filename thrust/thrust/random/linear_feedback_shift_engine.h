@@ -39,6 +39,7 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/random/detail/linear_feedback_shift_engine_wordmask.h>
+#include <thrust/random/detail/linear_feedback_shift_engine_discard.h>
 #include <iostream>
 #include <cstddef> // for size_t
 #include <thrust/random/detail/random_core_access.h>
@@ -150,7 +151,7 @@ template<typename UIntType, size_t w, size_t k, size_t q, size_t s>
      *  and discards the results.
      *
      *  \param z The number of random values to discard.
-     *  \note This function is provided because an implementation may be able to accelerate it.
+     *  \note The cost of this function grows logarithmically with \p z.
      */
     _CCCL_HOST_DEVICE
     void discard(unsigned long long z);
@@ -162,6 +163,8 @@ template<typename UIntType, size_t w, size_t k, size_t q, size_t s>
 
     friend struct thrust::random::detail::random_core_access;
 
+    friend struct thrust::random::detail::linear_feedback_shift_engine_discard;
+
     _CCCL_HOST_DEVICE
     bool equal(const linear_feedback_shift_engine &rhs) const;
 
@@ -154,6 +154,32 @@ template<typename RealType = double>
     _CCCL_HOST_DEVICE
     result_type operator()(UniformRandomNumberGenerator &urng, const param_type &parm);
 
+    /*! This method fills a range with normally distributed random numbers drawn from this \p normal_distribution, as if by assigning
+     *  <tt>(*this)(urng)</tt> to each of its elements in order.
+     *
+     *  \param urng The \p UniformRandomNumberGenerator to use as a source of randomness.
+     *  \param first The beginning of the range to fill.
+     *  \param last The end of the range to fill.
+     */
+    template<typename UniformRandomNumberGenerator, typename ForwardIterator>
+    _CCCL_HOST_DEVICE
+    void generate(UniformRandomNumberGenerator &urng, ForwardIterator first, ForwardIterator last);
+
+    /*! This method fills a range with normally distributed random numbers drawn from the \p normal_distribution
+     *  described by the given \p param_type object, as if by assigning <tt>(*this)(urng, parm)</tt>
+     *  to each of its elements in order.
+     *
+     *  \param urng The \p UniformRandomNumberGenerator to use as a source of randomness.
+     *  \param first The beginning of the range to fill.
+     *  \param last The end of the range to fill.
+     *  \param parm A \p param_type object encapsulating the parameters of the \p normal_distribution
+     *              to draw from.
+     */
+    template<typename UniformRandomNumberGenerator, typename ForwardIterator>
+    _CCCL_HOST_DEVICE
+    void generate(UniformRandomNumberGenerator &urng, ForwardIterator first, ForwardIterator last,
+                  const param_type &parm);
+
     // property functions
 
     /*! This method returns the value of the parameter with which this \p normal_distribution
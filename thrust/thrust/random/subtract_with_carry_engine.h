@@ -31,6 +31,7 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/random/detail/random_core_access.h>
+#include <thrust/random/detail/subtract_with_carry_engine_discard.h>
 
 #include <thrust/detail/cstdint.h>
 #include <cstddef> // for size_t
@@ -144,7 +145,7 @@ template<typename UIntType, size_t w, size_t s, size_t r>
      *  and discards the results.
      *
      *  \param z The number of random values to discard.
-     *  \note This function is provided because an implementation may be able to accelerate it.
+     *  \note The cost of this function grows logarithmically with \p z.
      */
     _CCCL_HOST_DEVICE
     void discard(unsigned long long z);
@@ -158,6 +159,8 @@ template<typename UIntType, size_t w, size_t s, size_t r>
 
     friend struct thrust::random::detail::random_core_access;
 
+    friend struct thrust::random::detail::subtract_with_carry_engine_discard;
+
     _CCCL_HOST_DEVICE
     bool equal(const subtract_with_carry_engine &rhs) const;
 
@@ -0,0 +1,285 @@
+/*
+ *  Copyright 2023 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file threefry_engine.h
+ *  \brief A counter-based pseudorandom number engine
+ *         based on Salmon et al.'s Threefry.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/random/detail/counter_based_engine.h>
+
+#include <thrust/detail/cstdint.h>
+#include <cstddef> // for size_t
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+
+/*! \addtogroup random_number_engine_templates
+ *  \{
+ */
+
+/*! \class threefry_engine
+ *  \brief A \p threefry_engine random number engine produces unsigned integer
+ *         random numbers using the counter-based Threefry algorithm of Salmon,
+ *         Moraes, Dror & Shaw, which is derived from the Threefish block cipher.
+ *
+ *         The engine's state is an <tt>n</tt>-word counter, an <tt>n</tt>-word key and
+ *         a block of \c n results. Every \c n invocations, the engine replaces the block with
+ *         \c r rounds of the Threefry bijection applied to the counter under the key, and
+ *         increments the counter. Each round adds pairs of words and xors one word of each
+ *         pair with the other rotated, and every fourth round adds words of the key.
+ *         Unlike Philox, Threefry uses no multiplications, which makes it the faster of the
+ *         two on processors with slow wide multiplication.
+ *
+ *         Since blocks depend only on the counter and the key, \p discard and \p set_counter
+ *         take constant time, which makes it cheap to give every element of a parallel
+ *         computation its own subsequence of one engine. The bijection is that of the
+ *         Random123 library.
+ *
+ *  \tparam UIntType The type of unsigned integer to produce.
+ *  \tparam w The word size of the produced values, which must be \c 32 or \c 64.
+ *  \tparam n The number of words of the counter, which must be \c 2 or \c 4.
+ *  \tparam r The number of rounds of the bijection.
+ *
+ *  \note Inexperienced users should not use this class template directly.  Instead, use
+ *  \p threefry4x32 or \p threefry4x64, which are instances of \p threefry_engine.
+ *
+ *  \see thrust::random::threefry4x32
+ *  \see thrust::random::threefry4x64
+ */
+template<typename UIntType, size_t w, size_t n, size_t r>
+  class threefry_engine
+    : public detail::counter_based_engine<threefry_engine<UIntType,w,n,r>, UIntType, w, n, n>
+{
+    /*! \cond
+     */
+  private:
+    static_assert(w == 32 || w == 64, "threefry_engine supports word sizes of 32 and 64 bits.");
+    static_assert(n == 2 || n == 4, "threefry_engine supports counters of 2 and 4 words.");
+
+    typedef detail::counter_based_engine<threefry_engine, UIntType, w, n, n> super_t;
+
+    friend super_t;
+    /*! \endcond
+     */
+
+  public:
+    // types
+
+    /*! \typedef result_type
+     *  \brief The type of the unsigned integer produced by this \p threefry_engine.
+     */
+    typedef UIntType result_type;
+
+    // engine characteristics
+
+    /*! The word size of the produced values.
+     */
+    static const size_t word_size = w;
+
+    /*! The number of words of the counter, which is the number of values
+     *  produced by each application of the bijection.
+     */
+    static const size_t word_count = n;
+
+    /*! The number of rounds of the bijection.
+     */
+    static const size_t round_count = r;
+
+    /*! The smallest value this \p threefry_engine may potentially produce.
+     */
+    static const result_type min = super_t::min;
+
+    /*! The largest value this \p threefry_engine may potentially produce.
+     */
+    static const result_type max = super_t::max;
+
+    /*! The default seed of this \p threefry_engine.
+     */
+    static const result_type default_seed = super_t::default_seed;
+
+    // constructors and seeding functions
+
+    /*! This constructor, which optionally accepts a seed, initializes a new
+     *  \p threefry_engine.
+     *
+     *  \param value The seed used to intialize this \p threefry_engine's state.
+     */
+    _CCCL_HOST_DEVICE
+    explicit threefry_engine(result_type value = default_seed);
+
+#if defined(THRUST_DOXYGEN)
+    /*! This method initializes this \p threefry_engine's state, and optionally accepts
+     *  a seed value. The seed becomes the first word of the key, and the counter is reset to zero.
+     *
+     *  \param value The seed used to initializes this \p threefry_engine's state.
+     */
+    _CCCL_HOST_DEVICE
+    void seed(result_type value = default_seed);
+
+    /*! This method sets the counter of this \p threefry_engine, so that the next
+     *  invocation returns the first value of the block of \p counter.
+     *
+     *  \param counter The counter, most significant word first.
+     */
+    _CCCL_HOST_DEVICE
+    void set_counter(const ::cuda::std::array<result_type, n> &counter);
+
+    // generating functions
+
+    /*! This member function produces a new random value and updates this \p threefry_engine's state.
+     *  \return A new random number.
+     */
+    _CCCL_HOST_DEVICE
+    result_type operator()(void);
+
+    /*! This member function advances this \p threefry_engine's state a given number of times
+     *  and discards the results. It takes constant time.
+     *
+     *  \param z The number of random values to discard.
+     */
+    _CCCL_HOST_DEVICE
+    void discard(unsigned long long z);
+
+    /*! This member function assigns the next <tt>last - first</tt> values this \p threefry_engine
+     *  produces to the elements of <tt>[first, last)</tt>. It is equivalent to invoking the
+     *  engine once per element, but stores whole blocks at a time.
+     *
+     *  \param first The beginning of the sequence to fill.
+     *  \param last The end of the sequence to fill.
+     */
+    template<typename OutputIterator>
+    _CCCL_HOST_DEVICE
+    void generate(OutputIterator first, OutputIterator last);
+#else
+    using super_t::seed;
+    using super_t::set_counter;
+    using super_t::operator();
+    using super_t::discard;
+    using super_t::generate;
+#endif
+
+    /*! \cond
+     */
+  private:
+    // applies the bijection with the key in m_k
+    _CCCL_HOST_DEVICE
+    void generate_block(const result_type (&counter)[n], result_type (&block)[n]) const;
+    /*! \endcond
+     */
+}; // end threefry_engine
+
+
+/*! This function checks two \p threefry_engines for equality.
+ *  \param lhs The first \p threefry_engine to test.
+ *  \param rhs The second \p threefry_engine to test.
+ *  \return \c true if \p lhs is equal to \p rhs; \c false, otherwise.
+ */
+template<typename UIntType_, size_t w_, size_t n_, size_t r_>
+_CCCL_HOST_DEVICE
+bool operator==(const threefry_engine<UIntType_,w_,n_,r_> &lhs,
+                const threefry_engine<UIntType_,w_,n_,r_> &rhs);
+
+
+/*! This function checks two \p threefry_engines for inequality.
+ *  \param lhs The first \p threefry_engine to test.
+ *  \param rhs The second \p threefry_engine to test.
+ *  \return \c true if \p lhs is not equal to \p rhs; \c false, otherwise.
+ */
+template<typename UIntType_, size_t w_, size_t n_, size_t r_>
+_CCCL_HOST_DEVICE
+bool operator!=(const threefry_engine<UIntType_,w_,n_,r_> &lhs,
+                const threefry_engine<UIntType_,w_,n_,r_> &rhs);
+
+
+/*! This function streams a threefry_engine to a \p std::basic_ostream.
+ *  \param os The \p basic_ostream to stream out to.
+ *  \param e The \p threefry_engine to stream out.
+ *  \return \p os
+ */
+template<typename UIntType_, size_t w_, size_t n_, size_t r_,
+         typename CharT, typename Traits>
+std::basic_ostream<CharT,Traits>&
+operator<<(std::basic_ostream<CharT,Traits> &os,
+           const threefry_engine<UIntType_,w_,n_,r_> &e);
+
+
+/*! This function streams a threefry_engine in from a std::basic_istream.
+ *  \param is The \p basic_istream to stream from.
+ *  \param e The \p threefry_engine to stream in.
+ *  \return \p is
+ */
+template<typename UIntType_, size_t w_, size_t n_, size_t r_,
+         typename CharT, typename Traits>
+std::basic_istream<CharT,Traits>&
+operator>>(std::basic_istream<CharT,Traits> &is,
+           threefry_engine<UIntType_,w_,n_,r_> &e);
+
+
+/*! \} // end random_number_engine_templates
+ */
+
+
+/*! \addtogroup predefined_random
+ *  \{
+ */
+
+/*! \typedef threefry4x32
+ *  \brief A random number engine with predefined parameters which implements the
+ *         Threefry4x32-20 counter-based random number generation algorithm.
+ *  \note The 10000th consecutive invocation of a default-constructed object of type \p threefry4x32
+ *        shall produce the value \c 112810865 .
+ */
+typedef threefry_engine<thrust::detail::uint32_t, 32, 4, 20> threefry4x32;
+
+
+/*! \typedef threefry4x64
+ *  \brief A random number engine with predefined parameters which implements the
+ *         Threefry4x64-20 counter-based random number generation algorithm.
+ *  \note The 10000th consecutive invocation of a default-constructed object of type \p threefry4x64
+ *        shall produce the value \c 9253438642465275567 .
+ */
+typedef threefry_engine<thrust::detail::uint64_t, 64, 4, 20> threefry4x64;
+
+/*! \} // end predefined_random
+ */
+
+} // end random
+
+// import names into thrust::
+using random::threefry_engine;
+using random::threefry4x32;
+using random::threefry4x64;
+
+THRUST_NAMESPACE_END
+
+#include <thrust/random/detail/threefry_engine.inl>
+
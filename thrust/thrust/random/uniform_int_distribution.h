@@ -156,6 +156,33 @@ template<typename IntType = int>
     _CCCL_HOST_DEVICE
     result_type operator()(UniformRandomNumberGenerator &urng, const param_type &parm);
 
+    /*! This method fills a range with uniform random integers drawn from this \p uniform_int_distribution's range, as if by assigning
+     *  <tt>(*this)(urng)</tt> to each of its elements in order. Work which does not depend on \p urng
+     *  is done once for the whole range.
+     *
+     *  \param urng The \p UniformRandomNumberGenerator to use as a source of randomness.
+     *  \param first The beginning of the range to fill.
+     *  \param last The end of the range to fill.
+     */
+    template<typename UniformRandomNumberGenerator, typename ForwardIterator>
+    _CCCL_HOST_DEVICE
+    void generate(UniformRandomNumberGenerator &urng, ForwardIterator first, ForwardIterator last);
+
+    /*! This method fills a range with uniform random integers drawn from the \p uniform_int_distribution's range
+     *  described by the given \p param_type object, as if by assigning <tt>(*this)(urng, parm)</tt>
+     *  to each of its elements in order.
+     *
+     *  \param urng The \p UniformRandomNumberGenerator to use as a source of randomness.
+     *  \param first The beginning of the range to fill.
+     *  \param last The end of the range to fill.
+     *  \param parm A \p param_type object encapsulating the parameters of the \p uniform_int_distribution
+     *              to draw from.
+     */
+    template<typename UniformRandomNumberGenerator, typename ForwardIterator>
+    _CCCL_HOST_DEVICE
+    void generate(UniformRandomNumberGenerator &urng, ForwardIterator first, ForwardIterator last,
+                  const param_type &parm);
+
     // property functions
 
     /*! This method returns the value of the parameter with which this \p uniform_int_distribution
@@ -172,7 +172,7 @@ template<typename Engine1, size_t s1,
      *  and discards the results.
      *
      *  \param z The number of random values to discard.
-     *  \note This function is provided because an implementation may be able to accelerate it.
+     *  \note The cost of this function grows logarithmically with \p z.
      */
     _CCCL_HOST_DEVICE
     void discard(unsigned long long z);
@@ -0,0 +1,155 @@
+/*
+ *  Copyright 2023 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file reduce_multi.h
+ *  \brief Computes several reductions of a range in a single pass
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/cpp11_required.h>
+
+#if _CCCL_STD_VER >= 2011
+
+#include <thrust/detail/execution_policy.h>
+#include <thrust/tuple.h>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup reductions
+ *  \{
+ */
+
+
+/*! \p reduce_multi computes several reductions of the range
+ *  <tt>[first, last)</tt> in a single pass. The \c i-th result is the
+ *  reduction of the elements of the range, each converted to the type of the
+ *  \c i-th element of \p init, with the \c i-th binary function, starting
+ *  from the \c i-th element of \p init. It returns the same results as one
+ *  \p reduce per binary function, but reads the range only once.
+ *
+ *  When the elements and all accumulators are arithmetic and the range is
+ *  contiguous, the CPU backends split every reduction into independent lanes,
+ *  which lets the compiler vectorize the loop.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param init The initial values of the reductions.
+ *  \param binary_ops The binary functions used to 'sum' values, one per
+ *         element of \p init.
+ *  \return The tuple of the results of the reductions.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input Iterator</a>
+ *          and \c InputIterator's \c value_type is convertible to each of \p Ts.
+ *  \tparam Ts The types of the results.
+ *  \tparam BinaryFunctions The types of the binary functions; the \c i-th one
+ *          is a model of <a href="https://en.cppreference.com/w/cpp/utility/functional/binary_function">Binary Function</a>
+ *          taking and returning the \c i-th type of \p Ts.
+ *
+ *  Like \p reduce, \p reduce_multi requires every binary function to be
+ *  associative and commutative.
+ *
+ *  The following code snippet demonstrates how to use \p reduce_multi to
+ *  compute the minimum, maximum and sum of a column using the
+ *  \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/reduce_multi.h>
+ *  #include <thrust/functional.h>
+ *  #include <thrust/execution_policy.h>
+ *  #include <limits>
+ *  ...
+ *  int data[6] = {1, 0, 2, 2, 1, 3};
+ *  thrust::tuple<int, int, long> result =
+ *    thrust::reduce_multi(thrust::host, data, data + 6,
+ *                         thrust::make_tuple(std::numeric_limits<int>::max(),
+ *                                            std::numeric_limits<int>::min(),
+ *                                            0l),
+ *                         thrust::minimum<int>(),
+ *                         thrust::maximum<int>(),
+ *                         thrust::plus<long>());
+ *  // result is (0, 3, 9); the count is thrust::distance(data, data + 6)
+ *  \endcode
+ *
+ *  \see reduce
+ *  \see transform_reduce
+ */
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename... Ts,
+         typename... BinaryFunctions>
+_CCCL_HOST_DEVICE
+  thrust::tuple<Ts...> reduce_multi(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                    InputIterator first,
+                                    InputIterator last,
+                                    thrust::tuple<Ts...> init,
+                                    BinaryFunctions... binary_ops);
+
+
+/*! \p reduce_multi computes several reductions of the range
+ *  <tt>[first, last)</tt> in a single pass. The \c i-th result is the
+ *  reduction of the elements of the range, each converted to the type of the
+ *  \c i-th element of \p init, with the \c i-th binary function, starting
+ *  from the \c i-th element of \p init.
+ *
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param init The initial values of the reductions.
+ *  \param binary_ops The binary functions used to 'sum' values, one per
+ *         element of \p init.
+ *  \return The tuple of the results of the reductions.
+ *
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input Iterator</a>
+ *          and \c InputIterator's \c value_type is convertible to each of \p Ts.
+ *  \tparam Ts The types of the results.
+ *  \tparam BinaryFunctions The types of the binary functions; the \c i-th one
+ *          is a model of <a href="https://en.cppreference.com/w/cpp/utility/functional/binary_function">Binary Function</a>
+ *          taking and returning the \c i-th type of \p Ts.
+ *
+ *  \see reduce
+ *  \see transform_reduce
+ */
+template<typename InputIterator,
+         typename... Ts,
+         typename... BinaryFunctions>
+  thrust::tuple<Ts...> reduce_multi(InputIterator first,
+                                    InputIterator last,
+                                    thrust::tuple<Ts...> init,
+                                    BinaryFunctions... binary_ops);
+
+
+/*! \} // end reductions
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/reduce_multi.inl>
+
+#endif // _CCCL_STD_VER >= 2011
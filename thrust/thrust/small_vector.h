@@ -0,0 +1,437 @@
+/*
+ *  Copyright 2023 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file small_vector.h
+ *  \brief A dynamically-sizable array of elements which resides in memory
+ *         accessible to hosts and stores up to a fixed number of elements
+ *         without allocating.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/memory_wrapper.h>
+#include <thrust/detail/type_traits.h>
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup container_classes Container Classes
+ *  \addtogroup host_containers Host Containers
+ *  \ingroup container_classes
+ *  \{
+ */
+
+/*! A \p small_vector is a host container with the interface of
+ *  <tt>std::vector</tt> which stores up to \p N elements inside the
+ *  \p small_vector object itself. Only when it grows beyond \p N elements does
+ *  it allocate storage with \p Alloc, so that many short vectors, e.g. one per
+ *  row of a sparse matrix, do not each require a trip to the allocator.
+ *
+ *  When the elements are stored inline, moving or swapping a \p small_vector
+ *  moves its elements, and iterators to them are invalidated. Elements of
+ *  trivially relocatable types are moved by copying their bytes.
+ *
+ *  \tparam T The type of the elements.
+ *  \tparam N The number of elements stored without allocating.
+ *  \tparam Alloc The allocator used once the size exceeds \p N.
+ *
+ *  \see https://en.cppreference.com/w/cpp/container/vector
+ *  \see host_vector
+ *  \see is_trivially_relocatable
+ */
+template<typename T, std::size_t N, typename Alloc = std::allocator<T> >
+  class small_vector
+{
+  private:
+    typedef std::allocator_traits<Alloc> alloc_traits;
+
+  public:
+    /*! \cond
+     */
+    typedef T                                     value_type;
+    typedef Alloc                                 allocator_type;
+    typedef std::size_t                           size_type;
+    typedef std::ptrdiff_t                        difference_type;
+    typedef T&                                    reference;
+    typedef const T&                              const_reference;
+    typedef T*                                    pointer;
+    typedef const T*                              const_pointer;
+    typedef T*                                    iterator;
+    typedef const T*                              const_iterator;
+    typedef std::reverse_iterator<iterator>       reverse_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    /*! The number of elements stored without allocating.
+     */
+    static const size_type inline_capacity = N;
+    /*! \endcond
+     */
+
+    /*! This constructor creates an empty \p small_vector.
+     */
+    small_vector(void);
+
+    /*! This constructor creates an empty \p small_vector.
+     *  \param alloc The allocator to use by this small_vector.
+     */
+    explicit small_vector(const Alloc &alloc);
+
+    /*! This constructor creates a \p small_vector with the given
+     *  size.
+     *  \param n The number of elements to initially create.
+     *  \param alloc The allocator to use by this small_vector.
+     */
+    explicit small_vector(size_type n, const Alloc &alloc = Alloc());
+
+    /*! This constructor creates a \p small_vector with copies
+     *  of an exemplar element.
+     *  \param n The number of elements to initially create.
+     *  \param value An element to copy.
+     *  \param alloc The allocator to use by this small_vector.
+     */
+    small_vector(size_type n, const value_type &value, const Alloc &alloc = Alloc());
+
+    /*! This constructor builds a \p small_vector from a range.
+     *  \param first The beginning of the range.
+     *  \param last The end of the range.
+     *  \param alloc The allocator to use by this small_vector.
+     */
+    template<typename InputIterator,
+             typename = typename detail::disable_if<detail::is_integral<InputIterator>::value>::type>
+    small_vector(InputIterator first, InputIterator last, const Alloc &alloc = Alloc());
+
+    /*! This constructor builds a \p small_vector from an intializer_list.
+     *  \param il The intializer_list.
+     *  \param alloc The allocator to use by this small_vector.
+     */
+    small_vector(std::initializer_list<T> il, const Alloc &alloc = Alloc());
+
+    /*! Copy constructor copies from an exemplar \p small_vector.
+     *  \param v The small_vector to copy.
+     */
+    small_vector(const small_vector &v);
+
+    /*! Move constructor moves from another \p small_vector. If \p v
+     *  stores its elements inline, they are moved one by one.
+     *  \param v The small_vector to move.
+     */
+    small_vector(small_vector &&v);
+
+    /*! The destructor erases the elements.
+     */
+    ~small_vector(void);
+
+    /*! Copy assign operator copies from another \p small_vector.
+     *  \param v The small_vector to copy.
+     */
+    small_vector &operator=(const small_vector &v);
+
+    /*! Move assign operator moves from another \p small_vector.
+     *  \param v The small_vector to move.
+     */
+    small_vector &operator=(small_vector &&v);
+
+    /*! Assign operator copies from an initializer_list.
+     *  \param il The initializer_list.
+     */
+    small_vector &operator=(std::initializer_list<T> il);
+
+    /*! This method assigns \p n copies of an exemplar element to this
+     *  \p small_vector.
+     *  \param n The number of copies of \p x.
+     *  \param x The exemplar element to copy.
+     */
+    void assign(size_type n, const value_type &x);
+
+    /*! This method assigns a range to this \p small_vector.
+     *  \param first The beginning of the range.
+     *  \param last The end of the range.
+     */
+    template<typename InputIterator,
+             typename = typename detail::disable_if<detail::is_integral<InputIterator>::value>::type>
+    void assign(InputIterator first, InputIterator last);
+
+    /*! This method returns a copy of this small_vector's allocator.
+     *  \return A copy of the allocator used by this small_vector.
+     */
+    allocator_type get_allocator(void) const;
+
+    iterator begin(void);
+    const_iterator begin(void) const;
+    const_iterator cbegin(void) const;
+    iterator end(void);
+    const_iterator end(void) const;
+    const_iterator cend(void) const;
+    reverse_iterator rbegin(void);
+    const_reverse_iterator rbegin(void) const;
+    const_reverse_iterator crbegin(void) const;
+    reverse_iterator rend(void);
+    const_reverse_iterator rend(void) const;
+    const_reverse_iterator crend(void) const;
+
+    /*! Returns the number of elements in this \p small_vector.
+     */
+    size_type size(void) const;
+
+    /*! Returns the size() of the largest possible \p small_vector.
+     */
+    size_type max_size(void) const;
+
+    /*! Returns the number of elements this \p small_vector can hold
+     *  without reallocating; never less than \p N.
+     */
+    size_type capacity(void) const;
+
+    /*! This method returns true iff size() == 0.
+     */
+    bool empty(void) const;
+
+    /*! This method returns true iff the elements are stored inside this
+     *  \p small_vector rather than in allocated storage.
+     */
+    bool is_inline(void) const;
+
+    /*! If \p n is greater than capacity(), this method allocates storage
+     *  for \p n elements and moves the elements there.
+     *  \param n The minimum capacity.
+     *  \throw std::length_error If \p n exceeds max_size().
+     */
+    void reserve(size_type n);
+
+    /*! This method releases unused allocated storage, moving the elements
+     *  back inside this \p small_vector if they fit.
+     */
+    void shrink_to_fit(void);
+
+    /*! This method resizes this \p small_vector to the specified number of
+     *  elements, value-initializing the new ones.
+     *  \param new_size Number of elements this small_vector should contain.
+     */
+    void resize(size_type new_size);
+
+    /*! This method resizes this \p small_vector to the specified number of
+     *  elements, copying \p x into the new ones.
+     *  \param new_size Number of elements this small_vector should contain.
+     *  \param x Data with which new elements should be populated.
+     */
+    void resize(size_type new_size, const value_type &x);
+
+    reference operator[](size_type n);
+    const_reference operator[](size_type n) const;
+
+    /*! Returns a reference to the element at position \p n.
+     *  \throw std::out_of_range If \p n is not less than size().
+     */
+    reference at(size_type n);
+
+    /*! Returns a const reference to the element at position \p n.
+     *  \throw std::out_of_range If \p n is not less than size().
+     */
+    const_reference at(size_type n) const;
+
+    reference front(void);
+    const_reference front(void) const;
+    reference back(void);
+    const_reference back(void) const;
+    pointer data(void);
+    const_pointer data(void) const;
+
+    /*! This method appends the given element to the end of this
+     *  \p small_vector.
+     *  \param x The element to append.
+     */
+    void push_back(const value_type &x);
+
+    /*! This method appends the given element to the end of this
+     *  \p small_vector.
+     *  \param x The element to move to the end.
+     */
+    void push_back(value_type &&x);
+
+    /*! This method appends an element constructed in place from the given
+     *  arguments to the end of this \p small_vector.
+     *  \param args The arguments to construct the element from.
+     *  \return A reference to the new element.
+     */
+    template<typename... Args>
+      reference emplace_back(Args&&... args);
+
+    /*! This method appends copies of the range <tt>[first,last)</tt> to the
+     *  end of this \p small_vector.
+     *  \param first The beginning of the range to append.
+     *  \param last The end of the range to append.
+     */
+    template<typename InputIterator>
+      void append(InputIterator first, InputIterator last);
+
+    /*! This method erases the last element of this \p small_vector.
+     */
+    void pop_back(void);
+
+    /*! This method inserts an element constructed in place from the given
+     *  arguments before \p position.
+     *  \param position The insertion position.
+     *  \param args The arguments to construct the element from.
+     *  \return An iterator pointing to the new element.
+     */
+    template<typename... Args>
+      iterator emplace(const_iterator position, Args&&... args);
+
+    /*! This method inserts a copy of \p x before \p position.
+     *  \param position The insertion position.
+     *  \param x The exemplar element to copy and insert.
+     *  \return An iterator pointing to the new element.
+     */
+    iterator insert(const_iterator position, const value_type &x);
+
+    /*! This method moves \p x before \p position.
+     *  \param position The insertion position.
+     *  \param x The element to move and insert.
+     *  \return An iterator pointing to the new element.
+     */
+    iterator insert(const_iterator position, value_type &&x);
+
+    /*! This method inserts \p n copies of \p x before \p position.
+     *  \param position The insertion position.
+     *  \param n The number of copies of \p x to insert.
+     *  \param x The exemplar element to copy and insert.
+     *  \return An iterator pointing to the first new element.
+     */
+    iterator insert(const_iterator position, size_type n, const value_type &x);
+
+    /*! This method inserts a copy of the range <tt>[first,last)</tt> before
+     *  \p position.
+     *  \param position The insertion position.
+     *  \param first The beginning of the range to copy.
+     *  \param last The end of the range to copy.
+     *  \return An iterator pointing to the first new element.
+     */
+    template<typename InputIterator,
+             typename = typename detail::disable_if<detail::is_integral<InputIterator>::value>::type>
+    iterator insert(const_iterator position, InputIterator first, InputIterator last);
+
+    /*! This method removes the element at position \p pos.
+     *  \param pos The position of the element of interest.
+     *  \return An iterator pointing to the element that followed the erased one.
+     */
+    iterator erase(const_iterator pos);
+
+    /*! This method removes the range of elements <tt>[first,last)</tt>.
+     *  \param first The beginning of the range of elements to remove.
+     *  \param last The end of the range of elements to remove.
+     *  \return An iterator pointing to the element that followed the erased ones.
+     */
+    iterator erase(const_iterator first, const_iterator last);
+
+    /*! This method erases all elements, keeping the capacity.
+     */
+    void clear(void);
+
+    /*! This method swaps the contents of this \p small_vector with another
+     *  \p small_vector.
+     *  \param v The small_vector with which to swap.
+     */
+    void swap(small_vector &v);
+
+  private:
+    // XXX we could inherit from this to take advantage of empty base class optimization
+    allocator_type m_allocator;
+    pointer m_begin;
+    size_type m_size;
+    size_type m_capacity;
+
+    // storage for up to N elements
+    alignas(T) unsigned char m_inline[sizeof(T) * (N > 0 ? N : 1)];
+
+    pointer inline_data(void);
+
+    // moves the elements of v, which must be empty
+    void steal(small_vector &v);
+
+    // frees allocated storage, if any, and returns to the inline storage
+    void release(void);
+
+    void propagate_allocator(small_vector &v, detail::true_type);
+    void propagate_allocator(small_vector &v, detail::false_type);
+
+    void swap_allocators(small_vector &v, detail::true_type);
+    void swap_allocators(small_vector &v, detail::false_type);
+
+    // these methods append a range at the end
+    template<typename InputIterator>
+      void append(InputIterator first, InputIterator last, std::input_iterator_tag);
+
+    template<typename ForwardIterator>
+      void append(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag);
+
+    // returns the capacity to grow to in order to fit n more elements
+    size_type grown_capacity(size_type n) const;
+
+    // this method appends n elements constructed with construct at the end
+    template<typename Constructor>
+      void append_n(size_type n, Constructor construct);
+
+    // this method moves the elements to new storage of new_capacity elements,
+    // after which it constructs n new elements with construct
+    template<typename Constructor>
+      void append_n(size_type n, Constructor construct, size_type new_capacity);
+
+    // destroys [first, last)
+    void destroy(pointer first, pointer last);
+
+    // moves [first, last) to the uninitialized storage at result and
+    // destroys [first, last)
+    void relocate(pointer first, pointer last, pointer result);
+    void relocate(pointer first, pointer last, pointer result, detail::true_type);
+    void relocate(pointer first, pointer last, pointer result, detail::false_type);
+};
+
+/*! Exchanges the contents of two \p small_vectors.
+ *  \param a The first \p small_vector of interest.
+ *  \param b The second \p small_vector of interest.
+ */
+template<typename T, std::size_t N, typename Alloc>
+  void swap(small_vector<T,N,Alloc> &a, small_vector<T,N,Alloc> &b);
+
+/*! Returns true iff both \p small_vectors have equal size and elements.
+ */
+template<typename T, std::size_t N, typename Alloc>
+  bool operator==(const small_vector<T,N,Alloc> &lhs, const small_vector<T,N,Alloc> &rhs);
+
+/*! Returns true iff the \p small_vectors differ in size or elements.
+ */
+template<typename T, std::size_t N, typename Alloc>
+  bool operator!=(const small_vector<T,N,Alloc> &lhs, const small_vector<T,N,Alloc> &rhs);
+
+/*! \} // host_containers
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/small_vector.inl>
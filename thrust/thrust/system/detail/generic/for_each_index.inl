@@ -0,0 +1,120 @@
+/*
+ *  Copyright 2023 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/detail/generic/for_each_index.h>
+#include <thrust/for_each.h>
+#include <thrust/transform_reduce.h>
+#include <thrust/iterator/counting_iterator.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace generic
+{
+namespace for_each_index_detail
+{
+
+
+template<typename IndexSpace, typename Function>
+struct decode_and_apply
+{
+  IndexSpace space;
+  mutable Function f;
+
+  _CCCL_HOST_DEVICE
+  decode_and_apply(const IndexSpace &space, Function f)
+    : space(space), f(f)
+  {}
+
+  _CCCL_EXEC_CHECK_DISABLE
+  _CCCL_HOST_DEVICE
+  auto operator()(typename IndexSpace::index_type i) const
+    -> decltype(IndexSpace::apply(f, typename IndexSpace::index_array()))
+  {
+    typename IndexSpace::index_array idx;
+    space.decode(i, idx);
+    return IndexSpace::apply(f, idx);
+  }
+}; // end decode_and_apply
+
+
+} // end for_each_index_detail
+
+
+template<typename DerivedPolicy,
+         typename Extents,
+         bool ColumnMajor,
+         typename Function>
+_CCCL_HOST_DEVICE
+void for_each_index(thrust::execution_policy<DerivedPolicy> &exec,
+                    const thrust::detail::index_space<Extents,ColumnMajor> &space,
+                    Function f)
+{
+  typedef thrust::detail::index_space<Extents,ColumnMajor> space_type;
+  typedef typename space_type::index_type                  index_type;
+
+  thrust::for_each_n(exec,
+                     thrust::counting_iterator<index_type>(0),
+                     space.size(),
+                     for_each_index_detail::decode_and_apply<space_type,Function>(space, f));
+} // end for_each_index()
+
+
+template<typename DerivedPolicy,
+         typename Extents,
+         bool ColumnMajor,
+         typename UnaryFunction,
+         typename OutputType,
+         typename BinaryFunction>
+_CCCL_HOST_DEVICE
+OutputType transform_reduce_index(thrust::execution_policy<DerivedPolicy> &exec,
+                                  const thrust::detail::index_space<Extents,ColumnMajor> &space,
+                                  UnaryFunction unary_op,
+                                  OutputType init,
+                                  BinaryFunction binary_op)
+{
+  typedef thrust::detail::index_space<Extents,ColumnMajor> space_type;
+  typedef typename space_type::index_type                  index_type;
+
+  thrust::counting_iterator<index_type> first(0);
+
+  return thrust::transform_reduce(exec,
+                                  first,
+                                  first + space.size(),
+                                  for_each_index_detail::decode_and_apply<space_type,UnaryFunction>(space, unary_op),
+                                  init,
+                                  binary_op);
+} // end transform_reduce_index()
+
+
+} // end namespace generic
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -0,0 +1,105 @@
+/*
+ *  Copyright 2023 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/detail/generic/reduce_multi.h>
+#include <thrust/system/detail/internal/reduce_multi.h>
+#include <thrust/transform_reduce.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace generic
+{
+namespace reduce_multi_detail
+{
+
+
+template<typename... Ts>
+struct replicate_functor
+{
+  template<typename T>
+  _CCCL_HOST_DEVICE
+  thrust::tuple<Ts...> operator()(const T &x) const
+  {
+    return thrust::system::detail::internal::reduce_multi_detail::replicate<Ts...>(x, thrust::make_index_sequence<sizeof...(Ts)>());
+  }
+}; // end replicate_functor
+
+
+template<typename OpTuple, typename... Ts>
+struct combine_functor
+{
+  mutable OpTuple ops;
+
+  _CCCL_HOST_DEVICE
+  combine_functor(OpTuple ops)
+    : ops(ops)
+  {}
+
+  _CCCL_HOST_DEVICE
+  thrust::tuple<Ts...> operator()(thrust::tuple<Ts...> lhs, const thrust::tuple<Ts...> &rhs) const
+  {
+    thrust::system::detail::internal::reduce_multi_combine(lhs, ops, rhs);
+    return lhs;
+  }
+}; // end combine_functor
+
+
+} // end reduce_multi_detail
+
+
+// every element becomes a tuple of accumulators, and a single reduction of
+// those tuples computes all results
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename... Ts,
+         typename... BinaryFunctions>
+_CCCL_HOST_DEVICE
+thrust::tuple<Ts...> reduce_multi(thrust::execution_policy<DerivedPolicy> &exec,
+                                  InputIterator first,
+                                  InputIterator last,
+                                  thrust::tuple<Ts...> init,
+                                  thrust::tuple<BinaryFunctions...> binary_ops)
+{
+  typedef thrust::tuple<BinaryFunctions...> op_tuple;
+
+  return thrust::transform_reduce(exec,
+                                  first,
+                                  last,
+                                  reduce_multi_detail::replicate_functor<Ts...>(),
+                                  init,
+                                  reduce_multi_detail::combine_functor<op_tuple, Ts...>(binary_ops));
+} // end reduce_multi()
+
+
+} // end namespace generic
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -31,12 +31,14 @@ namespace detail {
 namespace generic {
 
 // An implementation of a Feistel cipher for operating on 64 bit keys
+//
+// The bits of a key are split into a left and a right side, and each round
+// xors a keyed hash of one side into the other, alternating between the
+// sides. Every round is invertible, whatever the widths of the sides, so the
+// cipher is a bijection on [0, nearest_power_of_two()). The round function
+// mixes its input with two multiplications, which makes few rounds enough:
+// see num_rounds.
 class feistel_bijection {
-  struct round_state {
-    std::uint32_t left;
-    std::uint32_t right;
-  };
-
  public:
   template <class URBG>
   _CCCL_HOST_DEVICE feistel_bijection(std::uint64_t m, URBG&& g) {
@@ -49,7 +51,7 @@ class feistel_bijection {
     right_side_mask = (1ull << right_side_bits) - 1;
 
     for (std::uint32_t i = 0; i < num_rounds; i++) {
-      key[i] = g();
+      key[i] = static_cast<std::uint32_t>(g());
     }
   }
 
@@ -58,28 +60,27 @@ class feistel_bijection {
   }
 
   _CCCL_HOST_DEVICE std::uint64_t operator()(const std::uint64_t val) const {
-    std::uint32_t state[2] = { static_cast<std::uint32_t>( val >> right_side_bits ), static_cast<std::uint32_t>( val & right_side_mask ) };
-    for( std::uint32_t i = 0; i < num_rounds; i++ )
-    {
-        std::uint32_t hi, lo;
-        constexpr std::uint64_t M0 = UINT64_C( 0xD2B74407B1CE6E93 );
-        mulhilo( M0, state[0], hi, lo );
-        lo = ( lo << ( right_side_bits - left_side_bits ) ) | state[1] >> left_side_bits;
-        state[0] = ( ( hi ^ key[i] ) ^ state[1] ) & left_side_mask;
-        state[1] = lo & right_side_mask;
+    std::uint32_t left = static_cast<std::uint32_t>(val >> right_side_bits);
+    std::uint32_t right = static_cast<std::uint32_t>(val & right_side_mask);
+    for (std::uint32_t i = 0; i < num_rounds; i += 2) {
+      left = (left ^ round_function(right, key[i])) & left_side_mask;
+      right = (right ^ round_function(left, key[i + 1])) & right_side_mask;
     }
     // Combine the left and right sides together to get result
-    return (static_cast<std::uint64_t>(state[0]) << right_side_bits) | static_cast<std::uint64_t>(state[1]);
+    return (static_cast<std::uint64_t>(left) << right_side_bits) | static_cast<std::uint64_t>(right);
   }
 
  private:
-   // Perform 64 bit multiplication and save result in two 32 bit int
-   static _CCCL_HOST_DEVICE void mulhilo( std::uint64_t a, std::uint64_t b, std::uint32_t& hi, std::uint32_t& lo )
-   {
-       std::uint64_t product = a * b;
-       hi = static_cast<std::uint32_t>( product >> 32 );
-       lo = static_cast<std::uint32_t>( product );
-   }
+  // Keyed hash of one side of the state. The second multiplication makes
+  // every bit of the result depend on every bit of the input, and not only
+  // the high bits of the product.
+  static _CCCL_HOST_DEVICE std::uint32_t round_function(std::uint32_t x, std::uint32_t k) {
+    constexpr std::uint64_t M0 = UINT64_C(0xD2B74407B1CE6E93);
+    std::uint64_t h = (static_cast<std::uint64_t>(x) + k) * M0;
+    h ^= h >> 32;
+    h *= M0;
+    return static_cast<std::uint32_t>(h >> 32);
+  }
 
   // Find the nearest power of two
   static _CCCL_HOST_DEVICE std::uint64_t get_cipher_bits(std::uint64_t m) {
@@ -93,7 +94,10 @@ class feistel_bijection {
     return i;
   }
 
-  static constexpr std::uint32_t num_rounds = 24;
+  // Four rounds updating each side are enough for the permutations to be
+  // indistinguishable from uniform in the chi-squared tests of the shuffle
+  // tests, down to the smallest cipher of 4 bits.
+  static constexpr std::uint32_t num_rounds = 8;
   std::uint64_t right_side_bits;
   std::uint64_t left_side_bits;
   std::uint64_t right_side_mask;
@@ -0,0 +1,244 @@
+/*
+ *  Copyright 2023 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file reduce_multi.h
+ *  \brief Single pass kernels shared by the implementations of reduce_multi.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/cpp11_required.h>
+
+#if _CCCL_STD_VER >= 2011
+
+#include <thrust/detail/type_traits.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/tuple.h>
+#include <thrust/type_traits/integer_sequence.h>
+#include <thrust/type_traits/is_contiguous_iterator.h>
+
+// The number of independent accumulators per reduction that the arithmetic
+// fast path keeps. Splitting each reduction into several lanes breaks the
+// dependency chain through its accumulator, which lets the compiler keep the
+// lanes in one vector register and vectorize the loop.
+#ifndef THRUST_REDUCE_MULTI_LANES
+#  define THRUST_REDUCE_MULTI_LANES 8
+#endif
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace reduce_multi_detail
+{
+
+
+template<typename... Ts>
+struct all_arithmetic;
+
+template<>
+struct all_arithmetic<> : thrust::detail::true_type
+{};
+
+template<typename T, typename... Ts>
+struct all_arithmetic<T, Ts...>
+  : thrust::detail::integral_constant<
+      bool,
+      thrust::detail::is_arithmetic<T>::value && all_arithmetic<Ts...>::value
+    >
+{};
+
+
+// a tuple whose every element is x, converted to the element's type
+template<typename... Ts, typename T, std::size_t... Is>
+_CCCL_HOST_DEVICE
+thrust::tuple<Ts...> replicate(const T &x, thrust::index_sequence<Is...>)
+{
+  return thrust::tuple<Ts...>(static_cast<Ts>(x)...);
+}
+
+
+// acc_i = op_i(acc_i, x) for every i
+_CCCL_EXEC_CHECK_DISABLE
+template<typename... Ts, typename OpTuple, typename T, std::size_t... Is>
+_CCCL_HOST_DEVICE
+void accumulate(thrust::tuple<Ts...> &acc, OpTuple &ops, const T &x, thrust::index_sequence<Is...>)
+{
+  int swallow[] = {0, ((void)(thrust::get<Is>(acc) = thrust::get<Is>(ops)(thrust::get<Is>(acc), static_cast<Ts>(x))), 0)...};
+  (void)swallow;
+}
+
+
+// acc_i = op_i(acc_i, other_i) for every i
+_CCCL_EXEC_CHECK_DISABLE
+template<typename Tuple, typename OpTuple, std::size_t... Is>
+_CCCL_HOST_DEVICE
+void combine(Tuple &acc, OpTuple &ops, const Tuple &other, thrust::index_sequence<Is...>)
+{
+  int swallow[] = {0, ((void)(thrust::get<Is>(acc) = thrust::get<Is>(ops)(thrust::get<Is>(acc), thrust::get<Is>(other))), 0)...};
+  (void)swallow;
+}
+
+
+template<typename T>
+struct lanes
+{
+  T v[THRUST_REDUCE_MULTI_LANES];
+};
+
+
+template<typename T, typename BinaryFunction, typename U>
+void accumulate_lanes(lanes<T> &acc, BinaryFunction &op, const U *p)
+{
+  for(int l = 0; l != THRUST_REDUCE_MULTI_LANES; ++l)
+  {
+    acc.v[l] = op(acc.v[l], static_cast<T>(p[l]));
+  }
+}
+
+
+template<typename T, typename BinaryFunction>
+T reduce_lanes(const lanes<T> &acc, BinaryFunction &op)
+{
+  T result = acc.v[0];
+  for(int l = 1; l != THRUST_REDUCE_MULTI_LANES; ++l)
+  {
+    result = op(result, acc.v[l]);
+  }
+  return result;
+}
+
+
+// the fast path: a contiguous range of arithmetic values, reduced into
+// arithmetic accumulators, THRUST_REDUCE_MULTI_LANES elements at a time
+template<typename... Ts, typename OpTuple, typename T, typename Size, std::size_t... Is>
+thrust::tuple<Ts...> reduce_contiguous_n(const T *p, Size n, OpTuple &ops, thrust::index_sequence<Is...> seq)
+{
+  const Size num_lanes = THRUST_REDUCE_MULTI_LANES;
+
+  thrust::tuple<lanes<Ts>...> acc;
+  for(Size l = 0; l != num_lanes; ++l)
+  {
+    int swallow[] = {0, ((void)(thrust::get<Is>(acc).v[l] = static_cast<Ts>(p[l])), 0)...};
+    (void)swallow;
+  }
+
+  Size i = num_lanes;
+  for(; i + num_lanes <= n; i += num_lanes)
+  {
+    int swallow[] = {0, ((void)accumulate_lanes(thrust::get<Is>(acc), thrust::get<Is>(ops), p + i), 0)...};
+    (void)swallow;
+  }
+
+  thrust::tuple<Ts...> result(reduce_lanes(thrust::get<Is>(acc), thrust::get<Is>(ops))...);
+
+  for(; i != n; ++i)
+  {
+    accumulate(result, ops, p[i], seq);
+  }
+
+  return result;
+} // end reduce_contiguous_n()
+
+
+_CCCL_EXEC_CHECK_DISABLE
+template<typename... Ts, typename InputIterator, typename Size, typename OpTuple>
+_CCCL_HOST_DEVICE
+thrust::tuple<Ts...> reduce_n(InputIterator first, Size n, OpTuple &ops, thrust::detail::false_type)
+{
+  typedef thrust::make_index_sequence<sizeof...(Ts)> seq;
+
+  thrust::tuple<Ts...> result = replicate<Ts...>(*first, seq());
+  ++first;
+
+  for(Size i = 1; i < n; ++i, ++first)
+  {
+    accumulate(result, ops, *first, seq());
+  }
+
+  return result;
+} // end reduce_n()
+
+
+template<typename... Ts, typename InputIterator, typename Size, typename OpTuple>
+_CCCL_HOST_DEVICE
+thrust::tuple<Ts...> reduce_n(InputIterator first, Size n, OpTuple &ops, thrust::detail::true_type)
+{
+  typedef thrust::make_index_sequence<sizeof...(Ts)> seq;
+
+  if(n >= Size(THRUST_REDUCE_MULTI_LANES))
+  {
+    // the fast path is host code
+    NV_IF_TARGET(NV_IS_HOST, (
+      return reduce_contiguous_n<Ts...>(thrust::detail::try_unwrap_contiguous_iterator(first), n, ops, seq());
+    ));
+  }
+
+  return reduce_n<Ts...>(first, n, ops, thrust::detail::false_type());
+} // end reduce_n()
+
+
+} // end reduce_multi_detail
+
+
+// Reduces the n > 0 elements starting at first into one accumulator of each
+// of the types Ts, with the corresponding binary function from ops. Each
+// accumulator starts out as the first element.
+template<typename... Ts, typename InputIterator, typename Size, typename OpTuple>
+_CCCL_HOST_DEVICE
+thrust::tuple<Ts...> reduce_multi_n(InputIterator first, Size n, OpTuple &ops)
+{
+  typedef typename thrust::iterator_value<InputIterator>::type value_type;
+
+  typedef thrust::detail::integral_constant<
+    bool,
+    thrust::is_contiguous_iterator<InputIterator>::value &&
+    thrust::detail::is_arithmetic<value_type>::value &&
+    reduce_multi_detail::all_arithmetic<Ts...>::value
+  > use_lanes;
+
+  return reduce_multi_detail::reduce_n<Ts...>(first, n, ops, use_lanes());
+} // end reduce_multi_n()
+
+
+// acc_i = op_i(acc_i, other_i) for every i
+template<typename... Ts, typename OpTuple>
+_CCCL_HOST_DEVICE
+void reduce_multi_combine(thrust::tuple<Ts...> &acc, OpTuple &ops, const thrust::tuple<Ts...> &other)
+{
+  reduce_multi_detail::combine(acc, ops, other, thrust::make_index_sequence<sizeof...(Ts)>());
+} // end reduce_multi_combine()
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
+#endif // _CCCL_STD_VER >= 2011
@@ -0,0 +1,181 @@
+/*
+ *  Copyright 2023 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file shuffle.h
+ *  \brief Kernels shared by the CPU implementations of shuffle_copy.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+// shuffle_copy gathers input[f(i)] for every i in [0, f.nearest_power_of_two())
+// with f(i) < m, in order of i. The CPU backends split [0, n) into ranges of
+// i, count the keys each range keeps, and then gather every range from the
+// offset that the counts of the preceding ranges give. Unlike the generic
+// implementation, this never materializes the keys, and the compaction is
+// fused into the pass which computes them.
+
+
+// the number of i in [first, last) for which f(i) < m
+template<typename Bijection>
+_CCCL_HOST_DEVICE
+std::uint64_t shuffle_count(const Bijection &f,
+                            std::uint64_t m,
+                            std::uint64_t first,
+                            std::uint64_t last)
+{
+  std::uint64_t count = 0;
+
+  for(std::uint64_t i = first; i != last; ++i)
+  {
+    count += (f(i) < m) ? 1 : 0;
+  }
+
+  return count;
+}
+
+
+// The number of keys which shuffle_gather computes before loading the
+// elements they select. Gathering a block of keys without branching on
+// whether they are in range lets the loads of a block overlap, which matters
+// because nearly every one of them misses the cache on large inputs.
+#ifndef THRUST_SHUFFLE_GATHER_BLOCK
+#  define THRUST_SHUFFLE_GATHER_BLOCK 64
+#endif
+
+
+namespace shuffle_detail
+{
+
+
+_CCCL_EXEC_CHECK_DISABLE
+template<typename Bijection,
+         typename RandomAccessIterator,
+         typename OutputIterator>
+_CCCL_HOST_DEVICE
+OutputIterator gather(const Bijection &f,
+                      std::uint64_t m,
+                      std::uint64_t first,
+                      std::uint64_t last,
+                      RandomAccessIterator input,
+                      OutputIterator result)
+{
+  for(std::uint64_t i = first; i != last; ++i)
+  {
+    const std::uint64_t key = f(i);
+
+    if(key < m)
+    {
+      *result = input[key];
+      ++result;
+    }
+  }
+
+  return result;
+} // end gather()
+
+
+template<typename Bijection,
+         typename RandomAccessIterator,
+         typename OutputIterator>
+OutputIterator gather_blocked(const Bijection &f,
+                              std::uint64_t m,
+                              std::uint64_t first,
+                              std::uint64_t last,
+                              RandomAccessIterator input,
+                              OutputIterator result)
+{
+  std::uint64_t keys[THRUST_SHUFFLE_GATHER_BLOCK];
+
+  while(first != last)
+  {
+    const std::uint64_t block_last =
+      (last - first < THRUST_SHUFFLE_GATHER_BLOCK) ? last : first + THRUST_SHUFFLE_GATHER_BLOCK;
+
+    // compact the block's keys; out of range keys are overwritten
+    int num_keys = 0;
+    for(std::uint64_t i = first; i != block_last; ++i)
+    {
+      const std::uint64_t key = f(i);
+      keys[num_keys] = key;
+      num_keys += (key < m) ? 1 : 0;
+    }
+
+    for(int j = 0; j != num_keys; ++j)
+    {
+      *result = input[keys[j]];
+      ++result;
+    }
+
+    first = block_last;
+  }
+
+  return result;
+} // end gather_blocked()
+
+
+} // end shuffle_detail
+
+
+// writes input[f(i)] for every i in [first, last) for which f(i) < m to
+// consecutive elements from result, and returns the end of the output
+_CCCL_EXEC_CHECK_DISABLE
+template<typename Bijection,
+         typename RandomAccessIterator,
+         typename OutputIterator>
+_CCCL_HOST_DEVICE
+OutputIterator shuffle_gather(const Bijection &f,
+                              std::uint64_t m,
+                              std::uint64_t first,
+                              std::uint64_t last,
+                              RandomAccessIterator input,
+                              OutputIterator result)
+{
+  // the blocked path is host code, as the block would live in local memory
+  // on the device
+  NV_IF_TARGET(NV_IS_HOST, (
+    return shuffle_detail::gather_blocked(f, m, first, last, input, result);
+  ), (
+    return shuffle_detail::gather(f, m, first, last, input, result);
+  ));
+} // end shuffle_gather()
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
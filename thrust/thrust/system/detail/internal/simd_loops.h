@@ -0,0 +1,106 @@
+/*
+ *  Copyright 2023 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file simd_loops.h
+ *  \brief Elementwise loops over raw pointers, which the parallel host
+ *         backends run on each chunk of a contiguous range.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/type_traits.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/type_traits/is_contiguous_iterator.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+// Iterators whose elements are contiguous in memory can be replaced by raw
+// pointers, which keeps the loops below free of iterator wrappers so that the
+// compiler can vectorize them.
+template<typename... Iterators>
+struct are_contiguous_iterators;
+
+template<>
+struct are_contiguous_iterators<> : thrust::detail::true_type
+{};
+
+template<typename Iterator, typename... Iterators>
+struct are_contiguous_iterators<Iterator, Iterators...>
+  : thrust::detail::integral_constant<
+      bool,
+      thrust::is_contiguous_iterator<Iterator>::value &&
+      are_contiguous_iterators<Iterators...>::value
+    >
+{};
+
+
+// f(first[i]) for every i in [0, n)
+template<typename T, typename Size, typename UnaryFunction>
+void simd_for_each_n(T *first, Size n, UnaryFunction &f)
+{
+  THRUST_PRAGMA_OMP_SIMD
+  for(Size i = 0; i < n; ++i)
+  {
+    f(first[i]);
+  }
+}
+
+
+// result[i] = op(first[i]) for every i in [0, n)
+// the input pointers keep the constness of the unwrapped iterators, so that
+// functors taking their arguments by non-const reference still apply
+template<typename InputPointer, typename Size, typename OutputPointer, typename UnaryFunction>
+void simd_transform_n(InputPointer first, Size n, OutputPointer result, UnaryFunction &op)
+{
+  THRUST_PRAGMA_OMP_SIMD
+  for(Size i = 0; i < n; ++i)
+  {
+    result[i] = op(first[i]);
+  }
+}
+
+
+// result[i] = op(first1[i], first2[i]) for every i in [0, n)
+template<typename InputPointer1, typename InputPointer2, typename Size, typename OutputPointer, typename BinaryFunction>
+void simd_transform_n(InputPointer1 first1, InputPointer2 first2, Size n, OutputPointer result, BinaryFunction &op)
+{
+  THRUST_PRAGMA_OMP_SIMD
+  for(Size i = 0; i < n; ++i)
+  {
+    result[i] = op(first1[i], first2[i]);
+  }
+}
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
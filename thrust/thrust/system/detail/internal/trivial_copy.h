@@ -0,0 +1,175 @@
+/*
+ *  Copyright 2023 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file trivial_copy.h
+ *  \brief Decomposition of bulk copies of trivially relocatable data for
+ *         the parallel host backends.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cstddef>
+#include <cstring>
+
+#if !defined(__CUDA_ARCH__) && \
+    (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#  define THRUST_HAS_HOST_STREAMING_STORES
+#  include <emmintrin.h>
+#endif
+
+// Size of the pieces a parallel host backend splits a bulk copy into.
+#ifndef THRUST_HOST_TRIVIAL_COPY_CHUNK_SIZE
+#  define THRUST_HOST_TRIVIAL_COPY_CHUNK_SIZE (1 << 20)
+#endif
+
+// Copies of at least this many bytes bypass the cache with non-temporal
+// stores, because the destination would not fit in the cache anyway.
+#ifndef THRUST_HOST_STREAMING_COPY_THRESHOLD
+#  define THRUST_HOST_STREAMING_COPY_THRESHOLD (std::size_t(32) << 20)
+#endif
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+// Splits a copy of `bytes` bytes into chunks whose destination boundaries are
+// page aligned, so that no two threads write to the same page and each chunk
+// can be copied independently with memcpy.
+class trivial_copy_decomposition
+{
+  public:
+    static const std::size_t page_size = 4096;
+
+    trivial_copy_decomposition(void *dst, const void *src, std::size_t bytes)
+      : m_dst(static_cast<char *>(dst)),
+        m_src(static_cast<const char *>(src)),
+        m_bytes(bytes),
+        m_chunk(chunk_size()),
+        m_chunks((bytes + m_chunk - 1) / m_chunk),
+        m_streaming(bytes >= THRUST_HOST_STREAMING_COPY_THRESHOLD)
+    {}
+
+    // Copies smaller than this do not benefit from being split across threads.
+    static std::size_t parallel_threshold()
+    {
+      return 2 * chunk_size();
+    }
+
+    std::size_t size() const
+    {
+      return m_chunks;
+    }
+
+    void copy(std::size_t i) const
+    {
+      const std::size_t begin = offset(i);
+      const std::size_t end   = offset(i + 1);
+
+      if(m_streaming)
+      {
+        stream_copy(m_dst + begin, m_src + begin, end - begin);
+      }
+      else
+      {
+        std::memcpy(m_dst + begin, m_src + begin, end - begin);
+      }
+    }
+
+  private:
+    char *m_dst;
+    const char *m_src;
+    std::size_t m_bytes;
+    std::size_t m_chunk;
+    std::size_t m_chunks;
+    bool m_streaming;
+
+    static std::size_t chunk_size()
+    {
+      const std::size_t chunk = THRUST_HOST_TRIVIAL_COPY_CHUNK_SIZE;
+      return chunk < page_size ? page_size : chunk - chunk % page_size;
+    }
+
+    // Offset of the beginning of chunk i: the nominal boundary i * m_chunk,
+    // moved down to the beginning of its destination page.
+    std::size_t offset(std::size_t i) const
+    {
+      if(i == 0)
+      {
+        return 0;
+      }
+      if(i >= m_chunks)
+      {
+        return m_bytes;
+      }
+
+      const std::size_t dst  = reinterpret_cast<std::size_t>(m_dst);
+      const std::size_t page = (dst + i * m_chunk) & ~(page_size - 1);
+      return page - dst;
+    }
+
+    static void stream_copy(char *dst, const char *src, std::size_t n)
+    {
+#if defined(THRUST_HAS_HOST_STREAMING_STORES)
+      const std::size_t misalignment = reinterpret_cast<std::size_t>(dst) % 16;
+      if(misalignment != 0)
+      {
+        const std::size_t head = (16 - misalignment) < n ? (16 - misalignment) : n;
+        std::memcpy(dst, src, head);
+        dst += head;
+        src += head;
+        n -= head;
+      }
+
+      for(; n >= 64; n -= 64, dst += 64, src += 64)
+      {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 16));
+        const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 32));
+        const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 48));
+        _mm_stream_si128(reinterpret_cast<__m128i *>(dst), a);
+        _mm_stream_si128(reinterpret_cast<__m128i *>(dst + 16), b);
+        _mm_stream_si128(reinterpret_cast<__m128i *>(dst + 32), c);
+        _mm_stream_si128(reinterpret_cast<__m128i *>(dst + 48), d);
+      }
+
+      std::memcpy(dst, src, n);
+
+      // non-temporal stores are weakly ordered
+      _mm_sfence();
+#else
+      std::memcpy(dst, src, n);
+#endif
+    }
+};
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,78 @@
+/*
+ *  Copyright 2023 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/cpp11_required.h>
+
+#if _CCCL_STD_VER >= 2011
+
+#include <thrust/distance.h>
+#include <thrust/system/detail/internal/reduce_multi.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+#include <thrust/tuple.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+
+
+_CCCL_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename... Ts,
+         typename... BinaryFunctions>
+_CCCL_HOST_DEVICE
+thrust::tuple<Ts...> reduce_multi(sequential::execution_policy<DerivedPolicy> &,
+                                  InputIterator first,
+                                  InputIterator last,
+                                  thrust::tuple<Ts...> init,
+                                  thrust::tuple<BinaryFunctions...> binary_ops)
+{
+  typedef typename thrust::iterator_difference<InputIterator>::type Size;
+
+  const Size n = thrust::distance(first, last);
+
+  if (n > 0)
+  {
+    thrust::tuple<Ts...> sum = thrust::system::detail::internal::reduce_multi_n<Ts...>(first, n, binary_ops);
+    thrust::system::detail::internal::reduce_multi_combine(init, binary_ops, sum);
+  }
+
+  return init;
+} // end reduce_multi()
+
+
+} // end namespace sequential
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
+#endif // _CCCL_STD_VER >= 2011
+
@@ -0,0 +1,74 @@
+/*
+ *  Copyright 2023 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/cpp11_required.h>
+
+#if _CCCL_STD_VER >= 2011
+
+#include <thrust/system/detail/generic/shuffle.h>
+#include <thrust/system/detail/internal/shuffle.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+
+#include <cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+
+
+template<typename DerivedPolicy,
+         typename RandomIterator,
+         typename OutputIterator,
+         typename URBG>
+_CCCL_HOST_DEVICE
+void shuffle_copy(sequential::execution_policy<DerivedPolicy> &,
+                  RandomIterator first,
+                  RandomIterator last,
+                  OutputIterator result,
+                  URBG &&g)
+{
+  const std::uint64_t m = last - first;
+
+  thrust::system::detail::generic::feistel_bijection bijection(m, g);
+
+  // a single pass gathers the elements in the same order as the generic
+  // implementation's scan
+  thrust::system::detail::internal::shuffle_gather(bijection, m, 0, bijection.nearest_power_of_two(), first, result);
+} // end shuffle_copy()
+
+
+} // end namespace sequential
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
+#endif // _CCCL_STD_VER >= 2011
+
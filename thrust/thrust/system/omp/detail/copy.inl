@@ -29,6 +29,10 @@
 #include <thrust/system/detail/generic/copy.h>
 #include <thrust/system/detail/sequential/copy.h>
 #include <thrust/detail/type_traits/minimum_type.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/system/detail/internal/trivial_copy.h>
+#include <thrust/type_traits/is_trivially_relocatable.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
 
 
 THRUST_NAMESPACE_BEGIN
@@ -38,6 +42,72 @@ namespace omp
 {
 namespace detail
 {
+namespace copy_detail
+{
+
+
+// copies n trivially relocatable elements from first to result with all threads
+template<typename T>
+  T *trivial_copy_n(const T *first,
+                    std::ptrdiff_t n,
+                    T *result)
+{
+  const std::size_t bytes = n * sizeof(T);
+
+  if(bytes < thrust::system::detail::internal::trivial_copy_decomposition::parallel_threshold())
+  {
+    std::memmove(result, first, bytes);
+    return result + n;
+  }
+
+  thrust::system::detail::internal::trivial_copy_decomposition chunks(result, first, bytes);
+
+  // use a signed type for the iteration variable
+  const long num_chunks = static_cast<long>(chunks.size());
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for(long i = 0; i < num_chunks; ++i)
+  {
+    chunks.copy(i);
+  }
+  return result + n;
+} // end trivial_copy_n()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename Size,
+         typename OutputIterator>
+  OutputIterator copy_n(execution_policy<DerivedPolicy> &,
+                        InputIterator first,
+                        Size n,
+                        OutputIterator result,
+                        thrust::detail::true_type)  // is_indirectly_trivially_relocatable_to
+{
+  if(n <= 0) return result;
+
+  copy_detail::trivial_copy_n(thrust::raw_pointer_cast(&*first), n, thrust::raw_pointer_cast(&*result));
+  return result + n;
+} // end copy_n()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename Size,
+         typename OutputIterator>
+  OutputIterator copy_n(execution_policy<DerivedPolicy> &exec,
+                        InputIterator first,
+                        Size n,
+                        OutputIterator result,
+                        thrust::detail::false_type)  // is_indirectly_trivially_relocatable_to
+{
+  return thrust::system::detail::generic::copy_n(exec, first, n, result);
+} // end copy_n()
+
+
+} // end copy_detail
+
+
 namespace dispatch
 {
 
@@ -64,7 +134,8 @@ template<typename DerivedPolicy,
                       OutputIterator result,
                       thrust::random_access_traversal_tag)
 {
-  return thrust::system::detail::generic::copy(exec, first, last, result);
+  return thrust::system::omp::detail::copy_detail::copy_n(exec, first, last - first, result,
+    typename thrust::is_indirectly_trivially_relocatable_to<InputIterator,OutputIterator>::type());
 } // end copy()
 
 
@@ -92,7 +163,8 @@ template<typename DerivedPolicy,
                         OutputIterator result,
                         thrust::random_access_traversal_tag)
 {
-  return thrust::system::detail::generic::copy_n(exec, first, n, result);
+  return thrust::system::omp::detail::copy_detail::copy_n(exec, first, n, result,
+    typename thrust::is_indirectly_trivially_relocatable_to<InputIterator,OutputIterator>::type());
 } // end copy_n()
 
 
@@ -30,6 +30,9 @@
 #include <thrust/distance.h>
 #include <thrust/for_each.h>
 #include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/simd_loops.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
 #include <thrust/system/omp/detail/pragma_omp.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -39,6 +42,52 @@ namespace omp
 {
 namespace detail
 {
+namespace for_each_detail
+{
+
+template<typename RandomAccessIterator,
+         typename DifferenceType,
+         typename UnaryFunction>
+void for_each_n(RandomAccessIterator first,
+                DifferenceType n,
+                UnaryFunction &f,
+                thrust::detail::false_type) // not contiguous
+{
+  THRUST_PRAGMA_OMP(parallel for)
+  for(DifferenceType i = 0;
+      i < n;
+      ++i)
+  {
+    RandomAccessIterator temp = first + i;
+    f(*temp);
+  }
+}
+
+template<typename RandomAccessIterator,
+         typename DifferenceType,
+         typename UnaryFunction>
+void for_each_n(RandomAccessIterator first,
+                DifferenceType n,
+                UnaryFunction &f,
+                thrust::detail::true_type) // contiguous
+{
+  // each thread runs a vectorizable loop over a raw pointer to its chunk
+  thrust::system::detail::internal::uniform_decomposition<DifferenceType> decomp =
+    thrust::system::omp::detail::default_decomposition(n);
+
+  const DifferenceType num_chunks = decomp.size();
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for(DifferenceType i = 0;
+      i < num_chunks;
+      ++i)
+  {
+    thrust::system::detail::internal::simd_for_each_n(
+      thrust::detail::try_unwrap_contiguous_iterator(first + decomp[i].begin()), decomp[i].size(), f);
+  }
+}
+
+} // end for_each_detail
 
 template<typename DerivedPolicy,
          typename RandomAccessIterator,
@@ -70,14 +119,10 @@ RandomAccessIterator for_each_n(execution_policy<DerivedPolicy> &,
   typedef typename thrust::iterator_difference<RandomAccessIterator>::type DifferenceType;
   DifferenceType signed_n = n;
 
-  THRUST_PRAGMA_OMP(parallel for)
-  for(DifferenceType i = 0;
-      i < signed_n;
-      ++i)
-  {
-    RandomAccessIterator temp = first + i;
-    wrapped_f(*temp);
-  }
+  for_each_detail::for_each_n(first,
+                              signed_n,
+                              wrapped_f,
+                              thrust::is_contiguous_iterator<RandomAccessIterator>());
 
   return first + n;
 } // end for_each_n()
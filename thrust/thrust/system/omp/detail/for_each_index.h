@@ -0,0 +1,70 @@
+/*
+ *  Copyright 2023 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_STD_VER >= 2014
+
+#include <thrust/detail/index_space.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+template<typename DerivedPolicy,
+         typename Extents,
+         bool ColumnMajor,
+         typename Function>
+  void for_each_index(execution_policy<DerivedPolicy> &exec,
+                      const thrust::detail::index_space<Extents,ColumnMajor> &space,
+                      Function f);
+
+template<typename DerivedPolicy,
+         typename Extents,
+         bool ColumnMajor,
+         typename UnaryFunction,
+         typename OutputType,
+         typename BinaryFunction>
+  OutputType transform_reduce_index(execution_policy<DerivedPolicy> &exec,
+                                    const thrust::detail::index_space<Extents,ColumnMajor> &space,
+                                    UnaryFunction unary_op,
+                                    OutputType init,
+                                    BinaryFunction binary_op);
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
+
+#include <thrust/system/omp/detail/for_each_index.inl>
+
+#endif // _CCCL_STD_VER >= 2014
+
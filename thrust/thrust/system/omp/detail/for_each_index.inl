@@ -0,0 +1,153 @@
+/*
+ *  Copyright 2023 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/cstdint.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/for_each_index.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+// Both algorithms hand each thread one contiguous range of lines of the
+// space, so that a thread walks its part of the space in memory order and
+// decodes a multidimensional index only once.
+
+template<typename DerivedPolicy,
+         typename Extents,
+         bool ColumnMajor,
+         typename Function>
+void for_each_index(execution_policy<DerivedPolicy> &,
+                    const thrust::detail::index_space<Extents,ColumnMajor> &space,
+                    Function f)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      Function, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+  // use a signed type for the iteration variable or suffer the consequences of warnings
+  typedef thrust::detail::intptr_t index_type;
+
+  const index_type num_lines = static_cast<index_type>(space.num_lines());
+
+  if (num_lines == 0) return;
+
+  thrust::system::detail::internal::uniform_decomposition<index_type> decomp =
+    thrust::system::omp::detail::default_decomposition(num_lines);
+
+  const index_type n = decomp.size();
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for(index_type i = 0; i < n; ++i)
+  {
+    // each thread calls its own copy of f
+    Function thread_f(f);
+
+    space.for_each_in_lines(decomp[i].begin(), decomp[i].end(), thread_f);
+  }
+} // end for_each_index()
+
+
+template<typename DerivedPolicy,
+         typename Extents,
+         bool ColumnMajor,
+         typename UnaryFunction,
+         typename OutputType,
+         typename BinaryFunction>
+OutputType transform_reduce_index(execution_policy<DerivedPolicy> &exec,
+                                  const thrust::detail::index_space<Extents,ColumnMajor> &space,
+                                  UnaryFunction unary_op,
+                                  OutputType init,
+                                  BinaryFunction binary_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      UnaryFunction, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+  typedef thrust::detail::intptr_t index_type;
+
+  const index_type num_lines = static_cast<index_type>(space.num_lines());
+
+  if (num_lines == 0) return init;
+
+  thrust::system::detail::internal::uniform_decomposition<index_type> decomp =
+    thrust::system::omp::detail::default_decomposition(num_lines);
+
+  const index_type n = decomp.size();
+
+  // one partial sum per interval; no interval of the decomposition is empty
+  thrust::detail::temporary_array<OutputType,DerivedPolicy> partial_sums(exec, n);
+  OutputType *partial_sums_ptr = thrust::raw_pointer_cast(partial_sums.data());
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for(index_type i = 0; i < n; ++i)
+  {
+    UnaryFunction thread_unary_op(unary_op);
+    BinaryFunction thread_binary_op(binary_op);
+
+    partial_sums_ptr[i] = space.template reduce_lines<OutputType>(
+      decomp[i].begin(), decomp[i].end(), thread_unary_op, thread_binary_op);
+  }
+
+  // fold the partial sums into init in order
+  for(index_type i = 0; i < n; ++i)
+  {
+    init = binary_op(init, partial_sums_ptr[i]);
+  }
+
+  return init;
+} // end transform_reduce_index()
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
+
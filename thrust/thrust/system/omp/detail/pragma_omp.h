@@ -62,3 +62,11 @@
 #else
 #define THRUST_PRAGMA_OMP(directive)
 #endif
+
+// THRUST_PRAGMA_OMP_SIMD marks a loop whose iterations may execute
+// concurrently in SIMD lanes. It is empty unless OpenMP 4.0 is available.
+#if defined(_OPENMP) && _OPENMP >= 201307
+#define THRUST_PRAGMA_OMP_SIMD THRUST_PRAGMA_OMP(simd)
+#else
+#define THRUST_PRAGMA_OMP_SIMD
+#endif
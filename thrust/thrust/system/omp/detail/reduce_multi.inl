@@ -0,0 +1,110 @@
+/*
+ *  Copyright 2023 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/reduce_multi.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/reduce_multi.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename... Ts,
+         typename... BinaryFunctions>
+thrust::tuple<Ts...> reduce_multi(execution_policy<DerivedPolicy> &exec,
+                                  InputIterator first,
+                                  InputIterator last,
+                                  thrust::tuple<Ts...> init,
+                                  thrust::tuple<BinaryFunctions...> binary_ops)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      InputIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+  typedef typename thrust::iterator_difference<InputIterator>::type difference_type;
+  typedef thrust::tuple<Ts...>                                        accumulator_type;
+
+  const difference_type n = thrust::distance(first, last);
+
+  if (n <= 0) return init;
+
+  thrust::system::detail::internal::uniform_decomposition<difference_type> decomp =
+    thrust::system::omp::detail::default_decomposition(n);
+
+  const difference_type num_intervals = decomp.size();
+
+  // one tuple of partial results per interval; no interval is empty
+  thrust::detail::temporary_array<accumulator_type,DerivedPolicy> partial_sums(exec, num_intervals);
+  accumulator_type *partial_sums_ptr = thrust::raw_pointer_cast(partial_sums.data());
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for(difference_type i = 0; i < num_intervals; ++i)
+  {
+    // each thread reduces its interval in a single pass, with its own copy
+    // of the binary functions
+    thrust::tuple<BinaryFunctions...> thread_binary_ops(binary_ops);
+
+    partial_sums_ptr[i] = thrust::system::detail::internal::reduce_multi_n<Ts...>(
+      first + decomp[i].begin(), decomp[i].size(), thread_binary_ops);
+  }
+
+  // fold the partial results into init in order
+  for(difference_type i = 0; i < num_intervals; ++i)
+  {
+    thrust::system::detail::internal::reduce_multi_combine(init, binary_ops, partial_sums_ptr[i]);
+  }
+
+  return init;
+} // end reduce_multi()
+
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
+
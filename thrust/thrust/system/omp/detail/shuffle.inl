@@ -0,0 +1,114 @@
+/*
+ *  Copyright 2023 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/system/detail/generic/shuffle.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/shuffle.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/shuffle.h>
+
+#include <cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+
+template<typename DerivedPolicy,
+         typename RandomIterator,
+         typename OutputIterator,
+         typename URBG>
+void shuffle_copy(execution_policy<DerivedPolicy> &exec,
+                  RandomIterator first,
+                  RandomIterator last,
+                  OutputIterator result,
+                  URBG &&g)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      RandomIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+  const std::uint64_t m = last - first;
+
+  thrust::system::detail::generic::feistel_bijection bijection(m, g);
+
+  // the keys are the bijection of [0, n)
+  const std::int64_t n = static_cast<std::int64_t>(bijection.nearest_power_of_two());
+
+  thrust::system::detail::internal::uniform_decomposition<std::int64_t> decomp =
+    thrust::system::omp::detail::default_decomposition(n);
+
+  const std::int64_t num_intervals = decomp.size();
+
+  thrust::detail::temporary_array<std::uint64_t,DerivedPolicy> offsets(exec, num_intervals);
+  std::uint64_t *offsets_ptr = thrust::raw_pointer_cast(offsets.data());
+
+  // the output of each interval begins after the keys in [0, m) of the
+  // intervals before it, so the last interval's keys need not be counted
+  offsets_ptr[0] = 0;
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for(std::int64_t i = 1; i < num_intervals; ++i)
+  {
+    offsets_ptr[i] = thrust::system::detail::internal::shuffle_count(bijection, m, decomp[i - 1].begin(), decomp[i - 1].end());
+  }
+
+  for(std::int64_t i = 1; i < num_intervals; ++i)
+  {
+    offsets_ptr[i] += offsets_ptr[i - 1];
+  }
+
+  // recompute the keys and gather, rather than store n keys between the passes
+  THRUST_PRAGMA_OMP(parallel for)
+  for(std::int64_t i = 0; i < num_intervals; ++i)
+  {
+    thrust::system::detail::internal::shuffle_gather(
+      bijection, m, decomp[i].begin(), decomp[i].end(), first, result + offsets_ptr[i]);
+  }
+} // end shuffle_copy()
+
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -0,0 +1,222 @@
+/*
+ *  Copyright 2023 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/static_assert.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/transform.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/simd_loops.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/transform.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace transform_detail
+{
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename UnaryFunction>
+  OutputIterator transform(execution_policy<DerivedPolicy> &exec,
+                           InputIterator first,
+                           InputIterator last,
+                           OutputIterator result,
+                           UnaryFunction op,
+                           thrust::detail::false_type) // not contiguous
+{
+  return thrust::system::detail::generic::transform(exec, first, last, result, op);
+}
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename UnaryFunction>
+  OutputIterator transform(execution_policy<DerivedPolicy> &,
+                           InputIterator first,
+                           InputIterator last,
+                           OutputIterator result,
+                           UnaryFunction op,
+                           thrust::detail::true_type) // contiguous
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      InputIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+  typedef typename thrust::iterator_difference<InputIterator>::type difference_type;
+
+  const difference_type n = thrust::distance(first, last);
+
+  if (n <= 0) return result;
+
+  // each thread runs a vectorizable loop over raw pointers to its chunk
+  thrust::system::detail::internal::uniform_decomposition<difference_type> decomp =
+    thrust::system::omp::detail::default_decomposition(n);
+
+  const difference_type num_chunks = decomp.size();
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for(difference_type i = 0; i < num_chunks; ++i)
+  {
+    thrust::system::detail::internal::simd_transform_n(
+      thrust::detail::try_unwrap_contiguous_iterator(first + decomp[i].begin()),
+      decomp[i].size(),
+      thrust::detail::try_unwrap_contiguous_iterator(result + decomp[i].begin()),
+      op);
+  }
+
+  return result + n;
+}
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename BinaryFunction>
+  OutputIterator transform(execution_policy<DerivedPolicy> &exec,
+                           InputIterator1 first1,
+                           InputIterator1 last1,
+                           InputIterator2 first2,
+                           OutputIterator result,
+                           BinaryFunction op,
+                           thrust::detail::false_type) // not contiguous
+{
+  return thrust::system::detail::generic::transform(exec, first1, last1, first2, result, op);
+}
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename BinaryFunction>
+  OutputIterator transform(execution_policy<DerivedPolicy> &,
+                           InputIterator1 first1,
+                           InputIterator1 last1,
+                           InputIterator2 first2,
+                           OutputIterator result,
+                           BinaryFunction op,
+                           thrust::detail::true_type) // contiguous
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      InputIterator1, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+  typedef typename thrust::iterator_difference<InputIterator1>::type difference_type;
+
+  const difference_type n = thrust::distance(first1, last1);
+
+  if (n <= 0) return result;
+
+  // each thread runs a vectorizable loop over raw pointers to its chunk
+  thrust::system::detail::internal::uniform_decomposition<difference_type> decomp =
+    thrust::system::omp::detail::default_decomposition(n);
+
+  const difference_type num_chunks = decomp.size();
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for(difference_type i = 0; i < num_chunks; ++i)
+  {
+    thrust::system::detail::internal::simd_transform_n(
+      thrust::detail::try_unwrap_contiguous_iterator(first1 + decomp[i].begin()),
+      thrust::detail::try_unwrap_contiguous_iterator(first2 + decomp[i].begin()),
+      decomp[i].size(),
+      thrust::detail::try_unwrap_contiguous_iterator(result + decomp[i].begin()),
+      op);
+  }
+
+  return result + n;
+}
+
+} // end transform_detail
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename UnaryFunction>
+  OutputIterator transform(execution_policy<DerivedPolicy> &exec,
+                           InputIterator first,
+                           InputIterator last,
+                           OutputIterator result,
+                           UnaryFunction op)
+{
+  typedef thrust::system::detail::internal::are_contiguous_iterators<
+    InputIterator, OutputIterator
+  > is_contiguous;
+
+  return transform_detail::transform(exec, first, last, result, op, is_contiguous());
+} // end transform()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename BinaryFunction>
+  OutputIterator transform(execution_policy<DerivedPolicy> &exec,
+                           InputIterator1 first1,
+                           InputIterator1 last1,
+                           InputIterator2 first2,
+                           OutputIterator result,
+                           BinaryFunction op)
+{
+  typedef thrust::system::detail::internal::are_contiguous_iterators<
+    InputIterator1, InputIterator2, OutputIterator
+  > is_contiguous;
+
+  return transform_detail::transform(exec, first1, last1, first2, result, op, is_contiguous());
+} // end transform()
+
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
+
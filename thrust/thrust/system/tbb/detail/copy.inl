@@ -29,6 +29,11 @@
 #include <thrust/system/detail/generic/copy.h>
 #include <thrust/system/detail/sequential/copy.h>
 #include <thrust/detail/type_traits/minimum_type.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/system/detail/internal/trivial_copy.h>
+#include <thrust/type_traits/is_trivially_relocatable.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
 #include <thrust/detail/copy.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -38,6 +43,83 @@ namespace tbb
 {
 namespace detail
 {
+namespace copy_detail
+{
+
+
+struct trivial_copy_body
+{
+  thrust::system::detail::internal::trivial_copy_decomposition m_chunks;
+
+  trivial_copy_body(const thrust::system::detail::internal::trivial_copy_decomposition &chunks)
+    : m_chunks(chunks)
+  {}
+
+  void operator()(const ::tbb::blocked_range<std::size_t> &r) const
+  {
+    for(std::size_t i = r.begin(); i != r.end(); ++i)
+    {
+      m_chunks.copy(i);
+    }
+  }
+}; // end trivial_copy_body
+
+
+// copies n trivially relocatable elements from first to result with all threads
+template<typename T>
+  T *trivial_copy_n(const T *first,
+                    std::ptrdiff_t n,
+                    T *result)
+{
+  const std::size_t bytes = n * sizeof(T);
+
+  if(bytes < thrust::system::detail::internal::trivial_copy_decomposition::parallel_threshold())
+  {
+    std::memmove(result, first, bytes);
+    return result + n;
+  }
+
+  thrust::system::detail::internal::trivial_copy_decomposition chunks(result, first, bytes);
+
+  ::tbb::parallel_for(::tbb::blocked_range<std::size_t>(0, chunks.size()), copy_detail::trivial_copy_body(chunks));
+  return result + n;
+} // end trivial_copy_n()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename Size,
+         typename OutputIterator>
+  OutputIterator copy_n(execution_policy<DerivedPolicy> &,
+                        InputIterator first,
+                        Size n,
+                        OutputIterator result,
+                        thrust::detail::true_type)  // is_indirectly_trivially_relocatable_to
+{
+  if(n <= 0) return result;
+
+  copy_detail::trivial_copy_n(thrust::raw_pointer_cast(&*first), n, thrust::raw_pointer_cast(&*result));
+  return result + n;
+} // end copy_n()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename Size,
+         typename OutputIterator>
+  OutputIterator copy_n(execution_policy<DerivedPolicy> &exec,
+                        InputIterator first,
+                        Size n,
+                        OutputIterator result,
+                        thrust::detail::false_type)  // is_indirectly_trivially_relocatable_to
+{
+  return thrust::system::detail::generic::copy_n(exec, first, n, result);
+} // end copy_n()
+
+
+} // end copy_detail
+
+
 namespace dispatch
 {
 
@@ -64,7 +146,8 @@ template<typename DerivedPolicy,
                       OutputIterator result,
                       thrust::random_access_traversal_tag)
 {
-  return thrust::system::detail::generic::copy(exec, first, last, result);
+  return thrust::system::tbb::detail::copy_detail::copy_n(exec, first, last - first, result,
+    typename thrust::is_indirectly_trivially_relocatable_to<InputIterator,OutputIterator>::type());
 } // end copy()
 
 
@@ -92,7 +175,8 @@ template<typename DerivedPolicy,
                         OutputIterator result,
                         thrust::random_access_traversal_tag)
 {
-  return thrust::system::detail::generic::copy_n(exec, first, n, result);
+  return thrust::system::tbb::detail::copy_detail::copy_n(exec, first, n, result,
+    typename thrust::is_indirectly_trivially_relocatable_to<InputIterator,OutputIterator>::type());
 } // end copy_n()
 
 
@@ -25,10 +25,12 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/function.h>
 #include <thrust/detail/static_assert.h>
 #include <thrust/distance.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/distance.h>
+#include <thrust/system/detail/internal/simd_loops.h>
 #include <thrust/system/detail/sequential/execution_policy.h>
 
 #include <tbb/blocked_range.h>
@@ -59,8 +61,21 @@ template<typename RandomAccessIterator,
   void operator()(const ::tbb::blocked_range<Size> &r) const
   {
     // we assume that blocked_range specifies a contiguous range of integers
-    thrust::for_each_n(thrust::system::detail::sequential::seq, m_first + r.begin(), r.size(), m_f);
+    apply(r, thrust::is_contiguous_iterator<RandomAccessIterator>());
   } // end operator()()
+
+  void apply(const ::tbb::blocked_range<Size> &r, thrust::detail::false_type) const
+  {
+    thrust::for_each_n(thrust::system::detail::sequential::seq, m_first + r.begin(), r.size(), m_f);
+  }
+
+  void apply(const ::tbb::blocked_range<Size> &r, thrust::detail::true_type) const
+  {
+    // run a vectorizable loop over a raw pointer to the range
+    thrust::detail::wrapped_function<UnaryFunction,void> wrapped_f(m_f);
+    thrust::system::detail::internal::simd_for_each_n(
+      thrust::detail::try_unwrap_contiguous_iterator(m_first + r.begin()), r.size(), wrapped_f);
+  }
 }; // end body
 
 
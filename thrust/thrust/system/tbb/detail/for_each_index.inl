@@ -0,0 +1,168 @@
+/*
+ *  Copyright 2023 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/tbb/detail/for_each_index.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace for_each_index_detail
+{
+
+// TBB hands each body a blocked_range of lines of the space, which it walks
+// in memory order, decoding a multidimensional index only once.
+
+template<typename IndexSpace,
+         typename Function>
+struct for_each_body
+{
+  typedef typename IndexSpace::index_type index_type;
+
+  const IndexSpace &space;
+  Function f;
+
+  for_each_body(const IndexSpace &space, Function f)
+    : space(space), f(f)
+  {}
+
+  void operator()(const ::tbb::blocked_range<index_type> &r) const
+  {
+    Function body_f(f);
+    space.for_each_in_lines(r.begin(), r.end(), body_f);
+  } // end operator()()
+}; // end for_each_body
+
+
+template<typename IndexSpace,
+         typename UnaryFunction,
+         typename OutputType,
+         typename BinaryFunction>
+struct reduce_body
+{
+  typedef typename IndexSpace::index_type index_type;
+
+  const IndexSpace &space;
+  UnaryFunction unary_op;
+  OutputType sum;
+  bool first_call;  // TBB can invoke operator() multiple times on the same body
+  BinaryFunction binary_op;
+
+  // note: we only initalize sum with init to avoid calling OutputType's default constructor
+  reduce_body(const IndexSpace &space, UnaryFunction unary_op, OutputType init, BinaryFunction binary_op)
+    : space(space), unary_op(unary_op), sum(init), first_call(true), binary_op(binary_op)
+  {}
+
+  // note: we only initalize sum with b.sum to avoid calling OutputType's default constructor
+  reduce_body(reduce_body &b, ::tbb::split)
+    : space(b.space), unary_op(b.unary_op), sum(b.sum), first_call(true), binary_op(b.binary_op)
+  {}
+
+  void operator()(const ::tbb::blocked_range<index_type> &r)
+  {
+    if (r.empty()) return; // nothing to do
+
+    OutputType temp = space.template reduce_lines<OutputType>(r.begin(), r.end(), unary_op, binary_op);
+
+    if (first_call)
+    {
+      // first time body has been invoked
+      first_call = false;
+      sum = temp;
+    }
+    else
+    {
+      // body has been previously invoked, accumulate temp into sum
+      sum = binary_op(sum, temp);
+    }
+  } // end operator()()
+
+  void join(reduce_body &b)
+  {
+    sum = binary_op(sum, b.sum);
+  }
+}; // end reduce_body
+
+} // end for_each_index_detail
+
+
+template<typename DerivedPolicy,
+         typename Extents,
+         bool ColumnMajor,
+         typename Function>
+void for_each_index(execution_policy<DerivedPolicy> &,
+                    const thrust::detail::index_space<Extents,ColumnMajor> &space,
+                    Function f)
+{
+  typedef thrust::detail::index_space<Extents,ColumnMajor> space_type;
+  typedef typename space_type::index_type                  index_type;
+
+  const index_type num_lines = space.num_lines();
+
+  if (num_lines == 0) return;
+
+  for_each_index_detail::for_each_body<space_type,Function> body(space, f);
+  ::tbb::parallel_for(::tbb::blocked_range<index_type>(0, num_lines), body);
+} // end for_each_index()
+
+
+template<typename DerivedPolicy,
+         typename Extents,
+         bool ColumnMajor,
+         typename UnaryFunction,
+         typename OutputType,
+         typename BinaryFunction>
+OutputType transform_reduce_index(execution_policy<DerivedPolicy> &,
+                                  const thrust::detail::index_space<Extents,ColumnMajor> &space,
+                                  UnaryFunction unary_op,
+                                  OutputType init,
+                                  BinaryFunction binary_op)
+{
+  typedef thrust::detail::index_space<Extents,ColumnMajor> space_type;
+  typedef typename space_type::index_type                  index_type;
+
+  const index_type num_lines = space.num_lines();
+
+  if (num_lines == 0) return init;
+
+  for_each_index_detail::reduce_body<space_type,UnaryFunction,OutputType,BinaryFunction> body(space, unary_op, init, binary_op);
+  ::tbb::parallel_reduce(::tbb::blocked_range<index_type>(0, num_lines), body);
+  return binary_op(init, body.sum);
+} // end transform_reduce_index()
+
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -0,0 +1,135 @@
+/*
+ *  Copyright 2023 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/reduce_multi.h>
+#include <thrust/system/tbb/detail/reduce_multi.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_reduce.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace reduce_multi_detail
+{
+
+template<typename RandomAccessIterator,
+         typename AccumulatorTuple,
+         typename OpTuple>
+struct body;
+
+template<typename RandomAccessIterator,
+         typename... Ts,
+         typename OpTuple>
+struct body<RandomAccessIterator, thrust::tuple<Ts...>, OpTuple>
+{
+  RandomAccessIterator first;
+  thrust::tuple<Ts...> sum;
+  bool first_call;  // TBB can invoke operator() multiple times on the same body
+  OpTuple binary_ops;
+
+  // note: we only initalize sum with init to avoid calling the default constructors of Ts
+  body(RandomAccessIterator first, thrust::tuple<Ts...> init, OpTuple binary_ops)
+    : first(first), sum(init), first_call(true), binary_ops(binary_ops)
+  {}
+
+  // note: we only initalize sum with b.sum to avoid calling the default constructors of Ts
+  body(body& b, ::tbb::split)
+    : first(b.first), sum(b.sum), first_call(true), binary_ops(b.binary_ops)
+  {}
+
+  template <typename Size>
+  void operator()(const ::tbb::blocked_range<Size> &r)
+  {
+    // we assume that blocked_range specifies a contiguous range of integers
+
+    if (r.empty()) return; // nothing to do
+
+    thrust::tuple<Ts...> temp =
+      thrust::system::detail::internal::reduce_multi_n<Ts...>(first + r.begin(), r.size(), binary_ops);
+
+    if (first_call)
+    {
+      // first time body has been invoked
+      first_call = false;
+      sum = temp;
+    }
+    else
+    {
+      // body has been previously invoked, accumulate temp into sum
+      thrust::system::detail::internal::reduce_multi_combine(sum, binary_ops, temp);
+    }
+  } // end operator()()
+
+  void join(body& b)
+  {
+    thrust::system::detail::internal::reduce_multi_combine(sum, binary_ops, b.sum);
+  }
+}; // end body
+
+} // end reduce_multi_detail
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename... Ts,
+         typename... BinaryFunctions>
+thrust::tuple<Ts...> reduce_multi(execution_policy<DerivedPolicy> &,
+                                  InputIterator first,
+                                  InputIterator last,
+                                  thrust::tuple<Ts...> init,
+                                  thrust::tuple<BinaryFunctions...> binary_ops)
+{
+  typedef typename thrust::iterator_difference<InputIterator>::type Size;
+
+  Size n = thrust::distance(first, last);
+
+  if (n == 0)
+  {
+    return init;
+  }
+  else
+  {
+    typedef reduce_multi_detail::body<InputIterator, thrust::tuple<Ts...>, thrust::tuple<BinaryFunctions...> > Body;
+    Body reduce_body(first, init, binary_ops);
+    ::tbb::parallel_reduce(::tbb::blocked_range<Size>(0,n), reduce_body);
+    thrust::system::detail::internal::reduce_multi_combine(init, binary_ops, reduce_body.sum);
+    return init;
+  }
+}
+
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -0,0 +1,123 @@
+/*
+ *  Copyright 2023 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/detail/generic/shuffle.h>
+#include <thrust/system/detail/internal/shuffle.h>
+#include <thrust/system/tbb/detail/shuffle.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_scan.h>
+
+#include <cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace shuffle_detail
+{
+
+// a scan over the keys of the bijection whose sum is the number of keys in
+// [0, m): the pre-scan only counts, and the final scan gathers from the
+// offset it receives. Ranges which TBB scans only once compute their keys
+// only once.
+template<typename Bijection,
+         typename RandomIterator,
+         typename OutputIterator>
+struct body
+{
+  const Bijection &bijection;
+  std::uint64_t m;
+  RandomIterator input;
+  OutputIterator output;
+  std::uint64_t sum;
+
+  body(const Bijection &bijection, std::uint64_t m, RandomIterator input, OutputIterator output)
+    : bijection(bijection), m(m), input(input), output(output), sum(0)
+  {}
+
+  body(body& b, ::tbb::split)
+    : bijection(b.bijection), m(b.m), input(b.input), output(b.output), sum(0)
+  {}
+
+  template<typename Size>
+  void operator()(const ::tbb::blocked_range<Size>& r, ::tbb::pre_scan_tag)
+  {
+    sum += thrust::system::detail::internal::shuffle_count(bijection, m, r.begin(), r.end());
+  }
+
+  template<typename Size>
+  void operator()(const ::tbb::blocked_range<Size>& r, ::tbb::final_scan_tag)
+  {
+    OutputIterator end =
+      thrust::system::detail::internal::shuffle_gather(bijection, m, r.begin(), r.end(), input, output + sum);
+
+    sum = end - output;
+  }
+
+  void reverse_join(body& b)
+  {
+    sum += b.sum;
+  }
+
+  void assign(body& b)
+  {
+    sum = b.sum;
+  }
+};
+
+} // end namespace shuffle_detail
+
+
+template<typename DerivedPolicy,
+         typename RandomIterator,
+         typename OutputIterator,
+         typename URBG>
+void shuffle_copy(execution_policy<DerivedPolicy> &,
+                  RandomIterator first,
+                  RandomIterator last,
+                  OutputIterator result,
+                  URBG &&g)
+{
+  typedef thrust::system::detail::generic::feistel_bijection Bijection;
+
+  const std::uint64_t m = last - first;
+
+  Bijection bijection(m, g);
+
+  shuffle_detail::body<Bijection, RandomIterator, OutputIterator> scan_body(bijection, m, first, result);
+  ::tbb::parallel_scan(::tbb::blocked_range<std::uint64_t>(0, bijection.nearest_power_of_two()), scan_body);
+} // end shuffle_copy()
+
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
+
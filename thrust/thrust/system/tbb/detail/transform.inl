@@ -0,0 +1,231 @@
+/*
+ *  Copyright 2023 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/transform.h>
+#include <thrust/system/detail/internal/simd_loops.h>
+#include <thrust/system/tbb/detail/transform.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace transform_detail
+{
+
+// the bodies run a vectorizable loop over raw pointers to their range
+
+template<typename InputPointer,
+         typename OutputPointer,
+         typename Size,
+         typename UnaryFunction>
+struct unary_body
+{
+  InputPointer m_first;
+  OutputPointer m_result;
+  UnaryFunction m_op;
+
+  unary_body(InputPointer first, OutputPointer result, UnaryFunction op)
+    : m_first(first), m_result(result), m_op(op)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size> &r) const
+  {
+    UnaryFunction op(m_op);
+    thrust::system::detail::internal::simd_transform_n(m_first + r.begin(), r.size(), m_result + r.begin(), op);
+  }
+}; // end unary_body
+
+
+template<typename InputPointer1,
+         typename InputPointer2,
+         typename OutputPointer,
+         typename Size,
+         typename BinaryFunction>
+struct binary_body
+{
+  InputPointer1 m_first1;
+  InputPointer2 m_first2;
+  OutputPointer m_result;
+  BinaryFunction m_op;
+
+  binary_body(InputPointer1 first1, InputPointer2 first2, OutputPointer result, BinaryFunction op)
+    : m_first1(first1), m_first2(first2), m_result(result), m_op(op)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size> &r) const
+  {
+    BinaryFunction op(m_op);
+    thrust::system::detail::internal::simd_transform_n(m_first1 + r.begin(), m_first2 + r.begin(), r.size(), m_result + r.begin(), op);
+  }
+}; // end binary_body
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename UnaryFunction>
+  OutputIterator transform(execution_policy<DerivedPolicy> &exec,
+                           InputIterator first,
+                           InputIterator last,
+                           OutputIterator result,
+                           UnaryFunction op,
+                           thrust::detail::false_type) // not contiguous
+{
+  return thrust::system::detail::generic::transform(exec, first, last, result, op);
+}
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename UnaryFunction>
+  OutputIterator transform(execution_policy<DerivedPolicy> &,
+                           InputIterator first,
+                           InputIterator last,
+                           OutputIterator result,
+                           UnaryFunction op,
+                           thrust::detail::true_type) // contiguous
+{
+  typedef typename thrust::iterator_difference<InputIterator>::type Size;
+  typedef thrust::detail::try_unwrap_contiguous_iterator_return_t<InputIterator>  InputPointer;
+  typedef thrust::detail::try_unwrap_contiguous_iterator_return_t<OutputIterator> OutputPointer;
+
+  const Size n = thrust::distance(first, last);
+
+  if (n <= 0) return result;
+
+  unary_body<InputPointer,OutputPointer,Size,UnaryFunction> body(
+    thrust::detail::try_unwrap_contiguous_iterator(first),
+    thrust::detail::try_unwrap_contiguous_iterator(result),
+    op);
+
+  ::tbb::parallel_for(::tbb::blocked_range<Size>(0,n), body);
+
+  return result + n;
+}
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename BinaryFunction>
+  OutputIterator transform(execution_policy<DerivedPolicy> &exec,
+                           InputIterator1 first1,
+                           InputIterator1 last1,
+                           InputIterator2 first2,
+                           OutputIterator result,
+                           BinaryFunction op,
+                           thrust::detail::false_type) // not contiguous
+{
+  return thrust::system::detail::generic::transform(exec, first1, last1, first2, result, op);
+}
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename BinaryFunction>
+  OutputIterator transform(execution_policy<DerivedPolicy> &,
+                           InputIterator1 first1,
+                           InputIterator1 last1,
+                           InputIterator2 first2,
+                           OutputIterator result,
+                           BinaryFunction op,
+                           thrust::detail::true_type) // contiguous
+{
+  typedef typename thrust::iterator_difference<InputIterator1>::type Size;
+  typedef thrust::detail::try_unwrap_contiguous_iterator_return_t<InputIterator1> InputPointer1;
+  typedef thrust::detail::try_unwrap_contiguous_iterator_return_t<InputIterator2> InputPointer2;
+  typedef thrust::detail::try_unwrap_contiguous_iterator_return_t<OutputIterator> OutputPointer;
+
+  const Size n = thrust::distance(first1, last1);
+
+  if (n <= 0) return result;
+
+  binary_body<InputPointer1,InputPointer2,OutputPointer,Size,BinaryFunction> body(
+    thrust::detail::try_unwrap_contiguous_iterator(first1),
+    thrust::detail::try_unwrap_contiguous_iterator(first2),
+    thrust::detail::try_unwrap_contiguous_iterator(result),
+    op);
+
+  ::tbb::parallel_for(::tbb::blocked_range<Size>(0,n), body);
+
+  return result + n;
+}
+
+} // end transform_detail
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename UnaryFunction>
+  OutputIterator transform(execution_policy<DerivedPolicy> &exec,
+                           InputIterator first,
+                           InputIterator last,
+                           OutputIterator result,
+                           UnaryFunction op)
+{
+  typedef thrust::system::detail::internal::are_contiguous_iterators<
+    InputIterator, OutputIterator
+  > is_contiguous;
+
+  return transform_detail::transform(exec, first, last, result, op, is_contiguous());
+} // end transform()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename BinaryFunction>
+  OutputIterator transform(execution_policy<DerivedPolicy> &exec,
+                           InputIterator1 first1,
+                           InputIterator1 last1,
+                           InputIterator2 first2,
+                           OutputIterator result,
+                           BinaryFunction op)
+{
+  typedef thrust::system::detail::internal::are_contiguous_iterators<
+    InputIterator1, InputIterator2, OutputIterator
+  > is_contiguous;
+
+  return transform_detail::transform(exec, first1, last1, first2, result, op, is_contiguous());
+} // end transform()
+
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
+